@@ -0,0 +1,503 @@
+////////////////////////////////////////////////////////////////////////////
+// Copyright (c) 2026 intel_vulkan
+// All rights reserved.
+//
+// Contact: mehoggan@gmail.com
+//
+// This software is licensed under the terms of the Your License.
+// See the LICENSE file in the top-level directory.
+/////////////////////////////////////////////////////////////////////////
+
+#include "intel_vulkan/AssetArchive.h"
+#include "intel_vulkan/AsyncReader.h"
+#include "intel_vulkan/ImageCache.h"
+#include "intel_vulkan/ImageLoader.h"
+#include "intel_vulkan/PngDecode.h"
+#include "intel_vulkan/Tools.h"
+
+#include <benchmark/benchmark.h>
+
+#include <fcntl.h>
+#include <unistd.h>
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <filesystem>
+#include <fstream>
+#include <memory>
+#include <random>
+#include <span>
+#include <string>
+#include <vector>
+
+namespace {
+constexpr std::size_t TOTAL_ASSET_BYTES = 100 * 1024 * 1024;
+
+// A directory of files adding up to TOTAL_ASSET_BYTES, written once per
+// file size and removed when the process exits. The files stay in the page
+// cache, so both loaders are measured without disk latency.
+class AssetSet {
+public:
+    explicit AssetSet(std::size_t file_size) {
+        m_dir = std::filesystem::temp_directory_path() /
+                ("intel_vulkan_asset_bench_" + std::to_string(file_size));
+        std::filesystem::create_directories(m_dir);
+        std::vector<char> contents(file_size);
+        std::mt19937 random(static_cast<std::uint32_t>(file_size));
+        for (char& byte : contents) {
+            byte = static_cast<char>(random());
+        }
+        for (std::size_t index = 0; index < TOTAL_ASSET_BYTES / file_size;
+             ++index) {
+            std::string path =
+                    (m_dir / ("asset" + std::to_string(index) + ".bin"))
+                            .string();
+            std::ofstream(path, std::ios::binary)
+                    .write(contents.data(),
+                           static_cast<std::streamsize>(contents.size()));
+            m_paths.push_back(path);
+        }
+    }
+
+    ~AssetSet() { std::filesystem::remove_all(m_dir); }
+
+    const std::vector<std::string>& paths() const { return m_paths; }
+
+private:
+    std::filesystem::path m_dir;
+    std::vector<std::string> m_paths;
+};
+
+const AssetSet& assetSet(std::size_t file_size) {
+    static std::vector<std::unique_ptr<AssetSet>> sets;
+    for (const std::unique_ptr<AssetSet>& set : sets) {
+        if (set->paths().size() == TOTAL_ASSET_BYTES / file_size) {
+            return *set;
+        }
+    }
+    sets.push_back(std::make_unique<AssetSet>(file_size));
+    return *sets.back();
+}
+
+// Writes a width x height RGB PNG. The zlib stream uses stored blocks, so
+// decoding it costs little beyond the copies the loaders make, which is
+// what the image benchmarks compare.
+void writeTestPng(const std::string& path, std::uint32_t width,
+                  std::uint32_t height) {
+    std::vector<std::uint32_t> crc_table(256);
+    for (std::uint32_t index = 0; index < 256; ++index) {
+        std::uint32_t crc = index;
+        for (int bit = 0; bit < 8; ++bit) {
+            crc = (crc & 1) ? 0xedb88320u ^ (crc >> 1) : crc >> 1;
+        }
+        crc_table[index] = crc;
+    }
+    std::ofstream file(path, std::ios::binary);
+    auto put32 = [](std::vector<unsigned char>& out, std::uint32_t value) {
+        for (int shift = 24; shift >= 0; shift -= 8) {
+            out.push_back(static_cast<unsigned char>(value >> shift));
+        }
+    };
+    auto writeChunk = [&](const char* type,
+                          const std::vector<unsigned char>& data) {
+        std::vector<unsigned char> chunk;
+        put32(chunk, static_cast<std::uint32_t>(data.size()));
+        chunk.insert(chunk.end(), type, type + 4);
+        chunk.insert(chunk.end(), data.begin(), data.end());
+        std::uint32_t crc = 0xffffffffu;
+        for (std::size_t index = 4; index < chunk.size(); ++index) {
+            crc = crc_table[(crc ^ chunk[index]) & 0xff] ^ (crc >> 8);
+        }
+        put32(chunk, crc ^ 0xffffffffu);
+        file.write(reinterpret_cast<const char*>(chunk.data()),
+                   static_cast<std::streamsize>(chunk.size()));
+    };
+
+    std::vector<unsigned char> raw;
+    raw.reserve((width * 3 + 1) * height);
+    for (std::uint32_t y = 0; y < height; ++y) {
+        raw.push_back(0);
+        for (std::uint32_t x = 0; x < width; ++x) {
+            raw.push_back(static_cast<unsigned char>(x));
+            raw.push_back(static_cast<unsigned char>(y));
+            raw.push_back(static_cast<unsigned char>(x ^ y));
+        }
+    }
+    std::vector<unsigned char> zlib = {0x78, 0x01};
+    for (std::size_t offset = 0; offset < raw.size(); offset += 65535) {
+        std::size_t length = std::min<std::size_t>(65535, raw.size() - offset);
+        zlib.push_back(offset + length == raw.size() ? 1 : 0);
+        zlib.push_back(static_cast<unsigned char>(length));
+        zlib.push_back(static_cast<unsigned char>(length >> 8));
+        zlib.push_back(static_cast<unsigned char>(~length));
+        zlib.push_back(static_cast<unsigned char>(~length >> 8));
+        zlib.insert(zlib.end(),
+                    raw.begin() + static_cast<std::ptrdiff_t>(offset),
+                    raw.begin() + static_cast<std::ptrdiff_t>(offset + length));
+    }
+    std::uint32_t a = 1, b = 0;
+    for (unsigned char byte : raw) {
+        a = (a + byte) % 65521;
+        b = (b + a) % 65521;
+    }
+    put32(zlib, (b << 16) | a);
+
+    const unsigned char signature[8] = {
+            0x89, 'P', 'N', 'G', '\r', '\n', 0x1a, '\n'};
+    file.write(reinterpret_cast<const char*>(signature), sizeof(signature));
+    std::vector<unsigned char> header;
+    put32(header, width);
+    put32(header, height);
+    header.insert(header.end(), {8, 2, 0, 0, 0});
+    writeChunk("IHDR", header);
+    writeChunk("IDAT", zlib);
+    writeChunk("IEND", {});
+}
+
+// A 4096 x 4096 texture, written once and removed when the process exits.
+const std::string& texturePath() {
+    static struct Texture {
+        Texture()
+                : path((std::filesystem::temp_directory_path() /
+                        "intel_vulkan_asset_bench_4k.png")
+                               .string()) {
+            writeTestPng(path, 4096, 4096);
+        }
+        ~Texture() { std::filesystem::remove(path); }
+        std::string path;
+    } texture;
+    return texture.path;
+}
+
+// Reads every byte, standing in for vkCreateShaderModule or an image
+// decoder consuming the contents.
+std::uint64_t consume(std::span<const char> contents) {
+    std::uint64_t sum = 0;
+    std::size_t index = 0;
+    for (; index + sizeof(std::uint64_t) <= contents.size();
+         index += sizeof(std::uint64_t)) {
+        std::uint64_t word;
+        std::memcpy(&word, contents.data() + index, sizeof(word));
+        sum += word;
+    }
+    for (; index < contents.size(); ++index) {
+        sum += static_cast<unsigned char>(contents[index]);
+    }
+    return sum;
+}
+
+// Loads the whole set through getBinaryFileContents, which copies every
+// file into a new vector. The argument is the size of a single file.
+void BM_LoadAssetsCopy(benchmark::State& state) {
+    const AssetSet& assets =
+            assetSet(static_cast<std::size_t>(state.range(0)));
+    for (auto _ : state) {
+        for (const std::string& path : assets.paths()) {
+            std::vector<char> contents =
+                    intel_vulkan::Tools::getBinaryFileContents(path);
+            benchmark::DoNotOptimize(consume(contents));
+        }
+    }
+    state.SetBytesProcessed(static_cast<int64_t>(state.iterations()) *
+                            static_cast<int64_t>(TOTAL_ASSET_BYTES));
+}
+BENCHMARK(BM_LoadAssetsCopy)
+        ->Arg(64 * 1024)
+        ->Arg(4 * 1024 * 1024)
+        ->Unit(benchmark::kMillisecond);
+
+// The same set read in place through Tools::MappedFile. The second
+// argument is the MappedFile::Access hint.
+void BM_LoadAssetsMapped(benchmark::State& state) {
+    const AssetSet& assets =
+            assetSet(static_cast<std::size_t>(state.range(0)));
+    for (auto _ : state) {
+        for (const std::string& path : assets.paths()) {
+            intel_vulkan::Tools::MappedFile contents(
+                    path,
+                    static_cast<intel_vulkan::Tools::MappedFile::Access>(
+                            state.range(1)));
+            benchmark::DoNotOptimize(consume(contents.view()));
+        }
+    }
+    state.SetBytesProcessed(static_cast<int64_t>(state.iterations()) *
+                            static_cast<int64_t>(TOTAL_ASSET_BYTES));
+}
+BENCHMARK(BM_LoadAssetsMapped)
+        ->ArgsProduct({{64 * 1024, 4 * 1024 * 1024},
+                       {static_cast<int64_t>(
+                                intel_vulkan::Tools::MappedFile::Access::
+                                        SEQUENTIAL),
+                        static_cast<int64_t>(
+                                intel_vulkan::Tools::MappedFile::Access::
+                                        WILL_NEED)}})
+        ->Unit(benchmark::kMillisecond);
+
+// Drops \p paths from the page cache, so the next read goes to the disk.
+void evict(const std::vector<std::string>& paths) {
+    for (const std::string& path : paths) {
+        int file = ::open(path.c_str(), O_RDONLY);
+        if (file != -1) {
+            ::posix_fadvise(file, 0, 0, POSIX_FADV_DONTNEED);
+            ::close(file);
+        }
+    }
+}
+
+// Reads the 64 KiB set from the disk into preallocated buffers through an
+// AsyncReader. The first argument is the queue depth, the second the
+// backend. The files are evicted before every batch, so depth 1 is the
+// disk's latency bound and deeper queues show how far it overlaps reads.
+void BM_AsyncRead(benchmark::State& state) {
+    namespace Tools = intel_vulkan::Tools;
+    const AssetSet& assets = assetSet(64 * 1024);
+    Tools::AsyncReader reader(
+            static_cast<std::size_t>(state.range(0)),
+            static_cast<Tools::AsyncReader::Backend>(state.range(1)));
+    if (reader.backend() !=
+        static_cast<Tools::AsyncReader::Backend>(state.range(1))) {
+        state.SkipWithError("io_uring is not available");
+        return;
+    }
+    std::vector<char> buffers(TOTAL_ASSET_BYTES);
+    std::vector<Tools::ReadRequest> requests;
+    for (std::size_t index = 0; index < assets.paths().size(); ++index) {
+        requests.push_back(
+                {assets.paths()[index],
+                 std::span<char>(buffers).subspan(index * 64 * 1024,
+                                                  64 * 1024)});
+    }
+    for (auto _ : state) {
+        state.PauseTiming();
+        evict(assets.paths());
+        state.ResumeTiming();
+        reader.read(requests, [](Tools::ReadResult&& result) {
+            benchmark::DoNotOptimize(result.data.data());
+        });
+        reader.wait();
+    }
+    state.SetBytesProcessed(static_cast<int64_t>(state.iterations()) *
+                            static_cast<int64_t>(TOTAL_ASSET_BYTES));
+}
+BENCHMARK(BM_AsyncRead)
+        ->ArgsProduct({{1, 8, 32},
+                       {static_cast<int64_t>(
+                                intel_vulkan::Tools::AsyncReader::Backend::
+                                        IO_URING),
+                        static_cast<int64_t>(
+                                intel_vulkan::Tools::AsyncReader::Backend::
+                                        THREAD_POOL)}})
+        ->UseRealTime()
+        ->Unit(benchmark::kMillisecond);
+
+// Decodes the 4K texture into a vector and copies it into a staging buffer,
+// the way a texture upload had to use getImageData so far.
+void BM_DecodeImageToVector(benchmark::State& state) {
+    const std::string& path = texturePath();
+    std::vector<char> staging(4096 * 4096 * 4);
+    for (auto _ : state) {
+        int width = 0, height = 0, components = 0, data_size = 0;
+        std::vector<char> image = intel_vulkan::Tools::getImageData(
+                path, 4, &width, &height, &components, &data_size);
+        std::memcpy(staging.data(), image.data(), image.size());
+        benchmark::DoNotOptimize(staging.data());
+    }
+    state.SetBytesProcessed(static_cast<int64_t>(state.iterations()) *
+                            static_cast<int64_t>(staging.size()));
+}
+BENCHMARK(BM_DecodeImageToVector)->Unit(benchmark::kMillisecond);
+
+// The same texture decoded straight into the staging buffer.
+void BM_DecodeImageInto(benchmark::State& state) {
+    const std::string& path = texturePath();
+    std::vector<char> staging(4096 * 4096 * 4);
+    for (auto _ : state) {
+        int width = 0, height = 0, components = 0;
+        intel_vulkan::Tools::getImageData(path,
+                                          4,
+                                          staging.data(),
+                                          4096 * 4,
+                                          staging.size(),
+                                          &width,
+                                          &height,
+                                          &components);
+        benchmark::DoNotOptimize(staging.data());
+    }
+    state.SetBytesProcessed(static_cast<int64_t>(state.iterations()) *
+                            static_cast<int64_t>(staging.size()));
+}
+BENCHMARK(BM_DecodeImageInto)->Unit(benchmark::kMillisecond);
+
+// BM_DecodeImageInto through an ImageCache. With argument 0 the cache is
+// emptied before every load, which measures a cold start: a decode plus
+// writing the entry. With 1 every load is a hit.
+void BM_DecodeImageCached(benchmark::State& state) {
+    namespace Tools = intel_vulkan::Tools;
+    const std::string& path = texturePath();
+    auto cache = std::make_shared<Tools::ImageCache>(
+            (std::filesystem::temp_directory_path() /
+             "intel_vulkan_asset_bench_cache")
+                    .string());
+    cache->clear();
+    Tools::ImageCache::setGlobal(cache);
+    bool warm = state.range(0) != 0;
+    std::vector<char> staging(4096 * 4096 * 4);
+    int width = 0, height = 0, components = 0;
+    auto load = [&]() {
+        Tools::getImageData(path,
+                            4,
+                            staging.data(),
+                            4096 * 4,
+                            staging.size(),
+                            &width,
+                            &height,
+                            &components);
+    };
+    if (warm) {
+        load();
+    }
+    for (auto _ : state) {
+        if (!warm) {
+            state.PauseTiming();
+            cache->clear();
+            state.ResumeTiming();
+        }
+        load();
+        benchmark::DoNotOptimize(staging.data());
+    }
+    Tools::ImageCache::setGlobal(nullptr);
+    cache->clear();
+    state.SetBytesProcessed(static_cast<int64_t>(state.iterations()) *
+                            static_cast<int64_t>(staging.size()));
+}
+BENCHMARK(BM_DecodeImageCached)
+        ->Arg(0)
+        ->Arg(1)
+        ->Unit(benchmark::kMillisecond);
+
+#ifdef INTEL_VULKAN_RESOURCES_DIR
+// Decodes a batch of 64 copies of the tutorial texture on an ImageLoader
+// with the given number of workers. Compare the rates across thread counts
+// for scaling; one worker is the old serial loop plus a thread hop.
+void BM_ImageLoader(benchmark::State& state) {
+    std::vector<std::string> paths(
+            64, INTEL_VULKAN_RESOURCES_DIR "/07/Data/texture.png");
+    intel_vulkan::Tools::ImageLoader loader(
+            static_cast<std::size_t>(state.range(0)));
+    std::size_t bytes = 0;
+    for (auto _ : state) {
+        bytes = 0;
+        for (std::future<intel_vulkan::Tools::LoadedImage>& future :
+             loader.load(paths, 4)) {
+            bytes += future.get().data.size();
+        }
+    }
+    state.SetItemsProcessed(static_cast<int64_t>(state.iterations()) *
+                            static_cast<int64_t>(paths.size()));
+    state.SetBytesProcessed(static_cast<int64_t>(state.iterations()) *
+                            static_cast<int64_t>(bytes));
+}
+BENCHMARK(BM_ImageLoader)
+        ->RangeMultiplier(2)
+        ->Range(1, 16)
+        ->UseRealTime()
+        ->Unit(benchmark::kMillisecond);
+
+// Loads every file under resources/ the way a runner starts up. With
+// argument 0 each one is a loose file; with 1 the archive is mapped and
+// every file is a lookup in it, one open and mmap in total.
+void BM_LoadResources(benchmark::State& state) {
+    namespace Tools = intel_vulkan::Tools;
+    std::string archive_path = (std::filesystem::temp_directory_path() /
+                                "intel_vulkan_asset_bench.pak")
+                                       .string();
+    std::vector<Tools::AssetArchive::Source> sources;
+    for (const std::filesystem::directory_entry& item :
+         std::filesystem::recursive_directory_iterator(
+                 INTEL_VULKAN_RESOURCES_DIR)) {
+        if (item.is_regular_file()) {
+            sources.push_back(
+                    {item.path().lexically_relative(
+                                        INTEL_VULKAN_RESOURCES_DIR)
+                             .generic_string(),
+                     item.path().string()});
+        }
+    }
+    Tools::AssetArchive::pack(archive_path, sources);
+    bool packed = state.range(0) != 0;
+    for (auto _ : state) {
+        if (packed) {
+            Tools::AssetArchive::setGlobal(
+                    std::make_shared<const Tools::AssetArchive>(
+                            archive_path));
+        }
+        for (const Tools::AssetArchive::Source& source : sources) {
+            Tools::Asset asset = Tools::loadAsset(
+                    packed ? source.name : source.path);
+            benchmark::DoNotOptimize(consume(asset.contents));
+        }
+        Tools::AssetArchive::setGlobal(nullptr);
+    }
+    std::filesystem::remove(archive_path);
+    state.SetItemsProcessed(static_cast<int64_t>(state.iterations()) *
+                            static_cast<int64_t>(sources.size()));
+}
+BENCHMARK(BM_LoadResources)
+        ->Arg(0)
+        ->Arg(1)
+        ->Unit(benchmark::kMicrosecond);
+
+// Decodes a PNG into a staging buffer with getImageData. The first argument
+// picks the decoder: 0 is stb_image, 1 to 3 are Tools::decodePng with the
+// scalar, SSSE3 and AVX2 unfilters. The second picks the file: 0 is the
+// deflated tutorial texture, which mostly measures inflate, 1 the 4K
+// texture in stored blocks, which mostly measures unfiltering. The rate is
+// of decoded pixels.
+void BM_DecodePng(benchmark::State& state) {
+    namespace Tools = intel_vulkan::Tools;
+    namespace CpuFeatures = Tools::CpuFeatures;
+    if (state.range(0) > 0) {
+        CpuFeatures::Isa isa =
+                static_cast<CpuFeatures::Isa>(state.range(0) - 1);
+        if (Tools::setPngIsa(isa) != isa) {
+            state.SkipWithError("instruction set not supported by this CPU");
+            return;
+        }
+    }
+    Tools::setPngDecoder(state.range(0) == 0 ? Tools::PngDecoder::STB
+                                             : Tools::PngDecoder::FAST);
+    std::string path = state.range(1) == 0
+                               ? INTEL_VULKAN_RESOURCES_DIR
+                                         "/07/Data/texture.png"
+                               : texturePath();
+    int width = 0, height = 0, components = 0;
+    if (!Tools::getImageInfo(path, &width, &height, &components)) {
+        state.SkipWithError("could not read the texture");
+        return;
+    }
+    std::vector<char> staging(static_cast<std::size_t>(width) * height * 4);
+    for (auto _ : state) {
+        Tools::getImageData(path,
+                            4,
+                            staging.data(),
+                            static_cast<std::size_t>(width) * 4,
+                            staging.size(),
+                            &width,
+                            &height,
+                            &components);
+        benchmark::DoNotOptimize(staging.data());
+    }
+    Tools::setPngDecoder(Tools::PngDecoder::FAST);
+    Tools::setPngIsa(CpuFeatures::bestIsa());
+    state.SetBytesProcessed(static_cast<int64_t>(state.iterations()) *
+                            static_cast<int64_t>(staging.size()));
+}
+BENCHMARK(BM_DecodePng)
+        ->ArgsProduct({{0, 1, 2, 3}, {0, 1}})
+        ->Unit(benchmark::kMillisecond);
+#endif
+}  // namespace
+
+BENCHMARK_MAIN();
@@ -0,0 +1,428 @@
+////////////////////////////////////////////////////////////////////////////
+// Copyright (c) 2026 intel_vulkan
+// All rights reserved.
+//
+// Contact: mehoggan@gmail.com
+//
+// This software is licensed under the terms of the Your License.
+// See the LICENSE file in the top-level directory.
+/////////////////////////////////////////////////////////////////////////
+
+#include "AllocationCounter.h"
+#include "intel_vulkan/LoggedClass.hpp"
+#include "intel_vulkan/Logging.h"
+#include "intel_vulkan/RotatingFileBackend.h"
+
+#include <benchmark/benchmark.h>
+#include <boost/filesystem/operations.hpp>
+
+#include <algorithm>
+#include <chrono>
+#include <cstdint>
+#include <fstream>
+#include <iostream>
+#include <memory>
+#include <sstream>
+#include <streambuf>
+#include <string>
+#include <vector>
+
+namespace {
+const intel_vulkan::LogTag& benchTag() {
+    static intel_vulkan::LogTag bench_tag("LoggingBench");
+    return bench_tag;
+}
+
+// Every benchmark logs through a file sink pointed at /dev/null so the
+// numbers include formatting and sink cost but not terminal output.
+void setUpSink() {
+    intel_vulkan::Logging::clearAll();
+    intel_vulkan::Logging::addFileLogger(
+            benchTag(), "/dev/null", INTEL_VULKAN_TRACE);
+}
+
+void BM_SyncInfo(benchmark::State& state) {
+    setUpSink();
+    std::uint64_t frame = 0;
+    for (auto _ : state) {
+        intel_vulkan::Logging::info(benchTag(), "frame", ++frame, "drawn");
+    }
+    intel_vulkan::Logging::clearAll();
+}
+BENCHMARK(BM_SyncInfo);
+
+// Heap allocations made on the calling thread per logged record, after a
+// warm up pass so that reusable buffers have reached their steady size.
+// Arguments select stream or format style and synchronous or async mode.
+void BM_AllocationsPerCall(benchmark::State& state) {
+    bool format_style = state.range(0) != 0;
+    bool async = state.range(1) != 0;
+    setUpSink();
+    if (async) {
+        intel_vulkan::Logging::enableAsync(1024);
+    }
+    auto log_once = [format_style](std::uint64_t frame) {
+        if (format_style) {
+            intel_vulkan::Logging::infof(
+                    benchTag(), "swapchain {}x{} frame {}", 1920, 1080, frame);
+        } else {
+            intel_vulkan::Logging::info(
+                    benchTag(), "swapchain", 1920, "x", 1080, "frame", frame);
+        }
+    };
+    for (std::uint64_t frame = 0; frame < 4096; ++frame) {
+        log_once(frame);
+    }
+
+    std::uint64_t frame = 0;
+    std::uint64_t allocations = threadAllocationCount();
+    for (auto _ : state) {
+        log_once(++frame);
+    }
+    allocations = threadAllocationCount() - allocations;
+    state.counters["allocs_per_call"] = benchmark::Counter(
+            static_cast<double>(allocations),
+            benchmark::Counter::kAvgIterations);
+    if (async) {
+        intel_vulkan::Logging::disableAsync();
+    }
+    intel_vulkan::Logging::clearAll();
+}
+BENCHMARK(BM_AllocationsPerCall)
+        ->ArgNames({"format", "async"})
+        ->Args({0, 0})
+        ->Args({1, 0})
+        ->Args({0, 1})
+        ->Args({1, 1});
+
+// Calls rejected before any formatting or allocation takes place: kind 0
+// is a trace call against a sink that only accepts info and above, kind 1
+// the same with a format string, and kind 2 an info call for a tag that
+// has no sink while other tags do.
+void BM_FilteredCall(benchmark::State& state) {
+    intel_vulkan::Logging::clearAll();
+    intel_vulkan::Logging::addFileLogger(
+            benchTag(), "/dev/null", INTEL_VULKAN_INFO);
+    static intel_vulkan::LogTag unrouted_tag("LoggingBenchUnrouted");
+    std::uint64_t frame = 0;
+    for (auto _ : state) {
+        switch (state.range(0)) {
+            case 0:
+                intel_vulkan::Logging::trace(
+                        benchTag(), "frame", ++frame, "drawn");
+                break;
+            case 1:
+                intel_vulkan::Logging::tracef(
+                        benchTag(), "frame {} drawn", ++frame);
+                break;
+            default:
+                intel_vulkan::Logging::info(
+                        unrouted_tag, "frame", ++frame, "drawn");
+                break;
+        }
+    }
+    benchmark::DoNotOptimize(frame);
+    intel_vulkan::Logging::clearAll();
+}
+BENCHMARK(BM_FilteredCall)->ArgName("kind")->Arg(0)->Arg(1)->Arg(2);
+
+// Records per second with state.threads() threads logging through the same
+// sink, synchronously (async:0) or through the writer thread (async:1).
+void BM_ThreadedInfo(benchmark::State& state) {
+    bool async = state.range(0) != 0;
+    if (state.thread_index() == 0) {
+        setUpSink();
+        if (async) {
+            intel_vulkan::Logging::enableAsync();
+        }
+    }
+    std::uint64_t frame = 0;
+    for (auto _ : state) {
+        intel_vulkan::Logging::infof(benchTag(), "frame {} drawn", ++frame);
+    }
+    state.SetItemsProcessed(state.iterations());
+    if (state.thread_index() == 0) {
+        if (async) {
+            intel_vulkan::Logging::disableAsync();
+        }
+        intel_vulkan::Logging::clearAll();
+    }
+}
+BENCHMARK(BM_ThreadedInfo)
+        ->ArgName("async")
+        ->Arg(0)
+        ->Arg(1)
+        ->ThreadRange(1, 8)
+        ->UseRealTime();
+
+// Distribution of the time a single call takes on the calling thread,
+// reported as the p50_ns and p99_ns counters.
+void BM_InfoLatency(benchmark::State& state) {
+    bool async = state.range(0) != 0;
+    setUpSink();
+    if (async) {
+        intel_vulkan::Logging::enableAsync();
+    }
+    std::vector<std::uint32_t> samples;
+    samples.reserve(1 << 20);
+    std::uint64_t frame = 0;
+    for (auto _ : state) {
+        auto start = std::chrono::steady_clock::now();
+        intel_vulkan::Logging::infof(benchTag(), "frame {} drawn", ++frame);
+        auto elapsed = std::chrono::steady_clock::now() - start;
+        samples.push_back(static_cast<std::uint32_t>(
+                std::chrono::duration_cast<std::chrono::nanoseconds>(elapsed)
+                        .count()));
+    }
+    if (async) {
+        intel_vulkan::Logging::disableAsync();
+    }
+    intel_vulkan::Logging::clearAll();
+
+    auto percentile = [&samples](double fraction) {
+        std::size_t index = static_cast<std::size_t>(
+                fraction * static_cast<double>(samples.size() - 1));
+        std::nth_element(samples.begin(),
+                         samples.begin() + static_cast<std::ptrdiff_t>(index),
+                         samples.end());
+        return static_cast<double>(samples[index]);
+    };
+    if (!samples.empty()) {
+        state.counters["p50_ns"] = percentile(0.50);
+        state.counters["p99_ns"] = percentile(0.99);
+    }
+}
+BENCHMARK(BM_InfoLatency)->ArgName("async")->Arg(0)->Arg(1);
+
+// Interns and registers state.range(0) distinct tags, the way one
+// LoggedClass per object does.
+void BM_RegisterTags(benchmark::State& state) {
+    std::vector<std::string> names;
+    for (int64_t index = 0; index < state.range(0); ++index) {
+        names.push_back("RegisteredTag_" + std::to_string(index));
+    }
+    for (auto _ : state) {
+        for (const std::string& name : names) {
+            intel_vulkan::Logging::addStdLogLogger(intel_vulkan::LogTag(name),
+                                                   INTEL_VULKAN_FATAL);
+        }
+        state.PauseTiming();
+        intel_vulkan::Logging::clearAll();
+        state.ResumeTiming();
+    }
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+BENCHMARK(BM_RegisterTags)
+        ->Arg(100)
+        ->Arg(1000)
+        ->Arg(10000)
+        ->Unit(benchmark::kMillisecond);
+
+// Stands in for a tutorial object. Its own sinks only accept fatal records
+// so the benchmark output stays quiet.
+class LiveObject : public intel_vulkan::LoggedClass<LiveObject> {
+public:
+    LiveObject()
+            : intel_vulkan::LoggedClass<LiveObject>(
+                      *this, INTEL_VULKAN_FATAL, INTEL_VULKAN_FATAL) {}
+};
+
+// Cost of one record while state.range(0) LoggedClass instances are alive.
+// This should stay flat as the number of instances grows.
+void BM_InfoWithLiveObjects(benchmark::State& state) {
+    setUpSink();
+    std::vector<std::unique_ptr<LiveObject>> objects;
+    for (int64_t index = 0; index < state.range(0); ++index) {
+        objects.push_back(std::make_unique<LiveObject>());
+    }
+    std::uint64_t frame = 0;
+    for (auto _ : state) {
+        intel_vulkan::Logging::info(benchTag(), "frame", ++frame, "drawn");
+    }
+    objects.clear();
+    intel_vulkan::Logging::clearAll();
+}
+BENCHMARK(BM_InfoWithLiveObjects)->Arg(5)->Arg(50)->Arg(500)->Arg(5000);
+
+// Measures the cost paid by the calling thread only. The writer thread is
+// drained once the timed loop has finished.
+void BM_AsyncInfo(benchmark::State& state) {
+    setUpSink();
+    intel_vulkan::Logging::enableAsync(
+            static_cast<std::size_t>(state.range(0)),
+            static_cast<intel_vulkan::LogOverflowPolicy>(state.range(1)));
+    std::uint64_t frame = 0;
+    for (auto _ : state) {
+        intel_vulkan::Logging::info(benchTag(), "frame", ++frame, "drawn");
+    }
+    state.counters["dropped"] = static_cast<double>(
+            intel_vulkan::Logging::asyncDroppedCount());
+    intel_vulkan::Logging::disableAsync();
+    intel_vulkan::Logging::clearAll();
+}
+BENCHMARK(BM_AsyncInfo)
+        ->ArgNames({"capacity", "policy"})
+        ->Args({8192,
+                static_cast<int>(intel_vulkan::LogOverflowPolicy::BLOCK)})
+        ->Args({8192,
+                static_cast<int>(
+                        intel_vulkan::LogOverflowPolicy::DROP_OLDEST)})
+        ->Args({8192,
+                static_cast<int>(
+                        intel_vulkan::LogOverflowPolicy::DROP_NEWEST)});
+
+// The stdlog stream sink, with std::clog pointed at /dev/null for the
+// duration of the benchmark.
+void BM_StreamSink(benchmark::State& state) {
+    std::ofstream null_stream("/dev/null");
+    std::streambuf* clog_buffer = std::clog.rdbuf(null_stream.rdbuf());
+    intel_vulkan::Logging::clearAll();
+    intel_vulkan::Logging::addStdLogLogger(benchTag(), INTEL_VULKAN_TRACE);
+    std::uint64_t frame = 0;
+    for (auto _ : state) {
+        intel_vulkan::Logging::infof(benchTag(), "frame {} drawn", ++frame);
+    }
+    intel_vulkan::Logging::clearAll();
+    std::clog.rdbuf(clog_buffer);
+    state.SetItemsProcessed(state.iterations());
+}
+BENCHMARK(BM_StreamSink);
+
+// Write throughput of the file sink into a real file, reported as records
+// and bytes per second. Bytes are counted as they are written, so records
+// in files dropped by rotation still count.
+void BM_FileSink(benchmark::State& state) {
+    intel_vulkan::Logging::clearAll();
+    boost::filesystem::path log_dir = intel_vulkan::Logging::mktmpdir(
+            boost::filesystem::temp_directory_path() / "%%%%-%%%%");
+    intel_vulkan::Logging::addFileLogger(
+            benchTag(), log_dir / "bench.log", INTEL_VULKAN_TRACE);
+    std::uint64_t bytes = intel_vulkan::RotatingFileBackend::bytesWritten();
+    std::uint64_t frame = 0;
+    for (auto _ : state) {
+        intel_vulkan::Logging::infof(
+                benchTag(), "swapchain {}x{} frame {}", 1920, 1080, ++frame);
+    }
+    intel_vulkan::Logging::clearAll();
+    bytes = intel_vulkan::RotatingFileBackend::bytesWritten() - bytes;
+    state.SetItemsProcessed(state.iterations());
+    state.SetBytesProcessed(static_cast<int64_t>(bytes));
+    boost::filesystem::remove_all(log_dir);
+}
+BENCHMARK(BM_FileSink);
+
+// Counts the bytes passed on to a std::filebuf.
+class CountingFileBuffer : public std::streambuf {
+public:
+    explicit CountingFileBuffer(const std::string& path) {
+        m_file.open(path, std::ios::out | std::ios::trunc);
+    }
+
+    std::uint64_t bytes() const { return m_bytes; }
+
+protected:
+    int_type overflow(int_type ch) override {
+        if (traits_type::eq_int_type(ch, traits_type::eof())) {
+            return traits_type::not_eof(ch);
+        }
+        ++m_bytes;
+        return m_file.sputc(traits_type::to_char_type(ch));
+    }
+
+    std::streamsize xsputn(const char* data, std::streamsize size) override {
+        std::streamsize written = m_file.sputn(data, size);
+        m_bytes += static_cast<std::uint64_t>(written);
+        return written;
+    }
+
+    int sync() override { return m_file.pubsync(); }
+
+private:
+    std::filebuf m_file;
+    std::uint64_t m_bytes = 0;
+};
+
+// The sink addFileLogger used before RotatingFileBackend, a std::ofstream
+// behind a text_ostream_backend, on the same record as BM_FileSink. It is
+// rebuilt through the stdlog sink with std::clog pointed at the file.
+void BM_OfstreamFileSink(benchmark::State& state) {
+    boost::filesystem::path log_dir = intel_vulkan::Logging::mktmpdir(
+            boost::filesystem::temp_directory_path() / "%%%%-%%%%");
+    CountingFileBuffer file_buffer((log_dir / "bench.log").string());
+    std::streambuf* clog_buffer = std::clog.rdbuf(&file_buffer);
+    intel_vulkan::Logging::clearAll();
+    intel_vulkan::Logging::addStdLogLogger(benchTag(), INTEL_VULKAN_TRACE);
+    std::uint64_t frame = 0;
+    for (auto _ : state) {
+        intel_vulkan::Logging::infof(
+                benchTag(), "swapchain {}x{} frame {}", 1920, 1080, ++frame);
+    }
+    intel_vulkan::Logging::clearAll();
+    std::clog.rdbuf(clog_buffer);
+    state.SetItemsProcessed(state.iterations());
+    state.SetBytesProcessed(static_cast<int64_t>(file_buffer.bytes()));
+    boost::filesystem::remove_all(log_dir);
+}
+BENCHMARK(BM_OfstreamFileSink);
+
+// The same record as BM_SyncInfo and BM_AsyncInfo, stored unformatted in
+// a memory-mapped binary file.
+void BM_BinaryInfo(benchmark::State& state) {
+    intel_vulkan::Logging::clearAll();
+    boost::filesystem::path log_dir = intel_vulkan::Logging::mktmpdir(
+            boost::filesystem::temp_directory_path() / "%%%%-%%%%");
+    intel_vulkan::Logging::addBinaryFileLogger(
+            benchTag(), log_dir / "bench.bin", INTEL_VULKAN_TRACE);
+    std::uint64_t frame = 0;
+    for (auto _ : state) {
+        intel_vulkan::Logging::infof(benchTag(), "frame {} drawn", ++frame);
+    }
+    intel_vulkan::Logging::clearAll();
+    boost::filesystem::remove_all(log_dir);
+}
+BENCHMARK(BM_BinaryInfo);
+
+// A trace call no sink accepts, kept only by the flight recorder. Compare
+// with BM_FilteredCall for the cost of always recording.
+void BM_FlightRecorderTrace(benchmark::State& state) {
+    intel_vulkan::Logging::clearAll();
+    intel_vulkan::Logging::addFileLogger(
+            benchTag(), "/dev/null", INTEL_VULKAN_INFO);
+    intel_vulkan::Logging::enableFlightRecorder();
+    std::uint64_t frame = 0;
+    for (auto _ : state) {
+        intel_vulkan::Logging::tracef(benchTag(), "frame {} drawn", ++frame);
+    }
+    intel_vulkan::Logging::disableFlightRecorder();
+    intel_vulkan::Logging::clearAll();
+}
+BENCHMARK(BM_FlightRecorderTrace);
+
+void BM_AsyncFlush(benchmark::State& state) {
+    setUpSink();
+    intel_vulkan::Logging::enableAsync();
+    for (auto _ : state) {
+        intel_vulkan::Logging::info(benchTag(), "frame");
+        intel_vulkan::Logging::flush();
+    }
+    intel_vulkan::Logging::disableAsync();
+    intel_vulkan::Logging::clearAll();
+}
+BENCHMARK(BM_AsyncFlush);
+}  // namespace
+
+int main(int argc, char** argv) {
+    benchmark::Initialize(&argc, argv);
+    if (benchmark::ReportUnrecognizedArguments(argc, argv)) {
+        return 1;
+    }
+    // Recorded in the "context" block of --benchmark_format=json output so
+    // results from differently configured builds are not compared.
+    std::ostringstream min_level;
+    min_level << INTEL_VULKAN_MIN_LOG_LEVEL;
+    benchmark::AddCustomContext("intel_vulkan_min_log_level",
+                                min_level.str());
+    benchmark::RunSpecifiedBenchmarks();
+    benchmark::Shutdown();
+    return 0;
+}
@@ -0,0 +1,190 @@
+////////////////////////////////////////////////////////////////////////////
+// Copyright (c) 2026 intel_vulkan
+// All rights reserved.
+//
+// Contact: mehoggan@gmail.com
+//
+// This software is licensed under the terms of the Your License.
+// See the LICENSE file in the top-level directory.
+/////////////////////////////////////////////////////////////////////////
+
+#include "intel_vulkan/Matrix.h"
+
+#include <benchmark/benchmark.h>
+
+#include <array>
+#include <cstring>
+#include <random>
+#include <vector>
+
+namespace {
+namespace Tools = intel_vulkan::Tools;
+namespace CpuFeatures = intel_vulkan::Tools::CpuFeatures;
+
+// Every benchmark performs MATRIX_COUNT * PASS_COUNT (about a million)
+// matrix products or vector transforms per iteration.
+constexpr std::size_t MATRIX_COUNT = 1024;
+constexpr std::size_t PASS_COUNT = 1024;
+
+std::array<float, 16> randomArray(std::mt19937& random) {
+    std::uniform_real_distribution<float> distribution(-1.0f, 1.0f);
+    std::array<float, 16> values;
+    for (float& value : values) {
+        value = distribution(random);
+    }
+    return values;
+}
+
+const std::vector<Tools::Mat4>& sourceMatrices() {
+    static const std::vector<Tools::Mat4> matrices = []() {
+        std::vector<Tools::Mat4> values(MATRIX_COUNT);
+        std::mt19937 random(1);
+        for (Tools::Mat4& value : values) {
+            value = Tools::Mat4::fromArray(randomArray(random));
+        }
+        return values;
+    }();
+    return matrices;
+}
+
+// The column-major triple loop the projection helpers' callers would
+// otherwise write by hand.
+std::array<float, 16> multiplyNaive(const std::array<float, 16>& lhs,
+                                    const std::array<float, 16>& rhs) {
+    std::array<float, 16> result{};
+    for (int column = 0; column < 4; ++column) {
+        for (int row = 0; row < 4; ++row) {
+            float sum = 0.0f;
+            for (int k = 0; k < 4; ++k) {
+                sum += lhs[k * 4 + row] * rhs[column * 4 + k];
+            }
+            result[column * 4 + row] = sum;
+        }
+    }
+    return result;
+}
+
+void BM_MultiplyNaive(benchmark::State& state) {
+    std::vector<std::array<float, 16>> matrices;
+    for (const Tools::Mat4& matrix : sourceMatrices()) {
+        matrices.push_back(matrix.toArray());
+    }
+    std::array<float, 16> lhs = matrices[0];
+    std::vector<std::array<float, 16>> result(MATRIX_COUNT);
+    for (auto _ : state) {
+        for (std::size_t pass = 0; pass < PASS_COUNT; ++pass) {
+            for (std::size_t index = 0; index < MATRIX_COUNT; ++index) {
+                result[index] = multiplyNaive(lhs, matrices[index]);
+            }
+            benchmark::ClobberMemory();
+        }
+    }
+    state.SetItemsProcessed(static_cast<int64_t>(state.iterations()) *
+                            MATRIX_COUNT * PASS_COUNT);
+}
+BENCHMARK(BM_MultiplyNaive)->Unit(benchmark::kMillisecond);
+
+// One product at a time through operator*.
+void BM_MultiplyMat4(benchmark::State& state) {
+    const std::vector<Tools::Mat4>& matrices = sourceMatrices();
+    Tools::Mat4 lhs = matrices[0];
+    std::vector<Tools::Mat4> result(MATRIX_COUNT);
+    for (auto _ : state) {
+        for (std::size_t pass = 0; pass < PASS_COUNT; ++pass) {
+            for (std::size_t index = 0; index < MATRIX_COUNT; ++index) {
+                result[index] = lhs * matrices[index];
+            }
+            benchmark::ClobberMemory();
+        }
+    }
+    state.SetItemsProcessed(static_cast<int64_t>(state.iterations()) *
+                            MATRIX_COUNT * PASS_COUNT);
+}
+BENCHMARK(BM_MultiplyMat4)->Unit(benchmark::kMillisecond);
+
+// Runs \p run once with the scalar kernels and once with the kernels under
+// test, each after \p reset, and fails the benchmark unless the \p size
+// bytes at \p output are identical after both. The repeated calls then
+// measure the kernels under test.
+template <typename Reset, typename Run>
+void runBatch(benchmark::State& state,
+              const void* output,
+              std::size_t size,
+              Reset reset,
+              Run run) {
+    CpuFeatures::Isa isa = static_cast<CpuFeatures::Isa>(state.range(0));
+    if (Tools::setMatrixIsa(isa) != isa) {
+        state.SkipWithError("instruction set not supported by this CPU");
+        return;
+    }
+    std::vector<char> expected(size);
+    Tools::setMatrixIsa(CpuFeatures::Isa::SCALAR);
+    reset();
+    run();
+    std::memcpy(expected.data(), output, size);
+    Tools::setMatrixIsa(isa);
+    reset();
+    run();
+    if (std::memcmp(expected.data(), output, size) != 0) {
+        state.SkipWithError("output differs from the scalar kernel");
+        return;
+    }
+
+    for (auto _ : state) {
+        for (std::size_t pass = 0; pass < PASS_COUNT; ++pass) {
+            run();
+            benchmark::ClobberMemory();
+        }
+    }
+    state.SetItemsProcessed(static_cast<int64_t>(state.iterations()) *
+                            MATRIX_COUNT * PASS_COUNT);
+    Tools::setMatrixIsa(CpuFeatures::bestIsa());
+}
+
+void BM_MultiplyBatch(benchmark::State& state) {
+    const std::vector<Tools::Mat4>& matrices = sourceMatrices();
+    std::vector<Tools::Mat4> result(MATRIX_COUNT);
+    runBatch(state,
+             result.data(),
+             MATRIX_COUNT * sizeof(Tools::Mat4),
+             []() {},
+             [&matrices, &result]() {
+                 Tools::multiply(matrices[0], matrices, result);
+             });
+}
+
+// Transforms MATRIX_COUNT points held as four arrays of components, in
+// place, by a rotation so repeated passes stay finite.
+void BM_TransformPoints(benchmark::State& state) {
+    std::vector<float> source(MATRIX_COUNT * 4);
+    std::memcpy(source.data(),
+                sourceMatrices().data(),
+                source.size() * sizeof(float));
+    std::vector<float> points = source;
+    float* data = points.data();
+    Tools::Vec4Arrays vectors = {data,
+                                 data + MATRIX_COUNT,
+                                 data + MATRIX_COUNT * 2,
+                                 data + MATRIX_COUNT * 3};
+    Tools::Mat4 rotation = Tools::lookAt({0.0f, 0.0f, 0.0f, 1.0f},
+                                         {1.0f, 2.0f, 3.0f, 1.0f},
+                                         {0.0f, 1.0f, 0.0f, 0.0f});
+    runBatch(
+            state,
+            data,
+            points.size() * sizeof(float),
+            [&points, &source]() { points = source; },
+            [&rotation, &vectors]() {
+                Tools::transform(rotation, vectors, MATRIX_COUNT);
+            });
+}
+
+// The argument is the CpuFeatures::Isa: scalar, SSSE3, AVX2.
+#define MATRIX_BENCHMARK(name) \
+    BENCHMARK(name)->DenseRange(0, 2)->Unit(benchmark::kMillisecond)
+
+MATRIX_BENCHMARK(BM_MultiplyBatch);
+MATRIX_BENCHMARK(BM_TransformPoints);
+}  // namespace
+
+BENCHMARK_MAIN();
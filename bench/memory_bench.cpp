@@ -0,0 +1,210 @@
+////////////////////////////////////////////////////////////////////////////
+// Copyright (c) 2026 intel_vulkan
+// All rights reserved.
+//
+// Contact: mehoggan@gmail.com
+//
+// This software is licensed under the terms of the Your License.
+// See the LICENSE file in the top-level directory.
+/////////////////////////////////////////////////////////////////////////
+
+#include "intel_vulkan/DeviceMemoryAllocator.h"
+
+#include <benchmark/benchmark.h>
+
+#include <algorithm>
+#include <chrono>
+#include <cstdint>
+#include <cstdlib>
+#include <optional>
+#include <random>
+#include <vector>
+
+namespace {
+namespace Tools = intel_vulkan::Tools;
+
+constexpr std::uint64_t BLOCK_SIZE = 256ull << 20;
+
+// A resource of the churn workload: mostly small buffers, some textures.
+struct Request {
+    std::uint64_t size;
+    std::uint64_t alignment;
+    Tools::ResourceTiling tiling;
+};
+
+Request randomRequest(std::mt19937& random) {
+    std::uniform_int_distribution<int> kind(0, 9);
+    if (kind(random) < 8) {
+        std::uniform_int_distribution<std::uint64_t> size(256, 256 << 10);
+        return {size(random), 256, Tools::ResourceTiling::LINEAR};
+    }
+    std::uniform_int_distribution<int> side(6, 11);
+    std::uint64_t extent = 1ull << side(random);
+    return {extent * extent * 4, 64 << 10, Tools::ResourceTiling::OPTIMAL};
+}
+
+// Keeps state.range(0) resources alive and, per iteration, replaces a
+// random one, the way streaming replaces buffers and textures. Reports the
+// p50_ns and p99_ns latency of an allocation; report sees the allocator
+// before the resources are freed.
+template <class Allocate, class Free, class Report>
+void churn(benchmark::State& state,
+           Allocate allocate,
+           Free free,
+           Report report) {
+    using Handle = decltype(allocate(std::declval<const Request&>()));
+    std::mt19937 random(1);
+    std::vector<Handle> live;
+    for (int64_t index = 0; index < state.range(0); ++index) {
+        live.push_back(allocate(randomRequest(random)));
+    }
+
+    std::vector<std::uint32_t> samples;
+    samples.reserve(1 << 20);
+    std::uniform_int_distribution<std::size_t> victim(0, live.size() - 1);
+    for (auto _ : state) {
+        state.PauseTiming();
+        std::size_t index = victim(random);
+        Request request = randomRequest(random);
+        state.ResumeTiming();
+
+        free(live[index]);
+        auto start = std::chrono::steady_clock::now();
+        live[index] = allocate(request);
+        auto elapsed = std::chrono::steady_clock::now() - start;
+        samples.push_back(static_cast<std::uint32_t>(
+                std::chrono::duration_cast<std::chrono::nanoseconds>(elapsed)
+                        .count()));
+    }
+    report();
+    for (Handle& handle : live) {
+        free(handle);
+    }
+
+    auto percentile = [&samples](double fraction) {
+        std::size_t index = static_cast<std::size_t>(
+                fraction * static_cast<double>(samples.size() - 1));
+        std::nth_element(samples.begin(),
+                         samples.begin() + static_cast<std::ptrdiff_t>(index),
+                         samples.end());
+        return static_cast<double>(samples[index]);
+    };
+    if (!samples.empty()) {
+        state.counters["p50_ns"] = percentile(0.50);
+        state.counters["p99_ns"] = percentile(0.99);
+    }
+    state.SetItemsProcessed(static_cast<int64_t>(state.iterations()));
+}
+
+// Placement alone, in one large block, with the fragmentation it ends at.
+void BM_TlsfChurn(benchmark::State& state) {
+    Tools::TlsfAllocator allocator(64 * BLOCK_SIZE);
+    bool failed = false;
+    churn(
+            state,
+            [&allocator, &failed](const Request& request) {
+                std::optional<Tools::TlsfAllocator::Allocation> allocation =
+                        allocator.allocate(request.size, request.alignment);
+                failed |= !allocation;
+                return allocation;
+            },
+            [&allocator](
+                    const std::optional<Tools::TlsfAllocator::Allocation>&
+                            allocation) {
+                if (allocation) {
+                    allocator.free(allocation->handle);
+                }
+            },
+            [&state, &allocator]() {
+                double free_size = static_cast<double>(allocator.size() -
+                                                       allocator.usedSize());
+                double largest =
+                        static_cast<double>(allocator.largestFreeRange());
+                state.counters["fragmentation"] = 1.0 - largest / free_size;
+            });
+    if (failed) {
+        state.SkipWithError("TlsfAllocator ran out of space");
+    }
+}
+BENCHMARK(BM_TlsfChurn)->ArgName("live")->Arg(1 << 10)->Arg(1 << 14);
+
+// vkAllocateMemory and friends, counting the calls and handing out fake
+// handles, so the numbers are the allocator's own overhead.
+std::size_t g_device_allocations = 0;
+
+VkResult fakeAllocateMemory(VkDevice,
+                            const VkMemoryAllocateInfo*,
+                            const VkAllocationCallbacks*,
+                            VkDeviceMemory* memory) {
+    ++g_device_allocations;
+    *memory = reinterpret_cast<VkDeviceMemory>(std::malloc(1));
+    return VK_SUCCESS;
+}
+
+void fakeFreeMemory(VkDevice,
+                    VkDeviceMemory memory,
+                    const VkAllocationCallbacks*) {
+    std::free(memory);
+}
+
+VkResult fakeMapMemory(VkDevice,
+                       VkDeviceMemory,
+                       VkDeviceSize,
+                       VkDeviceSize,
+                       VkMemoryMapFlags,
+                       void** data) {
+    *data = nullptr;
+    return VK_SUCCESS;
+}
+
+// The whole DeviceMemoryAllocator on a device with one 8 GiB heap and the
+// largest granularity drivers report. device_allocations_per_resource is
+// what one vkAllocateMemory per resource would make 1.
+void BM_DeviceMemoryChurn(benchmark::State& state) {
+    VkPhysicalDeviceMemoryProperties properties = {};
+    properties.memoryTypeCount = 1;
+    properties.memoryTypes[0].propertyFlags =
+            VK_MEMORY_PROPERTY_DEVICE_LOCAL_BIT;
+    properties.memoryTypes[0].heapIndex = 0;
+    properties.memoryHeapCount = 1;
+    properties.memoryHeaps[0].size = 8ull << 30;
+    VkPhysicalDeviceLimits limits = {};
+    limits.bufferImageGranularity = 64 << 10;
+    limits.nonCoherentAtomSize = 64;
+
+    g_device_allocations = 0;
+    std::size_t resources = 0;
+    Tools::DeviceMemoryAllocator allocator(
+            reinterpret_cast<VkDevice>(1),
+            properties,
+            limits,
+            {fakeAllocateMemory, fakeFreeMemory, fakeMapMemory},
+            BLOCK_SIZE);
+    churn(
+            state,
+            [&allocator, &resources](const Request& request) {
+                ++resources;
+                return allocator.allocate({request.size, request.alignment, 1},
+                                          VK_MEMORY_PROPERTY_DEVICE_LOCAL_BIT,
+                                          request.tiling);
+            },
+            [&allocator](const Tools::MemoryAllocation& allocation) {
+                allocator.free(allocation);
+            },
+            [&state, &allocator, &resources]() {
+                Tools::MemoryStats stats = allocator.stats();
+                state.counters["blocks"] =
+                        static_cast<double>(stats.block_count);
+                state.counters["fragmentation"] = stats.fragmentation();
+                state.counters["occupancy"] =
+                        static_cast<double>(stats.used_size) /
+                        static_cast<double>(stats.block_size);
+                state.counters["device_allocations_per_resource"] =
+                        static_cast<double>(g_device_allocations) /
+                        static_cast<double>(resources);
+            });
+}
+BENCHMARK(BM_DeviceMemoryChurn)->ArgName("live")->Arg(1 << 10)->Arg(1 << 14);
+}  // namespace
+
+BENCHMARK_MAIN();
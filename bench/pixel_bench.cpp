@@ -0,0 +1,194 @@
+////////////////////////////////////////////////////////////////////////////
+// Copyright (c) 2026 intel_vulkan
+// All rights reserved.
+//
+// Contact: mehoggan@gmail.com
+//
+// This software is licensed under the terms of the Your License.
+// See the LICENSE file in the top-level directory.
+/////////////////////////////////////////////////////////////////////////
+
+#include "intel_vulkan/BlockCompress.h"
+#include "intel_vulkan/MipChain.h"
+#include "intel_vulkan/PixelConvert.h"
+#include "intel_vulkan/Tools.h"
+
+#include <benchmark/benchmark.h>
+
+#include <cstdint>
+#include <random>
+#include <vector>
+
+namespace {
+namespace PixelConvert = intel_vulkan::Tools::PixelConvert;
+
+// A 1080p frame plus a few pixels so every kernel also runs its scalar
+// tail.
+constexpr std::size_t PIXEL_COUNT = 1920 * 1080 + 7;
+
+const std::vector<std::uint8_t>& sourcePixels() {
+    static const std::vector<std::uint8_t> pixels = []() {
+        std::vector<std::uint8_t> values(PIXEL_COUNT * 4);
+        std::mt19937 random(1);
+        for (std::uint8_t& value : values) {
+            value = static_cast<std::uint8_t>(random());
+        }
+        return values;
+    }();
+    return pixels;
+}
+
+// Times \p convert with the kernels of the instruction set selected by the
+// argument. test/pixel_convert_test checks they match the scalar ones.
+template <typename Out, typename Convert>
+void runConversion(benchmark::State& state,
+                   std::size_t in_bytes,
+                   std::size_t out_count,
+                   Convert convert) {
+    PixelConvert::Isa isa = static_cast<PixelConvert::Isa>(state.range(0));
+    if (PixelConvert::setIsa(isa) != isa) {
+        state.SkipWithError("instruction set not supported by this CPU");
+        return;
+    }
+    std::vector<Out> actual(out_count);
+    for (auto _ : state) {
+        convert(actual.data());
+        benchmark::ClobberMemory();
+    }
+    state.SetBytesProcessed(static_cast<int64_t>(state.iterations()) *
+                            static_cast<int64_t>(in_bytes));
+    PixelConvert::setIsa(PixelConvert::bestIsa());
+}
+
+void BM_RgbToRgba(benchmark::State& state) {
+    const std::uint8_t* src = sourcePixels().data();
+    runConversion<std::uint8_t>(
+            state, PIXEL_COUNT * 3, PIXEL_COUNT * 4, [src](std::uint8_t* dst) {
+                PixelConvert::rgbToRgba(src, dst, PIXEL_COUNT);
+            });
+}
+
+void BM_RgbaToBgra(benchmark::State& state) {
+    const std::uint8_t* src = sourcePixels().data();
+    runConversion<std::uint8_t>(
+            state, PIXEL_COUNT * 4, PIXEL_COUNT * 4, [src](std::uint8_t* dst) {
+                PixelConvert::rgbaToBgra(src, dst, PIXEL_COUNT);
+            });
+}
+
+void BM_SrgbToLinear(benchmark::State& state) {
+    const std::uint8_t* src = sourcePixels().data();
+    runConversion<float>(
+            state, PIXEL_COUNT * 4, PIXEL_COUNT * 4, [src](float* dst) {
+                PixelConvert::srgbToLinear(src, dst, PIXEL_COUNT);
+            });
+}
+
+void BM_PremultiplyAlpha(benchmark::State& state) {
+    const std::uint8_t* src = sourcePixels().data();
+    runConversion<std::uint8_t>(
+            state, PIXEL_COUNT * 4, PIXEL_COUNT * 4, [src](std::uint8_t* dst) {
+                PixelConvert::premultiplyAlpha(src, dst, PIXEL_COUNT);
+            });
+}
+
+void BM_UnormToHalf(benchmark::State& state) {
+    const std::uint8_t* src = sourcePixels().data();
+    runConversion<std::uint16_t>(
+            state, PIXEL_COUNT * 4, PIXEL_COUNT * 4, [src](std::uint16_t* dst) {
+                PixelConvert::unormToHalf(src, dst, PIXEL_COUNT * 4);
+            });
+}
+
+// The argument is the PixelConvert::Isa: scalar, SSSE3, AVX2.
+#define PIXEL_BENCHMARK(name) \
+    BENCHMARK(name)->DenseRange(0, 2)->Unit(benchmark::kMicrosecond)
+
+PIXEL_BENCHMARK(BM_RgbToRgba);
+PIXEL_BENCHMARK(BM_RgbaToBgra);
+PIXEL_BENCHMARK(BM_SrgbToLinear);
+PIXEL_BENCHMARK(BM_PremultiplyAlpha);
+PIXEL_BENCHMARK(BM_UnormToHalf);
+
+// The full pyramid of a 4096x4096 texture. Arguments: 1 for sRGB, and the
+// number of threads.
+void BM_GenerateMipChain(benchmark::State& state) {
+    constexpr std::uint32_t SIZE = 4096;
+    std::vector<std::uint8_t> pixels(static_cast<std::size_t>(SIZE) * SIZE *
+                                     4);
+    std::mt19937 random(2);
+    for (std::uint8_t& value : pixels) {
+        value = static_cast<std::uint8_t>(random());
+    }
+    for (auto _ : state) {
+        intel_vulkan::Tools::MipChain chain =
+                intel_vulkan::Tools::generateMipChain(
+                        pixels.data(),
+                        SIZE,
+                        SIZE,
+                        0,
+                        state.range(0) != 0,
+                        static_cast<std::size_t>(state.range(1)));
+        benchmark::DoNotOptimize(chain.data.data());
+    }
+    state.SetBytesProcessed(static_cast<int64_t>(state.iterations()) *
+                            static_cast<int64_t>(pixels.size()));
+}
+BENCHMARK(BM_GenerateMipChain)
+        ->ArgsProduct({{0, 1}, {1, 4, 16}})
+        ->UseRealTime()
+        ->Unit(benchmark::kMillisecond);
+
+#ifdef INTEL_VULKAN_RESOURCES_DIR
+// Compresses the tutorial texture. Arguments: the BlockFormat (BC1, BC3,
+// BC7) and the number of threads. The PSNR counter is the quality of the
+// result in dB.
+void BM_CompressBlocks(benchmark::State& state) {
+    namespace Tools = intel_vulkan::Tools;
+    int width = 0, height = 0, components = 0, data_size = 0;
+    std::vector<char> pixels = Tools::getImageData(
+            INTEL_VULKAN_RESOURCES_DIR "/07/Data/texture.png",
+            4,
+            &width,
+            &height,
+            &components,
+            &data_size);
+    if (pixels.empty()) {
+        state.SkipWithError("could not load the tutorial texture");
+        return;
+    }
+    Tools::BlockFormat format =
+            static_cast<Tools::BlockFormat>(state.range(0));
+    std::size_t thread_count = static_cast<std::size_t>(state.range(1));
+    std::vector<char> blocks;
+    for (auto _ : state) {
+        blocks = Tools::compressBlocks(pixels.data(),
+                                       static_cast<std::uint32_t>(width),
+                                       static_cast<std::uint32_t>(height),
+                                       0,
+                                       format,
+                                       thread_count);
+        benchmark::DoNotOptimize(blocks.data());
+    }
+    std::vector<char> decoded(pixels.size());
+    Tools::decompressBlocks(blocks.data(),
+                            static_cast<std::uint32_t>(width),
+                            static_cast<std::uint32_t>(height),
+                            format,
+                            decoded.data());
+    state.counters["PSNR"] =
+            Tools::psnr(pixels.data(),
+                        decoded.data(),
+                        static_cast<std::size_t>(width) * height,
+                        format != Tools::BlockFormat::BC1);
+    state.SetItemsProcessed(static_cast<int64_t>(state.iterations()) * width *
+                            height);
+}
+BENCHMARK(BM_CompressBlocks)
+        ->ArgsProduct({{0, 1, 2}, {1, 4}})
+        ->UseRealTime()
+        ->Unit(benchmark::kMillisecond);
+#endif
+}  // namespace
+
+BENCHMARK_MAIN();
@@ -0,0 +1,103 @@
+////////////////////////////////////////////////////////////////////////////
+// Copyright (c) 2026 intel_vulkan
+// All rights reserved.
+//
+// Contact: mehoggan@gmail.com
+//
+// This software is licensed under the terms of the Your License.
+// See the LICENSE file in the top-level directory.
+/////////////////////////////////////////////////////////////////////////
+
+#include "intel_vulkan/AssetArchive.h"
+
+#include <cstdlib>
+#include <filesystem>
+#include <iostream>
+#include <string>
+#include <vector>
+
+namespace {
+int usage(const char* program) {
+    std::cerr << "usage: " << program
+              << " [--alignment <bytes>] <archive> <directory | name=file>..."
+              << std::endl
+              << "       " << program << " --list <archive>" << std::endl;
+    return 2;
+}
+
+// Prints the index and checks every asset against its hash.
+int list(std::string const& path) {
+    intel_vulkan::Tools::AssetArchive archive(path);
+    if (!archive.isValid()) {
+        return 1;
+    }
+    for (std::size_t index = 0; index < archive.size(); ++index) {
+        intel_vulkan::Tools::AssetArchive::Entry entry = archive.entry(index);
+        std::cout << entry.name << ' ' << entry.offset << ' ' << entry.size
+                  << std::endl;
+    }
+    if (!archive.verify()) {
+        std::cerr << path << ": contents do not match the index" << std::endl;
+        return 1;
+    }
+    return 0;
+}
+}  // namespace
+
+// Packs files into an archive for Tools::AssetArchive. Files in a
+// directory are named by their path relative to it, e.g. packing
+// resources makes resources/03/Data/shader.03.vert 03/Data/shader.03.vert.
+int main(int argc, char** argv) {
+    namespace Tools = intel_vulkan::Tools;
+
+    std::size_t alignment = Tools::AssetArchive::DEFAULT_ALIGNMENT;
+    std::vector<std::string> args;
+    for (int index = 1; index < argc; ++index) {
+        std::string arg(argv[index]);
+        if (arg == "--list" && index + 1 < argc && argc == 3) {
+            return list(argv[index + 1]);
+        } else if (arg == "--alignment" && index + 1 < argc) {
+            alignment = std::strtoul(argv[++index], nullptr, 10);
+        } else {
+            args.push_back(arg);
+        }
+    }
+    if (args.size() < 2) {
+        return usage(argv[0]);
+    }
+
+    std::vector<Tools::AssetArchive::Source> sources;
+    for (std::size_t index = 1; index < args.size(); ++index) {
+        std::string::size_type equals = args[index].find('=');
+        if (equals != std::string::npos) {
+            sources.push_back({args[index].substr(0, equals),
+                               args[index].substr(equals + 1)});
+            continue;
+        }
+        std::error_code error;
+        std::filesystem::path directory(args[index]);
+        for (std::filesystem::recursive_directory_iterator item(directory,
+                                                                 error),
+             end;
+             !error && item != end;
+             item.increment(error)) {
+            if (item->is_regular_file()) {
+                sources.push_back(
+                        {item->path().lexically_relative(directory)
+                                 .generic_string(),
+                         item->path().string()});
+            }
+        }
+        if (error) {
+            std::cerr << args[index] << ": " << error.message() << std::endl;
+            return 1;
+        }
+    }
+
+    if (!Tools::AssetArchive::pack(args[0], sources, alignment)) {
+        std::cerr << args[0] << ": could not write the archive" << std::endl;
+        return 1;
+    }
+    std::cout << args[0] << ": " << sources.size() << " assets" << std::endl;
+    return 0;
+}
@@ -0,0 +1,49 @@
+////////////////////////////////////////////////////////////////////////////
+// Copyright (c) 2026 intel_vulkan
+// All rights reserved.
+//
+// Contact: mehoggan@gmail.com
+//
+// This software is licensed under the terms of the Your License.
+// See the LICENSE file in the top-level directory.
+/////////////////////////////////////////////////////////////////////////
+
+#include "intel_vulkan/BinaryLog.h"
+
+#include <iostream>
+#include <string>
+
+// Decodes a file written by Logging::addBinaryFileLogger.
+int main(int argc, char** argv) {
+    bool json = false;
+    std::string path;
+    for (int index = 1; index < argc; ++index) {
+        std::string arg(argv[index]);
+        if (arg == "--json") {
+            json = true;
+        } else if (path.empty()) {
+            path = arg;
+        } else {
+            path.clear();
+            break;
+        }
+    }
+    if (path.empty()) {
+        std::cerr << "usage: " << argv[0] << " [--json] <binary log file>"
+                  << std::endl;
+        return 2;
+    }
+
+    intel_vulkan::BinaryLogReader reader(path);
+    if (!reader.isValid()) {
+        std::cerr << path << ": not a binary log file" << std::endl;
+        return 1;
+    }
+    for (const intel_vulkan::BinaryLogReader::Entry& entry :
+         reader.entries()) {
+        std::cout << (json ? intel_vulkan::BinaryLogReader::toJson(entry)
+                           : intel_vulkan::BinaryLogReader::toText(entry))
+                  << '\n';
+    }
+    return 0;
+}
@@ -0,0 +1,140 @@
+////////////////////////////////////////////////////////////////////////////
+// Copyright (c) 2026 intel_vulkan
+// All rights reserved.
+//
+// Contact: mehoggan@gmail.com
+//
+// This software is licensed under the terms of the Your License.
+// See the LICENSE file in the top-level directory.
+/////////////////////////////////////////////////////////////////////////
+
+#include "intel_vulkan/BlockCompress.h"
+#include "intel_vulkan/CompressedTexture.h"
+#include "intel_vulkan/MipChain.h"
+#include "intel_vulkan/Tools.h"
+
+#include <chrono>
+#include <cstdlib>
+#include <iomanip>
+#include <iostream>
+#include <string>
+#include <vector>
+
+namespace {
+int usage(const char* program) {
+    std::cerr << "usage: " << program
+              << " [--format bc1|bc3|bc7] [--srgb] [--threads <count>]"
+                 " <input image> <output.ktx2>"
+              << std::endl;
+    return 2;
+}
+}  // namespace
+
+// Decodes an image, builds its mip chain and writes it block compressed
+// as a KTX2 file for Tools::CompressedTexture.
+int main(int argc, char** argv) {
+    namespace Tools = intel_vulkan::Tools;
+
+    Tools::BlockFormat format = Tools::BlockFormat::BC7;
+    std::string format_name = "bc7";
+    bool srgb = false;
+    std::size_t thread_count = 0;
+    std::vector<std::string> paths;
+    for (int index = 1; index < argc; ++index) {
+        std::string arg(argv[index]);
+        if (arg == "--format" && index + 1 < argc) {
+            format_name = argv[++index];
+            if (format_name == "bc1") {
+                format = Tools::BlockFormat::BC1;
+            } else if (format_name == "bc3") {
+                format = Tools::BlockFormat::BC3;
+            } else if (format_name == "bc7") {
+                format = Tools::BlockFormat::BC7;
+            } else {
+                return usage(argv[0]);
+            }
+        } else if (arg == "--srgb") {
+            srgb = true;
+        } else if (arg == "--threads" && index + 1 < argc) {
+            thread_count = std::strtoul(argv[++index], nullptr, 10);
+        } else {
+            paths.push_back(arg);
+        }
+    }
+    if (paths.size() != 2) {
+        return usage(argv[0]);
+    }
+
+    int width = 0;
+    int height = 0;
+    int components = 0;
+    if (!Tools::getImageInfo(paths[0], &width, &height, &components)) {
+        std::cerr << paths[0] << ": not an image" << std::endl;
+        return 1;
+    }
+    std::vector<char> pixels(static_cast<std::size_t>(width) * height * 4);
+    if (!Tools::getImageData(paths[0],
+                             4,
+                             pixels.data(),
+                             static_cast<std::size_t>(width) * 4,
+                             pixels.size(),
+                             &width,
+                             &height,
+                             &components)) {
+        return 1;
+    }
+    Tools::MipChain chain =
+            Tools::generateMipChain(pixels.data(),
+                                    static_cast<std::uint32_t>(width),
+                                    static_cast<std::uint32_t>(height),
+                                    0,
+                                    srgb,
+                                    thread_count);
+
+    std::vector<std::vector<char>> levels;
+    std::size_t pixel_count = 0;
+    std::size_t compressed_size = 0;
+    std::chrono::steady_clock::duration encode_time{};
+    for (const Tools::MipLevel& level : chain.levels) {
+        auto start = std::chrono::steady_clock::now();
+        levels.push_back(Tools::compressBlocks(chain.data.data() + level.offset,
+                                               level.width,
+                                               level.height,
+                                               0,
+                                               format,
+                                               thread_count));
+        encode_time += std::chrono::steady_clock::now() - start;
+        pixel_count += static_cast<std::size_t>(level.width) * level.height;
+        compressed_size += levels.back().size();
+    }
+
+    // The error of level 0 against the decoded image.
+    const Tools::MipLevel& base = chain.levels.front();
+    std::vector<char> decoded(base.size);
+    Tools::decompressBlocks(levels.front().data(),
+                            base.width,
+                            base.height,
+                            format,
+                            decoded.data());
+    double quality = Tools::psnr(chain.data.data() + base.offset,
+                                 decoded.data(),
+                                 static_cast<std::size_t>(base.width) *
+                                         base.height,
+                                 format != Tools::BlockFormat::BC1);
+
+    if (!Tools::writeKtx2(paths[1],
+                          Tools::vulkanFormat(format, srgb),
+                          base.width,
+                          base.height,
+                          levels)) {
+        return 1;
+    }
+    double seconds = std::chrono::duration<double>(encode_time).count();
+    std::cout << std::fixed << std::setprecision(2) << paths[1] << ": "
+              << format_name << (srgb ? " srgb " : " ") << base.width << "x"
+              << base.height << ", " << levels.size() << " levels, "
+              << compressed_size << " bytes, encoded in " << seconds * 1000.0
+              << " ms (" << pixel_count / seconds / 1e6
+              << " Mpixel/s), PSNR " << quality << " dB" << std::endl;
+    return 0;
+}
@@ -14,10 +14,15 @@
 // under the License.
 ////////////////////////////////////////////////////////////////////////////////
 
+#include "intel_vulkan/AssetArchive.h"
 #include "intel_vulkan/Tutorial03.h"
 #include "intel_vulkan/TutorialBase.h"
 
 int main(int argc, char** argv) {
+    // Shaders come from the archive built next to the runner, or from the
+    // loose files if there is none.
+    intel_vulkan::Tools::AssetArchive::mount("assets.pak");
+
     intel_vulkan::os::Window window;
     std::shared_ptr<intel_vulkan::TutorialBase> tutorial =
             std::make_shared<intel_vulkan::Tutorial03>();
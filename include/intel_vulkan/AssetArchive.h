@@ -0,0 +1,166 @@
+////////////////////////////////////////////////////////////////////////////
+// Copyright (c) 2026 intel_vulkan
+// All rights reserved.
+//
+// Contact: mehoggan@gmail.com
+//
+// This software is licensed under the terms of the Your License.
+// See the LICENSE file in the top-level directory.
+/////////////////////////////////////////////////////////////////////////
+#ifndef INTEL_VULKAN_ASSETARCHIVE_H
+#define INTEL_VULKAN_ASSETARCHIVE_H
+
+#include "intel_vulkan/Tools.h"
+
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <optional>
+#include <span>
+#include <string>
+#include <string_view>
+#include <vector>
+
+namespace intel_vulkan::Tools {
+/**
+ * @brief A read-only archive of assets that is mapped once and serves
+ *        every asset as a view into the mapping.
+ *
+ * The archive starts with an index of every asset's name, offset, size,
+ * alignment and content hash, sorted by name. The payloads follow, each
+ * starting on a multiple of its alignment (64 KiB by default), so a single
+ * payload can be remapped or read ahead on its own. Looking up an asset
+ * is a binary search in memory with no system calls.
+ *
+ * Build archives with \ref AssetArchive::pack or the
+ * intel_vulkan_assetpack tool, and mount one at startup with
+ * \ref AssetArchive::mount so that \ref loadAsset,
+ * \ref getBinaryFileContents and \ref getImageData find assets in it.
+ */
+class AssetArchive {
+public:
+    static constexpr std::size_t DEFAULT_ALIGNMENT = 64 * 1024;
+
+    /**
+     * @brief A file to pack and the name it is looked up by.
+     */
+    struct Source {
+        std::string name;
+        std::string path;
+    };
+
+    /**
+     * @brief An asset as described by the index.
+     */
+    struct Entry {
+        std::string_view name;
+        std::uint64_t offset;  ///< Bytes from the start of the archive.
+        std::uint64_t size;
+        std::uint64_t hash;  ///< FNV-1a of the contents.
+        std::uint32_t alignment;
+    };
+
+    AssetArchive();
+
+    /**
+     * @brief ctor, maps \p filename and checks its index.
+     */
+    explicit AssetArchive(std::string const& filename);
+
+    AssetArchive(AssetArchive&& other) = default;
+    AssetArchive& operator=(AssetArchive&& other) = default;
+
+    /**
+     * @return true if the file is an archive with a consistent index.
+     */
+    bool isValid() const { return !m_file.empty(); }
+
+    /**
+     * @return The number of assets.
+     */
+    std::size_t size() const { return m_entry_count; }
+
+    /**
+     * @return The index entry of the \p index th asset in name order.
+     */
+    Entry entry(std::size_t index) const;
+
+    /**
+     * @return The contents of the asset called \p name, which stay valid
+     *         while the archive is alive, or nothing if there is no such
+     *         asset. An empty asset is found with empty contents.
+     */
+    std::optional<std::span<const char>> find(std::string_view name) const;
+
+    /**
+     * @return true if the contents of every asset match their hash.
+     */
+    bool verify() const;
+
+    /**
+     * @brief Writes an archive of \p sources.
+     *
+     * @param[in] filename The archive to write, replaced atomically.
+     * @param[in] sources The files to pack. Names must be unique.
+     * @param[in] alignment The alignment of every payload, a power of 2.
+     *
+     * @return true if every file was read and the archive was written.
+     */
+    static bool pack(std::string const& filename,
+                     std::vector<Source> sources,
+                     std::size_t alignment = DEFAULT_ALIGNMENT);
+
+    /**
+     * @brief Maps \p filename, resolved like \ref getBinaryFileContents,
+     *        and makes it the global archive.
+     *
+     * @return false if there is no such archive or it is invalid, e.g.
+     *         during development, in which case assets are loaded from
+     *         loose files.
+     */
+    static bool mount(std::string const& filename);
+
+    static void setGlobal(std::shared_ptr<const AssetArchive> archive);
+    static std::shared_ptr<const AssetArchive> global();
+
+private:
+    struct IndexEntry;
+
+    const IndexEntry* indexEntry(std::size_t index) const;
+    std::string_view indexName(const IndexEntry& entry) const;
+
+    MappedFile m_file;
+    std::size_t m_entry_count;
+    std::size_t m_names_offset;
+
+    static std::mutex s_global_mutex;
+    static std::shared_ptr<const AssetArchive> s_global;
+};
+
+/**
+ * @brief The contents of an asset, from the global archive or a loose
+ *        file.
+ */
+struct Asset {
+    std::span<const char> contents;
+
+    /// Keeps the archive \ref Asset::contents points into mapped.
+    std::shared_ptr<const AssetArchive> archive;
+    /// The loose file if the asset is not in the archive.
+    MappedFile file;
+
+    bool empty() const { return contents.empty(); }
+};
+
+/**
+ * @brief Looks \p name up in the global archive and falls back to mapping
+ *        the loose file, resolved like \ref getBinaryFileContents.
+ *
+ * @param[in] name The asset's name in the archive and its loose path.
+ * @param[in] access The access pattern hint for a loose file.
+ */
+Asset loadAsset(std::string const& name,
+                MappedFile::Access access = MappedFile::Access::SEQUENTIAL);
+}  // namespace intel_vulkan::Tools
+#endif
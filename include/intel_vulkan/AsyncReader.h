@@ -0,0 +1,145 @@
+////////////////////////////////////////////////////////////////////////////
+// Copyright (c) 2026 intel_vulkan
+// All rights reserved.
+//
+// Contact: mehoggan@gmail.com
+//
+// This software is licensed under the terms of the Your License.
+// See the LICENSE file in the top-level directory.
+/////////////////////////////////////////////////////////////////////////
+#ifndef INTEL_VULKAN_ASYNCREADER_H
+#define INTEL_VULKAN_ASYNCREADER_H
+
+#include <atomic>
+#include <condition_variable>
+#include <cstddef>
+#include <cstdint>
+#include <deque>
+#include <functional>
+#include <future>
+#include <memory>
+#include <mutex>
+#include <span>
+#include <string>
+#include <thread>
+#include <vector>
+
+namespace intel_vulkan::Tools {
+/**
+ * @brief A read of one file into a buffer owned by the caller.
+ */
+struct ReadRequest {
+    std::string path;  ///< Opened as given, not resolved.
+    std::span<char> buffer;  ///< Must stay alive until the read completes.
+    std::uint64_t offset = 0;  ///< Where in the file to start reading.
+};
+
+/**
+ * @brief A completed \ref ReadRequest.
+ */
+struct ReadResult {
+    std::string path;
+    std::span<char> data;  ///< The filled start of the request's buffer.
+    int error = 0;  ///< The errno of a failed open or read, 0 on success.
+
+    bool ok() const { return error == 0; }
+};
+
+/**
+ * @brief Reads many files at once into caller provided buffers.
+ *
+ * On Linux kernels with io_uring, one thread keeps up to the queue depth of
+ * reads submitted to the kernel, so the device sees that many requests at a
+ * time. Elsewhere, or if io_uring is unavailable, e.g. disabled by a
+ * seccomp policy, as many threads as the queue depth each run blocking
+ * preads. Either way a read fills its buffer up to its size or the end of
+ * the file and completes through a future or a callback as soon as it
+ * lands, in completion order. If the ring fails while reading, the reads
+ * it holds are cancelled and waited for, so no buffer is written after the
+ * ring is gone; those not complete by then are read again, along with the
+ * rest, by the threads.
+ */
+class AsyncReader {
+public:
+    enum class Backend {
+        AUTO,  ///< io_uring if available, else THREAD_POOL.
+        IO_URING,
+        THREAD_POOL,
+    };
+
+    using Callback = std::function<void(ReadResult&& result)>;
+
+    /**
+     * @brief ctor, sets up the backend and starts its threads.
+     *
+     * @param[in] queue_depth The number of reads in flight at once.
+     * @param[in] backend The backend to use; IO_URING falls back to
+     *                    THREAD_POOL if it cannot be set up.
+     */
+    explicit AsyncReader(std::size_t queue_depth = 32,
+                         Backend backend = Backend::AUTO);
+
+    /**
+     * @brief dtor, finishes the queued reads and stops the threads.
+     */
+    ~AsyncReader();
+
+    /**
+     * @brief Queues \p requests.
+     *
+     * @return A future per request, in the order of \p requests.
+     */
+    std::vector<std::future<ReadResult>> read(
+            const std::vector<ReadRequest>& requests);
+
+    /**
+     * @brief Queues \p requests and calls \p on_read from a reader thread
+     *        as each one completes.
+     */
+    void read(const std::vector<ReadRequest>& requests, Callback on_read);
+
+    /**
+     * @brief Blocks until every queued read has been delivered.
+     */
+    void wait();
+
+    /**
+     * @return The backend in use, never AUTO. IO_URING turns into
+     *         THREAD_POOL if the ring fails while reading.
+     */
+    Backend backend() const { return m_backend; }
+
+    std::size_t queueDepth() const { return m_queue_depth; }
+
+private:
+    struct Job {
+        ReadRequest request;
+        std::shared_ptr<std::promise<ReadResult>> promise;
+        Callback on_read;
+    };
+
+    struct Ring;
+
+    void enqueue(Job&& job);
+    void deliver(Job& job, std::size_t size, int error);
+    void ringLoop();
+    void poolLoop();
+
+    std::size_t m_queue_depth;
+    std::atomic<Backend> m_backend;
+    std::unique_ptr<Ring> m_ring;
+    std::deque<Job> m_jobs;
+    std::size_t m_pending;
+    bool m_running;
+    std::mutex m_mutex;
+    std::condition_variable m_job_ready;
+    std::condition_variable m_idle;
+    std::vector<std::thread> m_threads;
+    std::vector<std::thread> m_fallback_threads;  ///< Started by ringLoop.
+
+private:
+    AsyncReader(const AsyncReader& other) = delete;
+    AsyncReader& operator=(const AsyncReader& rhs) = delete;
+};
+}  // namespace intel_vulkan::Tools
+#endif
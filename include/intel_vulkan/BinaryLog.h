@@ -0,0 +1,308 @@
+////////////////////////////////////////////////////////////////////////////
+// Copyright (c) 2026 intel_vulkan
+// All rights reserved.
+//
+// Contact: mehoggan@gmail.com
+//
+// This software is licensed under the terms of the Your License.
+// See the LICENSE file in the top-level directory.
+/////////////////////////////////////////////////////////////////////////
+
+#ifndef INTEL_VULKAN_BINARYLOG_H
+#define INTEL_VULKAN_BINARYLOG_H
+
+#include "intel_vulkan/LoggerStdHelpers.h"
+
+#include <cstddef>
+#include <cstdint>
+#include <mutex>
+#include <sstream>
+#include <string>
+#include <string_view>
+#include <type_traits>
+#include <unordered_map>
+#include <vector>
+
+namespace intel_vulkan {
+/**
+ * @brief The number of bytes of encoded arguments a binary record holds.
+ */
+constexpr std::size_t BINARY_LOG_ARG_BYTES = 88;
+
+/**
+ * @brief The type code written in front of every encoded argument.
+ */
+enum class BinaryLogArgType : std::uint8_t {
+    INT64 = 1,
+    UINT64 = 2,
+    DOUBLE = 3,
+    BOOL = 4,
+    STRING = 5,  ///< Followed by a 16 bit length and the bytes.
+    POINTER = 6
+};
+
+/**
+ * @brief The kind of an entry in the string table of a binary log file.
+ */
+enum class BinaryLogStringKind : std::uint8_t { TAG = 1, FORMAT = 2 };
+
+/**
+ * @brief A fixed layout record in the ring of a binary log file.
+ *
+ * A record is committed once \p sequence and \p commit both hold its
+ * position in the ring plus one. A writer clears both before touching the
+ * record and stores \p commit and then \p sequence, with release
+ * semantics, once the rest is written. Readers load \p sequence first and
+ * \p commit last, so a record that is half written, or overwritten while
+ * it is read or copied by \ref BinaryLogWriter::dump, never has the two
+ * agree and is skipped.
+ */
+struct BinaryLogRecord {
+    std::uint64_t sequence;
+    std::uint64_t timestamp_ns;  ///< Nanoseconds since the Unix epoch.
+    std::uint32_t tag_id;        ///< \ref LogTag::id.
+    std::uint32_t format_id;
+    std::uint8_t severity;  ///< boost::log::trivial::severity_level.
+    std::uint8_t arg_count;
+    std::uint8_t truncated;  ///< Non zero if arguments did not fit.
+    std::uint8_t reserved;
+    std::uint32_t arg_bytes;
+    std::uint8_t args[BINARY_LOG_ARG_BYTES];
+    std::uint64_t commit;
+};
+static_assert(sizeof(BinaryLogRecord) == 128);
+
+/**
+ * @brief The header at offset 0 of a binary log file.
+ *
+ * The file holds the header, then a string table mapping tag and format
+ * ids to their strings, then the record ring.
+ */
+struct BinaryLogFileHeader {
+    char magic[8];
+    std::uint32_t version;
+    std::uint32_t record_size;
+    std::uint64_t record_capacity;
+    std::uint64_t strings_offset;
+    std::uint64_t strings_capacity;
+    std::uint64_t records_offset;
+    std::uint64_t write_cursor;  ///< Records ever written.
+    std::uint64_t strings_used;  ///< Bytes of the string table in use.
+};
+
+constexpr char BINARY_LOG_MAGIC[8] = {'I', 'V', 'K', 'B', 'L', 'O', 'G', '1'};
+constexpr std::uint32_t BINARY_LOG_VERSION = 2;
+
+/**
+ * @brief Encodes the arguments of a single log call into the layout
+ *        stored in \ref BinaryLogRecord::args.
+ *
+ * Arithmetic values, pointers and strings are stored raw. Any other type
+ * is written to a std::stringstream and stored as a string. Arguments that
+ * do not fit are dropped and the record is flagged as truncated.
+ */
+class BinaryLogArgs {
+public:
+    BinaryLogArgs() : m_size(0), m_count(0), m_truncated(false) {}
+
+    template <typename T> void append(const T& value) {
+        if constexpr (std::is_same_v<T, bool>) {
+            std::uint8_t raw = value ? 1 : 0;
+            appendRaw(BinaryLogArgType::BOOL, &raw, sizeof(raw));
+        } else if constexpr (std::is_same_v<T, char>) {
+            appendString(std::string_view(&value, 1));
+        } else if constexpr (std::is_enum_v<T>) {
+            append(static_cast<std::underlying_type_t<T>>(value));
+        } else if constexpr (std::is_integral_v<T> && std::is_signed_v<T>) {
+            std::int64_t raw = value;
+            appendRaw(BinaryLogArgType::INT64, &raw, sizeof(raw));
+        } else if constexpr (std::is_integral_v<T>) {
+            std::uint64_t raw = value;
+            appendRaw(BinaryLogArgType::UINT64, &raw, sizeof(raw));
+        } else if constexpr (std::is_floating_point_v<T>) {
+            double raw = value;
+            appendRaw(BinaryLogArgType::DOUBLE, &raw, sizeof(raw));
+        } else if constexpr (std::is_convertible_v<const T&,
+                                                   std::string_view>) {
+            // A null C string is stored as "(null)", as printf prints it,
+            // since a std::string_view cannot be built from one.
+            if constexpr (std::is_null_pointer_v<T>) {
+                appendString("(null)");
+            } else if constexpr (std::is_pointer_v<T>) {
+                appendString(value == nullptr ? std::string_view("(null)")
+                                              : std::string_view(value));
+            } else {
+                appendString(std::string_view(value));
+            }
+        } else if constexpr (std::is_pointer_v<T>) {
+            std::uint64_t raw = reinterpret_cast<std::uintptr_t>(value);
+            appendRaw(BinaryLogArgType::POINTER, &raw, sizeof(raw));
+        } else {
+            // A std::stringstream, like the text sinks format into, so the
+            // operator<< overloads in LoggerHelpers.h apply here too. Those
+            // for standard types are global and not found by argument
+            // dependent lookup, so LoggerStdHelpers.h declares them before
+            // this template; those for Vulkan types are found through it.
+            std::stringstream sstream;
+            sstream << value;
+            appendString(sstream.view());
+        }
+    }
+
+    void appendString(std::string_view value);
+
+    const std::uint8_t* data() const { return m_bytes; }
+    std::uint32_t size() const { return m_size; }
+    std::uint8_t count() const { return m_count; }
+    bool truncated() const { return m_truncated; }
+
+private:
+    void appendRaw(BinaryLogArgType type,
+                   const void* value,
+                   std::size_t value_size);
+
+    std::uint8_t m_bytes[BINARY_LOG_ARG_BYTES];
+    std::uint32_t m_size;
+    std::uint8_t m_count;
+    bool m_truncated;
+};
+
+/**
+ * @brief Writes records into a memory-mapped binary log file.
+ *
+ * The file is created with a fixed size and records wrap around once the
+ * ring is full, so the file always holds the most recent records. Writing
+ * a record is a copy into the mapping; the kernel writes pages back on its
+ * own and \ref BinaryLogWriter::sync forces it.
+ */
+class BinaryLogWriter {
+public:
+    BinaryLogWriter();
+    ~BinaryLogWriter();
+
+    /**
+     * @brief Creates or truncates \p path and maps it.
+     *
+     * @param[in] path The file to write.
+     * @param[in] record_capacity The number of records kept in the ring.
+     *
+     * @return true if the file was created and mapped, false otherwise.
+     */
+    bool open(const std::string& path, std::size_t record_capacity);
+
+    /**
+     * @brief Maps anonymous memory laid out exactly like a file.
+     *
+     * Nothing is written anywhere until \ref BinaryLogWriter::dump is
+     * called.
+     *
+     * @param[in] record_capacity The number of records kept in the ring.
+     *
+     * @return true if the memory was mapped, false otherwise.
+     */
+    bool openAnonymous(std::size_t record_capacity);
+
+    /**
+     * @brief Writes a copy of the whole mapping to \p path.
+     *
+     * Only calls open, write and close, so it is safe to call from a
+     * signal handler.
+     *
+     * @param[in] path The file to create or truncate.
+     *
+     * @return true if every byte was written, false otherwise.
+     */
+    bool dump(const char* path) const;
+
+    /**
+     * @brief Adds an id to string mapping to the file's string table.
+     *
+     * @return true if the entry was stored, false if the table is full.
+     */
+    bool addString(BinaryLogStringKind kind,
+                   std::uint32_t string_id,
+                   std::string_view value);
+
+    /**
+     * @brief Appends a record to the ring. Safe to call from any thread.
+     */
+    void write(std::uint64_t timestamp_ns,
+               std::uint32_t tag_id,
+               std::uint32_t format_id,
+               std::uint8_t severity,
+               const BinaryLogArgs& args);
+
+    /**
+     * @brief Asks the kernel to write dirty pages back to the file.
+     *
+     * @param[in] wait true to block until the pages are on disk.
+     */
+    void sync(bool wait);
+
+private:
+    bool map(int fd, std::size_t record_capacity);
+
+    BinaryLogWriter(const BinaryLogWriter& other) = delete;
+    BinaryLogWriter& operator=(const BinaryLogWriter& rhs) = delete;
+
+    int m_fd;
+    void* m_mapping;
+    std::size_t m_mapping_size;
+    BinaryLogFileHeader* m_header;
+    BinaryLogRecord* m_records;
+    std::mutex m_strings_mutex;
+};
+
+/**
+ * @brief Reads a binary log file written by \ref BinaryLogWriter.
+ *
+ * Used by the intel_vulkan_logdump tool to turn a capture into text or
+ * JSON after the fact.
+ */
+class BinaryLogReader {
+public:
+    struct Entry {
+        std::uint64_t timestamp_ns;
+        std::string tag;
+        std::string severity;
+        std::string format;
+        std::vector<std::string> args;
+        std::string message;
+        bool truncated;
+    };
+
+    /**
+     * @brief Maps \p path read-only and validates its header.
+     *
+     * @param[in] path The file to read.
+     */
+    explicit BinaryLogReader(const std::string& path);
+    ~BinaryLogReader();
+
+    /**
+     * @return true if the file was mapped and has a valid header.
+     */
+    bool isValid() const;
+
+    /**
+     * @brief Decodes every complete record in the ring.
+     *
+     * @return The records ordered from oldest to newest.
+     */
+    std::vector<Entry> entries() const;
+
+    static std::string toText(const Entry& entry);
+    static std::string toJson(const Entry& entry);
+
+private:
+    BinaryLogReader(const BinaryLogReader& other) = delete;
+    BinaryLogReader& operator=(const BinaryLogReader& rhs) = delete;
+
+    void* m_mapping;
+    std::size_t m_mapping_size;
+    const BinaryLogFileHeader* m_header;
+    std::unordered_map<std::uint32_t, std::string> m_tags;
+    std::unordered_map<std::uint32_t, std::string> m_formats;
+};
+}  // namespace intel_vulkan
+#endif
@@ -0,0 +1,88 @@
+////////////////////////////////////////////////////////////////////////////
+// Copyright (c) 2026 intel_vulkan
+// All rights reserved.
+//
+// Contact: mehoggan@gmail.com
+//
+// This software is licensed under the terms of the Your License.
+// See the LICENSE file in the top-level directory.
+/////////////////////////////////////////////////////////////////////////
+#ifndef INTEL_VULKAN_BLOCKCOMPRESS_H
+#define INTEL_VULKAN_BLOCKCOMPRESS_H
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+#include <vulkan/vulkan.h>
+
+namespace intel_vulkan::Tools {
+/**
+ * @brief The block formats \ref compressBlocks writes.
+ */
+enum class BlockFormat {
+    BC1,  ///< Opaque RGB, 8 bytes per block.
+    BC3,  ///< RGBA with separate alpha, 16 bytes per block.
+    BC7,  ///< RGBA, 16 bytes per block, written as BC7 mode 6.
+};
+
+/**
+ * @return The Vulkan format of \p format, the sRGB one if \p srgb.
+ */
+VkFormat vulkanFormat(BlockFormat format, bool srgb);
+
+/**
+ * @brief Compresses an RGBA8 image into 4x4 blocks.
+ *
+ * Endpoints start on the principal axis of each block's colors and are
+ * refit by least squares; every pixel then takes the closest palette
+ * entry. On sizes that are not a multiple of 4 the last row or column is
+ * repeated to fill the edge blocks. Rows of blocks are split into bands
+ * compressed on \p thread_count threads.
+ *
+ * @param[in] rgba The pixels.
+ * @param[in] width The width of the image.
+ * @param[in] height The height of the image.
+ * @param[in] row_pitch The bytes between rows of \p rgba, 0 for width * 4.
+ * @param[in] format The block format.
+ * @param[in] thread_count The number of threads, 0 for one per core.
+ *
+ * @return The blocks row by row, empty if \p width or \p height is 0.
+ */
+std::vector<char> compressBlocks(const void* rgba,
+                                 std::uint32_t width,
+                                 std::uint32_t height,
+                                 std::size_t row_pitch,
+                                 BlockFormat format,
+                                 std::size_t thread_count = 0);
+
+/**
+ * @brief Decodes blocks back to tightly packed RGBA8, e.g. to measure the
+ *        error of \ref compressBlocks.
+ *
+ * BC7 blocks in any mode other than 6, which \ref compressBlocks does not
+ * write, decode to zero.
+ *
+ * @param[in] blocks The blocks row by row.
+ * @param[in] width The width of the image.
+ * @param[in] height The height of the image.
+ * @param[in] format The block format.
+ * @param[out] rgba Receives width * height * 4 bytes.
+ */
+void decompressBlocks(const void* blocks,
+                      std::uint32_t width,
+                      std::uint32_t height,
+                      BlockFormat format,
+                      void* rgba);
+
+/**
+ * @return The peak signal to noise ratio in dB between two RGBA8 images
+ *         over the color channels, and alpha if \p with_alpha. Infinity if
+ *         they are identical.
+ */
+double psnr(const void* reference,
+            const void* actual,
+            std::size_t pixel_count,
+            bool with_alpha);
+}  // namespace intel_vulkan::Tools
+#endif
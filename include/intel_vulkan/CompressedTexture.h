@@ -0,0 +1,140 @@
+////////////////////////////////////////////////////////////////////////////
+// Copyright (c) 2026 intel_vulkan
+// All rights reserved.
+//
+// Contact: mehoggan@gmail.com
+//
+// This software is licensed under the terms of the Your License.
+// See the LICENSE file in the top-level directory.
+/////////////////////////////////////////////////////////////////////////
+#ifndef INTEL_VULKAN_COMPRESSEDTEXTURE_H
+#define INTEL_VULKAN_COMPRESSEDTEXTURE_H
+
+#include "intel_vulkan/Tools.h"
+
+#include <cstddef>
+#include <cstdint>
+#include <span>
+#include <string>
+#include <vector>
+
+#include <vulkan/vulkan.h>
+
+namespace intel_vulkan::Tools {
+/**
+ * @brief One mip level of a \ref CompressedTexture.
+ */
+struct CompressedLevel {
+    std::uint32_t width;
+    std::uint32_t height;
+    std::size_t offset;  ///< Bytes from the start of the file.
+    std::size_t size;
+};
+
+/**
+ * @brief A block-compressed (BC1 to BC7) texture read from a KTX2 or DDS
+ *        file.
+ *
+ * The file is memory mapped and its levels are copied as they are, so
+ * nothing is decoded on the CPU. Only 2D textures with a single layer and
+ * face and without supercompression are supported, with at most the
+ * levels of a full mip chain.
+ */
+class CompressedTexture {
+public:
+    /**
+     * @brief ctor, maps and parses \p filename.
+     */
+    explicit CompressedTexture(std::string const& filename);
+
+    /**
+     * @brief Parses a file already in memory, which must outlive the
+     *        returned texture.
+     */
+    static CompressedTexture fromMemory(std::span<const char> contents);
+
+    CompressedTexture(CompressedTexture&& other) = default;
+    CompressedTexture& operator=(CompressedTexture&& other) = default;
+
+    /**
+     * @return true if the file is a supported texture.
+     */
+    bool isValid() const { return m_format != VK_FORMAT_UNDEFINED; }
+
+    VkFormat format() const { return m_format; }
+    std::uint32_t width() const {
+        return m_levels.empty() ? 0 : m_levels[0].width;
+    }
+    std::uint32_t height() const {
+        return m_levels.empty() ? 0 : m_levels[0].height;
+    }
+
+    /**
+     * @return The levels, level 0 first. Use its size as the image's
+     *         mipLevels.
+     */
+    const std::vector<CompressedLevel>& levels() const { return m_levels; }
+
+    std::span<const char> levelData(std::size_t level) const;
+
+    /**
+     * @return The bytes \ref copyTo writes, including the padding that
+     *         keeps every level block aligned.
+     */
+    std::size_t stagingSize() const;
+
+    /**
+     * @brief Copies every level into \p destination, e.g. a mapped staging
+     *        buffer, and describes them for vkCmdCopyBufferToImage.
+     *
+     * @param[in] destination Where the levels are copied to.
+     * @param[in] destination_size Must be at least \ref stagingSize.
+     * @param[in] buffer_offset Where \p destination starts in the buffer
+     *                          the copy reads from. Must be a multiple of
+     *                          16.
+     *
+     * @return One region per level, empty if nothing was copied.
+     */
+    std::vector<VkBufferImageCopy> copyTo(void* destination,
+                                          std::size_t destination_size,
+                                          VkDeviceSize buffer_offset) const;
+
+private:
+    CompressedTexture();
+
+    bool parse(std::span<const char> contents);
+    bool parseKtx2(std::span<const char> contents);
+    bool parseDds(std::span<const char> contents);
+
+    MappedFile m_file;
+    std::span<const char> m_contents;
+    VkFormat m_format;
+    std::vector<CompressedLevel> m_levels;
+};
+
+/**
+ * @return The bytes per 4x4 block of a BC format, 0 for any other format.
+ */
+std::size_t blockSize(VkFormat format);
+
+/**
+ * @brief Writes a 2D block-compressed texture as a KTX2 file, e.g. the
+ *        output of \ref compressBlocks for every level of a mip chain.
+ *
+ * Supports BC1, BC2, BC3 and BC7 in unorm and sRGB.
+ *
+ * @param[in] filename The file to write.
+ * @param[in] format The format of the blocks.
+ * @param[in] width The width of level 0.
+ * @param[in] height The height of level 0.
+ * @param[in] levels The blocks of every level, level 0 first.
+ *
+ * @return true if the file was written.
+ */
+bool writeKtx2(std::string const& filename,
+               VkFormat format,
+               std::uint32_t width,
+               std::uint32_t height,
+               const std::vector<std::vector<char>>& levels);
+}  // namespace intel_vulkan::Tools
+#endif
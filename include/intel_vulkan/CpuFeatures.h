@@ -0,0 +1,37 @@
+////////////////////////////////////////////////////////////////////////////
+// Copyright (c) 2026 intel_vulkan
+// All rights reserved.
+//
+// Contact: mehoggan@gmail.com
+//
+// This software is licensed under the terms of the Your License.
+// See the LICENSE file in the top-level directory.
+/////////////////////////////////////////////////////////////////////////
+#ifndef INTEL_VULKAN_CPUFEATURES_H
+#define INTEL_VULKAN_CPUFEATURES_H
+
+/**
+ * @brief The CPU features the SIMD kernels of the pixel conversions, the
+ *        PNG decoder and the matrix batches are picked by.
+ *
+ * The CPU is queried once. Each of those modules keeps its own selection,
+ * which starts at \ref bestIsa and can be lowered for benchmarks and
+ * comparisons without affecting the others.
+ */
+namespace intel_vulkan::Tools::CpuFeatures {
+/**
+ * @brief The instruction sets kernels exist for, in increasing order.
+ */
+enum class Isa { SCALAR, SSSE3, AVX2 };
+
+/**
+ * @return The best instruction set the CPU supports.
+ */
+Isa bestIsa();
+
+/**
+ * @return \p isa, lowered to \ref bestIsa if the CPU does not support it.
+ */
+Isa supportedIsa(Isa isa);
+}  // namespace intel_vulkan::Tools::CpuFeatures
+#endif
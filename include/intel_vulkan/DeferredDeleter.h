@@ -0,0 +1,205 @@
+////////////////////////////////////////////////////////////////////////////
+// Copyright (c) 2026 intel_vulkan
+// All rights reserved.
+//
+// Contact: mehoggan@gmail.com
+//
+// This software is licensed under the terms of the Your License.
+// See the LICENSE file in the top-level directory.
+/////////////////////////////////////////////////////////////////////////
+#ifndef INTEL_VULKAN_DEFERREDDELETER_H
+#define INTEL_VULKAN_DEFERREDDELETER_H
+
+#include <cstddef>
+#include <cstdint>
+#include <deque>
+#include <functional>
+
+#include <vulkan/vulkan.h>
+
+namespace intel_vulkan::Tools {
+/**
+ * @brief Reports how far the device has got through submitted work.
+ *
+ * Work is numbered with increasing values, typically one per submitted
+ * frame. Value 0 stands for "before any submission" and is always
+ * complete. Derive from this to drive a \ref DeferredDeleter from a mock
+ * in tests.
+ */
+class DeletionBackend {
+public:
+    virtual ~DeletionBackend() = default;
+
+    /**
+     * @brief The highest value whose work, and all work before it, has
+     *        completed. Never decreases.
+     */
+    virtual std::uint64_t completedValue() = 0;
+
+    /**
+     * @brief Blocks until the work of \p value has completed.
+     *
+     * @return false if it never will, e.g. the value was not submitted or
+     *         the device was lost.
+     */
+    virtual bool waitFor(std::uint64_t value) = 0;
+};
+
+/**
+ * @brief A \ref DeletionBackend for a queue that signals one fence per
+ *        submission.
+ *
+ * Call \ref FenceDeletionBackend::submitted with the fence of every
+ * vkQueueSubmit. Fences may be reused: call
+ * \ref FenceDeletionBackend::signaled once a fence has been waited on and
+ * before it is reset, so a submission that then fails leaves nothing
+ * waiting on the unsignaled fence. Submitting a fence again also marks its
+ * previous value as complete even if the reset hid the signal.
+ */
+class FenceDeletionBackend : public DeletionBackend {
+public:
+    FenceDeletionBackend(VkDevice device,
+                         PFN_vkGetFenceStatus get_fence_status,
+                         PFN_vkWaitForFences wait_for_fences);
+
+    /**
+     * @brief Records that the work of \p value signals \p fence.
+     *
+     * @param[in] value Greater than every value submitted before.
+     */
+    void submitted(std::uint64_t value, VkFence fence);
+
+    /**
+     * @brief Records that \p fence was seen signaled, which completes its
+     *        submission and every one before it.
+     */
+    void signaled(VkFence fence);
+
+    std::uint64_t completedValue() override;
+    bool waitFor(std::uint64_t value) override;
+
+private:
+    struct Submission {
+        std::uint64_t value;
+        VkFence fence;
+    };
+
+    void complete(std::size_t count);
+
+    VkDevice m_device;
+    PFN_vkGetFenceStatus m_get_fence_status;
+    PFN_vkWaitForFences m_wait_for_fences;
+    std::deque<Submission> m_submissions;  ///< Oldest first.
+    std::uint64_t m_completed_value;
+};
+
+/**
+ * @brief A \ref DeletionBackend that reads a timeline semaphore, whose
+ *        counter is the completed value.
+ *
+ * Timeline semaphores are core in Vulkan 1.2 and otherwise need
+ * VK_KHR_timeline_semaphore; the caller loads the entry points of either.
+ */
+class TimelineDeletionBackend : public DeletionBackend {
+public:
+    TimelineDeletionBackend(
+            VkDevice device,
+            VkSemaphore semaphore,
+            PFN_vkGetSemaphoreCounterValue get_semaphore_counter_value,
+            PFN_vkWaitSemaphores wait_semaphores);
+
+    std::uint64_t completedValue() override;
+    bool waitFor(std::uint64_t value) override;
+
+private:
+    VkDevice m_device;
+    VkSemaphore m_semaphore;
+    PFN_vkGetSemaphoreCounterValue m_get_semaphore_counter_value;
+    PFN_vkWaitSemaphores m_wait_semaphores;
+    std::uint64_t m_completed_value;
+};
+
+/**
+ * @brief Destroys Vulkan objects once the GPU is done with them.
+ *
+ * Where \ref AutoDeleter destroys its object right away, which forces a
+ * vkDeviceWaitIdle whenever the object might still be in use, this queues
+ * the destruction with the value of the last submission that used the
+ * object. \ref DeferredDeleter::collect, called once per frame, destroys
+ * everything whose value the backend reports as complete, so replacing a
+ * resource needs no device idle. The swap chain itself is the exception:
+ * presents signal no fence, so it is still retired after a device idle.
+ *
+ * Objects are destroyed in the order they were queued. Not thread safe.
+ */
+class DeferredDeleter {
+public:
+    /**
+     * @param[in] backend Must outlive the deleter.
+     */
+    explicit DeferredDeleter(DeletionBackend& backend);
+
+    /**
+     * @brief dtor, waits for and destroys everything still queued.
+     */
+    ~DeferredDeleter();
+
+    DeferredDeleter(const DeferredDeleter&) = delete;
+    DeferredDeleter& operator=(const DeferredDeleter&) = delete;
+
+    /**
+     * @brief Queues \p destroy until the work of \p value has completed.
+     *
+     * @param[in] value The value of the last submission that used the
+     *                  objects \p destroy frees; 0 if none did.
+     */
+    void defer(std::uint64_t value, std::function<void()> destroy);
+
+    /**
+     * @brief Queues deleter(device, object, nullptr), the call
+     *        \ref AutoDeleter makes, until \p value has completed. Null
+     *        objects are ignored.
+     */
+    template <class T, class F>
+    void defer(std::uint64_t value, T object, F deleter, VkDevice device) {
+        if ((object == VK_NULL_HANDLE) || (deleter == nullptr) ||
+            (device == VK_NULL_HANDLE)) {
+            return;
+        }
+        defer(value, [object, deleter, device]() {
+            deleter(device, object, nullptr);
+        });
+    }
+
+    /**
+     * @brief Destroys everything queued with a completed value.
+     *
+     * @return The number of destroy calls made.
+     */
+    std::size_t collect();
+
+    /**
+     * @brief Waits for every queued value, then destroys everything.
+     *
+     * @return false if the backend could not wait for some value; the
+     *         objects queued with it stay queued.
+     */
+    bool flush();
+
+    /**
+     * @brief The number of queued destroy calls.
+     */
+    std::size_t pending() const;
+
+private:
+    struct Entry {
+        std::uint64_t value;
+        std::function<void()> destroy;
+    };
+
+    DeletionBackend& m_backend;
+    std::deque<Entry> m_entries;  ///< In the order they were queued.
+};
+}  // namespace intel_vulkan::Tools
+
+#endif  // INTEL_VULKAN_DEFERREDDELETER_H
@@ -0,0 +1,311 @@
+////////////////////////////////////////////////////////////////////////////
+// Copyright (c) 2026 intel_vulkan
+// All rights reserved.
+//
+// Contact: mehoggan@gmail.com
+//
+// This software is licensed under the terms of the Your License.
+// See the LICENSE file in the top-level directory.
+/////////////////////////////////////////////////////////////////////////
+#ifndef INTEL_VULKAN_DEVICEMEMORYALLOCATOR_H
+#define INTEL_VULKAN_DEVICEMEMORYALLOCATOR_H
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <optional>
+#include <vector>
+
+#include <vulkan/vulkan.h>
+
+namespace intel_vulkan::Tools {
+/**
+ * @brief Places ranges inside one block of memory with a two level
+ *        segregated fit (TLSF) scheme.
+ *
+ * Allocation and freeing take constant time: free ranges are kept in
+ * lists by size class, found through two bitmaps, and merged with their
+ * free neighbours when released. The allocator only hands out offsets and
+ * never touches the memory, so it runs without a GPU.
+ */
+class TlsfAllocator {
+public:
+    struct Allocation {
+        std::uint64_t offset;
+        std::uint32_t handle;  ///< Pass to \ref TlsfAllocator::free.
+    };
+
+    explicit TlsfAllocator(std::uint64_t size);
+
+    /**
+     * @brief Finds a free range of \p size bytes at a multiple of
+     *        \p alignment, a power of two.
+     *
+     * @return Empty if no free range is large enough.
+     */
+    std::optional<Allocation> allocate(std::uint64_t size,
+                                       std::uint64_t alignment);
+
+    /**
+     * @brief Releases an allocation made by this allocator.
+     */
+    void free(std::uint32_t handle);
+
+    std::uint64_t size() const;
+    std::uint64_t usedSize() const;
+    std::size_t allocationCount() const;
+
+    /**
+     * @brief The size of the largest free range, the largest allocation
+     *        that is certain to succeed without alignment.
+     */
+    std::uint64_t largestFreeRange() const;
+
+private:
+    static constexpr int SECOND_LEVEL_LOG2 = 5;
+    static constexpr int SECOND_LEVEL_COUNT = 1 << SECOND_LEVEL_LOG2;
+    static constexpr int FIRST_LEVEL_COUNT = 64;
+    static constexpr std::uint32_t NONE = UINT32_MAX;
+
+    // A used or free range. Neighbouring ranges are linked in address
+    // order; free ranges are also linked into the list of their size
+    // class.
+    struct Range {
+        std::uint64_t offset;
+        std::uint64_t size;
+        std::uint32_t previous_physical;
+        std::uint32_t next_physical;
+        std::uint32_t previous_free;
+        std::uint32_t next_free;
+        bool free;
+    };
+
+    std::uint32_t newRange(std::uint64_t offset, std::uint64_t size);
+    void releaseRange(std::uint32_t index);
+    void insertFree(std::uint32_t index);
+    void removeFree(std::uint32_t index);
+    std::uint32_t findFree(std::uint64_t size) const;
+    void merge(std::uint32_t into, std::uint32_t from);
+
+    std::uint64_t m_size;
+    std::uint64_t m_used_size;
+    std::size_t m_allocation_count;
+    std::vector<Range> m_ranges;
+    std::vector<std::uint32_t> m_unused_ranges;  ///< Slots to reuse.
+    std::uint64_t m_first_level_bitmap;
+    std::array<std::uint32_t, FIRST_LEVEL_COUNT> m_second_level_bitmaps;
+    std::array<std::array<std::uint32_t, SECOND_LEVEL_COUNT>,
+               FIRST_LEVEL_COUNT>
+            m_free_heads;
+};
+
+/**
+ * @brief How a resource lays out its memory, which decides whether it may
+ *        share a bufferImageGranularity page with another resource.
+ */
+enum class ResourceTiling {
+    LINEAR,   ///< Buffers and VK_IMAGE_TILING_LINEAR images.
+    OPTIMAL,  ///< VK_IMAGE_TILING_OPTIMAL images.
+};
+
+/**
+ * @brief What a resource's memory is used for, which decides the memory
+ *        types that suit it.
+ */
+enum class MemoryUsage {
+    GPU_ONLY,  ///< Written and read by the device only, e.g. render targets.
+    UPLOAD,    ///< Written once by the host, read by the device.
+    READBACK,  ///< Written by the device, read by the host.
+    DYNAMIC,   ///< Rewritten by the host every frame, read by the device.
+};
+
+/**
+ * @brief The memory types in \p memory_type_bits that can serve \p usage,
+ *        best first.
+ *
+ * Host access needs HOST_VISIBLE; lazily allocated, protected and AMD
+ * device coherent types are never returned. The rest are ranked by the
+ * flags that make \p usage fast:
+ *  - GPU_ONLY prefers DEVICE_LOCAL memory that is not HOST_VISIBLE, which
+ *    is left for the host.
+ *  - UPLOAD prefers HOST_COHERENT, uncached memory, and DEVICE_LOCAL,
+ *    which needs no staging copy, if its heap is larger than 256 MiB,
+ *    i.e. resizable BAR or an integrated GPU.
+ *  - READBACK prefers HOST_CACHED, then HOST_COHERENT memory that is not
+ *    DEVICE_LOCAL.
+ *  - DYNAMIC prefers DEVICE_LOCAL, HOST_COHERENT, uncached memory on a
+ *    heap of any size.
+ * Ties keep the order the device lists the types in.
+ */
+std::vector<std::uint32_t> rankMemoryTypes(
+        const VkPhysicalDeviceMemoryProperties& properties,
+        std::uint32_t memory_type_bits,
+        MemoryUsage usage);
+
+class DeviceMemoryAllocator;
+
+/**
+ * @brief A range of device memory from a \ref DeviceMemoryAllocator.
+ *
+ * Bind the resource with memory and offset. For host visible memory,
+ * mapped points at offset inside a mapping that lives as long as the
+ * allocation.
+ */
+struct MemoryAllocation {
+    VkDeviceMemory memory = VK_NULL_HANDLE;
+    VkDeviceSize offset = 0;
+    VkDeviceSize size = 0;
+    void* mapped = nullptr;
+    std::uint32_t memory_type = 0;
+    VkMemoryPropertyFlags property_flags = 0;  ///< Of memory_type.
+
+    bool operator!() const { return memory == VK_NULL_HANDLE; }
+
+private:
+    friend class DeviceMemoryAllocator;
+
+    void* m_block = nullptr;
+    std::uint32_t m_handle = 0;
+};
+
+/**
+ * @brief The state of a \ref DeviceMemoryAllocator.
+ */
+struct MemoryStats {
+    std::size_t block_count = 0;  ///< Live vkAllocateMemory allocations.
+    std::size_t allocation_count = 0;
+    VkDeviceSize block_size = 0;  ///< Bytes allocated from the device.
+    VkDeviceSize used_size = 0;  ///< Bytes handed out, with padding.
+    VkDeviceSize largest_free_range = 0;  ///< Over all blocks.
+
+    /**
+     * @brief 0 when all free memory is one range, approaching 1 as it is
+     *        split into many small ones.
+     */
+    double fragmentation() const {
+        VkDeviceSize free_size = block_size - used_size;
+        return free_size == 0 ? 0.0
+                              : 1.0 - static_cast<double>(largest_free_range) /
+                                              static_cast<double>(free_size);
+    }
+};
+
+/**
+ * @brief Sub-allocates device memory from a few large blocks instead of
+ *        calling vkAllocateMemory once per resource.
+ *
+ * Each memory type gets blocks of DEFAULT_BLOCK_SIZE, or an eighth of its
+ * heap on heaps of 1 GiB or less, and a \ref TlsfAllocator places
+ * resources inside them. Requests larger than half a block get a
+ * dedicated allocation. Host visible blocks are mapped once, when they
+ * are allocated.
+ *
+ * OPTIMAL resources are aligned to and padded out to
+ * bufferImageGranularity, so they never share a page with a LINEAR one.
+ * Host visible, non-coherent allocations are aligned to
+ * nonCoherentAtomSize so they can be flushed on their own. A block is
+ * freed once it is empty unless it is the last one of its memory type.
+ *
+ * The memory properties are read once, by the caller, and passed in;
+ * the memory types that suit each \ref MemoryUsage are ranked once, here.
+ * The device entry points are passed in too, so the allocator can run
+ * against fakes. Thread safe.
+ */
+class DeviceMemoryAllocator {
+public:
+    static constexpr VkDeviceSize DEFAULT_BLOCK_SIZE = 256ull << 20;
+
+    struct Functions {
+        PFN_vkAllocateMemory allocate_memory;
+        PFN_vkFreeMemory free_memory;
+        PFN_vkMapMemory map_memory;
+    };
+
+    DeviceMemoryAllocator(VkDevice device,
+                          const VkPhysicalDeviceMemoryProperties& properties,
+                          const VkPhysicalDeviceLimits& limits,
+                          const Functions& functions,
+                          VkDeviceSize block_size = DEFAULT_BLOCK_SIZE);
+
+    /**
+     * @brief dtor, frees every block. Allocations still in use are
+     *        invalidated.
+     */
+    ~DeviceMemoryAllocator();
+
+    DeviceMemoryAllocator(const DeviceMemoryAllocator&) = delete;
+    DeviceMemoryAllocator& operator=(const DeviceMemoryAllocator&) = delete;
+
+    /**
+     * @brief Allocates memory for a resource.
+     *
+     * @param[in] requirements From vkGet{Buffer,Image}MemoryRequirements.
+     * @param[in] properties Flags the memory type must have, tried in the
+     *                       order the device lists the types.
+     *
+     * @return An empty allocation if no matching memory type has room.
+     */
+    MemoryAllocation allocate(const VkMemoryRequirements& requirements,
+                              VkMemoryPropertyFlags properties,
+                              ResourceTiling tiling);
+
+    /**
+     * @brief Allocates memory for a resource from the memory types
+     *        \ref rankMemoryTypes gives for \p usage, falling back to the
+     *        next one while a type is out of memory.
+     *
+     * Check property_flags of the result: e.g. UPLOAD memory that is not
+     * DEVICE_LOCAL needs a staging copy, and memory that is not
+     * HOST_COHERENT needs vkFlushMappedMemoryRanges.
+     */
+    MemoryAllocation allocate(const VkMemoryRequirements& requirements,
+                              MemoryUsage usage,
+                              ResourceTiling tiling);
+
+    /**
+     * @brief Returns an allocation. Empty allocations are ignored.
+     */
+    void free(const MemoryAllocation& allocation);
+
+    MemoryStats stats() const;
+
+    const VkPhysicalDeviceMemoryProperties& memoryProperties() const;
+
+private:
+    struct Block {
+        VkDeviceMemory memory;
+        VkDeviceSize size;
+        std::uint32_t memory_type;
+        void* mapped;
+        std::unique_ptr<TlsfAllocator> placement;  ///< Null if dedicated.
+    };
+
+    MemoryAllocation allocateFromTypes(
+            const VkMemoryRequirements& requirements,
+            const std::vector<std::uint32_t>& memory_types,
+            ResourceTiling tiling);
+    std::optional<MemoryAllocation> allocateFromType(
+            std::uint32_t memory_type,
+            VkDeviceSize size,
+            VkDeviceSize alignment);
+    Block* allocateBlock(std::uint32_t memory_type,
+                         VkDeviceSize size,
+                         bool dedicated);
+    void freeBlock(Block* block);
+
+    VkDevice m_device;
+    VkPhysicalDeviceMemoryProperties m_properties;
+    VkDeviceSize m_buffer_image_granularity;
+    VkDeviceSize m_non_coherent_atom_size;
+    Functions m_functions;
+    VkDeviceSize m_block_size;
+    std::array<std::vector<std::uint32_t>, 4> m_usage_memory_types;
+    mutable std::mutex m_mutex;
+    std::array<std::vector<std::unique_ptr<Block>>, VK_MAX_MEMORY_TYPES>
+            m_blocks;
+};
+}  // namespace intel_vulkan::Tools
+
+#endif  // INTEL_VULKAN_DEVICEMEMORYALLOCATOR_H
@@ -0,0 +1,132 @@
+////////////////////////////////////////////////////////////////////////////
+// Copyright (c) 2026 intel_vulkan
+// All rights reserved.
+//
+// Contact: mehoggan@gmail.com
+//
+// This software is licensed under the terms of the Your License.
+// See the LICENSE file in the top-level directory.
+/////////////////////////////////////////////////////////////////////////
+#ifndef INTEL_VULKAN_IMAGECACHE_H
+#define INTEL_VULKAN_IMAGECACHE_H
+
+#include "intel_vulkan/Tools.h"
+
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <optional>
+#include <span>
+#include <string>
+
+namespace intel_vulkan::Tools {
+/**
+ * @brief An on-disk cache of decoded images that processes can share.
+ *
+ * Each entry is keyed on three things: the source file's path, its size
+ * and modification time, and the requested component count. An entry
+ * holds the tightly packed pixels behind a small header, so a hit costs a
+ * stat and a mapping instead of a decode.
+ *
+ * Entries are written to a temporary file and renamed into place. Other
+ * processes therefore see either no entry or a complete one. Deleting an
+ * entry does not affect mappings that are still open.
+ *
+ * Once the cache grows past its size cap, the least recently used entries
+ * are deleted. A hit counts as a use. The directory is only scanned for
+ * that on the first store and whenever the running total of the entries
+ * found then and stored since passes the cap, so entries other processes
+ * add are only noticed by the next scan.
+ *
+ * Install a cache with \ref ImageCache::setGlobal to make both
+ * \ref getImageData overloads consult it.
+ */
+class ImageCache {
+public:
+    /**
+     * @brief A cache hit, the pixels stay mapped while it is alive.
+     */
+    struct Image {
+        MappedFile file;
+        int width;
+        int height;
+        int components;  ///< The number of components in the source file.
+        std::span<const char> pixels;  ///< Tightly packed rows.
+    };
+
+    static constexpr std::size_t DEFAULT_MAX_SIZE = 1024 * 1024 * 1024;
+
+    /**
+     * @brief ctor, keeps entries in \p directory, which is created by the
+     *        first store.
+     *
+     * @param[in] directory The cache directory, one per cache.
+     * @param[in] max_size The bytes of entries kept before the least
+     *                     recently used ones are deleted.
+     */
+    explicit ImageCache(std::string directory,
+                        std::size_t max_size = DEFAULT_MAX_SIZE);
+
+    /**
+     * @brief Looks up the pixels of \p filename decoded with
+     *        \p requested_components.
+     *
+     * @return The mapped entry, nothing if there is none or \p filename
+     *         changed since it was stored.
+     */
+    std::optional<Image> find(std::string const& filename,
+                              int requested_components) const;
+
+    /**
+     * @brief Stores the decoded pixels of \p filename, replacing any entry
+     *        for it, and evicts entries if the cache is over its cap.
+     *
+     * @param[in] pixels The rows, \p row_pitch bytes apart.
+     * @param[in] channels The number of bytes per pixel in \p pixels.
+     *
+     * @return true if the entry was written.
+     */
+    bool store(std::string const& filename,
+               int requested_components,
+               int width,
+               int height,
+               int components,
+               int channels,
+               const void* pixels,
+               std::size_t row_pitch);
+
+    /**
+     * @brief Deletes the least recently used entries until the cache fits
+     *        its cap, and temporary files left behind by crashed writers.
+     *
+     * Restarts the running total from what is left.
+     */
+    void trim() const;
+
+    /**
+     * @brief Deletes every entry.
+     */
+    void clear() const;
+
+    const std::string& directory() const { return m_directory; }
+    std::size_t maxSize() const { return m_max_size; }
+
+    /**
+     * @brief Installs the cache \ref getImageData consults, nullptr to
+     *        decode every image again.
+     */
+    static void setGlobal(std::shared_ptr<ImageCache> cache);
+    static std::shared_ptr<ImageCache> global();
+
+private:
+    std::string m_directory;
+    std::size_t m_max_size;
+    mutable std::mutex m_size_mutex;
+    mutable std::optional<std::uint64_t> m_size;  ///< Unknown until a trim.
+
+    static std::mutex s_global_mutex;
+    static std::shared_ptr<ImageCache> s_global;
+};
+}  // namespace intel_vulkan::Tools
+#endif
@@ -0,0 +1,172 @@
+////////////////////////////////////////////////////////////////////////////
+// Copyright (c) 2026 intel_vulkan
+// All rights reserved.
+//
+// Contact: mehoggan@gmail.com
+//
+// This software is licensed under the terms of the Your License.
+// See the LICENSE file in the top-level directory.
+/////////////////////////////////////////////////////////////////////////
+#ifndef INTEL_VULKAN_IMAGELOADER_H
+#define INTEL_VULKAN_IMAGELOADER_H
+
+#include <condition_variable>
+#include <cstddef>
+#include <deque>
+#include <functional>
+#include <future>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+
+namespace intel_vulkan::Tools {
+/**
+ * @brief An image decoded by \ref ImageLoader.
+ */
+struct LoadedImage {
+    std::string path;
+    bool loaded = false;  ///< false if the file could not be decoded.
+    /// true if the loader was destroyed before the image was decoded.
+    bool cancelled = false;
+    int width = 0;
+    int height = 0;
+    int components = 0;  ///< The number of components in the file.
+    std::vector<char> data;
+
+    /// Returns the image's bytes to the loader's budget when the last copy
+    /// of the image is destroyed or \ref LoadedImage::release is called.
+    std::shared_ptr<void> reservation;
+
+    /**
+     * @brief Frees the pixels and returns their bytes to the budget, e.g.
+     *        once they were copied to a staging buffer.
+     */
+    void release() {
+        std::vector<char>().swap(data);
+        reservation.reset();
+    }
+};
+
+/**
+ * @brief Decodes batches of images concurrently on a pool of worker
+ *        threads.
+ *
+ * Each worker reads the dimensions of its next image first and waits until
+ * the decoded size fits into the in-flight budget before decoding it.
+ * Images are let in strictly in the order they were queued, so a caller
+ * waiting on the futures in order cannot be blocked by a later image. An
+ * image counts against the budget until its \ref LoadedImage is destroyed
+ * or released, so callers that keep every image of a batch alive need a
+ * budget large enough for all of them. An image larger than the whole
+ * budget is decoded once nothing else is in flight.
+ */
+class ImageLoader {
+public:
+    using Callback = std::function<void(LoadedImage&& image)>;
+
+    /**
+     * @brief ctor, starts the workers.
+     *
+     * @param[in] thread_count The number of workers, 0 for one per core.
+     * @param[in] max_in_flight_bytes The budget of decoded bytes.
+     */
+    explicit ImageLoader(std::size_t thread_count = 0,
+                         std::size_t max_in_flight_bytes = 256 * 1024 * 1024);
+
+    /**
+     * @brief dtor, stops the workers.
+     *
+     * Images already being decoded are finished. Those still queued or
+     * waiting for the budget are delivered with
+     * \ref LoadedImage::cancelled set, so destroying the loader does not
+     * wait for the caller to release images it still holds.
+     */
+    ~ImageLoader();
+
+    /**
+     * @brief Queues \p paths for decoding.
+     *
+     * @param[in] paths The images to decode.
+     * @param[in] requested_components Passed on to \ref getImageData.
+     *
+     * @return A future per path, in the order of \p paths.
+     */
+    std::vector<std::future<LoadedImage>> load(
+            const std::vector<std::string>& paths,
+            int requested_components);
+
+    /**
+     * @brief Queues \p paths for decoding and calls \p on_loaded from a
+     *        worker thread as each image is done, in completion order.
+     *
+     * The image's bytes return to the budget when \p on_loaded returns
+     * unless it moves the image elsewhere.
+     */
+    void load(const std::vector<std::string>& paths,
+              int requested_components,
+              Callback on_loaded);
+
+    /**
+     * @brief Blocks until every queued image has been delivered.
+     */
+    void wait();
+
+    /**
+     * @return The number of worker threads.
+     */
+    std::size_t threadCount() const;
+
+private:
+    struct Job {
+        std::size_t ticket;
+        std::string path;
+        int requested_components;
+        std::shared_ptr<std::promise<LoadedImage>> promise;
+        Callback on_loaded;
+    };
+
+    struct Budget {
+        explicit Budget(std::size_t max_bytes)
+                : max_bytes(max_bytes)
+                , in_flight_bytes(0)
+                , next_ticket(0)
+                , stopping(false) {}
+
+        // Waits for \p ticket's turn and for \p bytes to fit. Returns false
+        // without reserving anything once \ref stop has been called.
+        bool acquire(std::size_t ticket, std::size_t bytes);
+        void release(std::size_t bytes);
+        // Wakes every waiting acquire and makes it and later ones fail.
+        void stop();
+        bool stopped();
+
+        const std::size_t max_bytes;
+        std::size_t in_flight_bytes;
+        std::size_t next_ticket;
+        bool stopping;
+        std::mutex mutex;
+        std::condition_variable released;
+    };
+
+    void enqueue(Job&& job);
+    void workerLoop();
+    LoadedImage decode(const Job& job);
+
+    std::shared_ptr<Budget> m_budget;
+    std::deque<Job> m_jobs;
+    std::size_t m_next_ticket;
+    std::size_t m_pending;
+    bool m_running;
+    std::mutex m_mutex;
+    std::condition_variable m_job_ready;
+    std::condition_variable m_idle;
+    std::vector<std::thread> m_workers;
+
+private:
+    ImageLoader(const ImageLoader& other) = delete;
+    ImageLoader& operator=(const ImageLoader& rhs) = delete;
+};
+}  // namespace intel_vulkan::Tools
+#endif
@@ -167,4 +167,7 @@ VK_DEVICE_LEVEL_FUNCTION(vkDestroyDescriptorSetLayout)
 VK_DEVICE_LEVEL_FUNCTION(vkDestroySampler)
 VK_DEVICE_LEVEL_FUNCTION(vkDestroyImage)
 
+// Deferred deletion
+VK_DEVICE_LEVEL_FUNCTION(vkGetFenceStatus)
+
 #undef VK_DEVICE_LEVEL_FUNCTION
@@ -0,0 +1,174 @@
+////////////////////////////////////////////////////////////////////////////
+// Copyright (c) 2026 intel_vulkan
+// All rights reserved.
+//
+// Contact: mehoggan@gmail.com
+//
+// This software is licensed under the terms of the Your License.
+// See the LICENSE file in the top-level directory.
+/////////////////////////////////////////////////////////////////////////
+#ifndef INTEL_VULKAN_LOGRINGBUFFER_HPP
+#define INTEL_VULKAN_LOGRINGBUFFER_HPP
+
+#include <atomic>
+#include <cstddef>
+#include <memory>
+#include <utility>
+
+namespace intel_vulkan {
+/**
+ * @brief A bounded, lock-free queue used to hand log records between
+ *        threads.
+ *
+ * The queue is a fixed size ring of cells, each carrying a sequence number
+ * that tells producers and consumers whether the cell is free to write or
+ * ready to read. Any number of threads may push and pop concurrently, which
+ * lets a producer discard the oldest record itself when the ring is full.
+ *
+ * @tparam T The record type stored in the ring. Must be default and move
+ *           constructible.
+ */
+template <typename T> class LogRingBuffer {
+public:
+    /**
+     * @brief ctor
+     *
+     * @param[in] capacity The number of records the ring can hold. Rounded
+     *                     up to the next power of two.
+     */
+    explicit LogRingBuffer(std::size_t capacity)
+            : m_mask(roundUpToPowerOfTwo(capacity) - 1)
+            , m_cells(new Cell[m_mask + 1])
+            , m_enqueue_pos(0)
+            , m_dequeue_pos(0) {
+        for (std::size_t index = 0; index <= m_mask; ++index) {
+            m_cells[index].sequence.store(index, std::memory_order_relaxed);
+        }
+    }
+
+    /**
+     * @brief Attempts to push \p value into the ring.
+     *
+     * @param[in] value The record to move into the ring.
+     *
+     * @return true if \p value was stored, false if the ring is full in
+     *         which case \p value is left untouched.
+     */
+    bool tryPush(T& value) {
+        return tryPushWith([&value](T& cell) { cell = std::move(value); });
+    }
+
+    /**
+     * @brief Attempts to claim a free cell and fill it in place.
+     *
+     * Lets the caller assign into the record already living in the cell so
+     * buffers owned by the record are reused instead of reallocated.
+     *
+     * @param[in] fill Called with the claimed cell's record.
+     *
+     * @return true if a cell was filled, false if the ring is full in
+     *         which case \p fill is not called.
+     */
+    template <typename F> bool tryPushWith(F&& fill) {
+        std::size_t pos = m_enqueue_pos.load(std::memory_order_relaxed);
+        for (;;) {
+            Cell& cell = m_cells[pos & m_mask];
+            std::size_t seq = cell.sequence.load(std::memory_order_acquire);
+            std::ptrdiff_t diff = static_cast<std::ptrdiff_t>(seq) -
+                                  static_cast<std::ptrdiff_t>(pos);
+            if (diff == 0) {
+                if (m_enqueue_pos.compare_exchange_weak(
+                            pos, pos + 1, std::memory_order_relaxed)) {
+                    fill(cell.value);
+                    cell.sequence.store(pos + 1, std::memory_order_release);
+                    return true;
+                }
+            } else if (diff < 0) {
+                return false;
+            } else {
+                pos = m_enqueue_pos.load(std::memory_order_relaxed);
+            }
+        }
+    }
+
+    /**
+     * @brief Attempts to pop the oldest record from the ring.
+     *
+     * @param[out] value Receives the popped record.
+     *
+     * @return true if a record was popped, false if the ring is empty.
+     */
+    bool tryPop(T& value) {
+        return tryPopWith([&value](T& cell) { value = std::move(cell); });
+    }
+
+    /**
+     * @brief Attempts to consume the oldest record in place.
+     *
+     * The cell is handed back to producers only once \p consume returns,
+     * and the record keeps whatever buffers it owns for the next push.
+     *
+     * @param[in] consume Called with the oldest record.
+     *
+     * @return true if a record was consumed, false if the ring is empty in
+     *         which case \p consume is not called.
+     */
+    template <typename F> bool tryPopWith(F&& consume) {
+        std::size_t pos = m_dequeue_pos.load(std::memory_order_relaxed);
+        for (;;) {
+            Cell& cell = m_cells[pos & m_mask];
+            std::size_t seq = cell.sequence.load(std::memory_order_acquire);
+            std::ptrdiff_t diff = static_cast<std::ptrdiff_t>(seq) -
+                                  static_cast<std::ptrdiff_t>(pos + 1);
+            if (diff == 0) {
+                if (m_dequeue_pos.compare_exchange_weak(
+                            pos, pos + 1, std::memory_order_relaxed)) {
+                    consume(cell.value);
+                    cell.sequence.store(pos + m_mask + 1,
+                                        std::memory_order_release);
+                    return true;
+                }
+            } else if (diff < 0) {
+                return false;
+            } else {
+                pos = m_dequeue_pos.load(std::memory_order_relaxed);
+            }
+        }
+    }
+
+    /**
+     * @brief A getter for the number of records the ring can hold.
+     *
+     * @return The capacity after rounding to a power of two.
+     */
+    std::size_t capacity() const { return m_mask + 1; }
+
+private:
+    static std::size_t roundUpToPowerOfTwo(std::size_t value) {
+        std::size_t ret_val = 2;
+        while (ret_val < value) {
+            ret_val <<= 1;
+        }
+        return ret_val;
+    }
+
+    struct Cell {
+        std::atomic<std::size_t> sequence;
+        T value;
+    };
+
+    // Keep the producer and consumer cursors on separate cache lines so
+    // the render threads and the writer thread do not false share.
+    static constexpr std::size_t CACHE_LINE = 64;
+
+    const std::size_t m_mask;
+    std::unique_ptr<Cell[]> m_cells;
+    alignas(CACHE_LINE) std::atomic<std::size_t> m_enqueue_pos;
+    alignas(CACHE_LINE) std::atomic<std::size_t> m_dequeue_pos;
+
+private:
+    LogRingBuffer(const LogRingBuffer& other) = delete;
+    LogRingBuffer& operator=(const LogRingBuffer& rhs) = delete;
+};
+}  // namespace intel_vulkan
+#endif
@@ -11,14 +11,13 @@
 #ifndef INTEL_VULKAN_LOGGERHELPERS_H
 #define INTEL_VULKAN_LOGGERHELPERS_H
 
+#include "intel_vulkan/LoggerStdHelpers.h"
+
 #include <sstream>
 #include <vector>
 
 #include <vulkan/vulkan.h>
 
-std::stringstream& operator<<(std::stringstream& out,
-                              const std::vector<const char*>& vect);
-
 std::stringstream& operator<<(std::stringstream& out,
                               const VkLayerProperties& vk_layer_properties);
 
@@ -0,0 +1,20 @@
+////////////////////////////////////////////////////////////////////////////
+// Copyright (c) 2026 intel_vulkan
+// All rights reserved.
+//
+// Contact: mehoggan@gmail.com
+//
+// This software is licensed under the terms of the Your License.
+// See the LICENSE file in the top-level directory.
+/////////////////////////////////////////////////////////////////////////
+
+#ifndef INTEL_VULKAN_LOGGERSTDHELPERS_H
+#define INTEL_VULKAN_LOGGERSTDHELPERS_H
+
+#include <sstream>
+#include <vector>
+
+std::stringstream& operator<<(std::stringstream& out,
+                              const std::vector<const char*>& vect);
+
+#endif
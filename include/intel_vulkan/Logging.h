@@ -13,7 +13,9 @@
 
 #define BOOST_LOG_DYN_LINK 1
 
+#include "intel_vulkan/BinaryLog.h"
 #include "intel_vulkan/LoggerHelpers.h"
+#include "intel_vulkan/RotatingFileBackend.h"
 
 #include <gtest/gtest_prod.h>
 
@@ -21,12 +23,18 @@
 #include <boost/log/sinks/sync_frontend.hpp>
 #include <boost/log/sinks/text_ostream_backend.hpp>
 #include <boost/log/trivial.hpp>
+#include <boost/shared_ptr.hpp>
 #include <boost/weak_ptr.hpp>
 
 #include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <memory>
 #include <mutex>
 #include <sstream>
 #include <string>
+#include <string_view>
 #include <unordered_map>
 
 #define INTEL_VULKAN_TRACE boost::log::trivial::severity_level::trace
@@ -36,14 +44,37 @@
 #define INTEL_VULKAN_ERROR boost::log::trivial::severity_level::error
 #define INTEL_VULKAN_FATAL boost::log::trivial::severity_level::fatal
 
+// Calls below this level are compiled out of \ref intel_vulkan::Logging.
+// Release builds can raise it, e.g. with ./configure --with-min-log-level.
+// Calls made through the INTEL_VULKAN_LOG_* macros below are removed
+// entirely, arguments included. Direct calls to the level functions only
+// lose their formatting and sinks: their arguments are still evaluated.
+#ifndef INTEL_VULKAN_MIN_LOG_LEVEL
+#define INTEL_VULKAN_MIN_LOG_LEVEL INTEL_VULKAN_TRACE
+#endif
+
 namespace intel_vulkan {
 /**
  * @brief A class used to uniquely identify a specific log.
  *
- * A generic class used to identify a specific log and its source.
+ * A generic class used to identify a specific log and its source. Tag
+ * strings are interned into a process wide table when a \ref LogTag is
+ * created, so copies are cheap and comparing, hashing and looking up a
+ * \ref LogTag only ever touches its integer id.
+ *
+ * The table only grows: a string stays interned for the rest of the run,
+ * so build tags once per source rather than per message. Only the first
+ * 4194304 distinct tags can be routed to a sink. The add*Logger functions
+ * return false for later ones, and crossing the limit is reported once on
+ * std::cerr.
  */
 struct LogTag {
 public:
+    /**
+     * @brief ctor for the empty \ref LogTag, which always has id 0.
+     */
+    LogTag();
+
     /**
      * @brief ctor for a \ref LogTag.
      *
@@ -60,7 +91,24 @@ public:
      *
      * @return A null terminated string representation of \ref LogTag.
      */
-    const char* tag() const;
+    const char* tag() const { return tag_; }
+
+    /**
+     * @brief A getter for the interned id of the \ref LogTag.
+     *
+     * Ids are handed out densely from 0 in order of first use, so they can
+     * be used to index tables.
+     *
+     * @return The id shared by every \ref LogTag with the same string.
+     */
+    std::uint32_t id() const { return id_; }
+
+    /**
+     * @brief A getter for the hash of the tag string.
+     *
+     * @return The hash computed once when the string was interned.
+     */
+    std::size_t hash() const { return hash_; }
 
     /**
      * @brief A utility output operator.
@@ -100,23 +148,35 @@ public:
      * @return true if \p lhs tag_ is a string equivalent to \p rhs tag_.
      */
     friend bool operator==(const LogTag& lhs, const LogTag& rhs) {
-        return lhs.tag() == rhs.tag();
+        return lhs.id() == rhs.id();
     }
 
 private:
-    std::string tag_;
+    const char* tag_;
+    std::uint32_t id_;
+    std::size_t hash_;
 };
 }  // namespace intel_vulkan
 
 namespace std {
 template <> struct hash<intel_vulkan::LogTag> {
     size_t operator()(const intel_vulkan::LogTag& obj) const {
-        return hash<std::string>{}(obj.tag());
+        return obj.hash();
     }
 };
 }  // namespace std
 
 namespace intel_vulkan {
+/**
+ * @brief What an asynchronous \ref Logging call does when the record queue
+ *        is full.
+ */
+enum class LogOverflowPolicy {
+    BLOCK,        ///< Wait for the writer thread to make room.
+    DROP_OLDEST,  ///< Discard the oldest queued record to make room.
+    DROP_NEWEST   ///< Discard the record being logged.
+};
+
 /**
  * @brief A class used to log to various sinks or sources.based on a tag.
  *
@@ -138,11 +198,119 @@ private:
         logStringBuilder(sstream, args...);
     }
 
+    static bool appendFormatPrefix(std::stringstream& sstream,
+                                   std::string_view& format);
+
+    static void formatBuilder(std::stringstream& sstream,
+                              std::string_view format) {
+        // Placeholders without a matching argument are kept verbatim.
+        while (appendFormatPrefix(sstream, format)) {
+            sstream << "{}";
+        }
+    }
+
+    template <typename T, typename... Ts>
+    static void formatBuilder(std::stringstream& sstream,
+                              std::string_view format,
+                              T&& arg,
+                              Ts&&... args) {
+        if (appendFormatPrefix(sstream, format)) {
+            sstream << std::forward<T>(arg);
+            formatBuilder(sstream, format, args...);
+        }
+    }
+
+    /**
+     * @brief RAII access to the calling thread's reusable format stream.
+     *
+     * The stream is cleared on acquisition but keeps its capacity, so
+     * formatting a message does not allocate once the buffer has grown to
+     * the size of the longest message. A nested acquisition, e.g. from an
+     * operator<< that logs, gets a private stream instead.
+     */
+    class ThreadStream {
+    public:
+        ThreadStream();
+        ~ThreadStream();
+
+        std::stringstream& get() { return *m_stream; }
+
+    private:
+        std::stringstream* m_stream;
+        std::unique_ptr<std::stringstream> m_nested;
+
+        ThreadStream(const ThreadStream& other) = delete;
+        ThreadStream& operator=(const ThreadStream& rhs) = delete;
+    };
+
+    // Bits returned by Logging::routesFor.
+    static constexpr std::uint8_t TEXT_ROUTE = 1;
+    static constexpr std::uint8_t BINARY_ROUTE = 2;
+    static constexpr std::uint8_t RECORDER_ROUTE = 4;
+
+    // Binary sinks store the arguments raw, so they are encoded without
+    // ever being formatted. Stream style calls are stored against a format
+    // of space separated placeholders.
+    template <typename... Ts>
+    static void writeBinaryArgs(const LogTag& tag,
+                                boost::log::trivial::severity_level level,
+                                std::uint8_t routes,
+                                std::string_view format,
+                                Ts&&... args) {
+        BinaryLogArgs binary_args;
+        (binary_args.append(args), ...);
+        writeBinaryLog(tag, level, routes, format, binary_args);
+    }
+
+    template <boost::log::trivial::severity_level LEVEL, typename... Ts>
+    static void logAtLevel(const LogTag& tag, Ts&&... args) {
+        if constexpr (LEVEL >= INTEL_VULKAN_MIN_LOG_LEVEL) {
+            if (LEVEL < s_min_level.load(std::memory_order_relaxed)) {
+                return;
+            }
+            std::uint8_t routes = Logging::routesFor(tag, LEVEL);
+            if (routes & (BINARY_ROUTE | RECORDER_ROUTE)) {
+                writeBinaryArgs(tag,
+                                LEVEL,
+                                routes,
+                                streamFormat(sizeof...(Ts)),
+                                args...);
+            }
+            if (routes & TEXT_ROUTE) {
+                ThreadStream stream;
+                Logging::logStringBuilder(stream.get(), args...);
+                writeSeverityLog(tag, LEVEL, stream.get().view());
+            }
+        }
+    }
+
+    template <boost::log::trivial::severity_level LEVEL, typename... Ts>
+    static void formatAtLevel(const LogTag& tag,
+                              std::string_view format,
+                              Ts&&... args) {
+        if constexpr (LEVEL >= INTEL_VULKAN_MIN_LOG_LEVEL) {
+            if (LEVEL < s_min_level.load(std::memory_order_relaxed)) {
+                return;
+            }
+            std::uint8_t routes = Logging::routesFor(tag, LEVEL);
+            if (routes & (BINARY_ROUTE | RECORDER_ROUTE)) {
+                writeBinaryArgs(tag, LEVEL, routes, format, args...);
+            }
+            if (routes & TEXT_ROUTE) {
+                ThreadStream stream;
+                Logging::formatBuilder(stream.get(), format, args...);
+                writeSeverityLog(tag, LEVEL, stream.get().view());
+            }
+        }
+    }
+
 public:
     typedef boost::log::sinks::synchronous_sink<
             boost::log::sinks::text_ostream_backend>
             TextSink;
-    typedef std::unordered_map<LogTag, boost::weak_ptr<TextSink>> Dict;
+    typedef boost::log::sinks::synchronous_sink<RotatingFileBackend> FileSink;
+    typedef std::unordered_map<LogTag, boost::weak_ptr<boost::log::sinks::sink>>
+            Dict;
 
     /**
      * @brief Used to create a stdout source tied to a \ref LogTag.
@@ -193,19 +361,54 @@ public:
     /**
      * @brief Used to create a file source tied to a \ref LogTag.
      *
-     * A static function used to create a file source tied to a tag.
+     * A static function used to create a file source tied to a tag. The
+     * file is written in large blocks, synced on an interval and whenever
+     * an error is logged, and rotated by size; see \ref FileLogOptions.
+     * \ref Logging::flush writes out whatever is still buffered.
      *
      * @param[in] tag The \ref LogTag used to identify logs going to
                       a specific file stream.
      * @param[in] log_path The path to the file to log to.
      * @param[in] level A filter for a give sink and the \ref tag.
+     * @param[in] options How the file is buffered, synced and rotated.
+     *                    Only used when the file is first opened.
      *
-     * @return
+     * @return true if \p tag was not already added to logger and the file
+     *         could be opened, false otherwise.
      */
     static bool addFileLogger(
             const LogTag& tag,
             const boost::filesystem::path& log_path,
-            boost::log::trivial::severity_level level = INTEL_VULKAN_INFO);
+            boost::log::trivial::severity_level level = INTEL_VULKAN_INFO,
+            const FileLogOptions& options = FileLogOptions());
+
+    /**
+     * @brief Used to create a binary file source tied to a \ref LogTag.
+     *
+     * Records routed here are not formatted. Each one is copied into a
+     * memory-mapped ring of fixed size records holding a nanosecond time
+     * stamp, the tag id, the severity, the id of the format string and the
+     * raw argument bytes. Once the ring is full the oldest records are
+     * overwritten. Decode the file with the intel_vulkan_logdump tool.
+     *
+     * A tag may be routed to one binary file in addition to the sink added
+     * by the other add*Logger functions.
+     *
+     * @param[in] tag The \ref LogTag used to identify logs going to
+     *                the binary file.
+     * @param[in] log_path The path to the file to log to.
+     * @param[in] level A filter for a give sink and the \ref tag.
+     * @param[in] record_capacity The number of records kept in the file.
+     *                            Only used when the file is first opened.
+     *
+     * @return true if \p tag was not already added to a binary file, false
+     *         otherwise.
+     */
+    static bool addBinaryFileLogger(
+            const LogTag& tag,
+            const boost::filesystem::path& log_path,
+            boost::log::trivial::severity_level level = INTEL_VULKAN_TRACE,
+            std::size_t record_capacity = 65536);
 
     /**
      * @brief A utility function used to generate a log tag for a specific
@@ -259,9 +462,7 @@ public:
      */
     template <typename... Ts>
     static void trace(const LogTag& tag, Ts&&... args) {
-        std::stringstream sstream;
-        Logging::logStringBuilder(sstream, args...);
-        writeSeverityLog(tag, INTEL_VULKAN_TRACE, sstream.str());
+        logAtLevel<INTEL_VULKAN_TRACE>(tag, std::forward<Ts>(args)...);
     }
 
     /**
@@ -280,9 +481,7 @@ public:
      */
     template <typename... Ts>
     static void debug(const LogTag& tag, Ts&&... args) {
-        std::stringstream sstream;
-        Logging::logStringBuilder(sstream, args...);
-        writeSeverityLog(tag, INTEL_VULKAN_DEBUG, sstream.str());
+        logAtLevel<INTEL_VULKAN_DEBUG>(tag, std::forward<Ts>(args)...);
     }
 
     /**
@@ -301,9 +500,7 @@ public:
      */
     template <typename... Ts>
     static void info(const LogTag& tag, Ts&&... args) {
-        std::stringstream sstream;
-        Logging::logStringBuilder(sstream, args...);
-        writeSeverityLog(tag, INTEL_VULKAN_INFO, sstream.str());
+        logAtLevel<INTEL_VULKAN_INFO>(tag, std::forward<Ts>(args)...);
     }
 
     /**
@@ -322,9 +519,7 @@ public:
      */
     template <typename... Ts>
     static void warn(const LogTag& tag, Ts&&... args) {
-        std::stringstream sstream;
-        Logging::logStringBuilder(sstream, args...);
-        writeSeverityLog(tag, INTEL_VULKAN_WARN, sstream.str());
+        logAtLevel<INTEL_VULKAN_WARN>(tag, std::forward<Ts>(args)...);
     }
 
     /**
@@ -343,9 +538,7 @@ public:
      */
     template <typename... Ts>
     static void error(const LogTag& tag, Ts&&... args) {
-        std::stringstream sstream;
-        Logging::logStringBuilder(sstream, args...);
-        writeSeverityLog(tag, INTEL_VULKAN_ERROR, sstream.str());
+        logAtLevel<INTEL_VULKAN_ERROR>(tag, std::forward<Ts>(args)...);
     }
 
     /**
@@ -364,22 +557,246 @@ public:
      */
     template <typename... Ts>
     static void fatal(const LogTag& tag, Ts&&... args) {
-        std::stringstream sstream;
-        Logging::logStringBuilder(sstream, args...);
-        writeSeverityLog(tag, INTEL_VULKAN_FATAL, sstream.str());
+        logAtLevel<INTEL_VULKAN_FATAL>(tag, std::forward<Ts>(args)...);
+    }
+
+    /**
+     * @brief Logs at the \ref INTEL_VULKAN_TRACE level using a format
+     *        string.
+     *
+     * Each "{}" in \p format is replaced by the next argument written to
+     * a \ref std::ostream, "{{" and "}}" produce literal braces. The
+     * message is built in a per-thread buffer that is reused between calls.
+     *
+     * @tparam ...Ts A list of mixed types which all must have support for
+     *               writing to a string stream.
+     * @param[in] tag A \ref LogTag used in filtering.
+     * @param[in] format The message with a "{}" for each of \p args.
+     * @param[in] args The values substituted into \p format.
+     */
+    template <typename... Ts>
+    static void tracef(const LogTag& tag,
+                       std::string_view format,
+                       Ts&&... args) {
+        formatAtLevel<INTEL_VULKAN_TRACE>(
+                tag, format, std::forward<Ts>(args)...);
+    }
+
+    /**
+     * @brief Logs at the \ref INTEL_VULKAN_DEBUG level using a format
+     *        string.
+     *
+     * @see Logging::tracef
+     */
+    template <typename... Ts>
+    static void debugf(const LogTag& tag,
+                       std::string_view format,
+                       Ts&&... args) {
+        formatAtLevel<INTEL_VULKAN_DEBUG>(
+                tag, format, std::forward<Ts>(args)...);
+    }
+
+    /**
+     * @brief Logs at the \ref INTEL_VULKAN_INFO level using a format
+     *        string.
+     *
+     * @see Logging::tracef
+     */
+    template <typename... Ts>
+    static void infof(const LogTag& tag,
+                      std::string_view format,
+                      Ts&&... args) {
+        formatAtLevel<INTEL_VULKAN_INFO>(
+                tag, format, std::forward<Ts>(args)...);
+    }
+
+    /**
+     * @brief Logs at the \ref INTEL_VULKAN_WARN level using a format
+     *        string.
+     *
+     * @see Logging::tracef
+     */
+    template <typename... Ts>
+    static void warnf(const LogTag& tag,
+                      std::string_view format,
+                      Ts&&... args) {
+        formatAtLevel<INTEL_VULKAN_WARN>(
+                tag, format, std::forward<Ts>(args)...);
+    }
+
+    /**
+     * @brief Logs at the \ref INTEL_VULKAN_ERROR level using a format
+     *        string.
+     *
+     * @see Logging::tracef
+     */
+    template <typename... Ts>
+    static void errorf(const LogTag& tag,
+                       std::string_view format,
+                       Ts&&... args) {
+        formatAtLevel<INTEL_VULKAN_ERROR>(
+                tag, format, std::forward<Ts>(args)...);
+    }
+
+    /**
+     * @brief Logs at the \ref INTEL_VULKAN_FATAL level using a format
+     *        string.
+     *
+     * @see Logging::tracef
+     */
+    template <typename... Ts>
+    static void fatalf(const LogTag& tag,
+                       std::string_view format,
+                       Ts&&... args) {
+        formatAtLevel<INTEL_VULKAN_FATAL>(
+                tag, format, std::forward<Ts>(args)...);
+    }
+
+    /**
+     * @brief Tells whether a record at \p level for \p tag would reach
+     *        any sink.
+     *
+     * Checked before any formatting happens so filtered out calls cost a
+     * relaxed atomic load in the common case where no sink wants \p level
+     * at all.
+     *
+     * @param[in] tag The \ref LogTag the record would be written with.
+     * @param[in] level The severity the record would be written at.
+     *
+     * @return true if some sink registered for \p tag accepts \p level,
+     *         false otherwise.
+     */
+    static bool isEnabled(const LogTag& tag,
+                          boost::log::trivial::severity_level level) {
+        return level >= s_min_level.load(std::memory_order_relaxed) &&
+               routesFor(tag, level) != 0;
     }
 
     /**
      * @brief Removes all sinks and clears the tags.
      *
+     * Binary files are closed, so no thread may be logging to a binary
+     * sink while this runs.
+     *
      * @return true if successful, false otherwise.
      */
     static bool clearAll();
 
+    /**
+     * @brief Switches \ref Logging into asynchronous mode.
+     *
+     * Once enabled, logging calls push their record into a bounded queue
+     * and return. A background writer thread drains the queue in batches,
+     * hands the records to the sinks and flushes the standard streams once
+     * per batch instead of once per record.
+     *
+     * @param[in] capacity The number of records the queue can hold.
+     * @param[in] policy What to do with a record when the queue is full.
+     *
+     * @return true if asynchronous mode was enabled by this call, false if
+     *         it was already enabled.
+     */
+    static bool enableAsync(
+            std::size_t capacity = 8192,
+            LogOverflowPolicy policy = LogOverflowPolicy::BLOCK);
+
+    /**
+     * @brief Drains the queue, stops the writer thread and returns to
+     *        synchronous logging.
+     *
+     * @return true if asynchronous mode was disabled by this call, false if
+     *         it was not enabled.
+     */
+    static bool disableAsync();
+
+    /**
+     * @brief Blocks until every record logged before the call has been
+     *        written, then flushes the standard streams and log files.
+     *
+     * Binary files are handed to the kernel for write back without waiting.
+     * Call this on shutdown and before any path that may not return.
+     * \ref Logging::fatal calls it on its own.
+     */
+    static void flush();
+
+    /**
+     * @brief A getter for the number of records dropped because the queue
+     *        was full.
+     *
+     * @return The number of records dropped since the last call to
+     *         \ref Logging::enableAsync.
+     */
+    static std::uint64_t asyncDroppedCount();
+
+    /**
+     * @brief Starts keeping the most recent records in memory.
+     *
+     * While enabled every record of every tag and severity, trace
+     * included, is copied into an in-memory ring in the binary record
+     * format, whether or not a sink accepts it. Nothing is written until
+     * the ring is dumped, which happens on \ref Logging::fatal, on SIGSEGV
+     * or SIGABRT, or on a call to \ref Logging::dumpFlightRecorder. Decode
+     * a dump with the intel_vulkan_logdump tool.
+     *
+     * @param[in] record_capacity The number of records kept in the ring.
+     * @param[in] dump_path Where the ring is dumped to.
+     *
+     * @return true if the recorder was enabled by this call, false if it
+     *         was already enabled or the ring could not be allocated.
+     */
+    static bool enableFlightRecorder(
+            std::size_t record_capacity = 65536,
+            const boost::filesystem::path& dump_path =
+                    "intel_vulkan_flight_recorder.bin");
+
+    /**
+     * @brief Stops the flight recorder and frees its ring without
+     *        dumping it.
+     *
+     * @return true if the recorder was disabled by this call, false if it
+     *         was not enabled.
+     */
+    static bool disableFlightRecorder();
+
+    /**
+     * @brief Writes the flight recorder's ring to a file.
+     *
+     * @param[in] dump_path Where to write the ring. When empty the path
+     *                      given to \ref Logging::enableFlightRecorder is
+     *                      used.
+     *
+     * @return true if the ring was written, false if the recorder is not
+     *         enabled or the file could not be written.
+     */
+    static bool dumpFlightRecorder(
+            const boost::filesystem::path& dump_path = {});
+
 private:
+    static std::uint8_t routesFor(const LogTag& tag,
+                                  boost::log::trivial::severity_level level);
+
+    static std::string_view streamFormat(std::size_t arg_count);
+
+    static bool addRoutedLogger(
+            const LogTag& tag,
+            const std::string& stream_key,
+            const std::function<boost::shared_ptr<boost::log::sinks::sink>(
+                    std::uint8_t)>& make_sink,
+            boost::log::trivial::severity_level level);
+
     static void writeSeverityLog(const LogTag& tag,
                                  boost::log::trivial::severity_level level,
-                                 const std::string& message);
+                                 std::string_view message);
+
+    static void writeBinaryLog(const LogTag& tag,
+                               boost::log::trivial::severity_level level,
+                               std::uint8_t routes,
+                               std::string_view format,
+                               const BinaryLogArgs& args);
+
+    static void updateMinLevel(
+            bool first_sink,
+            boost::log::trivial::severity_level sink_level);
 
 private:
     LogTag tag_;
@@ -388,6 +805,7 @@ private:
     static std::atomic<bool> s_init;
     static Dict s_loggers;
     static std::mutex s_loggers_mutex;
+    static std::atomic<boost::log::trivial::severity_level> s_min_level;
 
 private:
     FRIEND_TEST(TestLogging, testClearAll);
@@ -418,4 +836,40 @@ LogTag addStdCoutStdErrLoggerForTypeInstance(
     return log_tag;
 }
 }  // namespace intel_vulkan
+
+// Logs through the \ref intel_vulkan::Logging function named \p function
+// unless \p level is below INTEL_VULKAN_MIN_LOG_LEVEL, in which case the
+// call and its argument expressions are discarded at compile time.
+#define INTEL_VULKAN_LOG_AT(level, function, ...)                           \
+    do {                                                                   \
+        if constexpr ((level) >= INTEL_VULKAN_MIN_LOG_LEVEL) {             \
+            ::intel_vulkan::Logging::function(__VA_ARGS__);                \
+        }                                                                  \
+    } while (false)
+
+#define INTEL_VULKAN_LOG_TRACE(...)                                         \
+    INTEL_VULKAN_LOG_AT(INTEL_VULKAN_TRACE, trace, __VA_ARGS__)
+#define INTEL_VULKAN_LOG_DEBUG(...)                                         \
+    INTEL_VULKAN_LOG_AT(INTEL_VULKAN_DEBUG, debug, __VA_ARGS__)
+#define INTEL_VULKAN_LOG_INFO(...)                                          \
+    INTEL_VULKAN_LOG_AT(INTEL_VULKAN_INFO, info, __VA_ARGS__)
+#define INTEL_VULKAN_LOG_WARN(...)                                          \
+    INTEL_VULKAN_LOG_AT(INTEL_VULKAN_WARN, warn, __VA_ARGS__)
+#define INTEL_VULKAN_LOG_ERROR(...)                                         \
+    INTEL_VULKAN_LOG_AT(INTEL_VULKAN_ERROR, error, __VA_ARGS__)
+#define INTEL_VULKAN_LOG_FATAL(...)                                         \
+    INTEL_VULKAN_LOG_AT(INTEL_VULKAN_FATAL, fatal, __VA_ARGS__)
+
+#define INTEL_VULKAN_LOG_TRACEF(...)                                        \
+    INTEL_VULKAN_LOG_AT(INTEL_VULKAN_TRACE, tracef, __VA_ARGS__)
+#define INTEL_VULKAN_LOG_DEBUGF(...)                                        \
+    INTEL_VULKAN_LOG_AT(INTEL_VULKAN_DEBUG, debugf, __VA_ARGS__)
+#define INTEL_VULKAN_LOG_INFOF(...)                                         \
+    INTEL_VULKAN_LOG_AT(INTEL_VULKAN_INFO, infof, __VA_ARGS__)
+#define INTEL_VULKAN_LOG_WARNF(...)                                         \
+    INTEL_VULKAN_LOG_AT(INTEL_VULKAN_WARN, warnf, __VA_ARGS__)
+#define INTEL_VULKAN_LOG_ERRORF(...)                                        \
+    INTEL_VULKAN_LOG_AT(INTEL_VULKAN_ERROR, errorf, __VA_ARGS__)
+#define INTEL_VULKAN_LOG_FATALF(...)                                        \
+    INTEL_VULKAN_LOG_AT(INTEL_VULKAN_FATAL, fatalf, __VA_ARGS__)
 #endif
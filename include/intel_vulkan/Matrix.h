@@ -0,0 +1,552 @@
+////////////////////////////////////////////////////////////////////////////
+// Copyright (c) 2026 intel_vulkan
+// All rights reserved.
+//
+// Contact: mehoggan@gmail.com
+//
+// This software is licensed under the terms of the Your License.
+// See the LICENSE file in the top-level directory.
+/////////////////////////////////////////////////////////////////////////
+#ifndef INTEL_VULKAN_MATRIX_H
+#define INTEL_VULKAN_MATRIX_H
+
+#include "intel_vulkan/CpuFeatures.h"
+
+#include <array>
+#include <bit>
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+#include <optional>
+#include <span>
+#include <type_traits>
+
+#if defined(__SSE2__)
+#define INTEL_VULKAN_MATRIX_SSE 1
+#include <emmintrin.h>
+#endif
+
+/**
+ * @brief 4x4 matrices and 4 component vectors for transforms.
+ *
+ * Matrices are column major like GLSL and the projection helpers, so a
+ * Mat4 can be copied into a uniform buffer as is and transforms column
+ * vectors: (projection * view * model) * position.
+ *
+ * Every function is constexpr. In constant expressions the scalar kernels
+ * in \ref MatrixScalar run; otherwise single matrices use the SSE kernels
+ * in \ref MatrixSse on x86 and the batch functions pick scalar, SSE or AVX2
+ * kernels through \ref matrixIsa. All kernels do the same operations in
+ * the same order and return bit-identical results.
+ */
+namespace intel_vulkan::Tools {
+struct alignas(16) Vec4 {
+    float x = 0.0f;
+    float y = 0.0f;
+    float z = 0.0f;
+    float w = 0.0f;
+
+    constexpr bool operator==(const Vec4& rhs) const = default;
+};
+
+struct alignas(16) Mat4 {
+    std::array<Vec4, 4> columns;
+
+    static constexpr Mat4 identity() {
+        return {{{{1.0f, 0.0f, 0.0f, 0.0f},
+                  {0.0f, 1.0f, 0.0f, 0.0f},
+                  {0.0f, 0.0f, 1.0f, 0.0f},
+                  {0.0f, 0.0f, 0.0f, 1.0f}}}};
+    }
+
+    /**
+     * @brief Reads 16 floats in column major order, e.g. from
+     *        \ref getPerspectiveProjectionMatrix.
+     */
+    static constexpr Mat4 fromArray(const std::array<float, 16>& values) {
+        Mat4 matrix{};
+        for (std::size_t column = 0; column < 4; ++column) {
+            matrix.columns[column] = {values[column * 4 + 0],
+                                      values[column * 4 + 1],
+                                      values[column * 4 + 2],
+                                      values[column * 4 + 3]};
+        }
+        return matrix;
+    }
+
+    constexpr std::array<float, 16> toArray() const {
+        std::array<float, 16> values{};
+        for (std::size_t column = 0; column < 4; ++column) {
+            values[column * 4 + 0] = columns[column].x;
+            values[column * 4 + 1] = columns[column].y;
+            values[column * 4 + 2] = columns[column].z;
+            values[column * 4 + 3] = columns[column].w;
+        }
+        return values;
+    }
+
+    constexpr bool operator==(const Mat4& rhs) const = default;
+};
+
+/**
+ * @brief Vectors in structure of arrays layout for \ref transform, one
+ *        array per component.
+ */
+struct Vec4Arrays {
+    float* x;
+    float* y;
+    float* z;
+    float* w;
+};
+
+/**
+ * @brief The scalar kernels, which define the results of every other
+ *        kernel. Vec4 functions other than \ref transform use only x, y
+ *        and z.
+ */
+namespace MatrixScalar {
+constexpr Vec4 transform(const Mat4& matrix, const Vec4& vector) {
+    const std::array<Vec4, 4>& c = matrix.columns;
+    return {((c[0].x * vector.x + c[1].x * vector.y) + c[2].x * vector.z) +
+                    c[3].x * vector.w,
+            ((c[0].y * vector.x + c[1].y * vector.y) + c[2].y * vector.z) +
+                    c[3].y * vector.w,
+            ((c[0].z * vector.x + c[1].z * vector.y) + c[2].z * vector.z) +
+                    c[3].z * vector.w,
+            ((c[0].w * vector.x + c[1].w * vector.y) + c[2].w * vector.z) +
+                    c[3].w * vector.w};
+}
+
+constexpr Mat4 multiply(const Mat4& lhs, const Mat4& rhs) {
+    return {{{transform(lhs, rhs.columns[0]),
+              transform(lhs, rhs.columns[1]),
+              transform(lhs, rhs.columns[2]),
+              transform(lhs, rhs.columns[3])}}};
+}
+
+constexpr Mat4 transpose(const Mat4& matrix) {
+    const std::array<Vec4, 4>& c = matrix.columns;
+    return {{{{c[0].x, c[1].x, c[2].x, c[3].x},
+              {c[0].y, c[1].y, c[2].y, c[3].y},
+              {c[0].z, c[1].z, c[2].z, c[3].z},
+              {c[0].w, c[1].w, c[2].w, c[3].w}}}};
+}
+
+/**
+ * @brief The inverse by cofactors, with the determinant from the 2x2
+ *        minors of the first and last two columns.
+ */
+constexpr std::optional<Mat4> inverse(const Mat4& matrix) {
+    // a[r][c] is row c of column r, which makes the rows computed below
+    // the columns of the inverse.
+    float a[4][4] = {};
+    for (int r = 0; r < 4; ++r) {
+        a[r][0] = matrix.columns[r].x;
+        a[r][1] = matrix.columns[r].y;
+        a[r][2] = matrix.columns[r].z;
+        a[r][3] = matrix.columns[r].w;
+    }
+    constexpr int PAIRS[6][2] = {
+            {0, 1}, {0, 2}, {0, 3}, {1, 2}, {1, 3}, {2, 3}};
+    float s[6] = {};
+    float c[6] = {};
+    for (int pair = 0; pair < 6; ++pair) {
+        int p = PAIRS[pair][0];
+        int q = PAIRS[pair][1];
+        s[pair] = a[0][p] * a[1][q] - a[1][p] * a[0][q];
+        c[pair] = a[2][p] * a[3][q] - a[3][p] * a[2][q];
+    }
+    float determinant = ((((s[0] * c[5] - s[1] * c[4]) + s[2] * c[3]) +
+                          s[3] * c[2]) -
+                         s[4] * c[1]) +
+                        s[5] * c[0];
+    if (determinant == 0.0f) {
+        return std::nullopt;
+    }
+    float scale = 1.0f / determinant;
+
+    // Row r of the result is sign * ((x * p - y * q) + z * t) per lane, with
+    // the lanes taking x, y and z from rows 1, 0, 3, 2 of the input and p,
+    // q and t from c for the first two lanes and from s for the others.
+    constexpr int X[4] = {1, 0, 0, 0};
+    constexpr int Y[4] = {2, 2, 1, 1};
+    constexpr int Z[4] = {3, 3, 3, 2};
+    constexpr int P[4] = {5, 5, 4, 3};
+    constexpr int Q[4] = {4, 2, 2, 1};
+    constexpr int T[4] = {3, 1, 0, 0};
+    constexpr int LANE_ROWS[4] = {1, 0, 3, 2};
+    Mat4 result{};
+    for (int row = 0; row < 4; ++row) {
+        float lanes[4] = {};
+        for (int lane = 0; lane < 4; ++lane) {
+            const float* in = a[LANE_ROWS[lane]];
+            const float* minors = lane < 2 ? c : s;
+            float value = (in[X[row]] * minors[P[row]] -
+                           in[Y[row]] * minors[Q[row]]) +
+                          in[Z[row]] * minors[T[row]];
+            lanes[lane] = ((row + lane) % 2 == 0 ? value : -value) * scale;
+        }
+        result.columns[row] = {lanes[0], lanes[1], lanes[2], lanes[3]};
+    }
+    return result;
+}
+
+/**
+ * @brief The correctly rounded square root, like std::sqrt, in constant
+ *        expressions.
+ */
+constexpr float sqrt(float value) {
+    if (!(value > 0.0f) || value == std::numeric_limits<float>::infinity()) {
+        return value < 0.0f ? std::numeric_limits<float>::quiet_NaN() : value;
+    }
+    // Newton's method from above decreases monotonically to within a
+    // rounding error of the root.
+    double target = value;
+    double root = target > 1.0 ? target : 1.0;
+    for (;;) {
+        double next = 0.5 * (root + target / root);
+        if (!(next < root)) {
+            break;
+        }
+        root = next;
+    }
+    // Moves to the neighbor whose rounding interval holds the exact root.
+    // The midpoints have 25 significant bits, so double squares them
+    // exactly, and the square of one is never a float, so there are no
+    // ties.
+    float result = static_cast<float>(root);
+    std::uint32_t bits = std::bit_cast<std::uint32_t>(result);
+    double below = 0.5 * (static_cast<double>(result) +
+                          std::bit_cast<float>(bits - 1));
+    double above = 0.5 * (static_cast<double>(result) +
+                          std::bit_cast<float>(bits + 1));
+    if (target < below * below) {
+        return std::bit_cast<float>(bits - 1);
+    }
+    if (target > above * above) {
+        return std::bit_cast<float>(bits + 1);
+    }
+    return result;
+}
+
+constexpr float dot(const Vec4& lhs, const Vec4& rhs) {
+    return (lhs.x * rhs.x + lhs.y * rhs.y) + lhs.z * rhs.z;
+}
+
+constexpr Vec4 cross(const Vec4& lhs, const Vec4& rhs) {
+    return {lhs.y * rhs.z - lhs.z * rhs.y,
+            lhs.z * rhs.x - lhs.x * rhs.z,
+            lhs.x * rhs.y - lhs.y * rhs.x,
+            0.0f};
+}
+
+constexpr Vec4 normalize(const Vec4& vector) {
+    float length = std::is_constant_evaluated()
+                           ? MatrixScalar::sqrt(dot(vector, vector))
+                           : std::sqrt(dot(vector, vector));
+    return {vector.x / length, vector.y / length, vector.z / length, 0.0f};
+}
+
+constexpr Mat4 lookAt(const Vec4& eye, const Vec4& center, const Vec4& up) {
+    Vec4 forward = normalize(
+            {center.x - eye.x, center.y - eye.y, center.z - eye.z, 0.0f});
+    Vec4 side = normalize(cross(forward, up));
+    Vec4 camera_up = cross(side, forward);
+    return {{{{side.x, camera_up.x, -forward.x, 0.0f},
+              {side.y, camera_up.y, -forward.y, 0.0f},
+              {side.z, camera_up.z, -forward.z, 0.0f},
+              {-dot(side, eye), -dot(camera_up, eye), dot(forward, eye),
+               1.0f}}}};
+}
+}  // namespace MatrixScalar
+
+#ifdef INTEL_VULKAN_MATRIX_SSE
+/**
+ * @brief The SSE kernels for single matrices, always available on x86-64.
+ */
+namespace MatrixSse {
+inline __m128 load(const Vec4& vector) { return _mm_load_ps(&vector.x); }
+
+inline Vec4 store(__m128 vector) {
+    Vec4 result;
+    _mm_store_ps(&result.x, vector);
+    return result;
+}
+
+template <int LANE>
+inline __m128 broadcast(__m128 vector) {
+    return _mm_shuffle_ps(vector, vector, _MM_SHUFFLE(LANE, LANE, LANE, LANE));
+}
+
+inline __m128 transform(const __m128 (&columns)[4], __m128 vector) {
+    __m128 sum = _mm_mul_ps(columns[0], broadcast<0>(vector));
+    sum = _mm_add_ps(sum, _mm_mul_ps(columns[1], broadcast<1>(vector)));
+    sum = _mm_add_ps(sum, _mm_mul_ps(columns[2], broadcast<2>(vector)));
+    return _mm_add_ps(sum, _mm_mul_ps(columns[3], broadcast<3>(vector)));
+}
+
+inline Vec4 transform(const Mat4& matrix, const Vec4& vector) {
+    const __m128 columns[4] = {load(matrix.columns[0]),
+                               load(matrix.columns[1]),
+                               load(matrix.columns[2]),
+                               load(matrix.columns[3])};
+    return store(transform(columns, load(vector)));
+}
+
+inline Mat4 multiply(const Mat4& lhs, const Mat4& rhs) {
+    const __m128 columns[4] = {load(lhs.columns[0]),
+                               load(lhs.columns[1]),
+                               load(lhs.columns[2]),
+                               load(lhs.columns[3])};
+    Mat4 result;
+    for (std::size_t column = 0; column < 4; ++column) {
+        result.columns[column] =
+                store(transform(columns, load(rhs.columns[column])));
+    }
+    return result;
+}
+
+inline Mat4 transpose(const Mat4& matrix) {
+    __m128 c0 = load(matrix.columns[0]);
+    __m128 c1 = load(matrix.columns[1]);
+    __m128 c2 = load(matrix.columns[2]);
+    __m128 c3 = load(matrix.columns[3]);
+    _MM_TRANSPOSE4_PS(c0, c1, c2, c3);
+    return {{{store(c0), store(c1), store(c2), store(c3)}}};
+}
+
+// (lhs[p] * rhs[q] - rhs[p] * lhs[q]) for the pairs (p, q) picked by the
+// two shuffles.
+template <int P, int Q>
+inline __m128 minors(__m128 lhs, __m128 rhs) {
+    return _mm_sub_ps(
+            _mm_mul_ps(_mm_shuffle_ps(lhs, lhs, P),
+                       _mm_shuffle_ps(rhs, rhs, Q)),
+            _mm_mul_ps(_mm_shuffle_ps(rhs, rhs, P),
+                       _mm_shuffle_ps(lhs, lhs, Q)));
+}
+
+// See MatrixScalar::inverse for the lane layout.
+inline std::optional<Mat4> inverse(const Mat4& matrix) {
+    __m128 c0 = load(matrix.columns[0]);
+    __m128 c1 = load(matrix.columns[1]);
+    __m128 c2 = load(matrix.columns[2]);
+    __m128 c3 = load(matrix.columns[3]);
+    // Pairs (0, 1), (0, 2), (0, 3), (1, 2) and (1, 3), (2, 3).
+    constexpr int LOW_P = _MM_SHUFFLE(1, 0, 0, 0);
+    constexpr int LOW_Q = _MM_SHUFFLE(2, 3, 2, 1);
+    constexpr int HIGH_P = _MM_SHUFFLE(2, 2, 2, 1);
+    constexpr int HIGH_Q = _MM_SHUFFLE(3, 3, 3, 3);
+    __m128 s_low = minors<LOW_P, LOW_Q>(c0, c1);
+    __m128 s_high = minors<HIGH_P, HIGH_Q>(c0, c1);
+    __m128 c_low = minors<LOW_P, LOW_Q>(c2, c3);
+    __m128 c_high = minors<HIGH_P, HIGH_Q>(c2, c3);
+
+    alignas(16) float s[8];
+    alignas(16) float c[8];
+    _mm_store_ps(s, s_low);
+    _mm_store_ps(s + 4, s_high);
+    _mm_store_ps(c, c_low);
+    _mm_store_ps(c + 4, c_high);
+    float determinant = ((((s[0] * c[5] - s[1] * c[4]) + s[2] * c[3]) +
+                          s[3] * c[2]) -
+                         s[4] * c[1]) +
+                        s[5] * c[0];
+    if (determinant == 0.0f) {
+        return std::nullopt;
+    }
+    __m128 scale = _mm_set1_ps(1.0f / determinant);
+
+    // The input rows across lanes 1, 0, 3, 2, i.e. transposed and swapped.
+    _MM_TRANSPOSE4_PS(c0, c1, c2, c3);
+    constexpr int SWAP = _MM_SHUFFLE(2, 3, 0, 1);
+    __m128 in[4] = {_mm_shuffle_ps(c0, c0, SWAP),
+                    _mm_shuffle_ps(c1, c1, SWAP),
+                    _mm_shuffle_ps(c2, c2, SWAP),
+                    _mm_shuffle_ps(c3, c3, SWAP)};
+    // (c[k], c[k], s[k], s[k]) per minor k.
+    constexpr int SPLAT[4] = {_MM_SHUFFLE(0, 0, 0, 0),
+                              _MM_SHUFFLE(1, 1, 1, 1),
+                              _MM_SHUFFLE(2, 2, 2, 2),
+                              _MM_SHUFFLE(3, 3, 3, 3)};
+    __m128 m0 = _mm_shuffle_ps(c_low, s_low, SPLAT[0]);
+    __m128 m1 = _mm_shuffle_ps(c_low, s_low, SPLAT[1]);
+    __m128 m2 = _mm_shuffle_ps(c_low, s_low, SPLAT[2]);
+    __m128 m3 = _mm_shuffle_ps(c_low, s_low, SPLAT[3]);
+    __m128 m4 = _mm_shuffle_ps(c_high, s_high, SPLAT[0]);
+    __m128 m5 = _mm_shuffle_ps(c_high, s_high, SPLAT[1]);
+    const __m128 even = _mm_setr_ps(0.0f, -0.0f, 0.0f, -0.0f);
+    const __m128 odd = _mm_setr_ps(-0.0f, 0.0f, -0.0f, 0.0f);
+
+    auto row = [&](__m128 x, __m128 p, __m128 y, __m128 q, __m128 z,
+                   __m128 t, __m128 sign) {
+        __m128 value = _mm_add_ps(
+                _mm_sub_ps(_mm_mul_ps(x, p), _mm_mul_ps(y, q)),
+                _mm_mul_ps(z, t));
+        return store(_mm_mul_ps(_mm_xor_ps(value, sign), scale));
+    };
+    Mat4 result;
+    result.columns[0] = row(in[1], m5, in[2], m4, in[3], m3, even);
+    result.columns[1] = row(in[0], m5, in[2], m2, in[3], m1, odd);
+    result.columns[2] = row(in[0], m4, in[1], m2, in[3], m0, even);
+    result.columns[3] = row(in[0], m3, in[1], m1, in[2], m0, odd);
+    return result;
+}
+
+// x + y + z of lanes 0 to 2, added in that order, in lane 0.
+inline __m128 dot(__m128 lhs, __m128 rhs) {
+    __m128 product = _mm_mul_ps(lhs, rhs);
+    return _mm_add_ss(_mm_add_ss(product, broadcast<1>(product)),
+                      broadcast<2>(product));
+}
+
+inline __m128 cross(__m128 lhs, __m128 rhs) {
+    constexpr int YZX = _MM_SHUFFLE(3, 0, 2, 1);
+    constexpr int ZXY = _MM_SHUFFLE(3, 1, 0, 2);
+    return _mm_sub_ps(_mm_mul_ps(_mm_shuffle_ps(lhs, lhs, YZX),
+                                 _mm_shuffle_ps(rhs, rhs, ZXY)),
+                      _mm_mul_ps(_mm_shuffle_ps(lhs, lhs, ZXY),
+                                 _mm_shuffle_ps(rhs, rhs, YZX)));
+}
+
+inline __m128 normalize(__m128 vector) {
+    return _mm_div_ps(vector, broadcast<0>(_mm_sqrt_ss(dot(vector, vector))));
+}
+
+inline Mat4 lookAt(const Vec4& eye, const Vec4& center, const Vec4& up) {
+    __m128 position = load(eye);
+    __m128 forward = normalize(_mm_sub_ps(load(center), position));
+    __m128 side = normalize(cross(forward, load(up)));
+    __m128 camera_up = cross(side, forward);
+    __m128 translation = _mm_setr_ps(-_mm_cvtss_f32(dot(side, position)),
+                                     -_mm_cvtss_f32(dot(camera_up, position)),
+                                     _mm_cvtss_f32(dot(forward, position)),
+                                     1.0f);
+    // The rows side, up and -forward with w = 0 become the columns.
+    const __m128 xyz = _mm_castsi128_ps(_mm_setr_epi32(-1, -1, -1, 0));
+    __m128 c0 = _mm_and_ps(side, xyz);
+    __m128 c1 = _mm_and_ps(camera_up, xyz);
+    __m128 c2 = _mm_and_ps(_mm_xor_ps(forward, _mm_set1_ps(-0.0f)), xyz);
+    __m128 c3 = _mm_setzero_ps();
+    _MM_TRANSPOSE4_PS(c0, c1, c2, c3);
+    return {{{store(c0), store(c1), store(c2), store(translation)}}};
+}
+}  // namespace MatrixSse
+#endif
+
+constexpr Vec4 operator*(const Mat4& matrix, const Vec4& vector) {
+#ifdef INTEL_VULKAN_MATRIX_SSE
+    if (!std::is_constant_evaluated()) {
+        return MatrixSse::transform(matrix, vector);
+    }
+#endif
+    return MatrixScalar::transform(matrix, vector);
+}
+
+constexpr Mat4 operator*(const Mat4& lhs, const Mat4& rhs) {
+#ifdef INTEL_VULKAN_MATRIX_SSE
+    if (!std::is_constant_evaluated()) {
+        return MatrixSse::multiply(lhs, rhs);
+    }
+#endif
+    return MatrixScalar::multiply(lhs, rhs);
+}
+
+constexpr Mat4 transpose(const Mat4& matrix) {
+#ifdef INTEL_VULKAN_MATRIX_SSE
+    if (!std::is_constant_evaluated()) {
+        return MatrixSse::transpose(matrix);
+    }
+#endif
+    return MatrixScalar::transpose(matrix);
+}
+
+/**
+ * @return The inverse, or nothing if \p matrix is singular.
+ */
+constexpr std::optional<Mat4> inverse(const Mat4& matrix) {
+#ifdef INTEL_VULKAN_MATRIX_SSE
+    if (!std::is_constant_evaluated()) {
+        return MatrixSse::inverse(matrix);
+    }
+#endif
+    return MatrixScalar::inverse(matrix);
+}
+
+/**
+ * @brief A right-handed view matrix looking from \p eye at \p center, like
+ *        gluLookAt. Only x, y and z of the arguments are used.
+ */
+constexpr Mat4 lookAt(const Vec4& eye, const Vec4& center, const Vec4& up) {
+#ifdef INTEL_VULKAN_MATRIX_SSE
+    if (!std::is_constant_evaluated()) {
+        return MatrixSse::lookAt(eye, center, up);
+    }
+#endif
+    return MatrixScalar::lookAt(eye, center, up);
+}
+
+/**
+ * @brief A Vulkan orthographic projection: y points down and depth maps
+ *        to [0, 1].
+ */
+constexpr Mat4 orthographic(float left_plane,
+                            float right_plane,
+                            float top_plane,
+                            float bottom_plane,
+                            float near_plane,
+                            float far_plane) {
+    return {{{{2.0f / (right_plane - left_plane), 0.0f, 0.0f, 0.0f},
+              {0.0f, 2.0f / (bottom_plane - top_plane), 0.0f, 0.0f},
+              {0.0f, 0.0f, 1.0f / (near_plane - far_plane), 0.0f},
+              {-(right_plane + left_plane) / (right_plane - left_plane),
+               -(bottom_plane + top_plane) / (bottom_plane - top_plane),
+               near_plane / (near_plane - far_plane),
+               1.0f}}}};
+}
+
+/**
+ * @brief A Vulkan perspective projection with a vertical field of view in
+ *        degrees: y points down and depth maps to [0, 1]. Not constexpr
+ *        because std::tan is not.
+ */
+Mat4 perspective(float aspect_ratio,
+                 float field_of_view,
+                 float near_clip,
+                 float far_clip);
+
+/**
+ * @return The instruction set \ref multiply and \ref transform batches
+ *         currently use.
+ */
+CpuFeatures::Isa matrixIsa();
+
+/**
+ * @brief Selects the kernels of the batch functions.
+ *
+ * @param[in] isa The instruction set to use, lowered to
+ *                \ref CpuFeatures::bestIsa if the CPU does not support it.
+ *
+ * @return The instruction set now in use.
+ */
+CpuFeatures::Isa setMatrixIsa(CpuFeatures::Isa isa);
+
+/**
+ * @brief Multiplies \p lhs with every matrix in \p rhs, e.g. a
+ *        view-projection matrix with each object's model matrix.
+ *
+ * @param[out] result At least as many matrices as \p rhs; may be \p rhs.
+ */
+void multiply(const Mat4& lhs,
+              std::span<const Mat4> rhs,
+              std::span<Mat4> result);
+
+/**
+ * @brief Transforms \p count vectors in place, e.g. points with w = 1.
+ */
+void transform(const Mat4& matrix,
+               const Vec4Arrays& vectors,
+               std::size_t count);
+}  // namespace intel_vulkan::Tools
+#endif
@@ -0,0 +1,75 @@
+////////////////////////////////////////////////////////////////////////////
+// Copyright (c) 2026 intel_vulkan
+// All rights reserved.
+//
+// Contact: mehoggan@gmail.com
+//
+// This software is licensed under the terms of the Your License.
+// See the LICENSE file in the top-level directory.
+/////////////////////////////////////////////////////////////////////////
+#ifndef INTEL_VULKAN_MIPCHAIN_H
+#define INTEL_VULKAN_MIPCHAIN_H
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+#include <vulkan/vulkan.h>
+
+namespace intel_vulkan::Tools {
+/**
+ * @brief The placement of one level in \ref MipChain::data.
+ */
+struct MipLevel {
+    std::uint32_t width;
+    std::uint32_t height;
+    std::size_t offset;  ///< Bytes from the start of the chain, 16 aligned.
+    std::size_t size;    ///< Tightly packed, width * height * 4 bytes.
+};
+
+/**
+ * @brief A full RGBA8 mip pyramid packed into one buffer, level 0 first.
+ */
+struct MipChain {
+    std::vector<MipLevel> levels;
+    std::vector<char> data;
+};
+
+/**
+ * @brief Builds the full mip pyramid of an RGBA8 image down to 1x1.
+ *
+ * Each level halves the one above it, rounding down. Even sides are
+ * filtered with a 2-tap box; odd sides with a 3-tap box, so the last row
+ * or column of the level above is weighted in rather than dropped. For
+ * sRGB images the color channels are averaged in linear space and encoded
+ * back to sRGB, alpha is averaged as is. Every level is split into row
+ * bands filtered on \p thread_count threads.
+ *
+ * @param[in] rgba The level 0 pixels.
+ * @param[in] width The width of level 0.
+ * @param[in] height The height of level 0.
+ * @param[in] row_pitch The bytes between rows of \p rgba, 0 for width * 4.
+ * @param[in] srgb true if the color channels are sRGB encoded.
+ * @param[in] thread_count The number of threads, 0 for one per core.
+ *
+ * @return The packed levels, empty if \p width or \p height is 0.
+ */
+MipChain generateMipChain(const void* rgba,
+                          std::uint32_t width,
+                          std::uint32_t height,
+                          std::size_t row_pitch,
+                          bool srgb,
+                          std::size_t thread_count = 0);
+
+/**
+ * @brief Describes every level of \p chain as a copy region, so the whole
+ *        chain uploads from a staging buffer with one
+ *        vkCmdCopyBufferToImage.
+ *
+ * @param[in] chain The levels, as copied into the staging buffer.
+ * @param[in] buffer_offset Where the chain starts in the staging buffer.
+ */
+std::vector<VkBufferImageCopy> getMipCopyRegions(const MipChain& chain,
+                                                 VkDeviceSize buffer_offset);
+}  // namespace intel_vulkan::Tools
+#endif
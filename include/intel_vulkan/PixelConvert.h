@@ -0,0 +1,88 @@
+////////////////////////////////////////////////////////////////////////////
+// Copyright (c) 2026 intel_vulkan
+// All rights reserved.
+//
+// Contact: mehoggan@gmail.com
+//
+// This software is licensed under the terms of the Your License.
+// See the LICENSE file in the top-level directory.
+/////////////////////////////////////////////////////////////////////////
+#ifndef INTEL_VULKAN_PIXELCONVERT_H
+#define INTEL_VULKAN_PIXELCONVERT_H
+
+#include "intel_vulkan/CpuFeatures.h"
+
+#include <cstddef>
+#include <cstdint>
+
+/**
+ * @brief Pixel format conversions used when ingesting textures.
+ *
+ * Every conversion has a scalar kernel and, on x86, SSSE3 and AVX2 kernels
+ * producing bit-identical results. The best kernels the CPU supports are
+ * picked the first time a conversion runs; \ref setIsa overrides that for
+ * benchmarks and comparisons. Source and destination may be the same
+ * buffer when both use the same pixel size, otherwise they must not
+ * overlap.
+ */
+namespace intel_vulkan::Tools::PixelConvert {
+using CpuFeatures::bestIsa;
+using Isa = CpuFeatures::Isa;
+
+/**
+ * @return The instruction set the conversions currently use.
+ */
+Isa activeIsa();
+
+/**
+ * @brief Selects the kernels used by every conversion.
+ *
+ * @param[in] isa The instruction set to use, lowered to \ref bestIsa if the
+ *                CPU does not support it.
+ *
+ * @return The instruction set now in use.
+ */
+Isa setIsa(Isa isa);
+
+/**
+ * @brief Expands RGB8 pixels to RGBA8 with an opaque alpha.
+ */
+void rgbToRgba(const std::uint8_t* src,
+               std::uint8_t* dst,
+               std::size_t pixel_count);
+
+/**
+ * @brief Swaps the red and blue channels of RGBA8 pixels, which turns RGBA
+ *        into BGRA and back.
+ */
+void rgbaToBgra(const std::uint8_t* src,
+                std::uint8_t* dst,
+                std::size_t pixel_count);
+
+/**
+ * @brief Converts sRGB encoded RGBA8 pixels to linear float RGBA. Alpha is
+ *        not gamma encoded and is only scaled to [0, 1].
+ */
+void srgbToLinear(const std::uint8_t* src,
+                  float* dst,
+                  std::size_t pixel_count);
+
+/**
+ * @brief Multiplies the color channels of RGBA8 pixels by their alpha,
+ *        rounding to nearest.
+ */
+void premultiplyAlpha(const std::uint8_t* src,
+                      std::uint8_t* dst,
+                      std::size_t pixel_count);
+
+/**
+ * @brief Converts 8 bit unorm values to IEEE half floats in [0, 1], e.g.
+ *        for VK_FORMAT_R16G16B16A16_SFLOAT textures.
+ *
+ * @param[in] value_count The number of channels, not pixels.
+ */
+void unormToHalf(const std::uint8_t* src,
+                 std::uint16_t* dst,
+                 std::size_t value_count);
+}  // namespace intel_vulkan::Tools::PixelConvert
+#endif
@@ -0,0 +1,92 @@
+////////////////////////////////////////////////////////////////////////////
+// Copyright (c) 2026 intel_vulkan
+// All rights reserved.
+//
+// Contact: mehoggan@gmail.com
+//
+// This software is licensed under the terms of the Your License.
+// See the LICENSE file in the top-level directory.
+/////////////////////////////////////////////////////////////////////////
+#ifndef INTEL_VULKAN_PNGDECODE_H
+#define INTEL_VULKAN_PNGDECODE_H
+
+#include "intel_vulkan/CpuFeatures.h"
+
+#include <cstddef>
+#include <span>
+#include <vector>
+
+namespace intel_vulkan::Tools {
+/**
+ * @brief The decoders \ref getImageData can use for PNG files.
+ */
+enum class PngDecoder {
+    STB,  ///< stb_image for every PNG file.
+    FAST,  ///< \ref decodePng, and stb_image for what it does not handle.
+};
+
+/**
+ * @brief Selects the PNG decoder of \ref getImageData for the process,
+ *        FAST by default.
+ */
+void setPngDecoder(PngDecoder decoder);
+PngDecoder pngDecoder();
+
+/**
+ * @brief Selects the unfilter kernels of \ref decodePng, lowered to
+ *        \ref CpuFeatures::bestIsa if the CPU does not support \p isa.
+ *
+ * @return The instruction set now in use.
+ */
+CpuFeatures::Isa setPngIsa(CpuFeatures::Isa isa);
+CpuFeatures::Isa pngIsa();
+
+/**
+ * @brief Decodes a PNG file into memory provided by the caller, with the
+ *        same pixels stb_image would produce.
+ *
+ * The inflate decodes up to two literals per table lookup, and the Sub,
+ * Avg, Paeth and Up filters of 3 and 4 byte pixels are undone with SSSE3
+ * or AVX2 when \ref pngIsa allows. When the encoder made IDAT chunks
+ * independent, i.e. ended each with a zlib full flush, runs of them are
+ * inflated on up to \p thread_count threads.
+ *
+ * Non-interlaced 8 and 16 bit files of every color type are decoded;
+ * interlaced files, bit depths below 8, Apple's CgBI files and anything
+ * malformed return false, so the caller can fall back to stb_image, which
+ * also reports the error.
+ *
+ * @param[in] requested_components The components per pixel to write, 0
+ *                                 for those in the file, as for
+ *                                 stbi_load.
+ * @param[in] thread_count The threads to inflate on, 0 for one per core.
+ *
+ * @return true if the image was decoded into \p destination.
+ */
+bool decodePng(std::span<const char> contents,
+               int requested_components,
+               void* destination,
+               std::size_t row_pitch,
+               std::size_t destination_size,
+               int* width,
+               int* height,
+               int* components,
+               std::size_t thread_count = 0);
+
+/**
+ * @brief Decodes a PNG file into tightly packed rows.
+ *
+ * @param[out] data_size The size of the returned pixels.
+ *
+ * @return The pixels, empty under the same conditions \ref decodePng
+ *         returns false.
+ */
+std::vector<char> decodePng(std::span<const char> contents,
+                            int requested_components,
+                            int* width,
+                            int* height,
+                            int* components,
+                            int* data_size,
+                            std::size_t thread_count = 0);
+}  // namespace intel_vulkan::Tools
+#endif
@@ -0,0 +1,137 @@
+////////////////////////////////////////////////////////////////////////////
+// Copyright (c) 2026 intel_vulkan
+// All rights reserved.
+//
+// Contact: mehoggan@gmail.com
+//
+// This software is licensed under the terms of the Your License.
+// See the LICENSE file in the top-level directory.
+/////////////////////////////////////////////////////////////////////////
+#ifndef INTEL_VULKAN_ROTATINGFILEBACKEND_H
+#define INTEL_VULKAN_ROTATINGFILEBACKEND_H
+
+#define BOOST_LOG_DYN_LINK 1
+
+#include <boost/filesystem/path.hpp>
+#include <boost/log/sinks/basic_sink_backend.hpp>
+#include <boost/log/trivial.hpp>
+
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <mutex>
+#include <string>
+#include <vector>
+
+namespace intel_vulkan {
+/**
+ * @brief How a log file written by \ref RotatingFileBackend is buffered,
+ *        synced and rotated.
+ */
+struct FileLogOptions {
+    /// The size at which the file is rotated. 0 never rotates.
+    std::uint64_t rotation_size = 64 * 1024 * 1024;
+    /// The number of rotated files kept next to the active one, named
+    /// <file>.1 (newest) to <file>.<max_files>.
+    std::size_t max_files = 4;
+    /// Records are collected in a buffer of this size and written in one
+    /// call once it fills up.
+    std::size_t buffer_size = 256 * 1024;
+    /// The longest time buffered records wait before being written and
+    /// synced to disk, also when no further record arrives.
+    std::chrono::milliseconds sync_interval = std::chrono::seconds(1);
+    /// Records at or above this severity are written and synced at once.
+    boost::log::trivial::severity_level sync_level =
+            boost::log::trivial::severity_level::error;
+};
+
+/**
+ * @brief A Boost.Log backend that writes formatted records to a file in
+ *        large blocks and rotates it by size.
+ *
+ * Unlike a \ref std::ofstream behind a text_ostream_backend, records are
+ * only handed to the kernel when the buffer fills, when the sync interval
+ * has passed or when a record at \ref FileLogOptions::sync_level or above
+ * arrives, and fsync is only called in the latter two cases. One timer
+ * thread shared by every backend writes and syncs records that are still
+ * pending once the sync interval has passed, so a log that goes quiet
+ * reaches the disk too.
+ * Files that are not regular files, e.g. /dev/null, are never rotated.
+ */
+class RotatingFileBackend
+        : public boost::log::sinks::basic_formatted_sink_backend<
+                  char,
+                  boost::log::sinks::combine_requirements<
+                          boost::log::sinks::synchronized_feeding,
+                          boost::log::sinks::flushing>::type> {
+public:
+    /**
+     * @brief ctor, creates or truncates \p path.
+     *
+     * @param[in] path The file to log to.
+     * @param[in] options How the file is buffered, synced and rotated.
+     */
+    RotatingFileBackend(const boost::filesystem::path& path,
+                        const FileLogOptions& options);
+
+    /**
+     * @brief dtor, writes and syncs whatever is still buffered.
+     */
+    ~RotatingFileBackend();
+
+    /**
+     * @return true if the file could be opened, false otherwise.
+     */
+    bool isOpen() const;
+
+    /**
+     * @brief Called by the sink frontend for every record it accepts.
+     */
+    void consume(const boost::log::record_view& record,
+                 const string_type& formatted_message);
+
+    /**
+     * @brief Writes the buffered records to the file without syncing.
+     *
+     * Called by the sink frontend's flush, which only forwards to backends
+     * that declare the flushing requirement.
+     */
+    void flush();
+
+    /**
+     * @return The number of bytes all backends have written to their
+     *         files, across rotations, since the program started.
+     */
+    static std::uint64_t bytesWritten();
+
+private:
+    class SyncTimer;
+
+    bool open();
+    void writeBuffer();
+    void sync();
+    void rotate();
+    std::chrono::steady_clock::time_point syncIfDue(
+            std::chrono::steady_clock::time_point now);
+    std::string rotatedPath(std::size_t index) const;
+
+    const std::string m_path;
+    const FileLogOptions m_options;
+    int m_fd;
+    bool m_regular_file;
+    std::uint64_t m_file_size;
+    std::vector<char> m_buffer;
+    // Whether records were buffered or written since the last sync.
+    bool m_unsynced;
+    std::chrono::steady_clock::time_point m_last_sync;
+    // Whether the backend is registered with the sync timer.
+    bool m_timed;
+    // Guards the file state against the sync timer thread.
+    std::mutex m_mutex;
+
+private:
+    RotatingFileBackend(const RotatingFileBackend& other) = delete;
+    RotatingFileBackend& operator=(const RotatingFileBackend& rhs) = delete;
+};
+}  // namespace intel_vulkan
+#endif
@@ -1410,10 +1410,11 @@ static unsigned char* stbi__convert_format(unsigned char* data,
         unsigned char* dest = good + j * x * req_comp;
 
 #define COMBO(a, b) ((a) * 8 + (b))
+// clang-format off
 #define CASE(a, b)                                          \
     case COMBO(a, b):                                       \
-        for (i = x - 1; i >= 0; --i, src += a, dest += b) { \
-        }
+        for (i = x - 1; i >= 0; --i, src += a, dest += b)
+        // clang-format on
         // convert source image with img_n components to one with req_comp
         // components; avoid switch per pixel, so use switch per scanline and
         // massive macros
@@ -12,6 +12,9 @@
 #define INTEL_VULKAN_TOOLS_H
 
 #include <array>
+#include <cstddef>
+#include <memory>
+#include <span>
 #include <string>
 #include <vector>
 
@@ -62,6 +65,86 @@ private:
     VkDevice Device;
 };
 
+/**
+ * @brief A read-only memory mapping of a whole file.
+ *
+ * The file is resolved like \ref getBinaryFileContents, next to the
+ * executable when it does not exist relative to the working directory. The
+ * mapping is released when the object is destroyed, so views returned by
+ * \ref MappedFile::view must not outlive it.
+ *
+ * Files smaller than \ref MappedFile::MIN_MAPPED_SIZE are read into a
+ * buffer owned by the object instead, since setting up and tearing down a
+ * mapping costs more than copying them. Either way the data is at least 16
+ * byte aligned.
+ */
+class MappedFile {
+public:
+    /**
+     * @brief How the contents are going to be read, passed to madvise.
+     */
+    enum class Access {
+        NORMAL,      ///< No hint.
+        SEQUENTIAL,  ///< Read once from front to back, e.g. to decode.
+        WILL_NEED    ///< Read soon, start reading ahead now.
+    };
+
+    static constexpr std::size_t MIN_MAPPED_SIZE = 128 * 1024;
+
+    MappedFile();
+
+    /**
+     * @brief ctor, maps \p filename.
+     *
+     * @param[in] filename The file to map.
+     * @param[in] access The access pattern hint given to the kernel.
+     */
+    explicit MappedFile(std::string const& filename,
+                        Access access = Access::SEQUENTIAL);
+
+    MappedFile(MappedFile&& other) noexcept;
+    MappedFile& operator=(MappedFile&& other) noexcept;
+
+    /**
+     * @brief dtor, unmaps the file.
+     */
+    ~MappedFile();
+
+    /**
+     * @brief Gives the kernel a new access pattern hint. Does nothing for
+     *        files that were read instead of mapped.
+     */
+    void advise(Access access) const;
+
+    const char* data() const { return m_data; }
+    std::size_t size() const { return m_size; }
+
+    /**
+     * @return true if the file could not be mapped or is empty.
+     */
+    bool empty() const { return m_size == 0; }
+
+    std::span<const char> view() const { return {m_data, m_size}; }
+
+private:
+    MappedFile(const MappedFile& other) = delete;
+    MappedFile& operator=(const MappedFile& rhs) = delete;
+
+    void unmap();
+
+    const char* m_data;
+    std::size_t m_size;
+    std::unique_ptr<char[]> m_buffer;  ///< Set if the file was read.
+};
+
+/**
+ * @brief Resolves \p filename like \ref getBinaryFileContents, relative to
+ *        the working directory or else next to the executable.
+ *
+ * @return The path of the file, empty if it exists in neither place.
+ */
+std::string findFile(std::string const& filename);
+
 std::vector<char> getBinaryFileContents(std::string const& filename);
 
 std::vector<char> getImageData(std::string const& filename,
@@ -71,6 +154,42 @@ std::vector<char> getImageData(std::string const& filename,
                                int* components,
                                int* data_size);
 
+/**
+ * @brief Reads the dimensions of an image without decoding it, e.g. to size
+ *        a staging buffer before calling the \ref getImageData overload
+ *        that decodes into it.
+ *
+ * @return true if \p filename is an image stb can read, false otherwise.
+ */
+bool getImageInfo(std::string const& filename,
+                  int* width,
+                  int* height,
+                  int* components);
+
+/**
+ * @brief Decodes an image into memory provided by the caller, such as a
+ *        persistently mapped staging buffer.
+ *
+ * Rows are written \p row_pitch bytes apart. \p components receives the
+ * number of components in the file, the destination holds
+ * \p requested_components per pixel unless it is 0.
+ *
+ * With an \ref ImageCache installed, a miss is decoded into a buffer of
+ * its own, which is stored, and then copied; the destination is only
+ * ever written, never read.
+ *
+ * @return false if the image could not be decoded or does not fit into
+ *         \p destination_size bytes, in which case nothing is written.
+ */
+bool getImageData(std::string const& filename,
+                  int requested_components,
+                  void* destination,
+                  std::size_t row_pitch,
+                  std::size_t destination_size,
+                  int* width,
+                  int* height,
+                  int* components);
+
 std::array<float, 16> getPerspectiveProjectionMatrix(float const aspect_ratio,
                                                      float const field_of_view,
                                                      float const near_clip,
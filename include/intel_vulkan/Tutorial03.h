@@ -65,6 +65,10 @@ public:
     void setVkCommandBuffers(
             const std::vector<VkCommandBuffer>& vk_command_buffers);
 
+    const std::vector<VkFence>& getVkFences() const;
+    std::vector<VkFence>& getVkFences();
+    void setVkFences(const std::vector<VkFence>& vk_fences);
+
 private:
     VkRenderPass m_vk_render_pass;
     std::vector<VkFramebuffer> m_vk_framebuffers;
@@ -73,6 +77,9 @@ private:
     VkSemaphore m_rendering_finished_vk_semaphore;
     VkCommandPool m_vk_command_pool;
     std::vector<VkCommandBuffer> m_vk_command_buffers;
+    // Signaled by the last submission of the command buffer at the same
+    // index.
+    std::vector<VkFence> m_vk_fences;
 };
 
 // ************************************************************ //
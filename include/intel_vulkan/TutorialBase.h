@@ -19,12 +19,16 @@
 
 #include <atomic>
 #include <cstdint>
+#include <memory>
 #include <vector>
 
 #include <vulkan/vulkan.h>
 
+#include "intel_vulkan/DeferredDeleter.h"
+#include "intel_vulkan/DeviceMemoryAllocator.h"
 #include "intel_vulkan/LoggedClass.hpp"
 #include "intel_vulkan/OperatingSystem.h"
+#include "intel_vulkan/ValidationMessageFilter.h"
 
 namespace intel_vulkan {
 
@@ -275,6 +279,20 @@ protected:
     os::WindowParameters m_window_parameters;
     TutorialBaseParameters m_vulkan_common_parameters;
     std::atomic<bool> m_enable_vk_debug;
+    // Outlives the debug messenger, which is destroyed in ~TutorialBase.
+    std::unique_ptr<ValidationMessageFilter> m_validation_message_filter;
+    // Children pass every submission's fence to m_deletion_backend along
+    // with ++m_frame_value, and every fence they wait on before resetting
+    // it to signaled. They queue objects they stop using on
+    // m_deferred_deleter with m_frame_value. Both exist once the device
+    // does.
+    std::unique_ptr<Tools::FenceDeletionBackend> m_deletion_backend;
+    std::unique_ptr<Tools::DeferredDeleter> m_deferred_deleter;
+    std::uint64_t m_frame_value;
+    // Reads the memory properties once per device; children allocate
+    // buffer and image memory from it by MemoryUsage. Outlives
+    // m_deferred_deleter, which may hold frees of its allocations.
+    std::unique_ptr<Tools::DeviceMemoryAllocator> m_memory_allocator;
 };
 
 }  // namespace intel_vulkan
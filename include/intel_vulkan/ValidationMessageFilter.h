@@ -0,0 +1,137 @@
+////////////////////////////////////////////////////////////////////////////
+// Copyright (c) 2026 intel_vulkan
+// All rights reserved.
+//
+// Contact: mehoggan@gmail.com
+//
+// This software is licensed under the terms of the Your License.
+// See the LICENSE file in the top-level directory.
+/////////////////////////////////////////////////////////////////////////
+#ifndef INTEL_VULKAN_VALIDATIONMESSAGEFILTER_H
+#define INTEL_VULKAN_VALIDATIONMESSAGEFILTER_H
+
+#include "intel_vulkan/LogRingBuffer.hpp"
+#include "intel_vulkan/Logging.h"
+
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <thread>
+
+namespace intel_vulkan {
+/**
+ * @brief Deduplicates and rate limits validation layer messages before
+ *        they reach \ref Logging.
+ *
+ * Messages are counted per message id. Within each interval only the
+ * first few messages of an id are logged, the rest are counted and
+ * reported in a summary at the end of the interval. \ref submit only
+ * touches atomics and a lock-free queue, so the driver thread issuing the
+ * debug callback never waits on a lock or on I/O. A writer thread owned by
+ * the filter hands the queued messages and the summaries to \ref Logging.
+ */
+class ValidationMessageFilter {
+public:
+    /**
+     * @brief ctor
+     *
+     * @param[in] tag The \ref LogTag messages and summaries are logged with.
+     * @param[in] max_per_interval The number of messages with the same id
+     *                             logged per interval.
+     * @param[in] interval The length of a rate limiting interval, which is
+     *                     also how often summaries are written.
+     * @param[in] queue_capacity The number of messages that can wait for
+     *                           the writer thread. Messages arriving when
+     *                           it is full are counted as dropped.
+     */
+    explicit ValidationMessageFilter(
+            const LogTag& tag,
+            std::uint32_t max_per_interval = 5,
+            std::chrono::milliseconds interval = std::chrono::seconds(1),
+            std::size_t queue_capacity = 1024);
+
+    /**
+     * @brief dtor
+     *
+     * Writes the messages still queued and a final summary.
+     */
+    ~ValidationMessageFilter();
+
+    /**
+     * @brief Counts a message and queues it for logging unless its id is
+     *        over its rate limit. Safe to call from any thread.
+     *
+     * @param[in] message_id The id shared by repeats of the same message,
+     *                       VkDebugUtilsMessengerCallbackDataEXT's
+     *                       messageIdNumber.
+     * @param[in] message_id_name A readable name for \p message_id, may be
+     *                            nullptr.
+     * @param[in] level The severity to log the message at.
+     * @param[in] message The message text.
+     */
+    void submit(std::int32_t message_id,
+                const char* message_id_name,
+                boost::log::trivial::severity_level level,
+                const char* message);
+
+    /**
+     * @brief A getter for the number of messages dropped because the
+     *        queue was full.
+     *
+     * @return The number of messages dropped since construction.
+     */
+    std::uint64_t droppedCount() const;
+
+private:
+    static constexpr std::size_t MAX_MESSAGE_IDS = 1024;
+    static constexpr std::size_t MAX_ID_NAME = 96;
+
+    // key is INT64_MIN until the slot is claimed by a message id.
+    struct MessageIdStats {
+        std::atomic<std::int64_t> key{INT64_MIN};
+        std::atomic<bool> name_ready{false};
+        char name[MAX_ID_NAME]{};
+        std::atomic<std::uint8_t> level{0};
+        std::atomic<std::int64_t> window_start{INT64_MIN / 2};
+        std::atomic<std::uint32_t> window_count{0};
+        std::atomic<std::uint64_t> total{0};
+        std::atomic<std::uint64_t> suppressed{0};
+    };
+
+    struct QueuedMessage {
+        boost::log::trivial::severity_level level;
+        std::string message;
+    };
+
+    MessageIdStats* findStats(std::int32_t message_id,
+                              const char* message_id_name);
+    void writerLoop();
+    void writeQueued();
+    void writeSummaries();
+    void log(boost::log::trivial::severity_level level,
+             const std::string& message) const;
+
+    const LogTag m_tag;
+    const std::uint32_t m_max_per_interval;
+    const std::int64_t m_interval_ns;
+    std::unique_ptr<MessageIdStats[]> m_stats;
+    LogRingBuffer<QueuedMessage> m_queue;
+    std::atomic<std::uint64_t> m_dropped;
+    std::uint64_t m_dropped_reported;
+    std::atomic<bool> m_running;
+    std::mutex m_wake_mutex;
+    std::condition_variable m_wake;
+    std::thread m_writer;
+
+private:
+    ValidationMessageFilter(const ValidationMessageFilter& other) = delete;
+    ValidationMessageFilter& operator=(const ValidationMessageFilter& rhs) =
+            delete;
+};
+}  // namespace intel_vulkan
+#endif
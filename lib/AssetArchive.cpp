@@ -0,0 +1,283 @@
+////////////////////////////////////////////////////////////////////////////
+// Copyright (c) 2026 intel_vulkan
+// All rights reserved.
+//
+// Contact: mehoggan@gmail.com
+//
+// This software is licensed under the terms of the Your License.
+// See the LICENSE file in the top-level directory.
+/////////////////////////////////////////////////////////////////////////
+#include "intel_vulkan/AssetArchive.h"
+
+#include <algorithm>
+#include <cstdio>
+#include <cstring>
+#include <filesystem>
+#include <fstream>
+#include <iostream>
+#include <utility>
+
+namespace intel_vulkan::Tools {
+
+std::mutex AssetArchive::s_global_mutex;
+std::shared_ptr<const AssetArchive> AssetArchive::s_global;
+
+namespace {
+constexpr std::uint32_t ARCHIVE_MAGIC = 0x4b505649;  // "IVPK"
+constexpr std::uint32_t ARCHIVE_VERSION = 1;
+
+// Followed by the index entries, sorted by name, and the names.
+struct ArchiveHeader {
+    std::uint32_t magic;
+    std::uint32_t version;
+    std::uint32_t entry_count;
+    std::uint32_t names_size;
+};
+
+std::uint64_t contentHash(std::span<const char> contents) {
+    std::uint64_t hash = 0xcbf29ce484222325;
+    for (char value : contents) {
+        hash = (hash ^ static_cast<unsigned char>(value)) * 0x100000001b3;
+    }
+    return hash;
+}
+}  // namespace
+
+struct AssetArchive::IndexEntry {
+    std::uint64_t offset;
+    std::uint64_t size;
+    std::uint64_t hash;
+    std::uint32_t name_offset;  ///< Bytes from the start of the names.
+    std::uint32_t name_size;
+    std::uint32_t alignment;
+    std::uint32_t reserved;
+};
+
+AssetArchive::AssetArchive() : m_entry_count(0), m_names_offset(0) {}
+
+AssetArchive::AssetArchive(std::string const& filename)
+        : m_file(filename, MappedFile::Access::NORMAL)
+        , m_entry_count(0)
+        , m_names_offset(0) {
+    if (m_file.empty()) {
+        return;
+    }
+
+    ArchiveHeader header;
+    bool valid = m_file.size() >= sizeof(header);
+    if (valid) {
+        std::memcpy(&header, m_file.data(), sizeof(header));
+        m_entry_count = header.entry_count;
+        m_names_offset = sizeof(header) +
+                         static_cast<std::size_t>(header.entry_count) *
+                                 sizeof(IndexEntry);
+        valid = header.magic == ARCHIVE_MAGIC &&
+                header.version == ARCHIVE_VERSION &&
+                m_names_offset <= m_file.size() &&
+                m_file.size() - m_names_offset >= header.names_size;
+    }
+    // Checked once here so lookups can trust the index.
+    for (std::size_t index = 0; valid && index < m_entry_count; ++index) {
+        const IndexEntry& entry = *indexEntry(index);
+        valid = entry.alignment != 0 &&
+                entry.offset % entry.alignment == 0 &&
+                entry.offset <= m_file.size() &&
+                m_file.size() - entry.offset >= entry.size &&
+                static_cast<std::uint64_t>(entry.name_offset) +
+                                entry.name_size <=
+                        header.names_size &&
+                (index == 0 ||
+                 indexName(*indexEntry(index - 1)) < indexName(entry));
+    }
+    if (!valid) {
+        std::cout << "\"" << filename << "\" is not a valid asset archive!"
+                  << std::endl;
+        m_file = MappedFile();
+        m_entry_count = 0;
+    }
+}
+
+const AssetArchive::IndexEntry* AssetArchive::indexEntry(
+        std::size_t index) const {
+    // The index starts 16 bytes into the page aligned mapping, so the
+    // entries are suitably aligned.
+    return reinterpret_cast<const IndexEntry*>(
+                   m_file.data() + sizeof(ArchiveHeader)) +
+           index;
+}
+
+std::string_view AssetArchive::indexName(const IndexEntry& entry) const {
+    return std::string_view(
+            m_file.data() + m_names_offset + entry.name_offset,
+            entry.name_size);
+}
+
+AssetArchive::Entry AssetArchive::entry(std::size_t index) const {
+    if (index >= m_entry_count) {
+        return Entry{{}, 0, 0, 0, 0};
+    }
+    const IndexEntry& entry = *indexEntry(index);
+    return Entry{indexName(entry),
+                 entry.offset,
+                 entry.size,
+                 entry.hash,
+                 entry.alignment};
+}
+
+std::optional<std::span<const char>> AssetArchive::find(
+        std::string_view name) const {
+    std::size_t low = 0;
+    std::size_t high = m_entry_count;
+    while (low < high) {
+        std::size_t middle = low + (high - low) / 2;
+        const IndexEntry& entry = *indexEntry(middle);
+        int order = indexName(entry).compare(name);
+        if (order == 0) {
+            return std::span<const char>(
+                    m_file.data() + entry.offset,
+                    static_cast<std::size_t>(entry.size));
+        }
+        if (order < 0) {
+            low = middle + 1;
+        } else {
+            high = middle;
+        }
+    }
+    return std::nullopt;
+}
+
+bool AssetArchive::verify() const {
+    for (std::size_t index = 0; index < m_entry_count; ++index) {
+        const IndexEntry& entry = *indexEntry(index);
+        if (contentHash(m_file.view().subspan(
+                    entry.offset, static_cast<std::size_t>(entry.size))) !=
+            entry.hash) {
+            return false;
+        }
+    }
+    return isValid();
+}
+
+bool AssetArchive::pack(std::string const& filename,
+                        std::vector<Source> sources,
+                        std::size_t alignment) {
+    if (alignment == 0 || (alignment & (alignment - 1)) != 0) {
+        return false;
+    }
+    std::sort(sources.begin(),
+              sources.end(),
+              [](const Source& lhs, const Source& rhs) {
+                  return lhs.name < rhs.name;
+              });
+
+    std::vector<MappedFile> files;
+    std::vector<IndexEntry> entries;
+    std::string names;
+    for (std::size_t index = 0; index < sources.size(); ++index) {
+        if (index > 0 && sources[index - 1].name == sources[index].name) {
+            std::cout << "\"" << sources[index].name
+                      << "\" is packed more than once!" << std::endl;
+            return false;
+        }
+        files.emplace_back(sources[index].path,
+                           MappedFile::Access::SEQUENTIAL);
+        std::error_code error;
+        if (files.back().empty() &&
+            std::filesystem::file_size(sources[index].path, error) != 0) {
+            return false;
+        }
+        entries.push_back(IndexEntry{
+                0,
+                files.back().size(),
+                contentHash(files.back().view()),
+                static_cast<std::uint32_t>(names.size()),
+                static_cast<std::uint32_t>(sources[index].name.size()),
+                static_cast<std::uint32_t>(alignment),
+                0});
+        names += sources[index].name;
+    }
+
+    ArchiveHeader header{ARCHIVE_MAGIC,
+                         ARCHIVE_VERSION,
+                         static_cast<std::uint32_t>(entries.size()),
+                         static_cast<std::uint32_t>(names.size())};
+    std::uint64_t offset =
+            sizeof(header) + entries.size() * sizeof(IndexEntry) +
+            names.size();
+    for (IndexEntry& entry : entries) {
+        offset = (offset + alignment - 1) & ~(alignment - 1);
+        entry.offset = offset;
+        offset += entry.size;
+    }
+
+    // The gaps between payloads are skipped rather than written, so the
+    // archive is sparse on file systems that support it.
+    std::string temporary = filename + ".tmp";
+    {
+        std::ofstream file(temporary, std::ios::binary | std::ios::trunc);
+        file.write(reinterpret_cast<const char*>(&header), sizeof(header));
+        file.write(reinterpret_cast<const char*>(entries.data()),
+                   entries.size() * sizeof(IndexEntry));
+        file.write(names.data(), names.size());
+        for (std::size_t index = 0; index < entries.size(); ++index) {
+            file.seekp(static_cast<std::streamoff>(entries[index].offset));
+            file.write(files[index].data(), files[index].size());
+        }
+        if (!file) {
+            std::cout << "Could not write \"" << temporary << "\" file!"
+                      << std::endl;
+            std::remove(temporary.c_str());
+            return false;
+        }
+    }
+    // An empty last asset starts past the last byte written, so the file
+    // is extended to where it starts.
+    std::error_code error;
+    std::filesystem::resize_file(temporary, offset, error);
+    if (error || std::rename(temporary.c_str(), filename.c_str()) != 0) {
+        std::remove(temporary.c_str());
+        return false;
+    }
+    return true;
+}
+
+bool AssetArchive::mount(std::string const& filename) {
+    // Checked first so a missing archive is not reported as an error.
+    std::string path = findFile(filename);
+    if (path.empty()) {
+        return false;
+    }
+    auto archive = std::make_shared<const AssetArchive>(path);
+    if (!archive->isValid()) {
+        return false;
+    }
+    setGlobal(std::move(archive));
+    return true;
+}
+
+void AssetArchive::setGlobal(std::shared_ptr<const AssetArchive> archive) {
+    std::lock_guard<std::mutex> lock(s_global_mutex);
+    s_global = std::move(archive);
+}
+
+std::shared_ptr<const AssetArchive> AssetArchive::global() {
+    std::lock_guard<std::mutex> lock(s_global_mutex);
+    return s_global;
+}
+
+Asset loadAsset(std::string const& name, MappedFile::Access access) {
+    Asset asset;
+    asset.archive = AssetArchive::global();
+    if (asset.archive) {
+        if (std::optional<std::span<const char>> contents =
+                    asset.archive->find(name)) {
+            asset.contents = *contents;
+            return asset;
+        }
+        asset.archive.reset();
+    }
+    asset.file = MappedFile(name, access);
+    asset.contents = asset.file.view();
+    return asset;
+}
+}  // namespace intel_vulkan::Tools
@@ -0,0 +1,528 @@
+////////////////////////////////////////////////////////////////////////////
+// Copyright (c) 2026 intel_vulkan
+// All rights reserved.
+//
+// Contact: mehoggan@gmail.com
+//
+// This software is licensed under the terms of the Your License.
+// See the LICENSE file in the top-level directory.
+/////////////////////////////////////////////////////////////////////////
+#include "intel_vulkan/AsyncReader.h"
+
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <unistd.h>
+#include <algorithm>
+#include <atomic>
+#include <cerrno>
+#include <chrono>
+#include <cstring>
+#include <iostream>
+
+#if defined(__linux__)
+#include <linux/io_uring.h>
+#include <sys/syscall.h>
+#endif
+
+namespace intel_vulkan::Tools {
+
+#if defined(__linux__)
+// A minimal io_uring on the raw system calls, so there is no dependency on
+// liburing. Only the reader thread touches the rings.
+struct AsyncReader::Ring {
+    static std::unique_ptr<Ring> create(unsigned entries);
+
+    ~Ring() {
+        if (sqes != MAP_FAILED) {
+            ::munmap(sqes, sqes_size);
+        }
+        if (rings != MAP_FAILED) {
+            ::munmap(rings, rings_size);
+        }
+        if (fd != -1) {
+            ::close(fd);
+        }
+    }
+
+    // Queues a read; \ref submitAndWait hands it to the kernel.
+    void queueRead(int file,
+                   char* buffer,
+                   std::size_t size,
+                   std::uint64_t offset,
+                   std::uint64_t user_data) {
+        io_uring_sqe sqe;
+        std::memset(&sqe, 0, sizeof(sqe));
+        sqe.opcode = IORING_OP_READ;
+        sqe.fd = file;
+        sqe.addr = reinterpret_cast<std::uintptr_t>(buffer);
+        sqe.len = static_cast<std::uint32_t>(
+                std::min<std::size_t>(size, 0x7ffff000));
+        sqe.off = offset;
+        sqe.user_data = user_data;
+        queue(sqe);
+    }
+
+    void queue(const io_uring_sqe& sqe) {
+        unsigned tail = *sq_tail;
+        unsigned index = tail & *sq_mask;
+        sqes[index] = sqe;
+        sq_array[index] = index;
+        std::atomic_ref<unsigned>(*sq_tail).store(tail + 1,
+                                                  std::memory_order_release);
+        ++unsubmitted;
+    }
+
+    // Submits the queued reads and blocks until at least one completes.
+    // Returns false, with errno set, if the ring cannot be used any more.
+    bool submitAndWait() {
+        for (;;) {
+            long submitted = ::syscall(__NR_io_uring_enter,
+                                       fd,
+                                       unsubmitted,
+                                       1,
+                                       IORING_ENTER_GETEVENTS,
+                                       nullptr,
+                                       0);
+            if (submitted >= 0) {
+                unsubmitted -= static_cast<unsigned>(submitted);
+                in_flight += static_cast<unsigned>(submitted);
+                return true;
+            }
+            if ((errno == EAGAIN || errno == EBUSY) && in_flight > 0) {
+                // Out of kernel resources; the queued reads stay in the
+                // ring and are submitted once a completion is reaped. With
+                // nothing in flight there is nothing to wait for, so that
+                // case fails like any other error.
+                if (waitForCompletion()) {
+                    return true;
+                }
+            }
+            if (errno != EINTR) {
+                std::cout << "io_uring_enter failed: " << std::strerror(errno)
+                          << std::endl;
+                return false;
+            }
+        }
+    }
+
+    // Blocks until at least one submitted read completes.
+    bool waitForCompletion() {
+        for (;;) {
+            if (::syscall(__NR_io_uring_enter,
+                          fd,
+                          0,
+                          1,
+                          IORING_ENTER_GETEVENTS,
+                          nullptr,
+                          0) >= 0) {
+                return true;
+            }
+            if (errno != EINTR) {
+                return false;
+            }
+        }
+    }
+
+    // Cancels the submitted reads of \p user_data and reaps until the
+    // kernel holds no read at all, calling \p handle like \ref reap. Reads
+    // queued but not submitted are dropped. If even the cancels cannot be
+    // submitted, this waits for the reads to complete on their own.
+    template <typename Handler>
+    void drain(const std::vector<std::uint64_t>& user_data,
+               Handler&& handle) {
+        // The kernel has not looked past its head, so the unsubmitted
+        // entries can be taken back.
+        std::atomic_ref<unsigned>(*sq_tail).store(*sq_tail - unsubmitted,
+                                                  std::memory_order_release);
+        unsubmitted = 0;
+        for (std::uint64_t target : user_data) {
+            io_uring_sqe sqe;
+            std::memset(&sqe, 0, sizeof(sqe));
+            sqe.opcode = IORING_OP_ASYNC_CANCEL;
+            sqe.addr = target;
+            sqe.user_data = CANCEL;
+            queue(sqe);
+        }
+        long submitted = ::syscall(
+                __NR_io_uring_enter, fd, unsubmitted, 0, 0, nullptr, 0);
+        if (submitted > 0) {
+            unsubmitted -= static_cast<unsigned>(submitted);
+            in_flight += static_cast<unsigned>(submitted);
+        }
+        for (;;) {
+            reap([&](std::uint64_t data, int result) {
+                if (data != CANCEL) {
+                    handle(data, result);
+                }
+            });
+            if (in_flight == 0) {
+                return;
+            }
+            if (!waitForCompletion()) {
+                // The kernel still posts completions without being
+                // waited on.
+                std::this_thread::sleep_for(std::chrono::milliseconds(1));
+            }
+        }
+    }
+
+    // Calls \p handle(user_data, result) for every completion.
+    template <typename Handler>
+    void reap(Handler&& handle) {
+        unsigned head = *cq_head;
+        unsigned tail =
+                std::atomic_ref<unsigned>(*cq_tail).load(
+                        std::memory_order_acquire);
+        for (; head != tail; ++head) {
+            const io_uring_cqe& cqe = cqes[head & *cq_mask];
+            --in_flight;
+            handle(cqe.user_data, cqe.res);
+        }
+        std::atomic_ref<unsigned>(*cq_head).store(head,
+                                                  std::memory_order_release);
+    }
+
+    int fd = -1;
+    void* rings = MAP_FAILED;
+    std::size_t rings_size = 0;
+    io_uring_sqe* sqes = static_cast<io_uring_sqe*>(MAP_FAILED);
+    std::size_t sqes_size = 0;
+    unsigned* sq_tail = nullptr;
+    unsigned* sq_mask = nullptr;
+    unsigned* sq_array = nullptr;
+    unsigned* cq_head = nullptr;
+    unsigned* cq_tail = nullptr;
+    unsigned* cq_mask = nullptr;
+    io_uring_cqe* cqes = nullptr;
+    unsigned unsubmitted = 0;
+    unsigned in_flight = 0;  ///< Submitted entries not reaped yet.
+
+    static constexpr std::uint64_t CANCEL = ~std::uint64_t(0);
+};
+
+std::unique_ptr<AsyncReader::Ring> AsyncReader::Ring::create(
+        unsigned entries) {
+    auto ring = std::make_unique<Ring>();
+    io_uring_params params;
+    std::memset(&params, 0, sizeof(params));
+    ring->fd = static_cast<int>(
+            ::syscall(__NR_io_uring_setup, entries, &params));
+    // Kernels before 5.4 map the rings separately, before 5.6 cannot read
+    // into a plain buffer; both fall back to the thread pool.
+    if (ring->fd == -1 || !(params.features & IORING_FEAT_SINGLE_MMAP) ||
+        !(params.features & IORING_FEAT_NODROP)) {
+        return nullptr;
+    }
+
+    ring->rings_size = std::max<std::size_t>(
+            params.sq_off.array + params.sq_entries * sizeof(unsigned),
+            params.cq_off.cqes + params.cq_entries * sizeof(io_uring_cqe));
+    ring->rings = ::mmap(nullptr,
+                         ring->rings_size,
+                         PROT_READ | PROT_WRITE,
+                         MAP_SHARED | MAP_POPULATE,
+                         ring->fd,
+                         IORING_OFF_SQ_RING);
+    ring->sqes_size = params.sq_entries * sizeof(io_uring_sqe);
+    ring->sqes = static_cast<io_uring_sqe*>(::mmap(nullptr,
+                                                   ring->sqes_size,
+                                                   PROT_READ | PROT_WRITE,
+                                                   MAP_SHARED | MAP_POPULATE,
+                                                   ring->fd,
+                                                   IORING_OFF_SQES));
+    if (ring->rings == MAP_FAILED || ring->sqes == MAP_FAILED) {
+        return nullptr;
+    }
+    char* base = static_cast<char*>(ring->rings);
+    ring->sq_tail = reinterpret_cast<unsigned*>(base + params.sq_off.tail);
+    ring->sq_mask =
+            reinterpret_cast<unsigned*>(base + params.sq_off.ring_mask);
+    ring->sq_array = reinterpret_cast<unsigned*>(base + params.sq_off.array);
+    ring->cq_head = reinterpret_cast<unsigned*>(base + params.cq_off.head);
+    ring->cq_tail = reinterpret_cast<unsigned*>(base + params.cq_off.tail);
+    ring->cq_mask =
+            reinterpret_cast<unsigned*>(base + params.cq_off.ring_mask);
+    ring->cqes = reinterpret_cast<io_uring_cqe*>(base + params.cq_off.cqes);
+
+    // IORING_FEAT_NODROP came with 5.5, so only 5.5 lacks IORING_OP_READ.
+    io_uring_probe* probe = static_cast<io_uring_probe*>(std::calloc(
+            1, sizeof(io_uring_probe) + 256 * sizeof(io_uring_probe_op)));
+    bool can_read =
+            ::syscall(__NR_io_uring_register,
+                      ring->fd,
+                      IORING_REGISTER_PROBE,
+                      probe,
+                      256) == 0 &&
+            probe->last_op >= IORING_OP_READ &&
+            (probe->ops[IORING_OP_READ].flags & IO_URING_OP_SUPPORTED);
+    std::free(probe);
+    if (!can_read) {
+        return nullptr;
+    }
+    return ring;
+}
+#else
+struct AsyncReader::Ring {
+    static std::unique_ptr<Ring> create(unsigned) { return nullptr; }
+};
+#endif
+
+AsyncReader::AsyncReader(std::size_t queue_depth, Backend backend)
+        : m_queue_depth(std::max<std::size_t>(queue_depth, 1))
+        , m_backend(Backend::THREAD_POOL)
+        , m_pending(0)
+        , m_running(true) {
+    if (backend != Backend::THREAD_POOL) {
+        m_ring = Ring::create(static_cast<unsigned>(m_queue_depth));
+    }
+    if (m_ring) {
+        m_backend = Backend::IO_URING;
+        m_threads.emplace_back([this]() { ringLoop(); });
+    } else {
+        for (std::size_t index = 0; index < m_queue_depth; ++index) {
+            m_threads.emplace_back([this]() { poolLoop(); });
+        }
+    }
+}
+
+AsyncReader::~AsyncReader() {
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        m_running = false;
+    }
+    m_job_ready.notify_all();
+    for (std::thread& thread : m_threads) {
+        thread.join();
+    }
+    // Started by the io_uring thread if it fell back, so only complete
+    // once that thread has been joined.
+    for (std::thread& thread : m_fallback_threads) {
+        thread.join();
+    }
+}
+
+std::vector<std::future<ReadResult>> AsyncReader::read(
+        const std::vector<ReadRequest>& requests) {
+    std::vector<std::future<ReadResult>> futures;
+    futures.reserve(requests.size());
+    for (const ReadRequest& request : requests) {
+        std::shared_ptr<std::promise<ReadResult>> promise =
+                std::make_shared<std::promise<ReadResult>>();
+        futures.push_back(promise->get_future());
+        enqueue(Job{request, promise, Callback()});
+    }
+    return futures;
+}
+
+void AsyncReader::read(const std::vector<ReadRequest>& requests,
+                       Callback on_read) {
+    for (const ReadRequest& request : requests) {
+        enqueue(Job{request, nullptr, on_read});
+    }
+}
+
+void AsyncReader::wait() {
+    std::unique_lock<std::mutex> lock(m_mutex);
+    m_idle.wait(lock, [this]() { return m_pending == 0; });
+}
+
+void AsyncReader::enqueue(Job&& job) {
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        m_jobs.push_back(std::move(job));
+        ++m_pending;
+    }
+    m_job_ready.notify_one();
+}
+
+void AsyncReader::deliver(Job& job, std::size_t size, int error) {
+    ReadResult result{std::move(job.request.path),
+                      job.request.buffer.first(size),
+                      error};
+    if (job.promise) {
+        job.promise->set_value(std::move(result));
+    } else if (job.on_read) {
+        job.on_read(std::move(result));
+    }
+
+    bool idle = false;
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        idle = --m_pending == 0;
+    }
+    if (idle) {
+        m_idle.notify_all();
+    }
+}
+
+void AsyncReader::ringLoop() {
+#if defined(__linux__)
+    struct Slot {
+        Job job;
+        int file = -1;
+        std::size_t size = 0;  ///< Bytes read so far.
+    };
+    std::vector<Slot> slots(m_queue_depth);
+    std::vector<std::size_t> free_slots;
+    for (std::size_t index = m_queue_depth; index > 0; --index) {
+        free_slots.push_back(index - 1);
+    }
+    std::vector<std::size_t> started;
+
+    for (;;) {
+        {
+            std::unique_lock<std::mutex> lock(m_mutex);
+            if (free_slots.size() == m_queue_depth) {
+                m_job_ready.wait(lock, [this]() {
+                    return !m_running || !m_jobs.empty();
+                });
+                if (m_jobs.empty()) {
+                    // Only reached once the reader is stopping and every
+                    // queued read has completed.
+                    return;
+                }
+            }
+            // New reads are picked up whenever a completion frees a slot.
+            while (!free_slots.empty() && !m_jobs.empty()) {
+                started.push_back(free_slots.back());
+                free_slots.pop_back();
+                slots[started.back()].job = std::move(m_jobs.front());
+                m_jobs.pop_front();
+            }
+        }
+
+        for (std::size_t index : started) {
+            Slot& slot = slots[index];
+            slot.size = 0;
+            slot.file = ::open(slot.job.request.path.c_str(),
+                               O_RDONLY | O_CLOEXEC);
+            if (slot.file == -1) {
+                deliver(slot.job, 0, errno);
+                free_slots.push_back(index);
+            } else if (slot.job.request.buffer.empty()) {
+                ::close(slot.file);
+                deliver(slot.job, 0, 0);
+                free_slots.push_back(index);
+            } else {
+                m_ring->queueRead(slot.file,
+                                  slot.job.request.buffer.data(),
+                                  slot.job.request.buffer.size(),
+                                  slot.job.request.offset,
+                                  index);
+            }
+        }
+        started.clear();
+        if (free_slots.size() == m_queue_depth) {
+            continue;
+        }
+
+        if (!m_ring->submitAndWait()) {
+            // The kernel may still write into the buffers of submitted
+            // reads, so they are cancelled and reaped before the ring is
+            // closed. Those that completed meanwhile are delivered; the
+            // rest are read again from the start by the thread pool,
+            // ahead of the jobs still queued.
+            std::vector<std::uint64_t> busy;
+            for (std::size_t index = 0; index < slots.size(); ++index) {
+                if (std::find(free_slots.begin(), free_slots.end(), index) ==
+                    free_slots.end()) {
+                    busy.push_back(index);
+                }
+            }
+            m_ring->drain(busy, [&](std::uint64_t index, int result) {
+                Slot& slot = slots[index];
+                if (result > 0) {
+                    slot.size += static_cast<std::size_t>(result);
+                }
+                bool finished =
+                        result > 0
+                                ? slot.size == slot.job.request.buffer.size()
+                                : result != -ECANCELED && result != -EINTR;
+                if (finished) {
+                    ::close(slot.file);
+                    slot.file = -1;
+                    deliver(slot.job, slot.size, result < 0 ? -result : 0);
+                }
+            });
+            m_ring.reset();
+
+            std::lock_guard<std::mutex> lock(m_mutex);
+            for (auto index = busy.rbegin(); index != busy.rend(); ++index) {
+                Slot& slot = slots[*index];
+                if (slot.file != -1) {
+                    ::close(slot.file);
+                    m_jobs.push_front(std::move(slot.job));
+                }
+            }
+            m_backend = Backend::THREAD_POOL;
+            for (std::size_t index = 0; index < m_queue_depth; ++index) {
+                m_fallback_threads.emplace_back([this]() { poolLoop(); });
+            }
+            return;
+        }
+        m_ring->reap([&](std::uint64_t index, int result) {
+            Slot& slot = slots[index];
+            std::span<char> buffer = slot.job.request.buffer;
+            if (result > 0) {
+                slot.size += static_cast<std::size_t>(result);
+            }
+            if (result > 0 && slot.size < buffer.size()) {
+                // A short read; the rest follows unless it was the end of
+                // the file, which the next read reports as 0 bytes.
+                m_ring->queueRead(slot.file,
+                                  buffer.data() + slot.size,
+                                  buffer.size() - slot.size,
+                                  slot.job.request.offset + slot.size,
+                                  index);
+                return;
+            }
+            ::close(slot.file);
+            deliver(slot.job, slot.size, result < 0 ? -result : 0);
+            free_slots.push_back(static_cast<std::size_t>(index));
+        });
+    }
+#endif
+}
+
+void AsyncReader::poolLoop() {
+    for (;;) {
+        Job job;
+        {
+            std::unique_lock<std::mutex> lock(m_mutex);
+            m_job_ready.wait(
+                    lock, [this]() { return !m_running || !m_jobs.empty(); });
+            if (m_jobs.empty()) {
+                return;
+            }
+            job = std::move(m_jobs.front());
+            m_jobs.pop_front();
+        }
+
+        int file = ::open(job.request.path.c_str(), O_RDONLY | O_CLOEXEC);
+        if (file == -1) {
+            deliver(job, 0, errno);
+            continue;
+        }
+        std::span<char> buffer = job.request.buffer;
+        std::size_t size = 0;
+        int error = 0;
+        while (size < buffer.size()) {
+            ssize_t result = ::pread(
+                    file,
+                    buffer.data() + size,
+                    buffer.size() - size,
+                    static_cast<off_t>(job.request.offset + size));
+            if (result < 0 && errno == EINTR) {
+                continue;
+            }
+            if (result <= 0) {
+                error = result < 0 ? errno : 0;
+                break;
+            }
+            size += static_cast<std::size_t>(result);
+        }
+        ::close(file);
+        deliver(job, size, error);
+    }
+}
+}  // namespace intel_vulkan::Tools
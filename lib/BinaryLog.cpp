@@ -0,0 +1,544 @@
+////////////////////////////////////////////////////////////////////////////
+// Copyright (c) 2026 intel_vulkan
+// All rights reserved.
+//
+// Contact: mehoggan@gmail.com
+//
+// This software is licensed under the terms of the Your License.
+// See the LICENSE file in the top-level directory.
+/////////////////////////////////////////////////////////////////////////
+
+#include "intel_vulkan/BinaryLog.h"
+
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <time.h>
+#include <unistd.h>
+
+#include <algorithm>
+#include <cerrno>
+#include <atomic>
+#include <cstdio>
+#include <cstring>
+#include <iomanip>
+
+namespace intel_vulkan {
+
+namespace {
+constexpr std::size_t PAGE_SIZE = 4096;
+constexpr std::size_t STRINGS_CAPACITY = 256 * 1024;
+
+// A string table entry is this header followed by the string, padded so
+// the next entry starts on an 8 byte boundary.
+struct StringEntryHeader {
+    std::uint8_t kind;
+    std::uint8_t reserved;
+    std::uint16_t length;
+    std::uint32_t string_id;
+};
+
+std::size_t alignUp(std::size_t value, std::size_t alignment) {
+    return (value + alignment - 1) / alignment * alignment;
+}
+
+// Loads half of a record's commit word from a mapping that another thread
+// or process may still be writing.
+std::uint64_t loadCommitWord(const std::uint64_t& word,
+                             std::memory_order order) {
+    return std::atomic_ref<std::uint64_t>(const_cast<std::uint64_t&>(word))
+            .load(order);
+}
+
+const char* severityName(std::uint8_t severity) {
+    static const char* const names[] = {
+            "trace", "debug", "info", "warning", "error", "fatal"};
+    return severity < 6 ? names[severity] : "unknown";
+}
+
+// Same substitution rules as Logging's format-string calls.
+std::string substitute(std::string_view format,
+                       const std::vector<std::string>& args) {
+    std::string message;
+    std::size_t next_arg = 0;
+    std::size_t index = 0;
+    while (index < format.size()) {
+        char current = format[index];
+        char next = index + 1 < format.size() ? format[index + 1] : '\0';
+        if (current == '{' && next == '}') {
+            if (next_arg < args.size()) {
+                message += args[next_arg++];
+            } else {
+                message += "{}";
+            }
+            index += 2;
+        } else if ((current == '{' && next == '{') ||
+                   (current == '}' && next == '}')) {
+            message += current;
+            index += 2;
+        } else {
+            message += current;
+            ++index;
+        }
+    }
+    return message;
+}
+
+std::string jsonEscape(std::string_view value) {
+    std::string escaped;
+    for (char current : value) {
+        switch (current) {
+            case '"':
+                escaped += "\\\"";
+                break;
+            case '\\':
+                escaped += "\\\\";
+                break;
+            case '\n':
+                escaped += "\\n";
+                break;
+            case '\t':
+                escaped += "\\t";
+                break;
+            default:
+                if (static_cast<unsigned char>(current) < 0x20) {
+                    char buffer[8];
+                    std::snprintf(buffer,
+                                  sizeof(buffer),
+                                  "\\u%04x",
+                                  static_cast<unsigned>(current));
+                    escaped += buffer;
+                } else {
+                    escaped += current;
+                }
+        }
+    }
+    return escaped;
+}
+}  // namespace
+
+/*
+ * BinaryLogArgs
+ */
+void BinaryLogArgs::appendString(std::string_view value) {
+    std::size_t header = 1 + sizeof(std::uint16_t);
+    if (m_size + header > BINARY_LOG_ARG_BYTES) {
+        m_truncated = true;
+        return;
+    }
+    std::size_t length = std::min(value.size(),
+                                  BINARY_LOG_ARG_BYTES - m_size - header);
+    if (length < value.size()) {
+        m_truncated = true;
+    }
+    std::uint16_t length16 = static_cast<std::uint16_t>(length);
+    m_bytes[m_size] = static_cast<std::uint8_t>(BinaryLogArgType::STRING);
+    std::memcpy(&m_bytes[m_size + 1], &length16, sizeof(length16));
+    std::memcpy(&m_bytes[m_size + header], value.data(), length);
+    m_size += static_cast<std::uint32_t>(header + length);
+    ++m_count;
+}
+
+void BinaryLogArgs::appendRaw(BinaryLogArgType type,
+                              const void* value,
+                              std::size_t value_size) {
+    if (m_size + 1 + value_size > BINARY_LOG_ARG_BYTES) {
+        m_truncated = true;
+        return;
+    }
+    m_bytes[m_size] = static_cast<std::uint8_t>(type);
+    std::memcpy(&m_bytes[m_size + 1], value, value_size);
+    m_size += static_cast<std::uint32_t>(1 + value_size);
+    ++m_count;
+}
+
+/*
+ * BinaryLogWriter
+ */
+BinaryLogWriter::BinaryLogWriter()
+        : m_fd(-1)
+        , m_mapping(MAP_FAILED)
+        , m_mapping_size(0)
+        , m_header(nullptr)
+        , m_records(nullptr) {}
+
+BinaryLogWriter::~BinaryLogWriter() {
+    if (m_mapping != MAP_FAILED) {
+        if (m_fd != -1) {
+            ::msync(m_mapping, m_mapping_size, MS_ASYNC);
+        }
+        ::munmap(m_mapping, m_mapping_size);
+    }
+    if (m_fd != -1) {
+        ::close(m_fd);
+    }
+}
+
+bool BinaryLogWriter::open(const std::string& path,
+                           std::size_t record_capacity) {
+    if (m_header != nullptr || record_capacity == 0) {
+        return false;
+    }
+    int fd = ::open(path.c_str(), O_RDWR | O_CREAT | O_TRUNC | O_CLOEXEC, 0644);
+    if (fd == -1) {
+        return false;
+    }
+    if (!map(fd, record_capacity)) {
+        ::close(fd);
+        return false;
+    }
+    m_fd = fd;
+    return true;
+}
+
+bool BinaryLogWriter::openAnonymous(std::size_t record_capacity) {
+    if (m_header != nullptr || record_capacity == 0) {
+        return false;
+    }
+    return map(-1, record_capacity);
+}
+
+bool BinaryLogWriter::map(int fd, std::size_t record_capacity) {
+    std::size_t strings_offset = PAGE_SIZE;
+    std::size_t records_offset =
+            alignUp(strings_offset + STRINGS_CAPACITY, PAGE_SIZE);
+    std::size_t file_size =
+            records_offset + record_capacity * sizeof(BinaryLogRecord);
+
+    if (fd == -1) {
+        m_mapping = ::mmap(nullptr,
+                           file_size,
+                           PROT_READ | PROT_WRITE,
+                           MAP_PRIVATE | MAP_ANONYMOUS,
+                           -1,
+                           0);
+    } else {
+        if (::ftruncate(fd, static_cast<off_t>(file_size)) != 0) {
+            return false;
+        }
+        m_mapping = ::mmap(nullptr,
+                           file_size,
+                           PROT_READ | PROT_WRITE,
+                           MAP_SHARED,
+                           fd,
+                           0);
+    }
+    if (m_mapping == MAP_FAILED) {
+        return false;
+    }
+    m_mapping_size = file_size;
+
+    // Both kinds of mapping start zero filled, so every record starts with
+    // sequence 0.
+    m_header = static_cast<BinaryLogFileHeader*>(m_mapping);
+    std::memcpy(m_header->magic, BINARY_LOG_MAGIC, sizeof(BINARY_LOG_MAGIC));
+    m_header->version = BINARY_LOG_VERSION;
+    m_header->record_size = sizeof(BinaryLogRecord);
+    m_header->record_capacity = record_capacity;
+    m_header->strings_offset = strings_offset;
+    m_header->strings_capacity = STRINGS_CAPACITY;
+    m_header->records_offset = records_offset;
+    m_header->write_cursor = 0;
+    m_header->strings_used = 0;
+    m_records = reinterpret_cast<BinaryLogRecord*>(
+            static_cast<char*>(m_mapping) + records_offset);
+    return true;
+}
+
+bool BinaryLogWriter::dump(const char* path) const {
+    if (m_header == nullptr) {
+        return false;
+    }
+    int file = ::open(path, O_WRONLY | O_CREAT | O_TRUNC | O_CLOEXEC, 0644);
+    if (file == -1) {
+        return false;
+    }
+    const char* bytes = static_cast<const char*>(m_mapping);
+    std::size_t written = 0;
+    while (written < m_mapping_size) {
+        ssize_t result =
+                ::write(file, bytes + written, m_mapping_size - written);
+        if (result < 0 && errno == EINTR) {
+            continue;
+        }
+        if (result <= 0) {
+            break;
+        }
+        written += static_cast<std::size_t>(result);
+    }
+    ::close(file);
+    return written == m_mapping_size;
+}
+
+bool BinaryLogWriter::addString(BinaryLogStringKind kind,
+                                std::uint32_t string_id,
+                                std::string_view value) {
+    if (m_header == nullptr) {
+        return false;
+    }
+    std::lock_guard<std::mutex> lock(m_strings_mutex);
+    std::atomic_ref<std::uint64_t> used(m_header->strings_used);
+    std::size_t offset = used.load(std::memory_order_relaxed);
+    std::size_t length = std::min<std::size_t>(value.size(), UINT16_MAX);
+    std::size_t entry_size =
+            alignUp(sizeof(StringEntryHeader) + length, sizeof(std::uint64_t));
+    if (offset + entry_size > m_header->strings_capacity) {
+        return false;
+    }
+
+    char* entry = static_cast<char*>(m_mapping) + m_header->strings_offset +
+                  offset;
+    StringEntryHeader entry_header{static_cast<std::uint8_t>(kind),
+                                   0,
+                                   static_cast<std::uint16_t>(length),
+                                   string_id};
+    std::memcpy(entry, &entry_header, sizeof(entry_header));
+    std::memcpy(entry + sizeof(entry_header), value.data(), length);
+    used.store(offset + entry_size, std::memory_order_release);
+    return true;
+}
+
+void BinaryLogWriter::write(std::uint64_t timestamp_ns,
+                            std::uint32_t tag_id,
+                            std::uint32_t format_id,
+                            std::uint8_t severity,
+                            const BinaryLogArgs& args) {
+    if (m_header == nullptr) {
+        return;
+    }
+    std::uint64_t position =
+            std::atomic_ref<std::uint64_t>(m_header->write_cursor)
+                    .fetch_add(1, std::memory_order_relaxed);
+    BinaryLogRecord& record =
+            m_records[position % m_header->record_capacity];
+    std::atomic_ref<std::uint64_t> sequence(record.sequence);
+    std::atomic_ref<std::uint64_t> commit(record.commit);
+    commit.store(0, std::memory_order_relaxed);
+    sequence.store(0, std::memory_order_relaxed);
+    // Keeps the writes below from being seen before the record is cleared.
+    std::atomic_thread_fence(std::memory_order_release);
+    record.timestamp_ns = timestamp_ns;
+    record.tag_id = tag_id;
+    record.format_id = format_id;
+    record.severity = severity;
+    record.arg_count = args.count();
+    record.truncated = args.truncated() ? 1 : 0;
+    record.reserved = 0;
+    record.arg_bytes = args.size();
+    std::memcpy(record.args, args.data(), args.size());
+    commit.store(position + 1, std::memory_order_release);
+    sequence.store(position + 1, std::memory_order_release);
+}
+
+void BinaryLogWriter::sync(bool wait) {
+    if (m_fd != -1) {
+        ::msync(m_mapping, m_mapping_size, wait ? MS_SYNC : MS_ASYNC);
+    }
+}
+
+/*
+ * BinaryLogReader
+ */
+BinaryLogReader::BinaryLogReader(const std::string& path)
+        : m_mapping(MAP_FAILED), m_mapping_size(0), m_header(nullptr) {
+    int file = ::open(path.c_str(), O_RDONLY | O_CLOEXEC);
+    if (file == -1) {
+        return;
+    }
+    struct stat file_stat;
+    if (::fstat(file, &file_stat) != 0 ||
+        static_cast<std::size_t>(file_stat.st_size) <
+                sizeof(BinaryLogFileHeader)) {
+        ::close(file);
+        return;
+    }
+    m_mapping_size = static_cast<std::size_t>(file_stat.st_size);
+    m_mapping = ::mmap(
+            nullptr, m_mapping_size, PROT_READ, MAP_PRIVATE, file, 0);
+    ::close(file);
+    if (m_mapping == MAP_FAILED) {
+        return;
+    }
+
+    const BinaryLogFileHeader* header =
+            static_cast<const BinaryLogFileHeader*>(m_mapping);
+    if (std::memcmp(header->magic,
+                    BINARY_LOG_MAGIC,
+                    sizeof(BINARY_LOG_MAGIC)) != 0 ||
+        header->version != BINARY_LOG_VERSION ||
+        header->record_size != sizeof(BinaryLogRecord) ||
+        header->strings_offset + header->strings_capacity > m_mapping_size ||
+        header->strings_used > header->strings_capacity ||
+        header->records_offset +
+                        header->record_capacity * sizeof(BinaryLogRecord) >
+                m_mapping_size) {
+        return;
+    }
+    m_header = header;
+
+    const char* strings =
+            static_cast<const char*>(m_mapping) + header->strings_offset;
+    std::size_t offset = 0;
+    while (offset + sizeof(StringEntryHeader) <= header->strings_used) {
+        StringEntryHeader entry_header;
+        std::memcpy(&entry_header, strings + offset, sizeof(entry_header));
+        std::size_t value_offset = offset + sizeof(entry_header);
+        if (value_offset + entry_header.length > header->strings_used) {
+            break;
+        }
+        std::string value(strings + value_offset, entry_header.length);
+        if (entry_header.kind ==
+            static_cast<std::uint8_t>(BinaryLogStringKind::TAG)) {
+            m_tags[entry_header.string_id] = std::move(value);
+        } else if (entry_header.kind ==
+                   static_cast<std::uint8_t>(BinaryLogStringKind::FORMAT)) {
+            m_formats[entry_header.string_id] = std::move(value);
+        }
+        offset = alignUp(value_offset + entry_header.length,
+                         sizeof(std::uint64_t));
+    }
+}
+
+BinaryLogReader::~BinaryLogReader() {
+    if (m_mapping != MAP_FAILED) {
+        ::munmap(m_mapping, m_mapping_size);
+    }
+}
+
+bool BinaryLogReader::isValid() const { return m_header != nullptr; }
+
+std::vector<BinaryLogReader::Entry> BinaryLogReader::entries() const {
+    std::vector<Entry> ret_val;
+    if (!isValid()) {
+        return ret_val;
+    }
+
+    const BinaryLogRecord* records = reinterpret_cast<const BinaryLogRecord*>(
+            static_cast<const char*>(m_mapping) + m_header->records_offset);
+    std::uint64_t cursor = m_header->write_cursor;
+    std::uint64_t count = std::min(cursor, m_header->record_capacity);
+    for (std::uint64_t position = cursor - count; position < cursor;
+         ++position) {
+        // Decoded from a copy, which is only used if the record was
+        // committed before it was taken and not touched while taking it.
+        const BinaryLogRecord& slot =
+                records[position % m_header->record_capacity];
+        if (loadCommitWord(slot.sequence, std::memory_order_acquire) !=
+            position + 1) {
+            continue;
+        }
+        BinaryLogRecord record;
+        std::memcpy(&record, &slot, sizeof(record));
+        std::atomic_thread_fence(std::memory_order_acquire);
+        if (loadCommitWord(slot.commit, std::memory_order_relaxed) !=
+                    position + 1 ||
+            record.arg_bytes > BINARY_LOG_ARG_BYTES) {
+            continue;
+        }
+
+        Entry entry;
+        entry.timestamp_ns = record.timestamp_ns;
+        auto tag_it = m_tags.find(record.tag_id);
+        entry.tag = tag_it != m_tags.end()
+                            ? tag_it->second
+                            : "tag#" + std::to_string(record.tag_id);
+        entry.severity = severityName(record.severity);
+        auto format_it = m_formats.find(record.format_id);
+        entry.format = format_it != m_formats.end()
+                               ? format_it->second
+                               : "format#" + std::to_string(record.format_id);
+        entry.truncated = record.truncated != 0;
+
+        std::size_t offset = 0;
+        while (offset < record.arg_bytes) {
+            BinaryLogArgType type =
+                    static_cast<BinaryLogArgType>(record.args[offset++]);
+            std::ostringstream sstream;
+            std::size_t remaining = record.arg_bytes - offset;
+            if (type == BinaryLogArgType::STRING) {
+                std::uint16_t length = 0;
+                if (remaining < sizeof(length)) {
+                    break;
+                }
+                std::memcpy(&length, &record.args[offset], sizeof(length));
+                offset += sizeof(length);
+                if (length > record.arg_bytes - offset) {
+                    break;
+                }
+                entry.args.emplace_back(
+                        reinterpret_cast<const char*>(&record.args[offset]),
+                        length);
+                offset += length;
+                continue;
+            }
+            if (remaining < sizeof(std::uint64_t) &&
+                type != BinaryLogArgType::BOOL) {
+                break;
+            }
+            if (type == BinaryLogArgType::INT64) {
+                std::int64_t value;
+                std::memcpy(&value, &record.args[offset], sizeof(value));
+                sstream << value;
+                offset += sizeof(value);
+            } else if (type == BinaryLogArgType::UINT64) {
+                std::uint64_t value;
+                std::memcpy(&value, &record.args[offset], sizeof(value));
+                sstream << value;
+                offset += sizeof(value);
+            } else if (type == BinaryLogArgType::DOUBLE) {
+                double value;
+                std::memcpy(&value, &record.args[offset], sizeof(value));
+                sstream << value;
+                offset += sizeof(value);
+            } else if (type == BinaryLogArgType::POINTER) {
+                std::uint64_t value;
+                std::memcpy(&value, &record.args[offset], sizeof(value));
+                sstream << "0x" << std::hex << value;
+                offset += sizeof(value);
+            } else if (type == BinaryLogArgType::BOOL && remaining >= 1) {
+                sstream << static_cast<int>(record.args[offset]);
+                offset += 1;
+            } else {
+                break;
+            }
+            entry.args.push_back(sstream.str());
+        }
+        entry.message = substitute(entry.format, entry.args);
+        ret_val.push_back(std::move(entry));
+    }
+    return ret_val;
+}
+
+std::string BinaryLogReader::toText(const Entry& entry) {
+    time_t seconds = static_cast<time_t>(entry.timestamp_ns / 1000000000ull);
+    struct tm local_time;
+    ::localtime_r(&seconds, &local_time);
+    char date[32];
+    std::strftime(date, sizeof(date), "%Y-%m-%d %H:%M:%S", &local_time);
+
+    std::ostringstream sstream;
+    sstream << date << "." << std::setw(9) << std::setfill('0')
+            << entry.timestamp_ns % 1000000000ull << " " << entry.tag << " "
+            << entry.severity << " - '" << entry.message << "'";
+    if (entry.truncated) {
+        sstream << " [truncated]";
+    }
+    return sstream.str();
+}
+
+std::string BinaryLogReader::toJson(const Entry& entry) {
+    std::ostringstream sstream;
+    sstream << "{\"timestamp_ns\":" << entry.timestamp_ns << ",\"tag\":\""
+            << jsonEscape(entry.tag) << "\",\"severity\":\"" << entry.severity
+            << "\",\"format\":\"" << jsonEscape(entry.format)
+            << "\",\"args\":[";
+    for (std::size_t index = 0; index < entry.args.size(); ++index) {
+        sstream << (index == 0 ? "\"" : ",\"") << jsonEscape(entry.args[index])
+                << "\"";
+    }
+    sstream << "],\"message\":\"" << jsonEscape(entry.message)
+            << "\",\"truncated\":" << (entry.truncated ? "true" : "false")
+            << "}";
+    return sstream.str();
+}
+}  // namespace intel_vulkan
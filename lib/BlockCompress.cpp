@@ -0,0 +1,750 @@
+////////////////////////////////////////////////////////////////////////////
+// Copyright (c) 2026 intel_vulkan
+// All rights reserved.
+//
+// Contact: mehoggan@gmail.com
+//
+// This software is licensed under the terms of the Your License.
+// See the LICENSE file in the top-level directory.
+/////////////////////////////////////////////////////////////////////////
+#include "intel_vulkan/BlockCompress.h"
+
+#include <algorithm>
+#include <cfloat>
+#include <cmath>
+#include <cstring>
+#include <limits>
+#include <thread>
+#include <utility>
+
+#if defined(__SSE2__)
+#include <emmintrin.h>
+#endif
+
+namespace intel_vulkan::Tools {
+
+namespace {
+// Images with fewer blocks than this are compressed on the calling thread;
+// starting threads would cost more than the compression.
+constexpr std::size_t MIN_PARALLEL_BLOCKS = 64 * 64;
+
+// How far each BC1 palette entry lies from color 0 to color 1.
+constexpr float BC1_WEIGHTS[4] = {0.0f, 1.0f, 1.0f / 3.0f, 2.0f / 3.0f};
+
+// The BC7 interpolation weights of 4 bit indices, out of 64.
+constexpr int BC7_WEIGHTS[16] = {
+        0, 4, 9, 13, 17, 21, 26, 30, 34, 38, 43, 47, 51, 55, 60, 64};
+
+// The mode 6 bits of the first byte of a BC7 block.
+constexpr std::uint64_t BC7_MODE_6 = 0x40;
+
+// One 4x4 block with the 16 values of each channel side by side, so the
+// same channel of 4 pixels loads as one vector.
+struct Block {
+    alignas(16) float channels[4][16];
+};
+
+void loadBlock(const std::uint8_t* rgba,
+               std::uint32_t width,
+               std::uint32_t height,
+               std::size_t row_pitch,
+               std::uint32_t block_x,
+               std::uint32_t block_y,
+               Block* block) {
+    for (std::uint32_t row = 0; row < 4; ++row) {
+        const std::uint8_t* line =
+                rgba + std::min(block_y * 4 + row, height - 1) * row_pitch;
+        for (std::uint32_t column = 0; column < 4; ++column) {
+            const std::uint8_t* pixel =
+                    line + std::min(block_x * 4 + column, width - 1) * 4;
+            for (std::size_t channel = 0; channel < 4; ++channel) {
+                block->channels[channel][row * 4 + column] = pixel[channel];
+            }
+        }
+    }
+}
+
+// Gives every pixel the index of the closest of the first palette_size
+// entries, comparing the channels from first_channel on. Returns the
+// summed squared error.
+float selectIndices(const Block& block,
+                    const float (*palette)[4],
+                    int palette_size,
+                    int first_channel,
+                    int channel_count,
+                    std::uint8_t* indices) {
+    float error = 0.0f;
+#if defined(__SSE2__)
+    for (int quad = 0; quad < 4; ++quad) {
+        __m128 best = _mm_set1_ps(FLT_MAX);
+        __m128i best_index = _mm_setzero_si128();
+        for (int entry = 0; entry < palette_size; ++entry) {
+            __m128 distance = _mm_setzero_ps();
+            for (int channel = first_channel;
+                 channel < first_channel + channel_count;
+                 ++channel) {
+                __m128 delta = _mm_sub_ps(
+                        _mm_load_ps(&block.channels[channel][quad * 4]),
+                        _mm_set1_ps(palette[entry][channel]));
+                distance = _mm_add_ps(distance, _mm_mul_ps(delta, delta));
+            }
+            __m128i closer = _mm_castps_si128(_mm_cmplt_ps(distance, best));
+            best = _mm_min_ps(distance, best);
+            best_index = _mm_or_si128(
+                    _mm_and_si128(closer, _mm_set1_epi32(entry)),
+                    _mm_andnot_si128(closer, best_index));
+        }
+        alignas(16) float distances[4];
+        alignas(16) std::int32_t lanes[4];
+        _mm_store_ps(distances, best);
+        _mm_store_si128(reinterpret_cast<__m128i*>(lanes), best_index);
+        for (int lane = 0; lane < 4; ++lane) {
+            indices[quad * 4 + lane] = static_cast<std::uint8_t>(lanes[lane]);
+            error += distances[lane];
+        }
+    }
+#else
+    for (int pixel = 0; pixel < 16; ++pixel) {
+        float best = FLT_MAX;
+        for (int entry = 0; entry < palette_size; ++entry) {
+            float distance = 0.0f;
+            for (int channel = first_channel;
+                 channel < first_channel + channel_count;
+                 ++channel) {
+                float delta = block.channels[channel][pixel] -
+                              palette[entry][channel];
+                distance += delta * delta;
+            }
+            if (distance < best) {
+                best = distance;
+                indices[pixel] = static_cast<std::uint8_t>(entry);
+            }
+        }
+        error += best;
+    }
+#endif
+    return error;
+}
+
+// Fits a line through the colors of the block along their principal axis
+// and returns the ends of the range the pixels project onto.
+void principalEndpoints(const Block& block,
+                        int channel_count,
+                        float* start,
+                        float* end) {
+    float mean[4] = {};
+    float axis[4] = {};
+    for (int channel = 0; channel < channel_count; ++channel) {
+        const float* values = block.channels[channel];
+        float low = values[0];
+        float high = values[0];
+        for (int pixel = 0; pixel < 16; ++pixel) {
+            mean[channel] += values[pixel];
+            low = std::min(low, values[pixel]);
+            high = std::max(high, values[pixel]);
+        }
+        mean[channel] /= 16.0f;
+        axis[channel] = high - low;
+    }
+
+    float covariance[4][4] = {};
+    for (int row = 0; row < channel_count; ++row) {
+        for (int column = row; column < channel_count; ++column) {
+            float sum = 0.0f;
+            for (int pixel = 0; pixel < 16; ++pixel) {
+                sum += (block.channels[row][pixel] - mean[row]) *
+                       (block.channels[column][pixel] - mean[column]);
+            }
+            covariance[row][column] = sum;
+            covariance[column][row] = sum;
+        }
+    }
+    // Power iteration from the bounding box diagonal.
+    for (int iteration = 0; iteration < 8; ++iteration) {
+        float next[4] = {};
+        float length = 0.0f;
+        for (int row = 0; row < channel_count; ++row) {
+            for (int column = 0; column < channel_count; ++column) {
+                next[row] += covariance[row][column] * axis[column];
+            }
+            length = std::max(length, std::abs(next[row]));
+        }
+        if (length <= 0.0f) {
+            break;
+        }
+        for (int channel = 0; channel < channel_count; ++channel) {
+            axis[channel] = next[channel] / length;
+        }
+    }
+
+    float norm = 0.0f;
+    for (int channel = 0; channel < channel_count; ++channel) {
+        norm += axis[channel] * axis[channel];
+    }
+    float low = 0.0f;
+    float high = 0.0f;
+    if (norm > 0.0f) {
+        low = FLT_MAX;
+        high = -FLT_MAX;
+        for (int pixel = 0; pixel < 16; ++pixel) {
+            float projection = 0.0f;
+            for (int channel = 0; channel < channel_count; ++channel) {
+                projection += (block.channels[channel][pixel] - mean[channel]) *
+                              axis[channel];
+            }
+            low = std::min(low, projection);
+            high = std::max(high, projection);
+        }
+        low /= norm;
+        high /= norm;
+    }
+    for (int channel = 0; channel < channel_count; ++channel) {
+        start[channel] =
+                std::clamp(mean[channel] + low * axis[channel], 0.0f, 255.0f);
+        end[channel] =
+                std::clamp(mean[channel] + high * axis[channel], 0.0f, 255.0f);
+    }
+}
+
+// The endpoints that minimize the squared error of the chosen indices,
+// where weights[index] is how far that palette entry lies from start to
+// end. Returns false if the indices do not pin down both endpoints.
+bool refitEndpoints(const Block& block,
+                    const std::uint8_t* indices,
+                    const float* weights,
+                    int channel_count,
+                    float* start,
+                    float* end) {
+    float start_start = 0.0f;
+    float start_end = 0.0f;
+    float end_end = 0.0f;
+    float start_sum[4] = {};
+    float end_sum[4] = {};
+    for (int pixel = 0; pixel < 16; ++pixel) {
+        float to_end = weights[indices[pixel]];
+        float to_start = 1.0f - to_end;
+        start_start += to_start * to_start;
+        start_end += to_start * to_end;
+        end_end += to_end * to_end;
+        for (int channel = 0; channel < channel_count; ++channel) {
+            start_sum[channel] += to_start * block.channels[channel][pixel];
+            end_sum[channel] += to_end * block.channels[channel][pixel];
+        }
+    }
+    float determinant = start_start * end_end - start_end * start_end;
+    if (std::abs(determinant) < 1e-6f) {
+        return false;
+    }
+    for (int channel = 0; channel < channel_count; ++channel) {
+        start[channel] = std::clamp((end_end * start_sum[channel] -
+                                     start_end * end_sum[channel]) /
+                                            determinant,
+                                    0.0f,
+                                    255.0f);
+        end[channel] = std::clamp((start_start * end_sum[channel] -
+                                   start_end * start_sum[channel]) /
+                                          determinant,
+                                  0.0f,
+                                  255.0f);
+    }
+    return true;
+}
+
+void toFloatPalette(const int (*palette)[4], int size, float (*out)[4]) {
+    for (int entry = 0; entry < size; ++entry) {
+        for (int channel = 0; channel < 4; ++channel) {
+            out[entry][channel] = static_cast<float>(palette[entry][channel]);
+        }
+    }
+}
+
+// Writes bits from the least significant bit of a 128 bit block on.
+struct BitWriter {
+    std::uint64_t low = 0;
+    std::uint64_t high = 0;
+    int position = 0;
+
+    void put(std::uint64_t value, int count) {
+        if (position < 64) {
+            low |= value << position;
+            if (position + count > 64) {
+                high |= value >> (64 - position);
+            }
+        } else {
+            high |= value << (position - 64);
+        }
+        position += count;
+    }
+};
+
+struct BitReader {
+    std::uint64_t low;
+    std::uint64_t high;
+    int position = 0;
+
+    int get(int count) {
+        std::uint64_t value;
+        if (position >= 64) {
+            value = high >> (position - 64);
+        } else {
+            value = low >> position;
+            if (position + count > 64) {
+                value |= high << (64 - position);
+            }
+        }
+        position += count;
+        return static_cast<int>(value & ((1u << count) - 1));
+    }
+};
+
+std::uint16_t packRgb565(const float* color) {
+    return static_cast<std::uint16_t>(
+            (std::lround(color[0] * 31.0f / 255.0f) << 11) |
+            (std::lround(color[1] * 63.0f / 255.0f) << 5) |
+            std::lround(color[2] * 31.0f / 255.0f));
+}
+
+void unpackRgb565(std::uint16_t packed, int* color) {
+    int red = packed >> 11;
+    int green = (packed >> 5) & 63;
+    int blue = packed & 31;
+    color[0] = (red << 3) | (red >> 2);
+    color[1] = (green << 2) | (green >> 4);
+    color[2] = (blue << 3) | (blue >> 2);
+    color[3] = 255;
+}
+
+void bc1Palette(std::uint16_t color0,
+                std::uint16_t color1,
+                bool four_colors,
+                int (*palette)[4]) {
+    unpackRgb565(color0, palette[0]);
+    unpackRgb565(color1, palette[1]);
+    for (int channel = 0; channel < 3; ++channel) {
+        int first = palette[0][channel];
+        int second = palette[1][channel];
+        if (four_colors) {
+            palette[2][channel] = (2 * first + second) / 3;
+            palette[3][channel] = (first + 2 * second) / 3;
+        } else {
+            palette[2][channel] = (first + second) / 2;
+            palette[3][channel] = 0;
+        }
+    }
+    palette[2][3] = 255;
+    palette[3][3] = four_colors ? 255 : 0;
+}
+
+void bc4Palette(int alpha0, int alpha1, int* values) {
+    values[0] = alpha0;
+    values[1] = alpha1;
+    if (alpha0 > alpha1) {
+        for (int index = 2; index < 8; ++index) {
+            values[index] = ((8 - index) * alpha0 + (index - 1) * alpha1) / 7;
+        }
+    } else {
+        for (int index = 2; index < 6; ++index) {
+            values[index] = ((6 - index) * alpha0 + (index - 1) * alpha1) / 5;
+        }
+        values[6] = 0;
+        values[7] = 255;
+    }
+}
+
+void bc7Palette(const int* endpoint0, const int* endpoint1, int (*palette)[4]) {
+    for (int index = 0; index < 16; ++index) {
+        int weight = BC7_WEIGHTS[index];
+        for (int channel = 0; channel < 4; ++channel) {
+            palette[index][channel] = ((64 - weight) * endpoint0[channel] +
+                                       weight * endpoint1[channel] + 32) >>
+                                      6;
+        }
+    }
+}
+
+// The 4 color RGB565 block of BC1 and BC3.
+void encodeColor(const Block& block, std::uint8_t* out) {
+    float start[4];
+    float end[4];
+    principalEndpoints(block, 3, start, end);
+
+    float best_error = FLT_MAX;
+    std::uint16_t best_colors[2] = {};
+    std::uint8_t best_indices[16] = {};
+    for (int pass = 0; pass < 3; ++pass) {
+        std::uint16_t color0 = packRgb565(end);
+        std::uint16_t color1 = packRgb565(start);
+        // Color 0 above color 1 selects the 4 color palette.
+        if (color0 < color1) {
+            std::swap(color0, color1);
+        }
+        int palette[4][4];
+        float values[4][4];
+        bc1Palette(color0, color1, true, palette);
+        toFloatPalette(palette, 4, values);
+        std::uint8_t indices[16];
+        float error = selectIndices(
+                block, values, color0 == color1 ? 1 : 4, 0, 3, indices);
+        if (error < best_error) {
+            best_error = error;
+            best_colors[0] = color0;
+            best_colors[1] = color1;
+            std::memcpy(best_indices, indices, sizeof(indices));
+        }
+        if (error == 0.0f ||
+            !refitEndpoints(block, indices, BC1_WEIGHTS, 3, end, start)) {
+            break;
+        }
+    }
+
+    std::uint32_t bits = 0;
+    for (int pixel = 0; pixel < 16; ++pixel) {
+        bits |= static_cast<std::uint32_t>(best_indices[pixel]) << (2 * pixel);
+    }
+    std::memcpy(out, best_colors, sizeof(best_colors));
+    std::memcpy(out + 4, &bits, sizeof(bits));
+}
+
+// The 8 value alpha block of BC3, between the lowest and highest alpha.
+void encodeAlpha(const Block& block, std::uint8_t* out) {
+    const float* alpha = block.channels[3];
+    int alpha0 = static_cast<int>(*std::max_element(alpha, alpha + 16));
+    int alpha1 = static_cast<int>(*std::min_element(alpha, alpha + 16));
+    int values[8];
+    bc4Palette(alpha0, alpha1, values);
+    float palette[8][4] = {};
+    for (int index = 0; index < 8; ++index) {
+        palette[index][3] = static_cast<float>(values[index]);
+    }
+    std::uint8_t indices[16];
+    selectIndices(block, palette, alpha0 == alpha1 ? 1 : 8, 3, 1, indices);
+
+    std::uint64_t bits = 0;
+    for (int pixel = 0; pixel < 16; ++pixel) {
+        bits |= static_cast<std::uint64_t>(indices[pixel]) << (3 * pixel);
+    }
+    out[0] = static_cast<std::uint8_t>(alpha0);
+    out[1] = static_cast<std::uint8_t>(alpha1);
+    std::memcpy(out + 2, &bits, 6);
+}
+
+// Rounds an endpoint to 7 bits per channel plus the p-bit the channels
+// share, whichever p-bit loses the least.
+void quantizeBc7Endpoint(const float* color, int* quantized, int* pbit) {
+    float best_error = FLT_MAX;
+    for (int bit = 0; bit < 2; ++bit) {
+        int values[4];
+        float error = 0.0f;
+        for (int channel = 0; channel < 4; ++channel) {
+            values[channel] = std::clamp(
+                    static_cast<int>(std::lround((color[channel] - bit) / 2)),
+                    0,
+                    127);
+            float delta = static_cast<float>(values[channel] * 2 + bit) -
+                          color[channel];
+            error += delta * delta;
+        }
+        if (error < best_error) {
+            best_error = error;
+            std::copy(values, values + 4, quantized);
+            *pbit = bit;
+        }
+    }
+}
+
+// BC7 mode 6: one subset, RGBA endpoints of 7 bits plus a p-bit each and
+// 4 bit indices.
+void encodeBc7(const Block& block, std::uint8_t* out) {
+    float start[4];
+    float end[4];
+    principalEndpoints(block, 4, start, end);
+    float weights[16];
+    for (int index = 0; index < 16; ++index) {
+        weights[index] = BC7_WEIGHTS[index] / 64.0f;
+    }
+
+    float best_error = FLT_MAX;
+    int best_endpoints[2][4] = {};
+    int best_pbits[2] = {};
+    std::uint8_t best_indices[16] = {};
+    for (int pass = 0; pass < 3; ++pass) {
+        int endpoints[2][4];
+        int pbits[2];
+        quantizeBc7Endpoint(start, endpoints[0], &pbits[0]);
+        quantizeBc7Endpoint(end, endpoints[1], &pbits[1]);
+        int expanded[2][4];
+        for (int side = 0; side < 2; ++side) {
+            for (int channel = 0; channel < 4; ++channel) {
+                expanded[side][channel] =
+                        endpoints[side][channel] * 2 + pbits[side];
+            }
+        }
+        int palette[16][4];
+        float values[16][4];
+        bc7Palette(expanded[0], expanded[1], palette);
+        toFloatPalette(palette, 16, values);
+        std::uint8_t indices[16];
+        float error = selectIndices(block, values, 16, 0, 4, indices);
+        if (error < best_error) {
+            best_error = error;
+            std::memcpy(best_endpoints, endpoints, sizeof(endpoints));
+            std::memcpy(best_pbits, pbits, sizeof(pbits));
+            std::memcpy(best_indices, indices, sizeof(indices));
+        }
+        if (error == 0.0f ||
+            !refitEndpoints(block, indices, weights, 4, start, end)) {
+            break;
+        }
+    }
+
+    // The first index is stored without its top bit, which must be 0.
+    if (best_indices[0] >= 8) {
+        std::swap(best_endpoints[0], best_endpoints[1]);
+        std::swap(best_pbits[0], best_pbits[1]);
+        for (std::uint8_t& index : best_indices) {
+            index = static_cast<std::uint8_t>(15 - index);
+        }
+    }
+    BitWriter writer;
+    writer.put(BC7_MODE_6, 7);
+    for (int channel = 0; channel < 4; ++channel) {
+        writer.put(static_cast<std::uint64_t>(best_endpoints[0][channel]), 7);
+        writer.put(static_cast<std::uint64_t>(best_endpoints[1][channel]), 7);
+    }
+    writer.put(static_cast<std::uint64_t>(best_pbits[0]), 1);
+    writer.put(static_cast<std::uint64_t>(best_pbits[1]), 1);
+    writer.put(best_indices[0], 3);
+    for (int pixel = 1; pixel < 16; ++pixel) {
+        writer.put(best_indices[pixel], 4);
+    }
+    std::memcpy(out, &writer.low, sizeof(writer.low));
+    std::memcpy(out + 8, &writer.high, sizeof(writer.high));
+}
+
+void decodeColor(const std::uint8_t* in, bool four_colors, int (*pixels)[4]) {
+    std::uint16_t colors[2];
+    std::uint32_t bits;
+    std::memcpy(colors, in, sizeof(colors));
+    std::memcpy(&bits, in + 4, sizeof(bits));
+    int palette[4][4];
+    bc1Palette(colors[0],
+               colors[1],
+               four_colors || colors[0] > colors[1],
+               palette);
+    for (int pixel = 0; pixel < 16; ++pixel) {
+        std::copy(palette[(bits >> (2 * pixel)) & 3],
+                  palette[(bits >> (2 * pixel)) & 3] + 4,
+                  pixels[pixel]);
+    }
+}
+
+void decodeAlpha(const std::uint8_t* in, int (*pixels)[4]) {
+    int values[8];
+    bc4Palette(in[0], in[1], values);
+    std::uint64_t bits = 0;
+    std::memcpy(&bits, in + 2, 6);
+    for (int pixel = 0; pixel < 16; ++pixel) {
+        pixels[pixel][3] = values[(bits >> (3 * pixel)) & 7];
+    }
+}
+
+void decodeBc7(const std::uint8_t* in, int (*pixels)[4]) {
+    BitReader reader{};
+    std::memcpy(&reader.low, in, sizeof(reader.low));
+    std::memcpy(&reader.high, in + 8, sizeof(reader.high));
+    if ((reader.low & 0x7f) != BC7_MODE_6) {
+        std::memset(pixels, 0, sizeof(int[16][4]));
+        return;
+    }
+    reader.get(7);
+    int endpoints[2][4];
+    for (int channel = 0; channel < 4; ++channel) {
+        endpoints[0][channel] = reader.get(7) << 1;
+        endpoints[1][channel] = reader.get(7) << 1;
+    }
+    int pbit0 = reader.get(1);
+    int pbit1 = reader.get(1);
+    for (int channel = 0; channel < 4; ++channel) {
+        endpoints[0][channel] |= pbit0;
+        endpoints[1][channel] |= pbit1;
+    }
+    int palette[16][4];
+    bc7Palette(endpoints[0], endpoints[1], palette);
+    for (int pixel = 0; pixel < 16; ++pixel) {
+        int index = reader.get(pixel == 0 ? 3 : 4);
+        std::copy(palette[index], palette[index] + 4, pixels[pixel]);
+    }
+}
+
+std::size_t bytesPerBlock(BlockFormat format) {
+    return format == BlockFormat::BC1 ? 8 : 16;
+}
+
+void compressRows(const std::uint8_t* rgba,
+                  std::uint32_t width,
+                  std::uint32_t height,
+                  std::size_t row_pitch,
+                  BlockFormat format,
+                  std::uint8_t* out,
+                  std::uint32_t row_begin,
+                  std::uint32_t row_end) {
+    std::uint32_t blocks_wide = (width + 3) / 4;
+    std::size_t block_bytes = bytesPerBlock(format);
+    Block block;
+    for (std::uint32_t row = row_begin; row < row_end; ++row) {
+        for (std::uint32_t column = 0; column < blocks_wide; ++column) {
+            loadBlock(rgba, width, height, row_pitch, column, row, &block);
+            std::uint8_t* destination =
+                    out + (static_cast<std::size_t>(row) * blocks_wide +
+                           column) *
+                                  block_bytes;
+            switch (format) {
+                case BlockFormat::BC1:
+                    encodeColor(block, destination);
+                    break;
+                case BlockFormat::BC3:
+                    encodeAlpha(block, destination);
+                    encodeColor(block, destination + 8);
+                    break;
+                case BlockFormat::BC7:
+                    encodeBc7(block, destination);
+                    break;
+            }
+        }
+    }
+}
+}  // namespace
+
+VkFormat vulkanFormat(BlockFormat format, bool srgb) {
+    switch (format) {
+        case BlockFormat::BC1:
+            return srgb ? VK_FORMAT_BC1_RGB_SRGB_BLOCK
+                        : VK_FORMAT_BC1_RGB_UNORM_BLOCK;
+        case BlockFormat::BC3:
+            return srgb ? VK_FORMAT_BC3_SRGB_BLOCK : VK_FORMAT_BC3_UNORM_BLOCK;
+        case BlockFormat::BC7:
+            return srgb ? VK_FORMAT_BC7_SRGB_BLOCK : VK_FORMAT_BC7_UNORM_BLOCK;
+    }
+    return VK_FORMAT_UNDEFINED;
+}
+
+std::vector<char> compressBlocks(const void* rgba,
+                                 std::uint32_t width,
+                                 std::uint32_t height,
+                                 std::size_t row_pitch,
+                                 BlockFormat format,
+                                 std::size_t thread_count) {
+    std::vector<char> blocks;
+    if (width == 0 || height == 0 || rgba == nullptr) {
+        return blocks;
+    }
+    if (row_pitch == 0) {
+        row_pitch = static_cast<std::size_t>(width) * 4;
+    }
+    if (thread_count == 0) {
+        thread_count = std::max(1u, std::thread::hardware_concurrency());
+    }
+    std::uint32_t blocks_wide = (width + 3) / 4;
+    std::uint32_t blocks_high = (height + 3) / 4;
+    blocks.resize(static_cast<std::size_t>(blocks_wide) * blocks_high *
+                  bytesPerBlock(format));
+
+    auto compress = [&](std::uint32_t row_begin, std::uint32_t row_end) {
+        compressRows(static_cast<const std::uint8_t*>(rgba),
+                     width,
+                     height,
+                     row_pitch,
+                     format,
+                     reinterpret_cast<std::uint8_t*>(blocks.data()),
+                     row_begin,
+                     row_end);
+    };
+    std::size_t bands = std::min<std::size_t>(thread_count, blocks_high);
+    if (bands <= 1 ||
+        static_cast<std::size_t>(blocks_wide) * blocks_high <
+                MIN_PARALLEL_BLOCKS) {
+        compress(0, blocks_high);
+        return blocks;
+    }
+    std::uint32_t band_rows =
+            static_cast<std::uint32_t>((blocks_high + bands - 1) / bands);
+    std::vector<std::thread> threads;
+    for (std::uint32_t row = band_rows; row < blocks_high; row += band_rows) {
+        threads.emplace_back(
+                compress, row, std::min(row + band_rows, blocks_high));
+    }
+    compress(0, band_rows);
+    for (std::thread& thread : threads) {
+        thread.join();
+    }
+    return blocks;
+}
+
+void decompressBlocks(const void* blocks,
+                      std::uint32_t width,
+                      std::uint32_t height,
+                      BlockFormat format,
+                      void* rgba) {
+    const std::uint8_t* in = static_cast<const std::uint8_t*>(blocks);
+    std::uint8_t* out = static_cast<std::uint8_t*>(rgba);
+    std::size_t block_bytes = bytesPerBlock(format);
+    for (std::uint32_t block_y = 0; block_y < height; block_y += 4) {
+        for (std::uint32_t block_x = 0; block_x < width; block_x += 4) {
+            int pixels[16][4];
+            switch (format) {
+                case BlockFormat::BC1:
+                    decodeColor(in, false, pixels);
+                    break;
+                case BlockFormat::BC3:
+                    decodeColor(in + 8, true, pixels);
+                    decodeAlpha(in, pixels);
+                    break;
+                case BlockFormat::BC7:
+                    decodeBc7(in, pixels);
+                    break;
+            }
+            in += block_bytes;
+            for (std::uint32_t row = 0;
+                 row < 4 && block_y + row < height;
+                 ++row) {
+                for (std::uint32_t column = 0;
+                     column < 4 && block_x + column < width;
+                     ++column) {
+                    std::uint8_t* pixel =
+                            out + ((static_cast<std::size_t>(block_y) + row) *
+                                           width +
+                                   block_x + column) *
+                                          4;
+                    for (int channel = 0; channel < 4; ++channel) {
+                        pixel[channel] = static_cast<std::uint8_t>(
+                                pixels[row * 4 + column][channel]);
+                    }
+                }
+            }
+        }
+    }
+}
+
+double psnr(const void* reference,
+            const void* actual,
+            std::size_t pixel_count,
+            bool with_alpha) {
+    const std::uint8_t* expected = static_cast<const std::uint8_t*>(reference);
+    const std::uint8_t* decoded = static_cast<const std::uint8_t*>(actual);
+    std::size_t channel_count = with_alpha ? 4 : 3;
+    double squared_error = 0.0;
+    for (std::size_t pixel = 0; pixel < pixel_count; ++pixel) {
+        for (std::size_t channel = 0; channel < channel_count; ++channel) {
+            double delta = static_cast<double>(expected[pixel * 4 + channel]) -
+                           decoded[pixel * 4 + channel];
+            squared_error += delta * delta;
+        }
+    }
+    if (squared_error == 0.0) {
+        return std::numeric_limits<double>::infinity();
+    }
+    double mean =
+            squared_error / static_cast<double>(pixel_count * channel_count);
+    return 10.0 * std::log10(255.0 * 255.0 / mean);
+}
+}  // namespace intel_vulkan::Tools
@@ -0,0 +1,547 @@
+////////////////////////////////////////////////////////////////////////////
+// Copyright (c) 2026 intel_vulkan
+// All rights reserved.
+//
+// Contact: mehoggan@gmail.com
+//
+// This software is licensed under the terms of the Your License.
+// See the LICENSE file in the top-level directory.
+/////////////////////////////////////////////////////////////////////////
+#include "intel_vulkan/CompressedTexture.h"
+
+#include <algorithm>
+#include <bit>
+#include <cstring>
+#include <fstream>
+#include <iostream>
+
+namespace intel_vulkan::Tools {
+
+namespace {
+constexpr unsigned char KTX2_IDENTIFIER[12] = {
+        0xab, 'K', 'T', 'X', ' ', '2', '0', 0xbb, '\r', '\n', 0x1a, '\n'};
+
+// KTX2 header fields after the identifier, see the KTX 2.0 specification.
+struct Ktx2Header {
+    std::uint32_t vk_format;
+    std::uint32_t type_size;
+    std::uint32_t pixel_width;
+    std::uint32_t pixel_height;
+    std::uint32_t pixel_depth;
+    std::uint32_t layer_count;
+    std::uint32_t face_count;
+    std::uint32_t level_count;
+    std::uint32_t supercompression_scheme;
+    std::uint32_t dfd_byte_offset;
+    std::uint32_t dfd_byte_length;
+    std::uint32_t kvd_byte_offset;
+    std::uint32_t kvd_byte_length;
+    // 64 bit fields at an offset that is only 4 aligned in this struct.
+    std::uint32_t sgd_byte_offset[2];
+    std::uint32_t sgd_byte_length[2];
+};
+static_assert(sizeof(Ktx2Header) == 68);
+
+struct Ktx2LevelIndex {
+    std::uint64_t byte_offset;
+    std::uint64_t byte_length;
+    std::uint64_t uncompressed_byte_length;
+};
+
+// DDS_PIXELFORMAT, DDS_HEADER and DDS_HEADER_DXT10 from the DirectX
+// documentation.
+struct DdsPixelFormat {
+    std::uint32_t size;
+    std::uint32_t flags;
+    std::uint32_t four_cc;
+    std::uint32_t rgb_bit_count;
+    std::uint32_t masks[4];
+};
+
+struct DdsHeader {
+    std::uint32_t size;
+    std::uint32_t flags;
+    std::uint32_t height;
+    std::uint32_t width;
+    std::uint32_t pitch_or_linear_size;
+    std::uint32_t depth;
+    std::uint32_t mip_map_count;
+    std::uint32_t reserved1[11];
+    DdsPixelFormat pixel_format;
+    std::uint32_t caps;
+    std::uint32_t caps2;
+    std::uint32_t caps3;
+    std::uint32_t caps4;
+    std::uint32_t reserved2;
+};
+static_assert(sizeof(DdsHeader) == 124);
+
+struct DdsHeaderDx10 {
+    std::uint32_t dxgi_format;
+    std::uint32_t resource_dimension;
+    std::uint32_t misc_flag;
+    std::uint32_t array_size;
+    std::uint32_t misc_flags2;
+};
+
+constexpr std::uint32_t DDS_MAGIC = 0x20534444;  // "DDS "
+constexpr std::uint32_t DDPF_FOURCC = 0x4;
+constexpr std::uint32_t DDSCAPS2_CUBEMAP = 0x200;
+constexpr std::uint32_t DDSCAPS2_VOLUME = 0x200000;
+constexpr std::uint32_t DDS_DIMENSION_TEXTURE2D = 3;
+
+constexpr std::uint32_t fourCc(const char (&code)[5]) {
+    return static_cast<std::uint32_t>(code[0]) |
+           (static_cast<std::uint32_t>(code[1]) << 8) |
+           (static_cast<std::uint32_t>(code[2]) << 16) |
+           (static_cast<std::uint32_t>(code[3]) << 24);
+}
+
+VkFormat formatFromFourCc(std::uint32_t four_cc) {
+    switch (four_cc) {
+        case fourCc("DXT1"):
+            return VK_FORMAT_BC1_RGBA_UNORM_BLOCK;
+        case fourCc("DXT2"):
+        case fourCc("DXT3"):
+            return VK_FORMAT_BC2_UNORM_BLOCK;
+        case fourCc("DXT4"):
+        case fourCc("DXT5"):
+            return VK_FORMAT_BC3_UNORM_BLOCK;
+        case fourCc("ATI1"):
+        case fourCc("BC4U"):
+            return VK_FORMAT_BC4_UNORM_BLOCK;
+        case fourCc("BC4S"):
+            return VK_FORMAT_BC4_SNORM_BLOCK;
+        case fourCc("ATI2"):
+        case fourCc("BC5U"):
+            return VK_FORMAT_BC5_UNORM_BLOCK;
+        case fourCc("BC5S"):
+            return VK_FORMAT_BC5_SNORM_BLOCK;
+        default:
+            return VK_FORMAT_UNDEFINED;
+    }
+}
+
+VkFormat formatFromDxgi(std::uint32_t dxgi_format) {
+    switch (dxgi_format) {
+        case 71:  // DXGI_FORMAT_BC1_UNORM
+            return VK_FORMAT_BC1_RGBA_UNORM_BLOCK;
+        case 72:  // DXGI_FORMAT_BC1_UNORM_SRGB
+            return VK_FORMAT_BC1_RGBA_SRGB_BLOCK;
+        case 74:  // DXGI_FORMAT_BC2_UNORM
+            return VK_FORMAT_BC2_UNORM_BLOCK;
+        case 75:  // DXGI_FORMAT_BC2_UNORM_SRGB
+            return VK_FORMAT_BC2_SRGB_BLOCK;
+        case 77:  // DXGI_FORMAT_BC3_UNORM
+            return VK_FORMAT_BC3_UNORM_BLOCK;
+        case 78:  // DXGI_FORMAT_BC3_UNORM_SRGB
+            return VK_FORMAT_BC3_SRGB_BLOCK;
+        case 80:  // DXGI_FORMAT_BC4_UNORM
+            return VK_FORMAT_BC4_UNORM_BLOCK;
+        case 81:  // DXGI_FORMAT_BC4_SNORM
+            return VK_FORMAT_BC4_SNORM_BLOCK;
+        case 83:  // DXGI_FORMAT_BC5_UNORM
+            return VK_FORMAT_BC5_UNORM_BLOCK;
+        case 84:  // DXGI_FORMAT_BC5_SNORM
+            return VK_FORMAT_BC5_SNORM_BLOCK;
+        case 95:  // DXGI_FORMAT_BC6H_UF16
+            return VK_FORMAT_BC6H_UFLOAT_BLOCK;
+        case 96:  // DXGI_FORMAT_BC6H_SF16
+            return VK_FORMAT_BC6H_SFLOAT_BLOCK;
+        case 98:  // DXGI_FORMAT_BC7_UNORM
+            return VK_FORMAT_BC7_UNORM_BLOCK;
+        case 99:  // DXGI_FORMAT_BC7_UNORM_SRGB
+            return VK_FORMAT_BC7_SRGB_BLOCK;
+        default:
+            return VK_FORMAT_UNDEFINED;
+    }
+}
+
+std::size_t levelSize(VkFormat format,
+                      std::uint32_t width,
+                      std::uint32_t height) {
+    return static_cast<std::size_t>((width + 3) / 4) * ((height + 3) / 4) *
+           blockSize(format);
+}
+
+// The levels of a full mip chain down to 1x1, floor(log2(max(w, h))) + 1,
+// at most 32, so a level index never shifts a size by 32 or more.
+std::uint32_t maxLevelCount(std::uint32_t width, std::uint32_t height) {
+    return static_cast<std::uint32_t>(std::bit_width(std::max(width, height)));
+}
+
+std::size_t alignUp(std::size_t value, std::size_t alignment) {
+    return (value + alignment - 1) / alignment * alignment;
+}
+
+// Khronos data format descriptor values, see the Khronos Data Format
+// specification.
+constexpr std::uint32_t KHR_DF_MODEL_BC1A = 128;
+constexpr std::uint32_t KHR_DF_MODEL_BC2 = 129;
+constexpr std::uint32_t KHR_DF_MODEL_BC3 = 130;
+constexpr std::uint32_t KHR_DF_MODEL_BC7 = 134;
+constexpr std::uint32_t KHR_DF_CHANNEL_COLOR = 0;
+constexpr std::uint32_t KHR_DF_CHANNEL_BC1A_ALPHAPRESENT = 1;
+constexpr std::uint32_t KHR_DF_CHANNEL_ALPHA = 15;
+constexpr std::uint32_t KHR_DF_SAMPLE_DATATYPE_LINEAR = 0x10;
+constexpr std::uint32_t KHR_DF_PRIMARIES_BT709 = 1;
+constexpr std::uint32_t KHR_DF_TRANSFER_LINEAR = 1;
+constexpr std::uint32_t KHR_DF_TRANSFER_SRGB = 2;
+
+// The data format descriptor of a KTX2 file, including its leading total
+// size, or nothing for formats the writer does not support.
+std::vector<std::uint32_t> dataFormatDescriptor(VkFormat format) {
+    struct Sample {
+        std::uint32_t bit_offset;
+        std::uint32_t bit_length;
+        std::uint32_t channel;
+    };
+    std::uint32_t model = 0;
+    bool srgb = false;
+    std::vector<Sample> samples;
+    switch (format) {
+        case VK_FORMAT_BC1_RGB_SRGB_BLOCK:
+            srgb = true;
+            [[fallthrough]];
+        case VK_FORMAT_BC1_RGB_UNORM_BLOCK:
+            model = KHR_DF_MODEL_BC1A;
+            samples = {{0, 64, KHR_DF_CHANNEL_COLOR}};
+            break;
+        case VK_FORMAT_BC1_RGBA_SRGB_BLOCK:
+            srgb = true;
+            [[fallthrough]];
+        case VK_FORMAT_BC1_RGBA_UNORM_BLOCK:
+            model = KHR_DF_MODEL_BC1A;
+            samples = {{0, 64, KHR_DF_CHANNEL_BC1A_ALPHAPRESENT}};
+            break;
+        case VK_FORMAT_BC2_SRGB_BLOCK:
+        case VK_FORMAT_BC3_SRGB_BLOCK:
+            srgb = true;
+            [[fallthrough]];
+        case VK_FORMAT_BC2_UNORM_BLOCK:
+        case VK_FORMAT_BC3_UNORM_BLOCK:
+            model = format == VK_FORMAT_BC2_UNORM_BLOCK ||
+                                    format == VK_FORMAT_BC2_SRGB_BLOCK
+                            ? KHR_DF_MODEL_BC2
+                            : KHR_DF_MODEL_BC3;
+            samples = {{0, 64, KHR_DF_CHANNEL_ALPHA},
+                       {64, 64, KHR_DF_CHANNEL_COLOR}};
+            break;
+        case VK_FORMAT_BC7_SRGB_BLOCK:
+            srgb = true;
+            [[fallthrough]];
+        case VK_FORMAT_BC7_UNORM_BLOCK:
+            model = KHR_DF_MODEL_BC7;
+            samples = {{0, 128, KHR_DF_CHANNEL_COLOR}};
+            break;
+        default:
+            return {};
+    }
+
+    std::uint32_t block_size = 24 + 16 * static_cast<std::uint32_t>(
+                                                 samples.size());
+    std::vector<std::uint32_t> words = {
+            4 + block_size,
+            0,  // Khronos vendor, basic descriptor type.
+            2 | (block_size << 16),
+            model | (KHR_DF_PRIMARIES_BT709 << 8) |
+                    ((srgb ? KHR_DF_TRANSFER_SRGB : KHR_DF_TRANSFER_LINEAR)
+                     << 16),
+            3 | (3 << 8),  // 4x4 texel blocks.
+            static_cast<std::uint32_t>(blockSize(format)),
+            0};
+    for (const Sample& sample : samples) {
+        // Alpha is never sRGB encoded.
+        std::uint32_t qualifiers =
+                srgb && sample.channel == KHR_DF_CHANNEL_ALPHA
+                        ? KHR_DF_SAMPLE_DATATYPE_LINEAR
+                        : 0;
+        words.push_back(sample.bit_offset | ((sample.bit_length - 1) << 16) |
+                        ((sample.channel | qualifiers) << 24));
+        words.push_back(0);
+        words.push_back(0);
+        words.push_back(0xffffffff);
+    }
+    return words;
+}
+
+// Copies a little-endian struct out of the file, which may not be aligned.
+template <typename T>
+bool readAt(std::span<const char> contents, std::size_t offset, T* value) {
+    if (offset > contents.size() || contents.size() - offset < sizeof(T)) {
+        return false;
+    }
+    std::memcpy(value, contents.data() + offset, sizeof(T));
+    return true;
+}
+}  // namespace
+
+std::size_t blockSize(VkFormat format) {
+    switch (format) {
+        case VK_FORMAT_BC1_RGB_UNORM_BLOCK:
+        case VK_FORMAT_BC1_RGB_SRGB_BLOCK:
+        case VK_FORMAT_BC1_RGBA_UNORM_BLOCK:
+        case VK_FORMAT_BC1_RGBA_SRGB_BLOCK:
+        case VK_FORMAT_BC4_UNORM_BLOCK:
+        case VK_FORMAT_BC4_SNORM_BLOCK:
+            return 8;
+        case VK_FORMAT_BC2_UNORM_BLOCK:
+        case VK_FORMAT_BC2_SRGB_BLOCK:
+        case VK_FORMAT_BC3_UNORM_BLOCK:
+        case VK_FORMAT_BC3_SRGB_BLOCK:
+        case VK_FORMAT_BC5_UNORM_BLOCK:
+        case VK_FORMAT_BC5_SNORM_BLOCK:
+        case VK_FORMAT_BC6H_UFLOAT_BLOCK:
+        case VK_FORMAT_BC6H_SFLOAT_BLOCK:
+        case VK_FORMAT_BC7_UNORM_BLOCK:
+        case VK_FORMAT_BC7_SRGB_BLOCK:
+            return 16;
+        default:
+            return 0;
+    }
+}
+
+CompressedTexture::CompressedTexture(std::string const& filename)
+        : m_file(filename, MappedFile::Access::SEQUENTIAL)
+        , m_format(VK_FORMAT_UNDEFINED) {
+    if (!m_file.empty() && !parse(m_file.view())) {
+        std::cout << "\"" << filename
+                  << "\" is not a supported KTX2 or DDS texture!"
+                  << std::endl;
+    }
+}
+
+CompressedTexture::CompressedTexture() : m_format(VK_FORMAT_UNDEFINED) {}
+
+CompressedTexture CompressedTexture::fromMemory(
+        std::span<const char> contents) {
+    CompressedTexture texture;
+    texture.parse(contents);
+    return texture;
+}
+
+std::span<const char> CompressedTexture::levelData(std::size_t level) const {
+    if (level >= m_levels.size()) {
+        return {};
+    }
+    return m_contents.subspan(m_levels[level].offset, m_levels[level].size);
+}
+
+std::size_t CompressedTexture::stagingSize() const {
+    std::size_t size = 0;
+    for (const CompressedLevel& level : m_levels) {
+        size = alignUp(size, 16) + level.size;
+    }
+    return size;
+}
+
+std::vector<VkBufferImageCopy> CompressedTexture::copyTo(
+        void* destination,
+        std::size_t destination_size,
+        VkDeviceSize buffer_offset) const {
+    std::vector<VkBufferImageCopy> regions;
+    if (!isValid() || destination == nullptr ||
+        destination_size < stagingSize()) {
+        return regions;
+    }
+    // Offsets stay multiples of 16, which covers the 8 and 16 byte blocks
+    // vkCmdCopyBufferToImage requires them to be aligned to.
+    std::size_t offset = 0;
+    for (std::size_t index = 0; index < m_levels.size(); ++index) {
+        const CompressedLevel& level = m_levels[index];
+        offset = alignUp(offset, 16);
+        std::memcpy(static_cast<char*>(destination) + offset,
+                    m_contents.data() + level.offset,
+                    level.size);
+        regions.push_back({buffer_offset + offset,
+                           0,
+                           0,
+                           {VK_IMAGE_ASPECT_COLOR_BIT,
+                            static_cast<std::uint32_t>(index),
+                            0,
+                            1},
+                           {0, 0, 0},
+                           {level.width, level.height, 1}});
+        offset += level.size;
+    }
+    return regions;
+}
+
+bool CompressedTexture::parse(std::span<const char> contents) {
+    m_contents = contents;
+    m_levels.clear();
+    m_format = VK_FORMAT_UNDEFINED;
+
+    bool parsed = false;
+    if (contents.size() >= sizeof(KTX2_IDENTIFIER) &&
+        std::memcmp(contents.data(),
+                    KTX2_IDENTIFIER,
+                    sizeof(KTX2_IDENTIFIER)) == 0) {
+        parsed = parseKtx2(contents);
+    } else {
+        parsed = parseDds(contents);
+    }
+    if (!parsed) {
+        m_levels.clear();
+        m_format = VK_FORMAT_UNDEFINED;
+    }
+    return parsed;
+}
+
+bool CompressedTexture::parseKtx2(std::span<const char> contents) {
+    Ktx2Header header;
+    if (!readAt(contents, sizeof(KTX2_IDENTIFIER), &header)) {
+        return false;
+    }
+    VkFormat format = static_cast<VkFormat>(header.vk_format);
+    if (blockSize(format) == 0 || header.pixel_width == 0 ||
+        header.pixel_height == 0 || header.pixel_depth > 1 ||
+        header.layer_count > 1 || header.face_count != 1 ||
+        header.supercompression_scheme != 0) {
+        return false;
+    }
+
+    // A level count of 0 asks the loader to generate mips, which block
+    // compressed data cannot have; only level 0 is stored.
+    std::uint32_t level_count = std::max(1u, header.level_count);
+    if (level_count >
+        maxLevelCount(header.pixel_width, header.pixel_height)) {
+        return false;
+    }
+    std::size_t index_offset = sizeof(KTX2_IDENTIFIER) + sizeof(header);
+    for (std::uint32_t index = 0; index < level_count; ++index) {
+        Ktx2LevelIndex level_index;
+        if (!readAt(contents,
+                    index_offset + index * sizeof(Ktx2LevelIndex),
+                    &level_index)) {
+            return false;
+        }
+        std::uint32_t width = std::max(1u, header.pixel_width >> index);
+        std::uint32_t height = std::max(1u, header.pixel_height >> index);
+        std::size_t size = levelSize(format, width, height);
+        if (level_index.byte_length < size ||
+            level_index.byte_offset > contents.size() ||
+            contents.size() - level_index.byte_offset < size) {
+            return false;
+        }
+        m_levels.push_back(CompressedLevel{
+                width,
+                height,
+                static_cast<std::size_t>(level_index.byte_offset),
+                size});
+    }
+    m_format = format;
+    return true;
+}
+
+bool CompressedTexture::parseDds(std::span<const char> contents) {
+    std::uint32_t magic = 0;
+    DdsHeader header;
+    if (!readAt(contents, 0, &magic) || magic != DDS_MAGIC ||
+        !readAt(contents, sizeof(magic), &header) ||
+        header.size != sizeof(DdsHeader)) {
+        return false;
+    }
+    if ((header.caps2 & (DDSCAPS2_CUBEMAP | DDSCAPS2_VOLUME)) != 0 ||
+        (header.pixel_format.flags & DDPF_FOURCC) == 0 ||
+        header.width == 0 || header.height == 0) {
+        return false;
+    }
+
+    std::size_t data_offset = sizeof(magic) + sizeof(header);
+    VkFormat format = VK_FORMAT_UNDEFINED;
+    if (header.pixel_format.four_cc == fourCc("DX10")) {
+        DdsHeaderDx10 header_dx10;
+        if (!readAt(contents, data_offset, &header_dx10) ||
+            header_dx10.resource_dimension != DDS_DIMENSION_TEXTURE2D ||
+            header_dx10.array_size > 1) {
+            return false;
+        }
+        format = formatFromDxgi(header_dx10.dxgi_format);
+        data_offset += sizeof(header_dx10);
+    } else {
+        format = formatFromFourCc(header.pixel_format.four_cc);
+    }
+    if (format == VK_FORMAT_UNDEFINED) {
+        return false;
+    }
+
+    // Levels follow each other without padding, level 0 first.
+    std::uint32_t level_count = std::max(1u, header.mip_map_count);
+    if (level_count > maxLevelCount(header.width, header.height)) {
+        return false;
+    }
+    for (std::uint32_t index = 0; index < level_count; ++index) {
+        std::uint32_t width = std::max(1u, header.width >> index);
+        std::uint32_t height = std::max(1u, header.height >> index);
+        std::size_t size = levelSize(format, width, height);
+        if (data_offset > contents.size() ||
+            contents.size() - data_offset < size) {
+            return false;
+        }
+        m_levels.push_back(CompressedLevel{width, height, data_offset, size});
+        data_offset += size;
+    }
+    m_format = format;
+    return true;
+}
+
+bool writeKtx2(std::string const& filename,
+               VkFormat format,
+               std::uint32_t width,
+               std::uint32_t height,
+               const std::vector<std::vector<char>>& levels) {
+    std::vector<std::uint32_t> descriptor = dataFormatDescriptor(format);
+    if (descriptor.empty() || width == 0 || height == 0 || levels.empty()) {
+        std::cout << "Could not write \"" << filename
+                  << "\", the texture is not a supported KTX2 texture!"
+                  << std::endl;
+        return false;
+    }
+
+    Ktx2Header header = {};
+    header.vk_format = static_cast<std::uint32_t>(format);
+    header.type_size = 1;
+    header.pixel_width = width;
+    header.pixel_height = height;
+    header.face_count = 1;
+    header.level_count = static_cast<std::uint32_t>(levels.size());
+    header.dfd_byte_offset = static_cast<std::uint32_t>(
+            sizeof(KTX2_IDENTIFIER) + sizeof(header) +
+            levels.size() * sizeof(Ktx2LevelIndex));
+    header.dfd_byte_length = static_cast<std::uint32_t>(
+            descriptor.size() * sizeof(std::uint32_t));
+
+    // Levels are stored smallest first, each aligned to the block size.
+    std::vector<Ktx2LevelIndex> level_index(levels.size());
+    std::size_t offset = header.dfd_byte_offset + header.dfd_byte_length;
+    for (std::size_t index = levels.size(); index-- > 0;) {
+        offset = alignUp(offset, blockSize(format));
+        level_index[index] = {
+                offset, levels[index].size(), levels[index].size()};
+        offset += levels[index].size();
+    }
+
+    std::ofstream file(filename, std::ios::binary | std::ios::trunc);
+    file.write(reinterpret_cast<const char*>(KTX2_IDENTIFIER),
+               sizeof(KTX2_IDENTIFIER));
+    file.write(reinterpret_cast<const char*>(&header), sizeof(header));
+    file.write(reinterpret_cast<const char*>(level_index.data()),
+               level_index.size() * sizeof(Ktx2LevelIndex));
+    file.write(reinterpret_cast<const char*>(descriptor.data()),
+               header.dfd_byte_length);
+    std::size_t written = header.dfd_byte_offset + header.dfd_byte_length;
+    for (std::size_t index = levels.size(); index-- > 0;) {
+        static const char padding[16] = {};
+        file.write(padding, level_index[index].byte_offset - written);
+        file.write(levels[index].data(), levels[index].size());
+        written = level_index[index].byte_offset + levels[index].size();
+    }
+    if (!file) {
+        std::cout << "Could not write \"" << filename << "\" file!"
+                  << std::endl;
+        return false;
+    }
+    return true;
+}
+}  // namespace intel_vulkan::Tools
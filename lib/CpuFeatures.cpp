@@ -0,0 +1,40 @@
+////////////////////////////////////////////////////////////////////////////
+// Copyright (c) 2026 intel_vulkan
+// All rights reserved.
+//
+// Contact: mehoggan@gmail.com
+//
+// This software is licensed under the terms of the Your License.
+// See the LICENSE file in the top-level directory.
+/////////////////////////////////////////////////////////////////////////
+
+#include "intel_vulkan/CpuFeatures.h"
+
+#if defined(__x86_64__) || defined(__i386__)
+#define INTEL_VULKAN_CPUFEATURES_X86 1
+#endif
+
+namespace intel_vulkan::Tools::CpuFeatures {
+
+namespace {
+Isa detectIsa() {
+#ifdef INTEL_VULKAN_CPUFEATURES_X86
+    __builtin_cpu_init();
+    if (__builtin_cpu_supports("avx2")) {
+        return Isa::AVX2;
+    }
+    if (__builtin_cpu_supports("ssse3")) {
+        return Isa::SSSE3;
+    }
+#endif
+    return Isa::SCALAR;
+}
+}  // namespace
+
+Isa bestIsa() {
+    static const Isa best = detectIsa();
+    return best;
+}
+
+Isa supportedIsa(Isa isa) { return isa > bestIsa() ? bestIsa() : isa; }
+}  // namespace intel_vulkan::Tools::CpuFeatures
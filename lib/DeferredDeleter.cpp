@@ -0,0 +1,166 @@
+////////////////////////////////////////////////////////////////////////////
+// Copyright (c) 2026 intel_vulkan
+// All rights reserved.
+//
+// Contact: mehoggan@gmail.com
+//
+// This software is licensed under the terms of the Your License.
+// See the LICENSE file in the top-level directory.
+/////////////////////////////////////////////////////////////////////////
+#include "intel_vulkan/DeferredDeleter.h"
+
+#include <algorithm>
+#include <iostream>
+#include <utility>
+
+namespace intel_vulkan::Tools {
+
+FenceDeletionBackend::FenceDeletionBackend(
+        VkDevice device,
+        PFN_vkGetFenceStatus get_fence_status,
+        PFN_vkWaitForFences wait_for_fences)
+        : m_device(device)
+        , m_get_fence_status(get_fence_status)
+        , m_wait_for_fences(wait_for_fences)
+        , m_submissions()
+        , m_completed_value(0) {}
+
+void FenceDeletionBackend::submitted(std::uint64_t value, VkFence fence) {
+    // The fence was waited on before this submission reset it, so its
+    // previous submission and everything before that are complete.
+    signaled(fence);
+    m_submissions.push_back({value, fence});
+}
+
+void FenceDeletionBackend::signaled(VkFence fence) {
+    for (std::size_t index = m_submissions.size(); index > 0; --index) {
+        if (m_submissions[index - 1].fence == fence) {
+            complete(index);
+            break;
+        }
+    }
+}
+
+std::uint64_t FenceDeletionBackend::completedValue() {
+    std::size_t count = 0;
+    while ((count < m_submissions.size()) &&
+           (m_get_fence_status(m_device, m_submissions[count].fence) ==
+            VK_SUCCESS)) {
+        ++count;
+    }
+    complete(count);
+    return m_completed_value;
+}
+
+bool FenceDeletionBackend::waitFor(std::uint64_t value) {
+    if (value <= completedValue()) {
+        return true;
+    }
+    for (std::size_t index = 0; index < m_submissions.size(); ++index) {
+        if (m_submissions[index].value >= value) {
+            if (m_wait_for_fences(m_device,
+                                  1,
+                                  &m_submissions[index].fence,
+                                  VK_TRUE,
+                                  UINT64_MAX) != VK_SUCCESS) {
+                std::cout << "Could not wait for a fence!" << std::endl;
+                return false;
+            }
+            complete(index + 1);
+            return true;
+        }
+    }
+    std::cout << "Cannot wait for work that was not submitted!" << std::endl;
+    return false;
+}
+
+void FenceDeletionBackend::complete(std::size_t count) {
+    if (count == 0) {
+        return;
+    }
+    m_completed_value = m_submissions[count - 1].value;
+    m_submissions.erase(m_submissions.begin(),
+                        m_submissions.begin() +
+                                static_cast<std::ptrdiff_t>(count));
+}
+
+TimelineDeletionBackend::TimelineDeletionBackend(
+        VkDevice device,
+        VkSemaphore semaphore,
+        PFN_vkGetSemaphoreCounterValue get_semaphore_counter_value,
+        PFN_vkWaitSemaphores wait_semaphores)
+        : m_device(device)
+        , m_semaphore(semaphore)
+        , m_get_semaphore_counter_value(get_semaphore_counter_value)
+        , m_wait_semaphores(wait_semaphores)
+        , m_completed_value(0) {}
+
+std::uint64_t TimelineDeletionBackend::completedValue() {
+    std::uint64_t value = 0;
+    if ((m_get_semaphore_counter_value(m_device, m_semaphore, &value) ==
+         VK_SUCCESS) &&
+        (value > m_completed_value)) {
+        m_completed_value = value;
+    }
+    return m_completed_value;
+}
+
+bool TimelineDeletionBackend::waitFor(std::uint64_t value) {
+    if (value <= completedValue()) {
+        return true;
+    }
+    VkSemaphoreWaitInfo wait_info = {VK_STRUCTURE_TYPE_SEMAPHORE_WAIT_INFO,
+                                     nullptr,
+                                     0,
+                                     1,
+                                     &m_semaphore,
+                                     &value};
+    if (m_wait_semaphores(m_device, &wait_info, UINT64_MAX) != VK_SUCCESS) {
+        std::cout << "Could not wait for a timeline semaphore!" << std::endl;
+        return false;
+    }
+    m_completed_value = value;
+    return true;
+}
+
+DeferredDeleter::DeferredDeleter(DeletionBackend& backend)
+        : m_backend(backend), m_entries() {}
+
+DeferredDeleter::~DeferredDeleter() { flush(); }
+
+void DeferredDeleter::defer(std::uint64_t value,
+                            std::function<void()> destroy) {
+    m_entries.push_back({value, std::move(destroy)});
+}
+
+std::size_t DeferredDeleter::collect() {
+    if (m_entries.empty()) {
+        return 0;
+    }
+    std::uint64_t completed_value = m_backend.completedValue();
+    std::size_t count = 0;
+    while (!m_entries.empty() && (m_entries.front().value <= completed_value)) {
+        // Popped first, so a destroy call may queue more work.
+        Entry entry = std::move(m_entries.front());
+        m_entries.pop_front();
+        entry.destroy();
+        ++count;
+    }
+    return count;
+}
+
+bool DeferredDeleter::flush() {
+    while (!m_entries.empty()) {
+        std::uint64_t value = m_entries.front().value;
+        for (const Entry& entry : m_entries) {
+            value = std::max(value, entry.value);
+        }
+        if (!m_backend.waitFor(value) || (collect() == 0)) {
+            return false;
+        }
+    }
+    return true;
+}
+
+std::size_t DeferredDeleter::pending() const { return m_entries.size(); }
+}  // namespace intel_vulkan::Tools
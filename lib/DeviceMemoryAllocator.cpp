@@ -0,0 +1,593 @@
+////////////////////////////////////////////////////////////////////////////
+// Copyright (c) 2026 intel_vulkan
+// All rights reserved.
+//
+// Contact: mehoggan@gmail.com
+//
+// This software is licensed under the terms of the Your License.
+// See the LICENSE file in the top-level directory.
+/////////////////////////////////////////////////////////////////////////
+#include "intel_vulkan/DeviceMemoryAllocator.h"
+
+#include <algorithm>
+#include <bit>
+#include <iostream>
+
+namespace intel_vulkan::Tools {
+
+namespace {
+std::uint64_t alignUp(std::uint64_t value, std::uint64_t alignment) {
+    return (value + alignment - 1) & ~(alignment - 1);
+}
+
+// The size class of a free range: the first level is the power of two
+// below the size, the second level splits it into SECOND_LEVEL_COUNT
+// linear steps. Sizes below SECOND_LEVEL_COUNT all go to the first level 0.
+template <int SECOND_LEVEL_LOG2>
+void mapping(std::uint64_t size, int* first_level, int* second_level) {
+    constexpr std::uint64_t SECOND_LEVEL_COUNT = 1ull << SECOND_LEVEL_LOG2;
+    if (size < SECOND_LEVEL_COUNT) {
+        *first_level = 0;
+        *second_level = static_cast<int>(size);
+        return;
+    }
+    int top_bit = std::bit_width(size) - 1;
+    *first_level = top_bit - SECOND_LEVEL_LOG2 + 1;
+    *second_level = static_cast<int>((size >> (top_bit - SECOND_LEVEL_LOG2)) -
+                                     SECOND_LEVEL_COUNT);
+}
+}  // namespace
+
+TlsfAllocator::TlsfAllocator(std::uint64_t size)
+        : m_size(size)
+        , m_used_size(0)
+        , m_allocation_count(0)
+        , m_ranges()
+        , m_unused_ranges()
+        , m_first_level_bitmap(0)
+        , m_second_level_bitmaps()
+        , m_free_heads() {
+    for (std::array<std::uint32_t, SECOND_LEVEL_COUNT>& heads : m_free_heads) {
+        heads.fill(NONE);
+    }
+    if (size > 0) {
+        insertFree(newRange(0, size));
+    }
+}
+
+std::optional<TlsfAllocator::Allocation> TlsfAllocator::allocate(
+        std::uint64_t size,
+        std::uint64_t alignment) {
+    size = std::max<std::uint64_t>(size, 1);
+    alignment = std::max<std::uint64_t>(alignment, 1);
+    if (size > m_size) {
+        return std::nullopt;
+    }
+
+    // The head of the good fit list usually needs no padding; only search
+    // for room to align in if it does not fit.
+    std::uint32_t index = findFree(size);
+    if ((index == NONE) ||
+        (alignUp(m_ranges[index].offset, alignment) + size >
+         m_ranges[index].offset + m_ranges[index].size)) {
+        if (size > m_size - (alignment - 1)) {
+            return std::nullopt;
+        }
+        index = findFree(size + alignment - 1);
+        if (index == NONE) {
+            return std::nullopt;
+        }
+    }
+    removeFree(index);
+
+    // Free ranges never touch, so the padding before and the rest after
+    // become free ranges of their own.
+    std::uint64_t offset = alignUp(m_ranges[index].offset, alignment);
+    std::uint64_t padding = offset - m_ranges[index].offset;
+    if (padding > 0) {
+        std::uint32_t front = newRange(m_ranges[index].offset, padding);
+        m_ranges[front].previous_physical = m_ranges[index].previous_physical;
+        m_ranges[front].next_physical = index;
+        if (m_ranges[index].previous_physical != NONE) {
+            m_ranges[m_ranges[index].previous_physical].next_physical = front;
+        }
+        m_ranges[index].previous_physical = front;
+        m_ranges[index].offset = offset;
+        m_ranges[index].size -= padding;
+        insertFree(front);
+    }
+    if (m_ranges[index].size > size) {
+        std::uint32_t back = newRange(offset + size,
+                                      m_ranges[index].size - size);
+        m_ranges[back].previous_physical = index;
+        m_ranges[back].next_physical = m_ranges[index].next_physical;
+        if (m_ranges[index].next_physical != NONE) {
+            m_ranges[m_ranges[index].next_physical].previous_physical = back;
+        }
+        m_ranges[index].next_physical = back;
+        m_ranges[index].size = size;
+        insertFree(back);
+    }
+
+    m_ranges[index].free = false;
+    m_used_size += size;
+    ++m_allocation_count;
+    return Allocation{offset, index};
+}
+
+void TlsfAllocator::free(std::uint32_t handle) {
+    m_used_size -= m_ranges[handle].size;
+    --m_allocation_count;
+    m_ranges[handle].free = true;
+
+    std::uint32_t previous = m_ranges[handle].previous_physical;
+    if ((previous != NONE) && m_ranges[previous].free) {
+        removeFree(previous);
+        merge(handle, previous);
+    }
+    std::uint32_t next = m_ranges[handle].next_physical;
+    if ((next != NONE) && m_ranges[next].free) {
+        removeFree(next);
+        merge(handle, next);
+    }
+    insertFree(handle);
+}
+
+std::uint64_t TlsfAllocator::size() const { return m_size; }
+
+std::uint64_t TlsfAllocator::usedSize() const { return m_used_size; }
+
+std::size_t TlsfAllocator::allocationCount() const {
+    return m_allocation_count;
+}
+
+std::uint64_t TlsfAllocator::largestFreeRange() const {
+    if (m_first_level_bitmap == 0) {
+        return 0;
+    }
+    int first_level = std::bit_width(m_first_level_bitmap) - 1;
+    int second_level = std::bit_width(m_second_level_bitmaps[first_level]) - 1;
+    std::uint64_t largest = 0;
+    for (std::uint32_t index = m_free_heads[first_level][second_level];
+         index != NONE;
+         index = m_ranges[index].next_free) {
+        largest = std::max(largest, m_ranges[index].size);
+    }
+    return largest;
+}
+
+std::uint32_t TlsfAllocator::newRange(std::uint64_t offset,
+                                      std::uint64_t size) {
+    Range range = {offset, size, NONE, NONE, NONE, NONE, true};
+    if (!m_unused_ranges.empty()) {
+        std::uint32_t index = m_unused_ranges.back();
+        m_unused_ranges.pop_back();
+        m_ranges[index] = range;
+        return index;
+    }
+    m_ranges.push_back(range);
+    return static_cast<std::uint32_t>(m_ranges.size() - 1);
+}
+
+void TlsfAllocator::releaseRange(std::uint32_t index) {
+    m_unused_ranges.push_back(index);
+}
+
+void TlsfAllocator::insertFree(std::uint32_t index) {
+    int first_level = 0;
+    int second_level = 0;
+    mapping<SECOND_LEVEL_LOG2>(
+            m_ranges[index].size, &first_level, &second_level);
+    std::uint32_t& head = m_free_heads[first_level][second_level];
+    m_ranges[index].previous_free = NONE;
+    m_ranges[index].next_free = head;
+    if (head != NONE) {
+        m_ranges[head].previous_free = index;
+    }
+    head = index;
+    m_first_level_bitmap |= 1ull << first_level;
+    m_second_level_bitmaps[first_level] |= 1u << second_level;
+}
+
+void TlsfAllocator::removeFree(std::uint32_t index) {
+    Range& range = m_ranges[index];
+    if (range.previous_free != NONE) {
+        m_ranges[range.previous_free].next_free = range.next_free;
+    }
+    if (range.next_free != NONE) {
+        m_ranges[range.next_free].previous_free = range.previous_free;
+    }
+    int first_level = 0;
+    int second_level = 0;
+    mapping<SECOND_LEVEL_LOG2>(range.size, &first_level, &second_level);
+    std::uint32_t& head = m_free_heads[first_level][second_level];
+    if (head == index) {
+        head = range.next_free;
+        if (head == NONE) {
+            m_second_level_bitmaps[first_level] &= ~(1u << second_level);
+            if (m_second_level_bitmaps[first_level] == 0) {
+                m_first_level_bitmap &= ~(1ull << first_level);
+            }
+        }
+    }
+}
+
+// The head of the first non-empty list whose ranges are all at least
+// size bytes, found by rounding size up to the next size class.
+std::uint32_t TlsfAllocator::findFree(std::uint64_t size) const {
+    if (size >= static_cast<std::uint64_t>(SECOND_LEVEL_COUNT)) {
+        int top_bit = std::bit_width(size) - 1;
+        size += (1ull << (top_bit - SECOND_LEVEL_LOG2)) - 1;
+    }
+    int first_level = 0;
+    int second_level = 0;
+    mapping<SECOND_LEVEL_LOG2>(size, &first_level, &second_level);
+    if (first_level >= FIRST_LEVEL_COUNT) {
+        return NONE;
+    }
+
+    std::uint32_t second_level_map = m_second_level_bitmaps[first_level] &
+                                     (~0u << second_level);
+    if (second_level_map == 0) {
+        std::uint64_t first_level_map =
+                first_level + 1 < FIRST_LEVEL_COUNT
+                        ? m_first_level_bitmap & (~0ull << (first_level + 1))
+                        : 0;
+        if (first_level_map == 0) {
+            return NONE;
+        }
+        first_level = std::countr_zero(first_level_map);
+        second_level_map = m_second_level_bitmaps[first_level];
+    }
+    return m_free_heads[first_level][std::countr_zero(second_level_map)];
+}
+
+// Absorbs the free range from, a physical neighbour, into into.
+void TlsfAllocator::merge(std::uint32_t into, std::uint32_t from) {
+    if (m_ranges[from].offset < m_ranges[into].offset) {
+        m_ranges[into].offset = m_ranges[from].offset;
+        m_ranges[into].previous_physical = m_ranges[from].previous_physical;
+        if (m_ranges[into].previous_physical != NONE) {
+            m_ranges[m_ranges[into].previous_physical].next_physical = into;
+        }
+    } else {
+        m_ranges[into].next_physical = m_ranges[from].next_physical;
+        if (m_ranges[into].next_physical != NONE) {
+            m_ranges[m_ranges[into].next_physical].previous_physical = into;
+        }
+    }
+    m_ranges[into].size += m_ranges[from].size;
+    releaseRange(from);
+}
+
+std::vector<std::uint32_t> rankMemoryTypes(
+        const VkPhysicalDeviceMemoryProperties& properties,
+        std::uint32_t memory_type_bits,
+        MemoryUsage usage) {
+    // Transient attachments, protected content and AMD's uncached debug
+    // memory; none of them suits a general allocation.
+    constexpr VkMemoryPropertyFlags EXCLUDED_FLAGS =
+            VK_MEMORY_PROPERTY_LAZILY_ALLOCATED_BIT |
+            VK_MEMORY_PROPERTY_PROTECTED_BIT |
+            VK_MEMORY_PROPERTY_DEVICE_COHERENT_BIT_AMD;
+    // Without resizable BAR the host sees 256 MiB of device memory, too
+    // little to hold uploaded assets.
+    constexpr VkDeviceSize SMALL_BAR_SIZE = 256ull << 20;
+
+    std::vector<std::pair<int, std::uint32_t>> scored_types;
+    for (std::uint32_t type = 0; type < properties.memoryTypeCount; ++type) {
+        VkMemoryPropertyFlags flags =
+                properties.memoryTypes[type].propertyFlags;
+        bool device_local = flags & VK_MEMORY_PROPERTY_DEVICE_LOCAL_BIT;
+        bool host_visible = flags & VK_MEMORY_PROPERTY_HOST_VISIBLE_BIT;
+        bool host_coherent = flags & VK_MEMORY_PROPERTY_HOST_COHERENT_BIT;
+        bool host_cached = flags & VK_MEMORY_PROPERTY_HOST_CACHED_BIT;
+        if (((memory_type_bits & (1u << type)) == 0) ||
+            (flags & EXCLUDED_FLAGS) ||
+            ((usage != MemoryUsage::GPU_ONLY) && !host_visible)) {
+            continue;
+        }
+
+        int score = 0;
+        switch (usage) {
+        case MemoryUsage::GPU_ONLY:
+            score = (device_local ? 4 : 0) - (host_visible ? 2 : 0);
+            break;
+        case MemoryUsage::UPLOAD: {
+            VkDeviceSize heap_size =
+                    properties
+                            .memoryHeaps[properties.memoryTypes[type]
+                                                 .heapIndex]
+                            .size;
+            if (device_local) {
+                score = heap_size > SMALL_BAR_SIZE ? 4 : -1;
+            }
+            score += (host_coherent ? 2 : 0) - (host_cached ? 1 : 0);
+            break;
+        }
+        case MemoryUsage::READBACK:
+            score = (host_cached ? 4 : 0) + (host_coherent ? 2 : 0) -
+                    (device_local ? 1 : 0);
+            break;
+        case MemoryUsage::DYNAMIC:
+            score = (device_local ? 4 : 0) + (host_coherent ? 2 : 0) -
+                    (host_cached ? 1 : 0);
+            break;
+        }
+        scored_types.emplace_back(score, type);
+    }
+
+    std::stable_sort(scored_types.begin(),
+                     scored_types.end(),
+                     [](const std::pair<int, std::uint32_t>& lhs,
+                        const std::pair<int, std::uint32_t>& rhs) {
+                         return lhs.first > rhs.first;
+                     });
+    std::vector<std::uint32_t> memory_types;
+    for (const std::pair<int, std::uint32_t>& scored_type : scored_types) {
+        memory_types.push_back(scored_type.second);
+    }
+    return memory_types;
+}
+
+DeviceMemoryAllocator::DeviceMemoryAllocator(
+        VkDevice device,
+        const VkPhysicalDeviceMemoryProperties& properties,
+        const VkPhysicalDeviceLimits& limits,
+        const Functions& functions,
+        VkDeviceSize block_size)
+        : m_device(device)
+        , m_properties(properties)
+        , m_buffer_image_granularity(
+                  std::max<VkDeviceSize>(limits.bufferImageGranularity, 1))
+        , m_non_coherent_atom_size(
+                  std::max<VkDeviceSize>(limits.nonCoherentAtomSize, 1))
+        , m_functions(functions)
+        , m_block_size(block_size)
+        , m_usage_memory_types()
+        , m_mutex()
+        , m_blocks() {
+    for (MemoryUsage usage : {MemoryUsage::GPU_ONLY,
+                              MemoryUsage::UPLOAD,
+                              MemoryUsage::READBACK,
+                              MemoryUsage::DYNAMIC}) {
+        m_usage_memory_types[static_cast<std::size_t>(usage)] =
+                rankMemoryTypes(properties, UINT32_MAX, usage);
+    }
+}
+
+DeviceMemoryAllocator::~DeviceMemoryAllocator() {
+    for (std::vector<std::unique_ptr<Block>>& blocks : m_blocks) {
+        for (std::unique_ptr<Block>& block : blocks) {
+            m_functions.free_memory(m_device, block->memory, nullptr);
+        }
+    }
+}
+
+MemoryAllocation DeviceMemoryAllocator::allocate(
+        const VkMemoryRequirements& requirements,
+        VkMemoryPropertyFlags properties,
+        ResourceTiling tiling) {
+    std::vector<std::uint32_t> memory_types;
+    for (std::uint32_t type = 0; type < m_properties.memoryTypeCount; ++type) {
+        if ((m_properties.memoryTypes[type].propertyFlags & properties) ==
+            properties) {
+            memory_types.push_back(type);
+        }
+    }
+    return allocateFromTypes(requirements, memory_types, tiling);
+}
+
+MemoryAllocation DeviceMemoryAllocator::allocate(
+        const VkMemoryRequirements& requirements,
+        MemoryUsage usage,
+        ResourceTiling tiling) {
+    return allocateFromTypes(
+            requirements,
+            m_usage_memory_types[static_cast<std::size_t>(usage)],
+            tiling);
+}
+
+void DeviceMemoryAllocator::free(const MemoryAllocation& allocation) {
+    if (!allocation) {
+        return;
+    }
+    std::lock_guard<std::mutex> lock(m_mutex);
+    Block* block = static_cast<Block*>(allocation.m_block);
+    if (!block->placement) {
+        freeBlock(block);
+        return;
+    }
+    block->placement->free(allocation.m_handle);
+    if (block->placement->allocationCount() == 0) {
+        std::size_t shared_count = 0;
+        for (const std::unique_ptr<Block>& other :
+             m_blocks[block->memory_type]) {
+            shared_count += other->placement ? 1 : 0;
+        }
+        if (shared_count > 1) {
+            freeBlock(block);
+        }
+    }
+}
+
+MemoryStats DeviceMemoryAllocator::stats() const {
+    std::lock_guard<std::mutex> lock(m_mutex);
+    MemoryStats stats;
+    for (const std::vector<std::unique_ptr<Block>>& blocks : m_blocks) {
+        for (const std::unique_ptr<Block>& block : blocks) {
+            ++stats.block_count;
+            stats.block_size += block->size;
+            if (block->placement) {
+                stats.allocation_count += block->placement->allocationCount();
+                stats.used_size += block->placement->usedSize();
+                stats.largest_free_range =
+                        std::max(stats.largest_free_range,
+                                 block->placement->largestFreeRange());
+            } else {
+                ++stats.allocation_count;
+                stats.used_size += block->size;
+            }
+        }
+    }
+    return stats;
+}
+
+const VkPhysicalDeviceMemoryProperties&
+DeviceMemoryAllocator::memoryProperties() const {
+    return m_properties;
+}
+
+MemoryAllocation DeviceMemoryAllocator::allocateFromTypes(
+        const VkMemoryRequirements& requirements,
+        const std::vector<std::uint32_t>& memory_types,
+        ResourceTiling tiling) {
+    std::lock_guard<std::mutex> lock(m_mutex);
+    for (std::uint32_t type : memory_types) {
+        if ((requirements.memoryTypeBits & (1u << type)) == 0) {
+            continue;
+        }
+
+        VkMemoryPropertyFlags flags =
+                m_properties.memoryTypes[type].propertyFlags;
+        VkDeviceSize size = requirements.size;
+        VkDeviceSize alignment = std::max<VkDeviceSize>(requirements.alignment,
+                                                        1);
+        if ((tiling == ResourceTiling::OPTIMAL) &&
+            (m_buffer_image_granularity > 1)) {
+            alignment = std::max(alignment, m_buffer_image_granularity);
+            size = alignUp(size, m_buffer_image_granularity);
+        }
+        if ((flags & VK_MEMORY_PROPERTY_HOST_VISIBLE_BIT) &&
+            !(flags & VK_MEMORY_PROPERTY_HOST_COHERENT_BIT)) {
+            alignment = std::max(alignment, m_non_coherent_atom_size);
+            size = alignUp(size, m_non_coherent_atom_size);
+        }
+
+        std::optional<MemoryAllocation> allocation =
+                allocateFromType(type, size, alignment);
+        if (allocation) {
+            return *allocation;
+        }
+    }
+    std::cout << "Could not allocate device memory!" << std::endl;
+    return MemoryAllocation();
+}
+
+std::optional<MemoryAllocation> DeviceMemoryAllocator::allocateFromType(
+        std::uint32_t memory_type,
+        VkDeviceSize size,
+        VkDeviceSize alignment) {
+    VkMemoryPropertyFlags property_flags =
+            m_properties.memoryTypes[memory_type].propertyFlags;
+    auto result = [memory_type, property_flags](Block* block,
+                                VkDeviceSize offset,
+                                VkDeviceSize size,
+                                std::uint32_t handle) {
+        MemoryAllocation allocation;
+        allocation.memory = block->memory;
+        allocation.offset = offset;
+        allocation.size = size;
+        allocation.mapped =
+                block->mapped ? static_cast<char*>(block->mapped) + offset
+                              : nullptr;
+        allocation.memory_type = memory_type;
+        allocation.property_flags = property_flags;
+        allocation.m_block = block;
+        allocation.m_handle = handle;
+        return allocation;
+    };
+
+    // Small heaps, e.g. the device local, host visible window on GPUs
+    // without resizable BAR, would be used up by a few full blocks.
+    VkDeviceSize heap_size =
+            m_properties
+                    .memoryHeaps[m_properties.memoryTypes[memory_type]
+                                         .heapIndex]
+                    .size;
+    VkDeviceSize block_size = m_block_size;
+    if (heap_size <= (1ull << 30)) {
+        block_size = std::min(block_size, heap_size / 8);
+    }
+
+    if (size > block_size / 2) {
+        Block* block = allocateBlock(memory_type, size, true);
+        if (block == nullptr) {
+            return std::nullopt;
+        }
+        return result(block, 0, size, 0);
+    }
+
+    for (std::unique_ptr<Block>& block : m_blocks[memory_type]) {
+        if (!block->placement) {
+            continue;
+        }
+        std::optional<TlsfAllocator::Allocation> placed =
+                block->placement->allocate(size, alignment);
+        if (placed) {
+            return result(block.get(), placed->offset, size, placed->handle);
+        }
+    }
+
+    // Out of device memory for a full block, try smaller ones before
+    // giving up on this memory type.
+    for (int attempt = 0; attempt < 3; ++attempt) {
+        Block* block = allocateBlock(memory_type, block_size, false);
+        if (block != nullptr) {
+            std::optional<TlsfAllocator::Allocation> placed =
+                    block->placement->allocate(size, alignment);
+            return result(block, placed->offset, size, placed->handle);
+        }
+        block_size /= 2;
+        if (block_size < size * 2) {
+            break;
+        }
+    }
+    return std::nullopt;
+}
+
+DeviceMemoryAllocator::Block* DeviceMemoryAllocator::allocateBlock(
+        std::uint32_t memory_type,
+        VkDeviceSize size,
+        bool dedicated) {
+    VkMemoryAllocateInfo memory_allocate_info = {
+            VK_STRUCTURE_TYPE_MEMORY_ALLOCATE_INFO, nullptr, size, memory_type};
+    VkDeviceMemory memory = VK_NULL_HANDLE;
+    if (m_functions.allocate_memory(
+                m_device, &memory_allocate_info, nullptr, &memory) !=
+        VK_SUCCESS) {
+        return nullptr;
+    }
+
+    void* mapped = nullptr;
+    if ((m_properties.memoryTypes[memory_type].propertyFlags &
+         VK_MEMORY_PROPERTY_HOST_VISIBLE_BIT) &&
+        (m_functions.map_memory(
+                 m_device, memory, 0, VK_WHOLE_SIZE, 0, &mapped) !=
+         VK_SUCCESS)) {
+        std::cout << "Could not map device memory!" << std::endl;
+        m_functions.free_memory(m_device, memory, nullptr);
+        return nullptr;
+    }
+
+    std::unique_ptr<Block> block(new Block{
+            memory,
+            size,
+            memory_type,
+            mapped,
+            dedicated ? nullptr : std::make_unique<TlsfAllocator>(size)});
+    m_blocks[memory_type].push_back(std::move(block));
+    return m_blocks[memory_type].back().get();
+}
+
+void DeviceMemoryAllocator::freeBlock(Block* block) {
+    // vkFreeMemory also unmaps the block.
+    m_functions.free_memory(m_device, block->memory, nullptr);
+    std::vector<std::unique_ptr<Block>>& blocks = m_blocks[block->memory_type];
+    blocks.erase(std::find_if(blocks.begin(),
+                              blocks.end(),
+                              [block](const std::unique_ptr<Block>& other) {
+                                  return other.get() == block;
+                              }));
+}
+}  // namespace intel_vulkan::Tools
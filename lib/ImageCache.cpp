@@ -0,0 +1,317 @@
+////////////////////////////////////////////////////////////////////////////
+// Copyright (c) 2026 intel_vulkan
+// All rights reserved.
+//
+// Contact: mehoggan@gmail.com
+//
+// This software is licensed under the terms of the Your License.
+// See the LICENSE file in the top-level directory.
+/////////////////////////////////////////////////////////////////////////
+#include "intel_vulkan/ImageCache.h"
+
+#include <fcntl.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#include <algorithm>
+#include <cerrno>
+#include <chrono>
+#include <cstdio>
+#include <cstring>
+#include <filesystem>
+#include <iostream>
+#include <utility>
+#include <vector>
+
+namespace intel_vulkan::Tools {
+
+std::mutex ImageCache::s_global_mutex;
+std::shared_ptr<ImageCache> ImageCache::s_global;
+
+namespace {
+constexpr std::uint32_t ENTRY_MAGIC = 0x43495649;  // "IVIC"
+constexpr std::uint32_t ENTRY_VERSION = 1;
+constexpr char ENTRY_EXTENSION[] = ".img";
+constexpr char TEMPORARY_EXTENSION[] = ".tmp";
+
+// Pixels start on a cache line, which also satisfies any SIMD load.
+constexpr std::size_t PIXEL_ALIGNMENT = 64;
+
+// Temporary files older than this belong to writers that died before
+// renaming them.
+constexpr auto STALE_TEMPORARY_AGE = std::chrono::minutes(10);
+
+struct EntryHeader {
+    std::uint32_t magic;
+    std::uint32_t version;
+    std::uint32_t width;
+    std::uint32_t height;
+    std::uint32_t components;
+    std::uint32_t channels;
+    std::uint32_t key_size;  ///< The key follows the header.
+    std::uint32_t pixel_offset;
+    std::uint64_t pixel_size;
+};
+
+// Identifies one decode of one version of a file, empty if the file does
+// not exist. The key is stored in the entry and compared on lookup, so
+// hash collisions are misses rather than wrong images.
+std::string entryKey(std::string const& filename, int requested_components) {
+    struct stat status;
+    std::error_code error;
+    std::filesystem::path path = std::filesystem::absolute(filename, error);
+    if (error || ::stat(path.c_str(), &status) != 0) {
+        return {};
+    }
+    return path.string() + '\n' + std::to_string(status.st_size) + '\n' +
+           std::to_string(status.st_mtim.tv_sec) + '.' +
+           std::to_string(status.st_mtim.tv_nsec) + '\n' +
+           std::to_string(requested_components);
+}
+
+// FNV-1a, which unlike std::hash is the same in every process.
+std::filesystem::path entryPath(std::string const& directory,
+                                std::string const& key) {
+    std::uint64_t hash = 0xcbf29ce484222325;
+    for (char value : key) {
+        hash = (hash ^ static_cast<unsigned char>(value)) * 0x100000001b3;
+    }
+    char name[17];
+    std::snprintf(name,
+                  sizeof(name),
+                  "%016llx",
+                  static_cast<unsigned long long>(hash));
+    return std::filesystem::path(directory) /
+           (std::string(name) + ENTRY_EXTENSION);
+}
+
+bool writeAll(int descriptor, const char* data, std::size_t size) {
+    while (size > 0) {
+        ssize_t written = ::write(descriptor, data, size);
+        if (written < 0) {
+            if (errno == EINTR) {
+                continue;
+            }
+            return false;
+        }
+        data += written;
+        size -= static_cast<std::size_t>(written);
+    }
+    return true;
+}
+}  // namespace
+
+ImageCache::ImageCache(std::string directory, std::size_t max_size)
+        : m_directory(std::move(directory)), m_max_size(max_size) {}
+
+std::optional<ImageCache::Image> ImageCache::find(
+        std::string const& filename,
+        int requested_components) const {
+    std::string key = entryKey(filename, requested_components);
+    if (key.empty()) {
+        return std::nullopt;
+    }
+    // Checked first so a miss does not make MappedFile report an error.
+    std::filesystem::path path = entryPath(m_directory, key);
+    struct stat status;
+    if (::stat(path.c_str(), &status) != 0) {
+        return std::nullopt;
+    }
+
+    MappedFile file(path.string(), MappedFile::Access::WILL_NEED);
+    EntryHeader header;
+    if (file.size() < sizeof(header)) {
+        return std::nullopt;
+    }
+    std::memcpy(&header, file.data(), sizeof(header));
+    if (header.magic != ENTRY_MAGIC || header.version != ENTRY_VERSION ||
+        header.key_size != key.size() ||
+        header.pixel_offset < sizeof(header) + key.size() ||
+        header.pixel_size != static_cast<std::uint64_t>(header.width) *
+                                     header.height * header.channels ||
+        file.size() < header.pixel_offset ||
+        file.size() - header.pixel_offset != header.pixel_size ||
+        std::memcmp(file.data() + sizeof(header), key.data(), key.size()) !=
+                0) {
+        return std::nullopt;
+    }
+
+    // The modification time of an entry is when it was last used.
+    ::utimensat(AT_FDCWD, path.c_str(), nullptr, 0);
+
+    Image image{std::move(file),
+                static_cast<int>(header.width),
+                static_cast<int>(header.height),
+                static_cast<int>(header.components),
+                {}};
+    image.pixels = std::span<const char>(
+            image.file.data() + header.pixel_offset,
+            static_cast<std::size_t>(header.pixel_size));
+    return image;
+}
+
+bool ImageCache::store(std::string const& filename,
+                       int requested_components,
+                       int width,
+                       int height,
+                       int components,
+                       int channels,
+                       const void* pixels,
+                       std::size_t row_pitch) {
+    std::string key = entryKey(filename, requested_components);
+    if (key.empty() || pixels == nullptr || width <= 0 || height <= 0 ||
+        channels <= 0) {
+        return false;
+    }
+    std::error_code error;
+    std::filesystem::create_directories(m_directory, error);
+    if (error) {
+        std::cout << "Could not create the image cache \"" << m_directory
+                  << "\"!" << std::endl;
+        return false;
+    }
+
+    // Written next to the entry and renamed over it, so readers never see
+    // a partial entry.
+    std::filesystem::path path = entryPath(m_directory, key);
+    std::string temporary = path.string() + ".XXXXXX" + TEMPORARY_EXTENSION;
+    int descriptor =
+            ::mkstemps(temporary.data(), sizeof(TEMPORARY_EXTENSION) - 1);
+    if (descriptor == -1) {
+        return false;
+    }
+
+    std::size_t row_size = static_cast<std::size_t>(width) * channels;
+    EntryHeader header = {};
+    header.magic = ENTRY_MAGIC;
+    header.version = ENTRY_VERSION;
+    header.width = static_cast<std::uint32_t>(width);
+    header.height = static_cast<std::uint32_t>(height);
+    header.components = static_cast<std::uint32_t>(components);
+    header.channels = static_cast<std::uint32_t>(channels);
+    header.key_size = static_cast<std::uint32_t>(key.size());
+    header.pixel_offset = static_cast<std::uint32_t>(
+            (sizeof(header) + key.size() + PIXEL_ALIGNMENT - 1) /
+            PIXEL_ALIGNMENT * PIXEL_ALIGNMENT);
+    header.pixel_size = static_cast<std::uint64_t>(row_size) * height;
+
+    std::vector<char> prefix(header.pixel_offset);
+    std::memcpy(prefix.data(), &header, sizeof(header));
+    std::memcpy(prefix.data() + sizeof(header), key.data(), key.size());
+    bool written = writeAll(descriptor, prefix.data(), prefix.size());
+    const char* rows = static_cast<const char*>(pixels);
+    if (row_pitch == row_size) {
+        written = written && writeAll(descriptor, rows, row_size * height);
+    } else {
+        for (int row = 0; written && row < height; ++row) {
+            written = writeAll(descriptor, rows + row * row_pitch, row_size);
+        }
+    }
+    // Flushed before the rename, so a crash cannot leave a complete looking
+    // entry whose pixels never reached the disk.
+    written = written && ::fsync(descriptor) == 0;
+    written = (::close(descriptor) == 0) && written;
+    struct stat replaced;
+    std::uint64_t replaced_size =
+            ::stat(path.c_str(), &replaced) == 0 ? replaced.st_size : 0;
+    if (!written || ::rename(temporary.c_str(), path.c_str()) != 0) {
+        ::unlink(temporary.c_str());
+        return false;
+    }
+
+    bool over_size = true;
+    {
+        std::lock_guard<std::mutex> lock(m_size_mutex);
+        if (m_size) {
+            *m_size += header.pixel_offset + header.pixel_size;
+            *m_size -= std::min(*m_size, replaced_size);
+            over_size = *m_size > m_max_size;
+        }
+    }
+    if (over_size) {
+        trim();
+    }
+    return true;
+}
+
+void ImageCache::trim() const {
+    struct Entry {
+        std::filesystem::path path;
+        std::filesystem::file_time_type used;
+        std::uintmax_t size;
+    };
+    std::vector<Entry> entries;
+    std::uintmax_t total_size = 0;
+    auto now = std::filesystem::file_time_type::clock::now();
+
+    // Other processes add and delete entries meanwhile, so every failure
+    // just skips the file.
+    std::error_code error;
+    for (std::filesystem::directory_iterator item(m_directory, error), end;
+         !error && item != end;
+         item.increment(error)) {
+        std::error_code item_error;
+        std::filesystem::file_time_type used =
+                item->last_write_time(item_error);
+        if (item_error) {
+            continue;
+        }
+        std::filesystem::path extension = item->path().extension();
+        if (extension == TEMPORARY_EXTENSION) {
+            if (now - used > STALE_TEMPORARY_AGE) {
+                std::filesystem::remove(item->path(), item_error);
+            }
+            continue;
+        }
+        std::uintmax_t size = item->file_size(item_error);
+        if (extension != ENTRY_EXTENSION || item_error) {
+            continue;
+        }
+        entries.push_back(Entry{item->path(), used, size});
+        total_size += size;
+    }
+    if (total_size > m_max_size) {
+        std::sort(entries.begin(),
+                  entries.end(),
+                  [](const Entry& lhs, const Entry& rhs) {
+                      return lhs.used < rhs.used;
+                  });
+        for (const Entry& entry : entries) {
+            if (total_size <= m_max_size) {
+                break;
+            }
+            std::error_code remove_error;
+            std::filesystem::remove(entry.path, remove_error);
+            total_size -= entry.size;
+        }
+    }
+
+    std::lock_guard<std::mutex> lock(m_size_mutex);
+    m_size = total_size;
+}
+
+void ImageCache::clear() const {
+    {
+        std::lock_guard<std::mutex> lock(m_size_mutex);
+        m_size = 0;
+    }
+    std::error_code error;
+    for (std::filesystem::directory_iterator item(m_directory, error), end;
+         !error && item != end;
+         item.increment(error)) {
+        if (item->path().extension() == ENTRY_EXTENSION) {
+            std::error_code remove_error;
+            std::filesystem::remove(item->path(), remove_error);
+        }
+    }
+}
+
+void ImageCache::setGlobal(std::shared_ptr<ImageCache> cache) {
+    std::lock_guard<std::mutex> lock(s_global_mutex);
+    s_global = std::move(cache);
+}
+
+std::shared_ptr<ImageCache> ImageCache::global() {
+    std::lock_guard<std::mutex> lock(s_global_mutex);
+    return s_global;
+}
+}  // namespace intel_vulkan::Tools
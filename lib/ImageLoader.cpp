@@ -0,0 +1,206 @@
+////////////////////////////////////////////////////////////////////////////
+// Copyright (c) 2026 intel_vulkan
+// All rights reserved.
+//
+// Contact: mehoggan@gmail.com
+//
+// This software is licensed under the terms of the Your License.
+// See the LICENSE file in the top-level directory.
+/////////////////////////////////////////////////////////////////////////
+#include "intel_vulkan/ImageLoader.h"
+
+#include "intel_vulkan/Tools.h"
+
+#include <algorithm>
+
+namespace intel_vulkan::Tools {
+
+bool ImageLoader::Budget::acquire(std::size_t ticket, std::size_t bytes) {
+    {
+        std::unique_lock<std::mutex> lock(mutex);
+        released.wait(lock, [this, ticket, bytes]() {
+            return stopping ||
+                   (ticket == next_ticket &&
+                    (in_flight_bytes == 0 ||
+                     in_flight_bytes + bytes <= max_bytes));
+        });
+        if (stopping) {
+            return false;
+        }
+        in_flight_bytes += bytes;
+        ++next_ticket;
+    }
+    released.notify_all();
+    return true;
+}
+
+void ImageLoader::Budget::release(std::size_t bytes) {
+    {
+        std::lock_guard<std::mutex> lock(mutex);
+        in_flight_bytes -= bytes;
+    }
+    released.notify_all();
+}
+
+bool ImageLoader::Budget::stopped() {
+    std::lock_guard<std::mutex> lock(mutex);
+    return stopping;
+}
+
+void ImageLoader::Budget::stop() {
+    {
+        std::lock_guard<std::mutex> lock(mutex);
+        stopping = true;
+    }
+    released.notify_all();
+}
+
+ImageLoader::ImageLoader(std::size_t thread_count,
+                         std::size_t max_in_flight_bytes)
+        : m_budget(std::make_shared<Budget>(max_in_flight_bytes))
+        , m_next_ticket(0)
+        , m_pending(0)
+        , m_running(true) {
+    if (thread_count == 0) {
+        thread_count = std::max(1u, std::thread::hardware_concurrency());
+    }
+    for (std::size_t index = 0; index < thread_count; ++index) {
+        m_workers.emplace_back([this]() { workerLoop(); });
+    }
+}
+
+ImageLoader::~ImageLoader() {
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        m_running = false;
+    }
+    m_job_ready.notify_all();
+    // Workers may be waiting for images the caller still holds to be
+    // released, which would never happen while the caller is in here.
+    m_budget->stop();
+    for (std::thread& worker : m_workers) {
+        worker.join();
+    }
+}
+
+std::vector<std::future<LoadedImage>> ImageLoader::load(
+        const std::vector<std::string>& paths,
+        int requested_components) {
+    std::vector<std::future<LoadedImage>> futures;
+    futures.reserve(paths.size());
+    for (const std::string& path : paths) {
+        std::shared_ptr<std::promise<LoadedImage>> promise =
+                std::make_shared<std::promise<LoadedImage>>();
+        futures.push_back(promise->get_future());
+        enqueue(Job{0, path, requested_components, promise, Callback()});
+    }
+    return futures;
+}
+
+void ImageLoader::load(const std::vector<std::string>& paths,
+                       int requested_components,
+                       Callback on_loaded) {
+    for (const std::string& path : paths) {
+        enqueue(Job{0, path, requested_components, nullptr, on_loaded});
+    }
+}
+
+void ImageLoader::wait() {
+    std::unique_lock<std::mutex> lock(m_mutex);
+    m_idle.wait(lock, [this]() { return m_pending == 0; });
+}
+
+std::size_t ImageLoader::threadCount() const { return m_workers.size(); }
+
+void ImageLoader::enqueue(Job&& job) {
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        job.ticket = m_next_ticket++;
+        m_jobs.push_back(std::move(job));
+        ++m_pending;
+    }
+    m_job_ready.notify_one();
+}
+
+void ImageLoader::workerLoop() {
+    for (;;) {
+        Job job;
+        {
+            std::unique_lock<std::mutex> lock(m_mutex);
+            m_job_ready.wait(
+                    lock, [this]() { return !m_running || !m_jobs.empty(); });
+            if (m_jobs.empty()) {
+                // Only reached once the loader is stopping and every queued
+                // image has been handed to a worker.
+                return;
+            }
+            job = std::move(m_jobs.front());
+            m_jobs.pop_front();
+        }
+
+        LoadedImage image = decode(job);
+        if (job.promise) {
+            job.promise->set_value(std::move(image));
+        } else if (job.on_loaded) {
+            job.on_loaded(std::move(image));
+        }
+
+        bool idle = false;
+        {
+            std::lock_guard<std::mutex> lock(m_mutex);
+            idle = --m_pending == 0;
+        }
+        if (idle) {
+            m_idle.notify_all();
+        }
+    }
+}
+
+LoadedImage ImageLoader::decode(const Job& job) {
+    LoadedImage image;
+    image.path = job.path;
+    // The jobs left once the loader is stopping are only drained, so their
+    // files are not even opened. acquire fails right away as well.
+    if (m_budget->stopped()) {
+        image.cancelled = true;
+        return image;
+    }
+
+    int width = 0, height = 0, components = 0;
+    if (!getImageInfo(job.path, &width, &height, &components)) {
+        // Still takes its turn so the images queued after it get theirs.
+        image.cancelled = !m_budget->acquire(job.ticket, 0);
+        return image;
+    }
+    std::size_t row_size =
+            static_cast<std::size_t>(width) *
+            static_cast<std::size_t>(job.requested_components <= 0
+                                             ? components
+                                             : job.requested_components);
+    std::size_t size = row_size * static_cast<std::size_t>(height);
+
+    // Reserved before decoding so the budget bounds peak memory, not only
+    // the images waiting to be picked up.
+    if (!m_budget->acquire(job.ticket, size)) {
+        image.cancelled = true;
+        return image;
+    }
+    std::shared_ptr<Budget> budget = m_budget;
+    image.reservation = std::shared_ptr<void>(
+            nullptr, [budget, size](void*) { budget->release(size); });
+
+    image.data.resize(size);
+    image.loaded = getImageData(job.path,
+                                job.requested_components,
+                                image.data.data(),
+                                row_size,
+                                size,
+                                &image.width,
+                                &image.height,
+                                &image.components);
+    if (!image.loaded) {
+        image.release();
+    }
+    return image;
+}
+}  // namespace intel_vulkan::Tools
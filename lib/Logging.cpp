@@ -9,10 +9,16 @@
 /////////////////////////////////////////////////////////////////////////
 #include "intel_vulkan/Logging.h"
 
+#include "intel_vulkan/LogRingBuffer.hpp"
+
 #include <boost/core/null_deleter.hpp>
+#include <boost/date_time/c_local_time_adjustor.hpp>
+#include <boost/date_time/posix_time/posix_time_types.hpp>
 #include <boost/date_time/posix_time/ptime.hpp>
 #include <boost/filesystem/operations.hpp>
 #include <boost/log/attributes.hpp>
+#include <boost/log/attributes/constant.hpp>
+#include <boost/log/attributes/current_thread_id.hpp>
 #include <boost/log/attributes/scoped_attribute.hpp>
 #include <boost/log/core.hpp>
 #include <boost/log/expressions.hpp>
@@ -33,20 +39,36 @@
 #include <boost/log/utility/setup/common_attributes.hpp>
 #include <boost/make_shared.hpp>
 #include <boost/shared_ptr.hpp>
+#include <signal.h>
+
+#include <algorithm>
+#include <chrono>
+#include <array>
+#include <condition_variable>
+#include <cstring>
+#include <deque>
 #include <fstream>
+#include <functional>
 #include <iostream>
+#include <memory>
+#include <string_view>
+#include <thread>
+#include <vector>
 
 BOOST_LOG_ATTRIBUTE_KEYWORD(line_id, "LineID", unsigned int)
 BOOST_LOG_ATTRIBUTE_KEYWORD(severity,
                             "Severity",
                             boost::log::trivial::severity_level)
-BOOST_LOG_ATTRIBUTE_KEYWORD(tag_attr, "Tag", std::string)
+BOOST_LOG_ATTRIBUTE_KEYWORD(tag_attr, "Tag", intel_vulkan::LogTag)
 
 namespace intel_vulkan {
 std::atomic<bool> Logging::s_init(false);
-std::unordered_map<LogTag, boost::weak_ptr<Logging::TextSink>>
-        Logging::s_loggers;
+Logging::Dict Logging::s_loggers;
 std::mutex Logging::s_loggers_mutex;
+// With no sinks registered Boost falls back to its default sink, which
+// accepts every record, so nothing may be filtered out early.
+std::atomic<boost::log::trivial::severity_level> Logging::s_min_level(
+        INTEL_VULKAN_TRACE);
 
 namespace detail {
 boost::log::formatter format =
@@ -63,38 +85,525 @@ boost::log::formatter format =
         << " " << severity << "(" << line_id << ")" << " - \'"
         << boost::log::expressions::smessage << "\'";
 
-boost::shared_ptr<Logging::TextSink> makeSink() {
-    boost::shared_ptr<Logging::TextSink> sink =
-            boost::make_shared<Logging::TextSink>();
-    return sink;
+Logging::Dict::iterator findSink(const LogTag& tag, Logging::Dict& dict) {
+    return dict.find(tag);
 }
 
-void configureSink(boost::shared_ptr<Logging::TextSink> sink,
-                   boost::log::trivial::severity_level level,
-                   const std::string& tag) {
+// The in-memory ring kept by Logging::enableFlightRecorder. Read without a
+// lock, including from the signal handlers below.
+std::atomic<BinaryLogWriter*> s_flight_recorder(nullptr);
+
+// Tags with an id at or above this cannot be routed to any sink; see
+// TagRouteTable. 4096 chunks of 1024 tags.
+constexpr std::uint32_t MAX_ROUTED_TAGS = 4096 * 1024;
+
+/**
+ * Owns every tag string ever used. Strings are never removed so the
+ * pointers and ids handed to \ref LogTag stay valid for the whole run,
+ * which also means the table only ever grows.
+ */
+class LogTagTable {
+public:
+    struct Entry {
+        const char* name;
+        std::uint32_t id;
+        std::size_t hash;
+    };
+
+    static LogTagTable& get() {
+        // Function local so tags created during static initialisation of
+        // other translation units find the table constructed.
+        static LogTagTable table;
+        return table;
+    }
+
+    Entry intern(const std::string& name) {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        auto entry_it = m_entries.find(std::string_view(name));
+        if (entry_it != m_entries.end()) {
+            return entry_it->second;
+        }
+        const std::string& stored = m_names.emplace_back(name);
+        std::string_view key(stored);
+        Entry entry{stored.c_str(),
+                    static_cast<std::uint32_t>(m_entries.size()),
+                    std::hash<std::string_view>{}(key)};
+        m_entries.emplace(key, entry);
+        if (entry.id == MAX_ROUTED_TAGS) {
+            // Ids only grow, so this is reported exactly once.
+            std::cerr << "intel_vulkan: only " << MAX_ROUTED_TAGS
+                      << " LogTags can be routed to a sink; \"" << key
+                      << "\" and later tags cannot be" << std::endl;
+        }
+        BinaryLogWriter* recorder = s_flight_recorder.load();
+        if (recorder != nullptr) {
+            recorder->addString(BinaryLogStringKind::TAG, entry.id, key);
+        }
+        return entry;
+    }
+
+    // Publishes the flight recorder under the table lock so it receives
+    // every tag exactly once, whether interned before or after.
+    void setFlightRecorder(BinaryLogWriter* recorder) {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        if (recorder != nullptr) {
+            for (std::size_t tag_id = 0; tag_id < m_names.size(); ++tag_id) {
+                recorder->addString(BinaryLogStringKind::TAG,
+                                    static_cast<std::uint32_t>(tag_id),
+                                    m_names[tag_id]);
+            }
+        }
+        s_flight_recorder.store(recorder);
+    }
+
+private:
+    LogTagTable() { intern(std::string()); }
+
+    std::mutex m_mutex;
+    std::deque<std::string> m_names;
+    std::unordered_map<std::string_view, Entry> m_entries;
+};
+
+/**
+ * The shared sink and lowest severity each tag is routed to, indexed by
+ * \ref LogTag::id and packed as (sink slot << 8 | severity). Storage grows
+ * in fixed chunks that are never moved, so readers never take a lock.
+ */
+class TagRouteTable {
+public:
+    static constexpr std::uint16_t UNROUTED = 0xffff;
+
+    // Routes to the shared text sinks.
+    static TagRouteTable& text() {
+        static TagRouteTable table;
+        return table;
+    }
+
+    // Routes to the binary files, where the slot indexes s_binary_writers.
+    static TagRouteTable& binary() {
+        static TagRouteTable table;
+        return table;
+    }
+
+    static std::uint8_t sinkSlot(std::uint16_t route) {
+        return static_cast<std::uint8_t>(route >> 8);
+    }
+
+    static std::uint8_t level(std::uint16_t route) {
+        return static_cast<std::uint8_t>(route & 0xff);
+    }
+
+    std::uint16_t route(std::uint32_t tag_id) const {
+        if ((tag_id >> CHUNK_BITS) >= MAX_CHUNKS) {
+            return UNROUTED;
+        }
+        const std::atomic<std::uint16_t>* chunk =
+                m_chunks[tag_id >> CHUNK_BITS].load(std::memory_order_acquire);
+        if (chunk == nullptr) {
+            return UNROUTED;
+        }
+        return chunk[tag_id & CHUNK_MASK].load(std::memory_order_relaxed);
+    }
+
+    bool assign(std::uint32_t tag_id,
+                std::uint8_t sink_slot,
+                boost::log::trivial::severity_level level) {
+        if ((tag_id >> CHUNK_BITS) >= MAX_CHUNKS) {
+            return false;
+        }
+        std::lock_guard<std::mutex> lock(m_mutex);
+        std::atomic<std::uint16_t>* chunk =
+                m_chunks[tag_id >> CHUNK_BITS].load(std::memory_order_relaxed);
+        if (chunk == nullptr) {
+            m_owned.emplace_back(new std::atomic<std::uint16_t>[CHUNK_SIZE]);
+            chunk = m_owned.back().get();
+            for (std::size_t index = 0; index < CHUNK_SIZE; ++index) {
+                chunk[index].store(UNROUTED, std::memory_order_relaxed);
+            }
+            m_chunks[tag_id >> CHUNK_BITS].store(chunk,
+                                                 std::memory_order_release);
+        }
+        chunk[tag_id & CHUNK_MASK].store(
+                static_cast<std::uint16_t>((sink_slot << 8) |
+                                           static_cast<std::uint8_t>(level)),
+                std::memory_order_relaxed);
+        return true;
+    }
+
+    void reset() {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        for (auto& chunk : m_owned) {
+            for (std::size_t index = 0; index < CHUNK_SIZE; ++index) {
+                chunk[index].store(UNROUTED, std::memory_order_relaxed);
+            }
+        }
+    }
+
+private:
+    TagRouteTable() = default;
+
+    static constexpr std::size_t CHUNK_BITS = 10;
+    static constexpr std::size_t CHUNK_SIZE = std::size_t(1) << CHUNK_BITS;
+    static constexpr std::size_t CHUNK_MASK = CHUNK_SIZE - 1;
+    static constexpr std::size_t MAX_CHUNKS = MAX_ROUTED_TAGS >> CHUNK_BITS;
+
+    std::array<std::atomic<std::atomic<std::uint16_t>*>, MAX_CHUNKS> m_chunks;
+    std::vector<std::unique_ptr<std::atomic<std::uint16_t>[]>> m_owned;
+    std::mutex m_mutex;
+};
+
+// One sink per output stream, shared by every tag routed to it. The slot
+// of a sink is its index here. Guarded by Logging::s_loggers_mutex.
+constexpr std::size_t MAX_SHARED_SINKS = 255;
+std::vector<boost::shared_ptr<boost::log::sinks::sink>> s_shared_sinks;
+std::unordered_map<std::string, std::uint8_t> s_shared_sink_slots;
+
+// The filter of a shared sink only has to look up the route of the
+// record's tag, so its cost does not depend on how many tags exist.
+template <typename SinkT>
+boost::shared_ptr<boost::log::sinks::sink> makeSharedSink(
+        std::uint8_t sink_slot,
+        const boost::shared_ptr<SinkT>& sink) {
     sink->set_formatter(detail::format);
+    sink->set_filter([sink_slot](
+                             const boost::log::attribute_value_set& values) {
+        boost::log::value_ref<LogTag, tag::tag_attr> tag = values[tag_attr];
+        boost::log::value_ref<boost::log::trivial::severity_level,
+                              tag::severity>
+                level = values[severity];
+        if (!tag || !level) {
+            return false;
+        }
+        std::uint16_t route = TagRouteTable::text().route(tag->id());
+        return route != TagRouteTable::UNROUTED &&
+               TagRouteTable::sinkSlot(route) == sink_slot &&
+               static_cast<std::uint8_t>(*level) >=
+                       TagRouteTable::level(route);
+    });
     boost::log::core::get()->add_sink(sink);
-    sink->set_filter(
-            severity >= level &&
-            (boost::log::expressions::has_attr(tag_attr) && tag_attr == tag));
+    return sink;
 }
 
-Logging::Dict::iterator findSink(const LogTag& tag, Logging::Dict& dict) {
-    Logging::Dict::iterator iterator = std::find_if(
-            dict.begin(),
-            dict.end(),
-            [&](Logging::Dict::value_type& key_value) {
-                bool ret_val = std::string(key_value.first.tag()) ==
-                               std::string(tag.tag());
-                return ret_val;
-            });
-    return iterator;
+boost::shared_ptr<boost::log::sinks::sink> makeStreamSink(
+        std::uint8_t sink_slot,
+        const boost::shared_ptr<std::ostream>& stream) {
+    boost::shared_ptr<Logging::TextSink> sink =
+            boost::make_shared<Logging::TextSink>();
+    sink->locked_backend()->add_stream(stream);
+    return makeSharedSink(sink_slot, sink);
+}
+
+// No sinks at all means Boost's default sink takes every record.
+std::atomic<bool> s_no_sinks(true);
+// The lowest level any sink accepts. Logging::s_min_level drops below it
+// while the flight recorder wants every record.
+std::atomic<boost::log::trivial::severity_level> s_sink_min_level(
+        INTEL_VULKAN_TRACE);
+
+// One writer per binary file, shared by every tag routed to it. Loggers
+// read the pointers without a lock; s_binary_users lets clearAll wait for
+// them before the writers are destroyed. Guarded by
+// Logging::s_loggers_mutex and s_formats_mutex.
+constexpr std::size_t MAX_BINARY_WRITERS = 255;
+std::array<std::atomic<BinaryLogWriter*>, MAX_BINARY_WRITERS> s_binary_writers;
+std::vector<std::unique_ptr<BinaryLogWriter>> s_owned_binary_writers;
+std::unordered_map<std::string, std::uint8_t> s_binary_writer_slots;
+std::atomic<std::uint32_t> s_binary_users(0);
+
+// Format strings are interned once per process and written to the string
+// table of every open binary file, so a record only stores the id.
+std::mutex s_formats_mutex;
+std::deque<std::string> s_formats;
+std::unordered_map<std::string_view, std::uint32_t> s_format_ids;
+
+void syncBinaryWriters(bool wait) {
+    for (std::atomic<BinaryLogWriter*>& slot : s_binary_writers) {
+        BinaryLogWriter* writer = slot.load();
+        if (writer != nullptr) {
+            writer->sync(wait);
+        }
+    }
+}
+
+std::uint32_t internFormat(std::string_view format) {
+    std::lock_guard<std::mutex> lock(s_formats_mutex);
+    auto format_it = s_format_ids.find(format);
+    if (format_it != s_format_ids.end()) {
+        return format_it->second;
+    }
+    std::uint32_t format_id = static_cast<std::uint32_t>(s_formats.size());
+    std::string_view stored(s_formats.emplace_back(format));
+    s_format_ids.emplace(stored, format_id);
+    for (std::atomic<BinaryLogWriter*>& slot : s_binary_writers) {
+        BinaryLogWriter* writer = slot.load();
+        if (writer != nullptr) {
+            writer->addString(BinaryLogStringKind::FORMAT, format_id, stored);
+        }
+    }
+    BinaryLogWriter* recorder = s_flight_recorder.load();
+    if (recorder != nullptr) {
+        recorder->addString(BinaryLogStringKind::FORMAT, format_id, stored);
+    }
+    return format_id;
+}
+
+// Format strings are almost always literals, so each thread remembers the
+// id per address and only compares contents on a hit.
+std::uint32_t formatId(std::string_view format) {
+    struct CachedFormat {
+        std::string_view stored;
+        std::uint32_t format_id;
+    };
+    constexpr std::size_t MAX_CACHED_FORMATS = 4096;
+    thread_local std::unordered_map<const char*, CachedFormat> s_cache;
+
+    auto cache_it = s_cache.find(format.data());
+    if (cache_it != s_cache.end() && cache_it->second.stored == format) {
+        return cache_it->second.format_id;
+    }
+    std::uint32_t format_id = internFormat(format);
+    if (s_cache.size() >= MAX_CACHED_FORMATS) {
+        s_cache.clear();
+    }
+    std::string_view stored;
+    {
+        std::lock_guard<std::mutex> lock(s_formats_mutex);
+        stored = s_formats[format_id];
+    }
+    s_cache[format.data()] = CachedFormat{stored, format_id};
+    return format_id;
+}
+
+// Owned by Logging::enableFlightRecorder and Logging::disableFlightRecorder.
+// The path is only replaced while the signal handlers are not installed.
+std::unique_ptr<BinaryLogWriter> s_owned_flight_recorder;
+std::string s_flight_recorder_path;
+
+constexpr int FLIGHT_RECORDER_SIGNALS[] = {SIGSEGV, SIGABRT};
+constexpr std::size_t FLIGHT_RECORDER_SIGNAL_COUNT =
+        sizeof(FLIGHT_RECORDER_SIGNALS) / sizeof(FLIGHT_RECORDER_SIGNALS[0]);
+struct sigaction s_previous_actions[FLIGHT_RECORDER_SIGNAL_COUNT];
+
+void restoreSignalHandlers() {
+    for (std::size_t index = 0; index < FLIGHT_RECORDER_SIGNAL_COUNT;
+         ++index) {
+        ::sigaction(FLIGHT_RECORDER_SIGNALS[index],
+                    &s_previous_actions[index],
+                    nullptr);
+    }
+}
+
+void flightRecorderSignalHandler(int signal_number) {
+    BinaryLogWriter* recorder = s_flight_recorder.load();
+    if (recorder != nullptr) {
+        recorder->dump(s_flight_recorder_path.c_str());
+    }
+    // Hand the signal back to the previous handler so the process still
+    // terminates, and dumps core, the way it would have.
+    restoreSignalHandlers();
+    ::raise(signal_number);
+}
+
+void installSignalHandlers() {
+    struct sigaction action;
+    std::memset(&action, 0, sizeof(action));
+    action.sa_handler = flightRecorderSignalHandler;
+    sigemptyset(&action.sa_mask);
+    for (std::size_t index = 0; index < FLIGHT_RECORDER_SIGNAL_COUNT;
+         ++index) {
+        ::sigaction(FLIGHT_RECORDER_SIGNALS[index],
+                    &action,
+                    &s_previous_actions[index]);
+    }
+}
+
+std::uint64_t binaryTimeStamp() {
+    return static_cast<std::uint64_t>(
+            std::chrono::duration_cast<std::chrono::nanoseconds>(
+                    std::chrono::system_clock::now().time_since_epoch())
+                    .count());
+}
+
+void flushStreams() {
+    std::cout.flush();
+    std::cerr.flush();
+    std::clog.flush();
+}
+
+void emitRecord(const LogTag& tag,
+                boost::log::trivial::severity_level level,
+                std::string_view message) {
+    // The logger carries no attributes of its own, so one per thread can be
+    // reused instead of constructing a new one for every record.
+    thread_local boost::log::sources::severity_logger<
+            boost::log::trivial::severity_level>
+            s_logger;
+
+    BOOST_LOG_SCOPED_THREAD_TAG("Tag", tag);
+    BOOST_LOG_SEV(s_logger, level) << message;
+}
+
+/**
+ * A record captured on the logging thread and written by the async writer.
+ * The time stamp and thread id are taken at the call site so the output is
+ * identical to what the synchronous path would have produced.
+ */
+struct AsyncRecord {
+    LogTag tag;
+    boost::log::trivial::severity_level level;
+    std::string message;
+    boost::posix_time::ptime time_stamp;
+    boost::log::attributes::current_thread_id::value_type thread_id;
+};
+
+struct AsyncState {
+    AsyncState(std::size_t capacity, LogOverflowPolicy overflow_policy)
+            : queue(capacity)
+            , policy(overflow_policy)
+            , running(true)
+            , writer_idle(false)
+            , pushed(0)
+            , retired(0) {}
+
+    LogRingBuffer<AsyncRecord> queue;
+    const LogOverflowPolicy policy;
+    std::atomic<bool> running;
+    std::atomic<bool> writer_idle;
+    // Records successfully queued, and records either written or dropped
+    // after being queued. flush() and a producer blocked on a full queue
+    // wait on retired, which is notified whenever it grows.
+    //
+    // pushed only counts a record once it is in the queue, so the writer
+    // or a DROP_OLDEST producer may retire it first and retired can run
+    // briefly ahead of pushed. That only wakes the writer early: it stops
+    // once retired equals pushed with running cleared, which only happens
+    // after every producer has left, and flush() waits for retired to
+    // reach a pushed value it read earlier, which a lead cannot lower.
+    std::atomic<std::uint64_t> pushed;
+    std::atomic<std::uint64_t> retired;
+    std::mutex wake_mutex;
+    std::condition_variable wake;
+    std::thread writer;
+};
+
+// Writing more than this many records between stream flushes only delays
+// output without making the writer noticeably cheaper.
+constexpr std::size_t ASYNC_BATCH_SIZE = 256;
+
+std::mutex s_async_mutex;
+std::atomic<AsyncState*> s_async_state(nullptr);
+std::atomic<std::uint32_t> s_async_users(0);
+std::atomic<std::uint64_t> s_async_dropped(0);
+
+void emitAsyncRecord(const AsyncRecord& record) {
+    typedef boost::date_time::c_local_adjustor<boost::posix_time::ptime>
+            LocalAdjustor;
+
+    BOOST_LOG_SCOPED_THREAD_ATTR(
+            "TimeStamp",
+            boost::log::attributes::constant<boost::posix_time::ptime>(
+                    LocalAdjustor::utc_to_local(record.time_stamp)));
+    BOOST_LOG_SCOPED_THREAD_ATTR(
+            "ThreadID",
+            boost::log::attributes::constant<
+                    boost::log::attributes::current_thread_id::value_type>(
+                    record.thread_id));
+    emitRecord(record.tag, record.level, record.message);
+}
+
+void wakeWriter(AsyncState& state) {
+    if (state.writer_idle.load()) {
+        std::lock_guard<std::mutex> lock(state.wake_mutex);
+        state.wake.notify_one();
+    }
+}
+
+void asyncWriterLoop(AsyncState& state) {
+    for (;;) {
+        std::size_t written = 0;
+        while (written < ASYNC_BATCH_SIZE &&
+               state.queue.tryPopWith([](AsyncRecord& record) {
+                   emitAsyncRecord(record);
+               })) {
+            ++written;
+        }
+        if (written > 0) {
+            flushStreams();
+            state.retired.fetch_add(written);
+            state.retired.notify_all();
+            continue;
+        }
+        if (!state.running.load() &&
+            state.retired.load() == state.pushed.load()) {
+            break;
+        }
+
+        std::unique_lock<std::mutex> lock(state.wake_mutex);
+        state.writer_idle.store(true);
+        state.wake.wait_for(lock, std::chrono::milliseconds(10), [&]() {
+            return !state.running.load() ||
+                   state.retired.load() != state.pushed.load();
+        });
+        state.writer_idle.store(false);
+    }
+}
+
+void pushAsyncRecord(AsyncState& state,
+                     const LogTag& tag,
+                     boost::log::trivial::severity_level level,
+                     std::string_view message) {
+    boost::posix_time::ptime time_stamp =
+            boost::posix_time::microsec_clock::universal_time();
+    const boost::log::attributes::current_thread_id::value_type& thread_id =
+            boost::log::aux::this_thread::get_id();
+    // Assigning into the cell's record reuses its message buffer, so once
+    // every cell has held a message this long no allocation takes place.
+    auto fill = [&](AsyncRecord& record) {
+        record.tag = tag;
+        record.level = level;
+        record.message.assign(message);
+        record.time_stamp = time_stamp;
+        record.thread_id = thread_id;
+    };
+    for (;;) {
+        // Read before trying, so a record retired after a failed push ends
+        // the BLOCK wait below.
+        std::uint64_t retired = state.retired.load();
+        if (state.queue.tryPushWith(fill)) {
+            state.pushed.fetch_add(1);
+            wakeWriter(state);
+            return;
+        }
+
+        switch (state.policy) {
+            case LogOverflowPolicy::DROP_NEWEST:
+                s_async_dropped.fetch_add(1);
+                return;
+            case LogOverflowPolicy::DROP_OLDEST:
+                if (state.queue.tryPopWith([](AsyncRecord&) {})) {
+                    s_async_dropped.fetch_add(1);
+                    state.retired.fetch_add(1);
+                    state.retired.notify_all();
+                }
+                break;
+            case LogOverflowPolicy::BLOCK:
+                // A cell only frees up when the writer retires a record.
+                wakeWriter(state);
+                state.retired.wait(retired);
+                break;
+        }
+    }
 }
 }  // namespace detail
 
-LogTag::LogTag(const ::std::string& tag) : tag_(tag) {}
+LogTag::LogTag() : LogTag(std::string()) {}
 
-const char* LogTag::tag() const { return tag_.c_str(); }
+LogTag::LogTag(const ::std::string& tag) {
+    detail::LogTagTable::Entry entry = detail::LogTagTable::get().intern(tag);
+    tag_ = entry.name;
+    id_ = entry.id;
+    hash_ = entry.hash;
+}
 
 bool Logging::init() {
     if (!s_init.load()) {
@@ -113,113 +622,474 @@ boost::filesystem::path Logging::mktmpdir(
 
 bool Logging::addStdCoutLogger(const LogTag& tag,
                                boost::log::trivial::severity_level level) {
-    bool ret_val = false;
+    return Logging::addRoutedLogger(
+            tag,
+            "stdout",
+            [](std::uint8_t sink_slot) {
+                return detail::makeStreamSink(
+                        sink_slot,
+                        boost::shared_ptr<std::ostream>(
+                                &std::cout, boost::null_deleter()));
+            },
+            level);
+}
 
+bool Logging::addStdCerrLogger(const LogTag& tag,
+                               boost::log::trivial::severity_level level) {
+    return Logging::addRoutedLogger(
+            tag,
+            "stderr",
+            [](std::uint8_t sink_slot) {
+                return detail::makeStreamSink(
+                        sink_slot,
+                        boost::shared_ptr<std::ostream>(
+                                &std::cerr, boost::null_deleter()));
+            },
+            level);
+}
+
+bool Logging::addStdLogLogger(const LogTag& tag,
+                              boost::log::trivial::severity_level level) {
+    return Logging::addRoutedLogger(
+            tag,
+            "stdlog",
+            [](std::uint8_t sink_slot) {
+                return detail::makeStreamSink(
+                        sink_slot,
+                        boost::shared_ptr<std::ostream>(
+                                &std::clog, boost::null_deleter()));
+            },
+            level);
+}
+
+bool Logging::addFileLogger(const LogTag& tag,
+                            const boost::filesystem::path& log_path,
+                            boost::log::trivial::severity_level level,
+                            const FileLogOptions& options) {
+    return Logging::addRoutedLogger(
+            tag,
+            "file:" + boost::filesystem::absolute(log_path).string(),
+            [&log_path, &options](std::uint8_t sink_slot) {
+                boost::shared_ptr<FileSink> sink =
+                        boost::make_shared<FileSink>(log_path, options);
+                if (!sink->locked_backend()->isOpen()) {
+                    return boost::shared_ptr<boost::log::sinks::sink>();
+                }
+                return detail::makeSharedSink(sink_slot, sink);
+            },
+            level);
+}
+
+bool Logging::addBinaryFileLogger(const LogTag& tag,
+                                  const boost::filesystem::path& log_path,
+                                  boost::log::trivial::severity_level level,
+                                  std::size_t record_capacity) {
     std::lock_guard<std::mutex> lock(Logging::s_loggers_mutex);
-    auto end_it = Logging::s_loggers.end();
-    auto tag_it = detail::findSink(tag, Logging::s_loggers);
-    if (tag_it == end_it) {
-        boost::shared_ptr<Logging::TextSink> sink = detail::makeSink();
-        boost::shared_ptr<std::ostream> stream(&std::cout,
-                                               boost::null_deleter());
-        sink->locked_backend()->add_stream(stream);
-        detail::configureSink(sink, level, tag.tag());
-        Logging::s_loggers[tag] = sink;
-        ret_val = true;
+    if (detail::TagRouteTable::binary().route(tag.id()) !=
+        detail::TagRouteTable::UNROUTED) {
+        return false;
     }
 
-    return ret_val;
+    std::string path = boost::filesystem::absolute(log_path).string();
+    auto slot_it = detail::s_binary_writer_slots.find(path);
+    if (slot_it == detail::s_binary_writer_slots.end()) {
+        if (detail::s_owned_binary_writers.size() >=
+            detail::MAX_BINARY_WRITERS) {
+            return false;
+        }
+        std::unique_ptr<BinaryLogWriter> writer =
+                std::make_unique<BinaryLogWriter>();
+        if (!writer->open(path, record_capacity)) {
+            return false;
+        }
+        std::uint8_t writer_slot = static_cast<std::uint8_t>(
+                detail::s_owned_binary_writers.size());
+        {
+            // Publishing under the formats lock means the new file sees
+            // every format exactly once, whether interned before or after.
+            std::lock_guard<std::mutex> formats_lock(detail::s_formats_mutex);
+            for (std::size_t format_id = 0;
+                 format_id < detail::s_formats.size();
+                 ++format_id) {
+                writer->addString(BinaryLogStringKind::FORMAT,
+                                  static_cast<std::uint32_t>(format_id),
+                                  detail::s_formats[format_id]);
+            }
+            detail::s_binary_writers[writer_slot].store(writer.get());
+        }
+        detail::s_owned_binary_writers.push_back(std::move(writer));
+        slot_it = detail::s_binary_writer_slots.emplace(path, writer_slot)
+                          .first;
+    }
+
+    detail::s_owned_binary_writers[slot_it->second]->addString(
+            BinaryLogStringKind::TAG, tag.id(), tag.tag());
+    if (!detail::TagRouteTable::binary().assign(
+                tag.id(), slot_it->second, level)) {
+        return false;
+    }
+    Logging::updateMinLevel(detail::s_no_sinks.exchange(false), level);
+    return true;
 }
 
-bool Logging::addStdCerrLogger(const LogTag& tag,
-                               boost::log::trivial::severity_level level) {
+bool Logging::addRoutedLogger(
+        const LogTag& tag,
+        const std::string& stream_key,
+        const std::function<boost::shared_ptr<boost::log::sinks::sink>(
+                std::uint8_t)>& make_sink,
+        boost::log::trivial::severity_level level) {
     bool ret_val = false;
 
     std::lock_guard<std::mutex> lock(Logging::s_loggers_mutex);
     auto end_it = Logging::s_loggers.end();
     auto tag_it = detail::findSink(tag, Logging::s_loggers);
     if (tag_it == end_it) {
-        boost::shared_ptr<Logging::TextSink> sink = detail::makeSink();
-        boost::shared_ptr<std::ostream> stream(&std::cerr,
-                                               boost::null_deleter());
-        sink->locked_backend()->add_stream(stream);
-        detail::configureSink(sink, level, tag.tag());
-        Logging::s_loggers[tag] = sink;
-        ret_val = true;
+        auto slot_it = detail::s_shared_sink_slots.find(stream_key);
+        if (slot_it == detail::s_shared_sink_slots.end()) {
+            if (detail::s_shared_sinks.size() >= detail::MAX_SHARED_SINKS) {
+                return false;
+            }
+            std::uint8_t sink_slot =
+                    static_cast<std::uint8_t>(detail::s_shared_sinks.size());
+            boost::shared_ptr<boost::log::sinks::sink> sink =
+                    make_sink(sink_slot);
+            if (!sink) {
+                return false;
+            }
+            detail::s_shared_sinks.push_back(sink);
+            slot_it = detail::s_shared_sink_slots
+                              .emplace(stream_key, sink_slot)
+                              .first;
+        }
+        if (detail::TagRouteTable::text().assign(
+                    tag.id(), slot_it->second, level)) {
+            Logging::s_loggers[tag] = detail::s_shared_sinks[slot_it->second];
+            Logging::updateMinLevel(detail::s_no_sinks.exchange(false),
+                                    level);
+            ret_val = true;
+        }
     }
 
     return ret_val;
 }
 
-bool Logging::addStdLogLogger(const LogTag& tag,
-                              boost::log::trivial::severity_level level) {
+bool Logging::appendFormatPrefix(std::stringstream& sstream,
+                                 std::string_view& format) {
+    std::size_t index = 0;
+    while (index < format.size()) {
+        char current = format[index];
+        char next = index + 1 < format.size() ? format[index + 1] : '\0';
+        if (current == '{' && next == '}') {
+            sstream.write(format.data(), static_cast<std::streamsize>(index));
+            format.remove_prefix(index + 2);
+            return true;
+        }
+        if ((current == '{' && next == '{') ||
+            (current == '}' && next == '}')) {
+            sstream.write(format.data(), static_cast<std::streamsize>(index));
+            sstream.put(current);
+            format.remove_prefix(index + 2);
+            index = 0;
+            continue;
+        }
+        ++index;
+    }
+    sstream.write(format.data(), static_cast<std::streamsize>(index));
+    format.remove_prefix(index);
+    return false;
+}
+
+namespace detail {
+thread_local std::stringstream s_thread_stream;
+thread_local bool s_thread_stream_in_use = false;
+}  // namespace detail
+
+Logging::ThreadStream::ThreadStream() : m_stream(&detail::s_thread_stream) {
+    if (detail::s_thread_stream_in_use) {
+        m_nested = std::make_unique<std::stringstream>();
+        m_stream = m_nested.get();
+    } else {
+        detail::s_thread_stream_in_use = true;
+        // Assigning an empty string keeps the buffer's capacity.
+        m_stream->str(std::string());
+        m_stream->clear();
+    }
+}
+
+Logging::ThreadStream::~ThreadStream() {
+    if (!m_nested) {
+        detail::s_thread_stream_in_use = false;
+    }
+}
+
+std::uint8_t Logging::routesFor(const LogTag& tag,
+                                boost::log::trivial::severity_level level) {
+    std::uint8_t ret_val = 0;
+
+    std::uint16_t route = detail::TagRouteTable::text().route(tag.id());
+    if (route == detail::TagRouteTable::UNROUTED) {
+        if (detail::s_no_sinks.load(std::memory_order_relaxed)) {
+            ret_val |= TEXT_ROUTE;
+        }
+    } else if (static_cast<std::uint8_t>(level) >=
+               detail::TagRouteTable::level(route)) {
+        ret_val |= TEXT_ROUTE;
+    }
+
+    route = detail::TagRouteTable::binary().route(tag.id());
+    if (route != detail::TagRouteTable::UNROUTED &&
+        static_cast<std::uint8_t>(level) >=
+                detail::TagRouteTable::level(route)) {
+        ret_val |= BINARY_ROUTE;
+    }
+
+    if (detail::s_flight_recorder.load(std::memory_order_relaxed) !=
+        nullptr) {
+        ret_val |= RECORDER_ROUTE;
+    }
+
+    return ret_val;
+}
+
+std::string_view Logging::streamFormat(std::size_t arg_count) {
+    // "{} {} ... {}" for each arity, matching logStringBuilder's spacing.
+    static constexpr std::size_t MAX_ARGS = 32;
+    static const std::array<std::string, MAX_ARGS + 1> formats = []() {
+        std::array<std::string, MAX_ARGS + 1> ret_val;
+        for (std::size_t count = 1; count <= MAX_ARGS; ++count) {
+            ret_val[count] = ret_val[count - 1] + (count > 1 ? " {}" : "{}");
+        }
+        return ret_val;
+    }();
+    return formats[std::min(arg_count, MAX_ARGS)];
+}
+
+void Logging::writeBinaryLog(const LogTag& tag,
+                             boost::log::trivial::severity_level level,
+                             std::uint8_t routes,
+                             std::string_view format,
+                             const BinaryLogArgs& args) {
+    std::uint32_t format_id = detail::formatId(format);
+    std::uint64_t time_stamp = detail::binaryTimeStamp();
+    std::uint8_t severity = static_cast<std::uint8_t>(level);
+
+    detail::s_binary_users.fetch_add(1);
+    std::uint16_t route = detail::TagRouteTable::binary().route(tag.id());
+    if ((routes & BINARY_ROUTE) && route != detail::TagRouteTable::UNROUTED) {
+        BinaryLogWriter* writer =
+                detail::s_binary_writers[detail::TagRouteTable::sinkSlot(
+                                                 route)]
+                        .load();
+        if (writer != nullptr) {
+            writer->write(time_stamp, tag.id(), format_id, severity, args);
+            if (level >= INTEL_VULKAN_FATAL) {
+                writer->sync(true);
+            }
+        }
+    }
+    BinaryLogWriter* recorder = detail::s_flight_recorder.load();
+    if ((routes & RECORDER_ROUTE) && recorder != nullptr) {
+        recorder->write(time_stamp, tag.id(), format_id, severity, args);
+        if (level >= INTEL_VULKAN_FATAL) {
+            recorder->dump(detail::s_flight_recorder_path.c_str());
+        }
+    }
+    detail::s_binary_users.fetch_sub(1);
+}
+
+void Logging::updateMinLevel(bool first_sink,
+                             boost::log::trivial::severity_level sink_level) {
+    if (first_sink || sink_level < detail::s_sink_min_level.load()) {
+        detail::s_sink_min_level.store(sink_level);
+    }
+    Logging::s_min_level.store(detail::s_flight_recorder.load() != nullptr
+                                       ? INTEL_VULKAN_TRACE
+                                       : detail::s_sink_min_level.load());
+}
+
+void Logging::writeSeverityLog(const LogTag& tag,
+                               boost::log::trivial::severity_level level,
+                               std::string_view message) {
+    Logging::init();
+
+    detail::s_async_users.fetch_add(1);
+    detail::AsyncState* state = detail::s_async_state.load();
+    if (state != nullptr) {
+        detail::pushAsyncRecord(*state, tag, level, message);
+        detail::s_async_users.fetch_sub(1);
+        if (level >= INTEL_VULKAN_FATAL) {
+            Logging::flush();
+        }
+        return;
+    }
+    detail::s_async_users.fetch_sub(1);
+
+    detail::emitRecord(tag, level, message);
+    detail::flushStreams();
+}
+
+bool Logging::enableAsync(std::size_t capacity, LogOverflowPolicy policy) {
     bool ret_val = false;
 
-    std::lock_guard<std::mutex> lock(Logging::s_loggers_mutex);
-    auto end_it = Logging::s_loggers.end();
-    auto tag_it = detail::findSink(tag, Logging::s_loggers);
-    if (tag_it == end_it) {
-        boost::shared_ptr<Logging::TextSink> sink = detail::makeSink();
-        boost::shared_ptr<std::ostream> stream(&std::clog,
-                                               boost::null_deleter());
-        sink->locked_backend()->add_stream(stream);
-        detail::configureSink(sink, level, tag.tag());
-        Logging::s_loggers[tag] = sink;
+    std::lock_guard<std::mutex> lock(detail::s_async_mutex);
+    if (detail::s_async_state.load() == nullptr) {
+        Logging::init();
+        std::unique_ptr<detail::AsyncState> state =
+                std::make_unique<detail::AsyncState>(capacity, policy);
+        detail::AsyncState& state_ref = *state;
+        state->writer = std::thread(
+                [&state_ref]() { detail::asyncWriterLoop(state_ref); });
+        detail::s_async_dropped.store(0);
+        detail::s_async_state.store(state.release());
         ret_val = true;
     }
 
     return ret_val;
 }
 
-bool Logging::addFileLogger(const LogTag& tag,
-                            const boost::filesystem::path& log_path,
-                            boost::log::trivial::severity_level level) {
+bool Logging::disableAsync() {
     bool ret_val = false;
 
-    std::lock_guard<std::mutex> lock(Logging::s_loggers_mutex);
-    auto end_it = Logging::s_loggers.end();
-    auto tag_it = detail::findSink(tag, Logging::s_loggers);
-    if (tag_it == end_it) {
-        boost::shared_ptr<Logging::TextSink> sink = detail::makeSink();
-        sink->locked_backend()->add_stream(
-                boost::make_shared<std::ofstream>(log_path.string()));
-        detail::configureSink(sink, level, tag.tag());
-        Logging::s_loggers[tag] = sink;
+    std::lock_guard<std::mutex> lock(detail::s_async_mutex);
+    std::unique_ptr<detail::AsyncState> state(
+            detail::s_async_state.exchange(nullptr));
+    if (state) {
+        // Callers that loaded the state before the exchange may still be
+        // pushing into it.
+        while (detail::s_async_users.load() != 0) {
+            std::this_thread::yield();
+        }
+        {
+            std::lock_guard<std::mutex> wake_lock(state->wake_mutex);
+            state->running.store(false);
+            state->wake.notify_one();
+        }
+        state->writer.join();
         ret_val = true;
     }
 
     return ret_val;
 }
 
-void Logging::writeSeverityLog(const LogTag& tag,
-                               boost::log::trivial::severity_level level,
-                               const std::string& message) {
-    Logging::init();
-    boost::log::sources::severity_logger<boost::log::trivial::severity_level>
-            s_logger;
+void Logging::flush() {
+    detail::s_async_users.fetch_add(1);
+    detail::AsyncState* state = detail::s_async_state.load();
+    if (state != nullptr) {
+        std::uint64_t target = state->pushed.load();
+        std::uint64_t retired = state->retired.load();
+        while (retired < target) {
+            detail::wakeWriter(*state);
+            state->retired.wait(retired);
+            retired = state->retired.load();
+        }
+    }
+    detail::s_async_users.fetch_sub(1);
 
-    BOOST_LOG_SCOPED_THREAD_TAG("Tag", tag.tag());
-    BOOST_LOG_SEV(s_logger, level) << message;
-    std::cout.flush();
-    std::cerr.flush();
-    std::clog.flush();
+    detail::flushStreams();
+    {
+        // Writes out what the file sinks are still buffering.
+        std::lock_guard<std::mutex> lock(Logging::s_loggers_mutex);
+        for (boost::shared_ptr<boost::log::sinks::sink>& sink :
+             detail::s_shared_sinks) {
+            sink->flush();
+        }
+    }
+    detail::syncBinaryWriters(false);
+}
+
+std::uint64_t Logging::asyncDroppedCount() {
+    return detail::s_async_dropped.load();
+}
+
+bool Logging::enableFlightRecorder(std::size_t record_capacity,
+                                   const boost::filesystem::path& dump_path) {
+    std::lock_guard<std::mutex> lock(Logging::s_loggers_mutex);
+    if (detail::s_owned_flight_recorder) {
+        return false;
+    }
+    std::unique_ptr<BinaryLogWriter> recorder =
+            std::make_unique<BinaryLogWriter>();
+    if (!recorder->openAnonymous(record_capacity)) {
+        return false;
+    }
+    detail::s_flight_recorder_path =
+            boost::filesystem::absolute(dump_path).string();
+    {
+        std::lock_guard<std::mutex> formats_lock(detail::s_formats_mutex);
+        for (std::size_t format_id = 0; format_id < detail::s_formats.size();
+             ++format_id) {
+            recorder->addString(BinaryLogStringKind::FORMAT,
+                                static_cast<std::uint32_t>(format_id),
+                                detail::s_formats[format_id]);
+        }
+        detail::LogTagTable::get().setFlightRecorder(recorder.get());
+    }
+    detail::s_owned_flight_recorder = std::move(recorder);
+    detail::installSignalHandlers();
+    Logging::s_min_level.store(INTEL_VULKAN_TRACE);
+    return true;
+}
+
+bool Logging::disableFlightRecorder() {
+    std::lock_guard<std::mutex> lock(Logging::s_loggers_mutex);
+    if (!detail::s_owned_flight_recorder) {
+        return false;
+    }
+    detail::restoreSignalHandlers();
+    {
+        std::lock_guard<std::mutex> formats_lock(detail::s_formats_mutex);
+        detail::LogTagTable::get().setFlightRecorder(nullptr);
+    }
+    Logging::s_min_level.store(detail::s_sink_min_level.load());
+    while (detail::s_binary_users.load() != 0) {
+        std::this_thread::yield();
+    }
+    detail::s_owned_flight_recorder.reset();
+    return true;
+}
+
+bool Logging::dumpFlightRecorder(const boost::filesystem::path& dump_path) {
+    std::lock_guard<std::mutex> lock(Logging::s_loggers_mutex);
+    if (!detail::s_owned_flight_recorder) {
+        return false;
+    }
+    return detail::s_owned_flight_recorder->dump(
+            dump_path.empty() ? detail::s_flight_recorder_path.c_str()
+                              : dump_path.c_str());
 }
 
 bool Logging::clearAll() {
     bool ret_val = true;
 
+    Logging::flush();
     std::lock_guard<std::mutex> lock(Logging::s_loggers_mutex);
 
-    std::for_each(Logging::s_loggers.begin(),
-                  Logging::s_loggers.end(),
-                  [&](std::unordered_map<LogTag, boost::weak_ptr<TextSink>>::
-                              value_type& pair) {
-                      boost::log::core::get()->remove_sink(pair.second.lock());
-                      pair.second.reset();
+    std::for_each(detail::s_shared_sinks.begin(),
+                  detail::s_shared_sinks.end(),
+                  [&](boost::shared_ptr<boost::log::sinks::sink>& sink) {
+                      boost::log::core::get()->remove_sink(sink);
                   });
+    detail::s_shared_sinks.clear();
+    detail::s_shared_sink_slots.clear();
     Logging::s_loggers.clear();
     // Get rid of default sink.
     boost::log::core::get()->remove_all_sinks();
+    detail::TagRouteTable::text().reset();
+    detail::TagRouteTable::binary().reset();
+    {
+        std::lock_guard<std::mutex> formats_lock(detail::s_formats_mutex);
+        for (std::atomic<BinaryLogWriter*>& slot : detail::s_binary_writers) {
+            slot.store(nullptr);
+        }
+    }
+    while (detail::s_binary_users.load() != 0) {
+        std::this_thread::yield();
+    }
+    detail::s_owned_binary_writers.clear();
+    detail::s_binary_writer_slots.clear();
+    detail::s_no_sinks.store(true);
+    detail::s_sink_min_level.store(INTEL_VULKAN_TRACE);
+    Logging::s_min_level.store(INTEL_VULKAN_TRACE);
     ret_val = Logging::s_loggers.empty();
 
     return ret_val;
@@ -0,0 +1,222 @@
+////////////////////////////////////////////////////////////////////////////
+// Copyright (c) 2026 intel_vulkan
+// All rights reserved.
+//
+// Contact: mehoggan@gmail.com
+//
+// This software is licensed under the terms of the Your License.
+// See the LICENSE file in the top-level directory.
+/////////////////////////////////////////////////////////////////////////
+#include "intel_vulkan/Matrix.h"
+
+#include <algorithm>
+#include <atomic>
+#include <cmath>
+
+#if defined(__x86_64__) || defined(__i386__)
+#define INTEL_VULKAN_MATRIX_X86 1
+#include <immintrin.h>
+#endif
+
+namespace intel_vulkan::Tools {
+
+namespace {
+void multiplyScalar(const Mat4& lhs,
+                    const Mat4* rhs,
+                    Mat4* result,
+                    std::size_t count) {
+    for (std::size_t index = 0; index < count; ++index) {
+        result[index] = MatrixScalar::multiply(lhs, rhs[index]);
+    }
+}
+
+void transformScalar(const Mat4& matrix,
+                     const Vec4Arrays& vectors,
+                     std::size_t begin,
+                     std::size_t end) {
+    for (std::size_t index = begin; index < end; ++index) {
+        Vec4 vector = MatrixScalar::transform(matrix,
+                                              {vectors.x[index],
+                                               vectors.y[index],
+                                               vectors.z[index],
+                                               vectors.w[index]});
+        vectors.x[index] = vector.x;
+        vectors.y[index] = vector.y;
+        vectors.z[index] = vector.z;
+        vectors.w[index] = vector.w;
+    }
+}
+
+#if defined(INTEL_VULKAN_MATRIX_X86) && defined(INTEL_VULKAN_MATRIX_SSE)
+void multiplySse(const Mat4& lhs,
+                 const Mat4* rhs,
+                 Mat4* result,
+                 std::size_t count) {
+    for (std::size_t index = 0; index < count; ++index) {
+        result[index] = MatrixSse::multiply(lhs, rhs[index]);
+    }
+}
+
+// Four vectors per iteration, one per lane; every element of the matrix is
+// broadcast once up front.
+void transformSse(const Mat4& matrix,
+                  const Vec4Arrays& vectors,
+                  std::size_t count) {
+    __m128 m[4][4];
+    for (int column = 0; column < 4; ++column) {
+        m[column][0] = _mm_set1_ps(matrix.columns[column].x);
+        m[column][1] = _mm_set1_ps(matrix.columns[column].y);
+        m[column][2] = _mm_set1_ps(matrix.columns[column].z);
+        m[column][3] = _mm_set1_ps(matrix.columns[column].w);
+    }
+    float* outputs[4] = {vectors.x, vectors.y, vectors.z, vectors.w};
+    std::size_t index = 0;
+    for (; index + 4 <= count; index += 4) {
+        __m128 x = _mm_loadu_ps(vectors.x + index);
+        __m128 y = _mm_loadu_ps(vectors.y + index);
+        __m128 z = _mm_loadu_ps(vectors.z + index);
+        __m128 w = _mm_loadu_ps(vectors.w + index);
+        for (int row = 0; row < 4; ++row) {
+            __m128 sum = _mm_mul_ps(m[0][row], x);
+            sum = _mm_add_ps(sum, _mm_mul_ps(m[1][row], y));
+            sum = _mm_add_ps(sum, _mm_mul_ps(m[2][row], z));
+            sum = _mm_add_ps(sum, _mm_mul_ps(m[3][row], w));
+            _mm_storeu_ps(outputs[row] + index, sum);
+        }
+    }
+    transformScalar(matrix, vectors, index, count);
+}
+
+// Two columns of the result per 256 bit vector, with the columns of lhs
+// repeated in both halves.
+__attribute__((target("avx2"))) void multiplyAvx2(const Mat4& lhs,
+                                                  const Mat4* rhs,
+                                                  Mat4* result,
+                                                  std::size_t count) {
+    __m256 c0 = _mm256_broadcast_ps(
+            reinterpret_cast<const __m128*>(&lhs.columns[0]));
+    __m256 c1 = _mm256_broadcast_ps(
+            reinterpret_cast<const __m128*>(&lhs.columns[1]));
+    __m256 c2 = _mm256_broadcast_ps(
+            reinterpret_cast<const __m128*>(&lhs.columns[2]));
+    __m256 c3 = _mm256_broadcast_ps(
+            reinterpret_cast<const __m128*>(&lhs.columns[3]));
+    for (std::size_t index = 0; index < count; ++index) {
+        const float* in = &rhs[index].columns[0].x;
+        float* out = &result[index].columns[0].x;
+        // Both loads come before the stores, so result may be rhs.
+        __m256 low = _mm256_loadu_ps(in);
+        __m256 high = _mm256_loadu_ps(in + 8);
+        __m256 vectors[2] = {low, high};
+        for (int half = 0; half < 2; ++half) {
+            __m256 v = vectors[half];
+            __m256 sum = _mm256_mul_ps(c0, _mm256_permute_ps(v, 0x00));
+            sum = _mm256_add_ps(sum,
+                                _mm256_mul_ps(c1, _mm256_permute_ps(v, 0x55)));
+            sum = _mm256_add_ps(sum,
+                                _mm256_mul_ps(c2, _mm256_permute_ps(v, 0xaa)));
+            sum = _mm256_add_ps(sum,
+                                _mm256_mul_ps(c3, _mm256_permute_ps(v, 0xff)));
+            _mm256_storeu_ps(out + half * 8, sum);
+        }
+    }
+}
+
+__attribute__((target("avx2"))) void transformAvx2(
+        const Mat4& matrix,
+        const Vec4Arrays& vectors,
+        std::size_t count) {
+    __m256 m[4][4];
+    for (int column = 0; column < 4; ++column) {
+        m[column][0] = _mm256_set1_ps(matrix.columns[column].x);
+        m[column][1] = _mm256_set1_ps(matrix.columns[column].y);
+        m[column][2] = _mm256_set1_ps(matrix.columns[column].z);
+        m[column][3] = _mm256_set1_ps(matrix.columns[column].w);
+    }
+    float* outputs[4] = {vectors.x, vectors.y, vectors.z, vectors.w};
+    std::size_t index = 0;
+    for (; index + 8 <= count; index += 8) {
+        __m256 x = _mm256_loadu_ps(vectors.x + index);
+        __m256 y = _mm256_loadu_ps(vectors.y + index);
+        __m256 z = _mm256_loadu_ps(vectors.z + index);
+        __m256 w = _mm256_loadu_ps(vectors.w + index);
+        for (int row = 0; row < 4; ++row) {
+            __m256 sum = _mm256_mul_ps(m[0][row], x);
+            sum = _mm256_add_ps(sum, _mm256_mul_ps(m[1][row], y));
+            sum = _mm256_add_ps(sum, _mm256_mul_ps(m[2][row], z));
+            sum = _mm256_add_ps(sum, _mm256_mul_ps(m[3][row], w));
+            _mm256_storeu_ps(outputs[row] + index, sum);
+        }
+    }
+    transformScalar(matrix, vectors, index, count);
+}
+#endif
+
+std::atomic<CpuFeatures::Isa>& isaSlot() {
+    static std::atomic<CpuFeatures::Isa> isa(CpuFeatures::bestIsa());
+    return isa;
+}
+}  // namespace
+
+Mat4 perspective(float aspect_ratio,
+                 float field_of_view,
+                 float near_clip,
+                 float far_clip) {
+    float fov_value = 1.0f / std::tan(field_of_view * 0.5f *
+                                      0.01745329251994329576923690768489f);
+    return {{{{fov_value / aspect_ratio, 0.0f, 0.0f, 0.0f},
+              {0.0f, -fov_value, 0.0f, 0.0f},
+              {0.0f, 0.0f, far_clip / (near_clip - far_clip), -1.0f},
+              {0.0f,
+               0.0f,
+               (near_clip * far_clip) / (near_clip - far_clip),
+               0.0f}}}};
+}
+
+CpuFeatures::Isa matrixIsa() {
+    return isaSlot().load(std::memory_order_relaxed);
+}
+
+CpuFeatures::Isa setMatrixIsa(CpuFeatures::Isa isa) {
+    isa = CpuFeatures::supportedIsa(isa);
+    isaSlot().store(isa, std::memory_order_relaxed);
+    return isa;
+}
+
+void multiply(const Mat4& lhs,
+              std::span<const Mat4> rhs,
+              std::span<Mat4> result) {
+    std::size_t count = std::min(rhs.size(), result.size());
+#if defined(INTEL_VULKAN_MATRIX_X86) && defined(INTEL_VULKAN_MATRIX_SSE)
+    switch (matrixIsa()) {
+        case CpuFeatures::Isa::AVX2:
+            multiplyAvx2(lhs, rhs.data(), result.data(), count);
+            return;
+        case CpuFeatures::Isa::SSSE3:
+            multiplySse(lhs, rhs.data(), result.data(), count);
+            return;
+        case CpuFeatures::Isa::SCALAR:
+            break;
+    }
+#endif
+    multiplyScalar(lhs, rhs.data(), result.data(), count);
+}
+
+void transform(const Mat4& matrix,
+               const Vec4Arrays& vectors,
+               std::size_t count) {
+#if defined(INTEL_VULKAN_MATRIX_X86) && defined(INTEL_VULKAN_MATRIX_SSE)
+    switch (matrixIsa()) {
+        case CpuFeatures::Isa::AVX2:
+            transformAvx2(matrix, vectors, count);
+            return;
+        case CpuFeatures::Isa::SSSE3:
+            transformSse(matrix, vectors, count);
+            return;
+        case CpuFeatures::Isa::SCALAR:
+            break;
+    }
+#endif
+    transformScalar(matrix, vectors, 0, count);
+}
+}  // namespace intel_vulkan::Tools
@@ -0,0 +1,374 @@
+////////////////////////////////////////////////////////////////////////////
+// Copyright (c) 2026 intel_vulkan
+// All rights reserved.
+//
+// Contact: mehoggan@gmail.com
+//
+// This software is licensed under the terms of the Your License.
+// See the LICENSE file in the top-level directory.
+/////////////////////////////////////////////////////////////////////////
+#include "intel_vulkan/MipChain.h"
+
+#include "intel_vulkan/PixelConvert.h"
+
+#include <algorithm>
+#include <array>
+#include <cmath>
+#include <cstring>
+#include <thread>
+
+#if defined(__SSE2__)
+#include <emmintrin.h>
+#endif
+
+namespace intel_vulkan::Tools {
+
+namespace {
+// Levels smaller than this are filtered on the calling thread; starting
+// threads would cost more than the filtering.
+constexpr std::size_t MIN_PARALLEL_PIXELS = 256 * 256;
+
+constexpr std::size_t LINEAR_STEPS = 1 << 14;
+
+const std::array<std::uint8_t, LINEAR_STEPS>& srgbEncodeTable() {
+    static const std::array<std::uint8_t, LINEAR_STEPS> table = []() {
+        std::array<std::uint8_t, LINEAR_STEPS> values;
+        for (std::size_t step = 0; step < LINEAR_STEPS; ++step) {
+            double linear = static_cast<double>(step) / (LINEAR_STEPS - 1);
+            double srgb = linear <= 0.0031308
+                                  ? linear * 12.92
+                                  : 1.055 * std::pow(linear, 1.0 / 2.4) - 0.055;
+            values[step] = static_cast<std::uint8_t>(
+                    std::lround(std::clamp(srgb, 0.0, 1.0) * 255.0));
+        }
+        return values;
+    }();
+    return table;
+}
+
+struct LevelView {
+    const std::uint8_t* pixels;
+    std::uint32_t width;
+    std::uint32_t height;
+    std::size_t row_pitch;
+};
+
+void filterUnormRows(const LevelView& src,
+                     std::uint8_t* dst,
+                     std::uint32_t dst_width,
+                     std::uint32_t row_begin,
+                     std::uint32_t row_end) {
+    for (std::uint32_t row = row_begin; row < row_end; ++row) {
+        const std::uint8_t* top = src.pixels + 2 * row * src.row_pitch;
+        const std::uint8_t* bottom =
+                src.pixels +
+                std::min(2 * row + 1, src.height - 1) * src.row_pitch;
+        std::uint8_t* out = dst + static_cast<std::size_t>(row) * dst_width * 4;
+
+        std::uint32_t column = 0;
+#if defined(__SSE2__)
+        // 4 output pixels from 8 source pixels of both rows, widened to 16
+        // bit so the sum of 4 is exact.
+        const __m128i zero = _mm_setzero_si128();
+        const __m128i two = _mm_set1_epi16(2);
+        for (; 2 * column + 8 <= src.width; column += 4) {
+            __m128i sums[2];
+            for (int half = 0; half < 2; ++half) {
+                std::size_t offset = (2 * column + 4 * half) * 4;
+                __m128i top_pixels = _mm_loadu_si128(
+                        reinterpret_cast<const __m128i*>(top + offset));
+                __m128i bottom_pixels = _mm_loadu_si128(
+                        reinterpret_cast<const __m128i*>(bottom + offset));
+                __m128i low = _mm_add_epi16(
+                        _mm_unpacklo_epi8(top_pixels, zero),
+                        _mm_unpacklo_epi8(bottom_pixels, zero));
+                __m128i high = _mm_add_epi16(
+                        _mm_unpackhi_epi8(top_pixels, zero),
+                        _mm_unpackhi_epi8(bottom_pixels, zero));
+                // Even source pixels plus odd source pixels.
+                sums[half] = _mm_add_epi16(_mm_unpacklo_epi64(low, high),
+                                           _mm_unpackhi_epi64(low, high));
+                sums[half] = _mm_srli_epi16(_mm_add_epi16(sums[half], two), 2);
+            }
+            _mm_storeu_si128(reinterpret_cast<__m128i*>(out + column * 4),
+                             _mm_packus_epi16(sums[0], sums[1]));
+        }
+#endif
+        for (; column < dst_width; ++column) {
+            std::size_t left = 2 * column * 4;
+            std::size_t right = std::min(2 * column + 1, src.width - 1) * 4;
+            for (std::size_t channel = 0; channel < 4; ++channel) {
+                out[column * 4 + channel] = static_cast<std::uint8_t>(
+                        (top[left + channel] + top[right + channel] +
+                         bottom[left + channel] + bottom[right + channel] +
+                         2) >>
+                        2);
+            }
+        }
+    }
+}
+
+void filterSrgbRows(const LevelView& src,
+                    std::uint8_t* dst,
+                    std::uint32_t dst_width,
+                    std::uint32_t row_begin,
+                    std::uint32_t row_end) {
+    const std::array<std::uint8_t, LINEAR_STEPS>& encode = srgbEncodeTable();
+    std::vector<float> top(static_cast<std::size_t>(src.width) * 4);
+    std::vector<float> bottom(static_cast<std::size_t>(src.width) * 4);
+    for (std::uint32_t row = row_begin; row < row_end; ++row) {
+        PixelConvert::srgbToLinear(
+                src.pixels + 2 * row * src.row_pitch, top.data(), src.width);
+        PixelConvert::srgbToLinear(
+                src.pixels +
+                        std::min(2 * row + 1, src.height - 1) * src.row_pitch,
+                bottom.data(),
+                src.width);
+        std::uint8_t* out = dst + static_cast<std::size_t>(row) * dst_width * 4;
+
+        for (std::uint32_t column = 0; column < dst_width; ++column) {
+            std::size_t left = 2 * column * 4;
+            std::size_t right = std::min(2 * column + 1, src.width - 1) * 4;
+            float average[4];
+#if defined(__SSE2__)
+            __m128 sum = _mm_add_ps(
+                    _mm_add_ps(_mm_loadu_ps(&top[left]),
+                               _mm_loadu_ps(&top[right])),
+                    _mm_add_ps(_mm_loadu_ps(&bottom[left]),
+                               _mm_loadu_ps(&bottom[right])));
+            _mm_storeu_ps(average, _mm_mul_ps(sum, _mm_set1_ps(0.25f)));
+#else
+            for (std::size_t channel = 0; channel < 4; ++channel) {
+                average[channel] = (top[left + channel] + top[right + channel] +
+                                    bottom[left + channel] +
+                                    bottom[right + channel]) *
+                                   0.25f;
+            }
+#endif
+            for (std::size_t channel = 0; channel < 3; ++channel) {
+                out[column * 4 + channel] = encode[static_cast<std::size_t>(
+                        average[channel] * (LINEAR_STEPS - 1) + 0.5f)];
+            }
+            out[column * 4 + 3] =
+                    static_cast<std::uint8_t>(average[3] * 255.0f + 0.5f);
+        }
+    }
+}
+
+// The source rows or columns one destination texel averages along an
+// axis. Even sizes use a 2-tap box. Odd sizes above 1 use the 3-tap box
+// that spreads all n source texels over the n / 2 destination ones, so the
+// last row or column is weighted in rather than dropped.
+struct AxisTaps {
+    std::uint32_t count;
+    std::uint32_t index[3];
+    float weight[3];
+};
+
+AxisTaps axisTaps(std::uint32_t src_size,
+                  std::uint32_t dst_size,
+                  std::uint32_t dst_index) {
+    if (src_size == 1) {
+        return AxisTaps{1, {0, 0, 0}, {1.0f, 0.0f, 0.0f}};
+    }
+    std::uint32_t first = 2 * dst_index;
+    if (src_size % 2 == 0) {
+        return AxisTaps{2, {first, first + 1, 0}, {0.5f, 0.5f, 0.0f}};
+    }
+    float size = static_cast<float>(src_size);
+    return AxisTaps{3,
+                    {first, first + 1, first + 2},
+                    {static_cast<float>(dst_size - dst_index) / size,
+                     static_cast<float>(dst_size) / size,
+                     static_cast<float>(dst_index + 1) / size}};
+}
+
+bool hasOddSide(const LevelView& src) {
+    return (src.width > 1 && src.width % 2 != 0) ||
+           (src.height > 1 && src.height % 2 != 0);
+}
+
+// The general filter for levels with an odd side, weighting up to 3x3
+// source texels per destination texel. For sRGB the rows are converted to
+// linear first, as in filterSrgbRows.
+void filterOddRows(const LevelView& src,
+                   std::uint8_t* dst,
+                   std::uint32_t dst_width,
+                   std::uint32_t dst_height,
+                   bool srgb,
+                   std::uint32_t row_begin,
+                   std::uint32_t row_end) {
+    const std::array<std::uint8_t, LINEAR_STEPS>& encode = srgbEncodeTable();
+    std::size_t row_values = static_cast<std::size_t>(src.width) * 4;
+    std::array<std::vector<float>, 3> rows;
+    for (std::vector<float>& values : rows) {
+        values.resize(row_values);
+    }
+    for (std::uint32_t row = row_begin; row < row_end; ++row) {
+        AxisTaps row_taps = axisTaps(src.height, dst_height, row);
+        for (std::uint32_t tap = 0; tap < row_taps.count; ++tap) {
+            const std::uint8_t* pixels =
+                    src.pixels + row_taps.index[tap] * src.row_pitch;
+            if (srgb) {
+                PixelConvert::srgbToLinear(
+                        pixels, rows[tap].data(), src.width);
+            } else {
+                std::copy(pixels, pixels + row_values, rows[tap].begin());
+            }
+        }
+        std::uint8_t* out = dst + static_cast<std::size_t>(row) * dst_width * 4;
+
+        for (std::uint32_t column = 0; column < dst_width; ++column) {
+            AxisTaps column_taps = axisTaps(src.width, dst_width, column);
+            float sum[4] = {0.0f, 0.0f, 0.0f, 0.0f};
+            for (std::uint32_t row_tap = 0; row_tap < row_taps.count;
+                 ++row_tap) {
+                for (std::uint32_t column_tap = 0;
+                     column_tap < column_taps.count;
+                     ++column_tap) {
+                    float weight = row_taps.weight[row_tap] *
+                                   column_taps.weight[column_tap];
+                    const float* texel =
+                            &rows[row_tap][column_taps.index[column_tap] * 4];
+                    for (std::size_t channel = 0; channel < 4; ++channel) {
+                        sum[channel] += weight * texel[channel];
+                    }
+                }
+            }
+            if (srgb) {
+                for (std::size_t channel = 0; channel < 3; ++channel) {
+                    float step = std::min(
+                            sum[channel] * (LINEAR_STEPS - 1) + 0.5f,
+                            static_cast<float>(LINEAR_STEPS - 1));
+                    out[column * 4 + channel] =
+                            encode[static_cast<std::size_t>(step)];
+                }
+                out[column * 4 + 3] = static_cast<std::uint8_t>(
+                        std::min(sum[3] * 255.0f + 0.5f, 255.0f));
+            } else {
+                for (std::size_t channel = 0; channel < 4; ++channel) {
+                    out[column * 4 + channel] = static_cast<std::uint8_t>(
+                            std::min(sum[channel] + 0.5f, 255.0f));
+                }
+            }
+        }
+    }
+}
+
+void filterLevel(const LevelView& src,
+                 std::uint8_t* dst,
+                 std::uint32_t dst_width,
+                 std::uint32_t dst_height,
+                 bool srgb,
+                 std::size_t thread_count) {
+    auto filter = [&](std::uint32_t row_begin, std::uint32_t row_end) {
+        if (hasOddSide(src)) {
+            filterOddRows(src,
+                          dst,
+                          dst_width,
+                          dst_height,
+                          srgb,
+                          row_begin,
+                          row_end);
+        } else if (srgb) {
+            filterSrgbRows(src, dst, dst_width, row_begin, row_end);
+        } else {
+            filterUnormRows(src, dst, dst_width, row_begin, row_end);
+        }
+    };
+
+    std::size_t bands = std::min<std::size_t>(thread_count, dst_height);
+    if (bands <= 1 ||
+        static_cast<std::size_t>(dst_width) * dst_height <
+                MIN_PARALLEL_PIXELS) {
+        filter(0, dst_height);
+        return;
+    }
+    std::uint32_t band_rows =
+            static_cast<std::uint32_t>((dst_height + bands - 1) / bands);
+    std::vector<std::thread> threads;
+    for (std::uint32_t row = band_rows; row < dst_height; row += band_rows) {
+        threads.emplace_back(
+                filter, row, std::min(row + band_rows, dst_height));
+    }
+    filter(0, band_rows);
+    for (std::thread& thread : threads) {
+        thread.join();
+    }
+}
+}  // namespace
+
+MipChain generateMipChain(const void* rgba,
+                          std::uint32_t width,
+                          std::uint32_t height,
+                          std::size_t row_pitch,
+                          bool srgb,
+                          std::size_t thread_count) {
+    MipChain chain;
+    if (width == 0 || height == 0 || rgba == nullptr) {
+        return chain;
+    }
+    if (row_pitch == 0) {
+        row_pitch = static_cast<std::size_t>(width) * 4;
+    }
+    if (thread_count == 0) {
+        thread_count = std::max(1u, std::thread::hardware_concurrency());
+    }
+
+    std::size_t offset = 0;
+    for (std::uint32_t level_width = width, level_height = height;;
+         level_width = std::max(1u, level_width / 2),
+                       level_height = std::max(1u, level_height / 2)) {
+        std::size_t size =
+                static_cast<std::size_t>(level_width) * level_height * 4;
+        chain.levels.push_back(
+                MipLevel{level_width, level_height, offset, size});
+        offset = (offset + size + 15) & ~static_cast<std::size_t>(15);
+        if (level_width == 1 && level_height == 1) {
+            break;
+        }
+    }
+    chain.data.resize(offset);
+
+    std::uint8_t* data = reinterpret_cast<std::uint8_t*>(chain.data.data());
+    for (std::uint32_t row = 0; row < height; ++row) {
+        std::memcpy(data + static_cast<std::size_t>(row) * width * 4,
+                    static_cast<const std::uint8_t*>(rgba) + row * row_pitch,
+                    static_cast<std::size_t>(width) * 4);
+    }
+    for (std::size_t index = 1; index < chain.levels.size(); ++index) {
+        const MipLevel& above = chain.levels[index - 1];
+        const MipLevel& level = chain.levels[index];
+        filterLevel(LevelView{data + above.offset,
+                              above.width,
+                              above.height,
+                              static_cast<std::size_t>(above.width) * 4},
+                    data + level.offset,
+                    level.width,
+                    level.height,
+                    srgb,
+                    thread_count);
+    }
+    return chain;
+}
+
+std::vector<VkBufferImageCopy> getMipCopyRegions(const MipChain& chain,
+                                                 VkDeviceSize buffer_offset) {
+    std::vector<VkBufferImageCopy> regions;
+    regions.reserve(chain.levels.size());
+    for (std::size_t index = 0; index < chain.levels.size(); ++index) {
+        const MipLevel& level = chain.levels[index];
+        regions.push_back(
+                {buffer_offset + level.offset,
+                 0,
+                 0,
+                 {VK_IMAGE_ASPECT_COLOR_BIT,
+                  static_cast<std::uint32_t>(index),
+                  0,
+                  1},
+                 {0, 0, 0},
+                 {level.width, level.height, 1}});
+    }
+    return regions;
+}
+}  // namespace intel_vulkan::Tools
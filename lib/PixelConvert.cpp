@@ -0,0 +1,446 @@
+////////////////////////////////////////////////////////////////////////////
+// Copyright (c) 2026 intel_vulkan
+// All rights reserved.
+//
+// Contact: mehoggan@gmail.com
+//
+// This software is licensed under the terms of the Your License.
+// See the LICENSE file in the top-level directory.
+/////////////////////////////////////////////////////////////////////////
+#include "intel_vulkan/PixelConvert.h"
+
+#include <array>
+#include <atomic>
+#include <cmath>
+#include <cstring>
+
+#if defined(__x86_64__) || defined(__i386__)
+#define INTEL_VULKAN_PIXELCONVERT_X86 1
+#include <immintrin.h>
+#endif
+
+namespace intel_vulkan::Tools::PixelConvert {
+
+namespace {
+// Color channels at [0, 256), alpha at [256, 512).
+const std::array<float, 512>& linearTable() {
+    static const std::array<float, 512> table = []() {
+        std::array<float, 512> values;
+        for (int value = 0; value < 256; ++value) {
+            double srgb = value / 255.0;
+            values[value] = static_cast<float>(
+                    srgb <= 0.04045 ? srgb / 12.92
+                                    : std::pow((srgb + 0.055) / 1.055, 2.4));
+            values[256 + value] = static_cast<float>(value) / 255.0f;
+        }
+        return values;
+    }();
+    return table;
+}
+
+// Rounds to nearest even. Only valid for 0 and normal halves, which covers
+// every value / 255.
+std::uint16_t unormToHalfScalar(std::uint8_t value) {
+    if (value == 0) {
+        return 0;
+    }
+    float normalized = static_cast<float>(value) / 255.0f;
+    std::uint32_t bits;
+    std::memcpy(&bits, &normalized, sizeof(bits));
+    bits += 0x0fff + ((bits >> 13) & 1);
+    return static_cast<std::uint16_t>((bits >> 13) - ((127 - 15) << 10));
+}
+
+// (value * alpha) / 255 rounded to nearest without a division, exact for
+// all 8 bit inputs.
+std::uint8_t mulDiv255(std::uint32_t value, std::uint32_t alpha) {
+    std::uint32_t product = value * alpha + 128;
+    return static_cast<std::uint8_t>((product + (product >> 8)) >> 8);
+}
+
+void rgbToRgbaScalar(const std::uint8_t* src,
+                     std::uint8_t* dst,
+                     std::size_t pixel_count) {
+    for (std::size_t pixel = 0; pixel < pixel_count; ++pixel) {
+        dst[pixel * 4 + 0] = src[pixel * 3 + 0];
+        dst[pixel * 4 + 1] = src[pixel * 3 + 1];
+        dst[pixel * 4 + 2] = src[pixel * 3 + 2];
+        dst[pixel * 4 + 3] = 0xff;
+    }
+}
+
+void rgbaToBgraScalar(const std::uint8_t* src,
+                      std::uint8_t* dst,
+                      std::size_t pixel_count) {
+    for (std::size_t pixel = 0; pixel < pixel_count; ++pixel) {
+        std::uint8_t red = src[pixel * 4 + 0];
+        dst[pixel * 4 + 0] = src[pixel * 4 + 2];
+        dst[pixel * 4 + 1] = src[pixel * 4 + 1];
+        dst[pixel * 4 + 2] = red;
+        dst[pixel * 4 + 3] = src[pixel * 4 + 3];
+    }
+}
+
+void srgbToLinearScalar(const std::uint8_t* src,
+                        float* dst,
+                        std::size_t pixel_count) {
+    const std::array<float, 512>& table = linearTable();
+    for (std::size_t pixel = 0; pixel < pixel_count; ++pixel) {
+        dst[pixel * 4 + 0] = table[src[pixel * 4 + 0]];
+        dst[pixel * 4 + 1] = table[src[pixel * 4 + 1]];
+        dst[pixel * 4 + 2] = table[src[pixel * 4 + 2]];
+        dst[pixel * 4 + 3] = table[256 + src[pixel * 4 + 3]];
+    }
+}
+
+void premultiplyAlphaScalar(const std::uint8_t* src,
+                            std::uint8_t* dst,
+                            std::size_t pixel_count) {
+    for (std::size_t pixel = 0; pixel < pixel_count; ++pixel) {
+        std::uint8_t alpha = src[pixel * 4 + 3];
+        dst[pixel * 4 + 0] = mulDiv255(src[pixel * 4 + 0], alpha);
+        dst[pixel * 4 + 1] = mulDiv255(src[pixel * 4 + 1], alpha);
+        dst[pixel * 4 + 2] = mulDiv255(src[pixel * 4 + 2], alpha);
+        dst[pixel * 4 + 3] = alpha;
+    }
+}
+
+void unormToHalfScalar(const std::uint8_t* src,
+                       std::uint16_t* dst,
+                       std::size_t value_count) {
+    for (std::size_t index = 0; index < value_count; ++index) {
+        dst[index] = unormToHalfScalar(src[index]);
+    }
+}
+
+#ifdef INTEL_VULKAN_PIXELCONVERT_X86
+// The kernels below are compiled for their instruction set through target
+// attributes, so the library itself builds for the baseline ISA and only
+// runs them once the CPU has been checked. Each one converts whole vectors
+// and leaves the remainder to the scalar kernel.
+
+__attribute__((target("ssse3"))) void rgbToRgbaSsse3(const std::uint8_t* src,
+                                                     std::uint8_t* dst,
+                                                     std::size_t pixel_count) {
+    const __m128i shuffle =
+            _mm_setr_epi8(0, 1, 2, -1, 3, 4, 5, -1, 6, 7, 8, -1, 9, 10, 11, -1);
+    const __m128i alpha = _mm_set1_epi32(static_cast<int>(0xff000000));
+    std::size_t pixel = 0;
+    // A 16 byte load covers 5 1/3 pixels, so stop while 6 remain.
+    for (; pixel + 6 <= pixel_count; pixel += 4) {
+        __m128i rgb = _mm_loadu_si128(
+                reinterpret_cast<const __m128i*>(src + pixel * 3));
+        _mm_storeu_si128(reinterpret_cast<__m128i*>(dst + pixel * 4),
+                         _mm_or_si128(_mm_shuffle_epi8(rgb, shuffle), alpha));
+    }
+    rgbToRgbaScalar(src + pixel * 3, dst + pixel * 4, pixel_count - pixel);
+}
+
+__attribute__((target("avx2"))) void rgbToRgbaAvx2(const std::uint8_t* src,
+                                                   std::uint8_t* dst,
+                                                   std::size_t pixel_count) {
+    const __m256i shuffle = _mm256_setr_epi8(0, 1, 2, -1, 3, 4, 5, -1,
+                                             6, 7, 8, -1, 9, 10, 11, -1,
+                                             0, 1, 2, -1, 3, 4, 5, -1,
+                                             6, 7, 8, -1, 9, 10, 11, -1);
+    const __m256i alpha = _mm256_set1_epi32(static_cast<int>(0xff000000));
+    std::size_t pixel = 0;
+    // Each lane loads 4 pixels from its own offset, the upper one reading
+    // up to 28 bytes past the start.
+    for (; pixel + 10 <= pixel_count; pixel += 8) {
+        const std::uint8_t* rgb_src = src + pixel * 3;
+        __m256i rgb = _mm256_inserti128_si256(
+                _mm256_castsi128_si256(_mm_loadu_si128(
+                        reinterpret_cast<const __m128i*>(rgb_src))),
+                _mm_loadu_si128(reinterpret_cast<const __m128i*>(rgb_src + 12)),
+                1);
+        _mm256_storeu_si256(
+                reinterpret_cast<__m256i*>(dst + pixel * 4),
+                _mm256_or_si256(_mm256_shuffle_epi8(rgb, shuffle), alpha));
+    }
+    rgbToRgbaScalar(src + pixel * 3, dst + pixel * 4, pixel_count - pixel);
+}
+
+__attribute__((target("ssse3"))) void rgbaToBgraSsse3(
+        const std::uint8_t* src,
+        std::uint8_t* dst,
+        std::size_t pixel_count) {
+    const __m128i shuffle = _mm_setr_epi8(
+            2, 1, 0, 3, 6, 5, 4, 7, 10, 9, 8, 11, 14, 13, 12, 15);
+    std::size_t pixel = 0;
+    for (; pixel + 4 <= pixel_count; pixel += 4) {
+        __m128i rgba = _mm_loadu_si128(
+                reinterpret_cast<const __m128i*>(src + pixel * 4));
+        _mm_storeu_si128(reinterpret_cast<__m128i*>(dst + pixel * 4),
+                         _mm_shuffle_epi8(rgba, shuffle));
+    }
+    rgbaToBgraScalar(src + pixel * 4, dst + pixel * 4, pixel_count - pixel);
+}
+
+__attribute__((target("avx2"))) void rgbaToBgraAvx2(const std::uint8_t* src,
+                                                    std::uint8_t* dst,
+                                                    std::size_t pixel_count) {
+    const __m256i shuffle = _mm256_setr_epi8(2, 1, 0, 3, 6, 5, 4, 7,
+                                             10, 9, 8, 11, 14, 13, 12, 15,
+                                             2, 1, 0, 3, 6, 5, 4, 7,
+                                             10, 9, 8, 11, 14, 13, 12, 15);
+    std::size_t pixel = 0;
+    for (; pixel + 8 <= pixel_count; pixel += 8) {
+        __m256i rgba = _mm256_loadu_si256(
+                reinterpret_cast<const __m256i*>(src + pixel * 4));
+        _mm256_storeu_si256(reinterpret_cast<__m256i*>(dst + pixel * 4),
+                            _mm256_shuffle_epi8(rgba, shuffle));
+    }
+    rgbaToBgraScalar(src + pixel * 4, dst + pixel * 4, pixel_count - pixel);
+}
+
+__attribute__((target("avx2"))) void srgbToLinearAvx2(
+        const std::uint8_t* src,
+        float* dst,
+        std::size_t pixel_count) {
+    const float* table = linearTable().data();
+    const __m256i alpha_offset = _mm256_setr_epi32(0, 0, 0, 256, 0, 0, 0, 256);
+    std::size_t pixel = 0;
+    for (; pixel + 2 <= pixel_count; pixel += 2) {
+        __m256i indices = _mm256_add_epi32(
+                _mm256_cvtepu8_epi32(_mm_loadl_epi64(
+                        reinterpret_cast<const __m128i*>(src + pixel * 4))),
+                alpha_offset);
+        _mm256_storeu_ps(dst + pixel * 4,
+                         _mm256_i32gather_ps(table, indices, 4));
+    }
+    srgbToLinearScalar(src + pixel * 4, dst + pixel * 4, pixel_count - pixel);
+}
+
+// Widens 2 pixels to 16 bit, multiplies the colors by alpha and alpha by
+// 255, then divides by 255 like mulDiv255.
+__attribute__((target("ssse3"))) __m128i premultiplyPairSsse3(
+        __m128i pixels) {
+    const __m128i color_mask = _mm_setr_epi16(-1, -1, -1, 0, -1, -1, -1, 0);
+    const __m128i alpha_factor = _mm_setr_epi16(0, 0, 0, 255, 0, 0, 0, 255);
+    __m128i alpha = _mm_shufflehi_epi16(
+            _mm_shufflelo_epi16(pixels, _MM_SHUFFLE(3, 3, 3, 3)),
+            _MM_SHUFFLE(3, 3, 3, 3));
+    __m128i factor =
+            _mm_or_si128(_mm_and_si128(alpha, color_mask), alpha_factor);
+    __m128i product = _mm_add_epi16(_mm_mullo_epi16(pixels, factor),
+                                    _mm_set1_epi16(128));
+    return _mm_srli_epi16(
+            _mm_add_epi16(product, _mm_srli_epi16(product, 8)), 8);
+}
+
+__attribute__((target("ssse3"))) void premultiplyAlphaSsse3(
+        const std::uint8_t* src,
+        std::uint8_t* dst,
+        std::size_t pixel_count) {
+    const __m128i zero = _mm_setzero_si128();
+    std::size_t pixel = 0;
+    for (; pixel + 4 <= pixel_count; pixel += 4) {
+        __m128i rgba = _mm_loadu_si128(
+                reinterpret_cast<const __m128i*>(src + pixel * 4));
+        __m128i low = premultiplyPairSsse3(_mm_unpacklo_epi8(rgba, zero));
+        __m128i high = premultiplyPairSsse3(_mm_unpackhi_epi8(rgba, zero));
+        _mm_storeu_si128(reinterpret_cast<__m128i*>(dst + pixel * 4),
+                         _mm_packus_epi16(low, high));
+    }
+    premultiplyAlphaScalar(
+            src + pixel * 4, dst + pixel * 4, pixel_count - pixel);
+}
+
+__attribute__((target("avx2"))) __m256i premultiplyPairsAvx2(
+        __m256i pixels) {
+    const __m256i color_mask = _mm256_setr_epi16(
+            -1, -1, -1, 0, -1, -1, -1, 0, -1, -1, -1, 0, -1, -1, -1, 0);
+    const __m256i alpha_factor = _mm256_setr_epi16(
+            0, 0, 0, 255, 0, 0, 0, 255, 0, 0, 0, 255, 0, 0, 0, 255);
+    __m256i alpha = _mm256_shufflehi_epi16(
+            _mm256_shufflelo_epi16(pixels, _MM_SHUFFLE(3, 3, 3, 3)),
+            _MM_SHUFFLE(3, 3, 3, 3));
+    __m256i factor = _mm256_or_si256(_mm256_and_si256(alpha, color_mask),
+                                     alpha_factor);
+    __m256i product = _mm256_add_epi16(_mm256_mullo_epi16(pixels, factor),
+                                       _mm256_set1_epi16(128));
+    return _mm256_srli_epi16(
+            _mm256_add_epi16(product, _mm256_srli_epi16(product, 8)), 8);
+}
+
+__attribute__((target("avx2"))) void premultiplyAlphaAvx2(
+        const std::uint8_t* src,
+        std::uint8_t* dst,
+        std::size_t pixel_count) {
+    const __m256i zero = _mm256_setzero_si256();
+    std::size_t pixel = 0;
+    for (; pixel + 8 <= pixel_count; pixel += 8) {
+        __m256i rgba = _mm256_loadu_si256(
+                reinterpret_cast<const __m256i*>(src + pixel * 4));
+        // Unpacking and packing both work per 128 bit lane, so the pixel
+        // order survives the round trip.
+        __m256i low = premultiplyPairsAvx2(_mm256_unpacklo_epi8(rgba, zero));
+        __m256i high = premultiplyPairsAvx2(_mm256_unpackhi_epi8(rgba, zero));
+        _mm256_storeu_si256(reinterpret_cast<__m256i*>(dst + pixel * 4),
+                            _mm256_packus_epi16(low, high));
+    }
+    premultiplyAlphaScalar(
+            src + pixel * 4, dst + pixel * 4, pixel_count - pixel);
+}
+
+// The same steps as unormToHalfScalar for 4 values widened to 32 bit.
+__attribute__((target("ssse3"))) __m128i unormToHalfQuadSsse3(
+        __m128i values) {
+    __m128 normalized =
+            _mm_div_ps(_mm_cvtepi32_ps(values), _mm_set1_ps(255.0f));
+    __m128i bits = _mm_castps_si128(normalized);
+    bits = _mm_add_epi32(
+            bits,
+            _mm_add_epi32(_mm_set1_epi32(0x0fff),
+                          _mm_and_si128(_mm_srli_epi32(bits, 13),
+                                        _mm_set1_epi32(1))));
+    __m128i half = _mm_sub_epi32(_mm_srli_epi32(bits, 13),
+                                 _mm_set1_epi32((127 - 15) << 10));
+    return _mm_andnot_si128(
+            _mm_cmpeq_epi32(values, _mm_setzero_si128()), half);
+}
+
+__attribute__((target("ssse3"))) void unormToHalfSsse3(
+        const std::uint8_t* src,
+        std::uint16_t* dst,
+        std::size_t value_count) {
+    const __m128i zero = _mm_setzero_si128();
+    std::size_t index = 0;
+    for (; index + 8 <= value_count; index += 8) {
+        __m128i words = _mm_unpacklo_epi8(
+                _mm_loadl_epi64(reinterpret_cast<const __m128i*>(src + index)),
+                zero);
+        __m128i low = unormToHalfQuadSsse3(_mm_unpacklo_epi16(words, zero));
+        __m128i high = unormToHalfQuadSsse3(_mm_unpackhi_epi16(words, zero));
+        // Halves of values in [0, 1] are below 0x8000, so the signed
+        // saturating pack keeps them intact.
+        _mm_storeu_si128(reinterpret_cast<__m128i*>(dst + index),
+                         _mm_packs_epi32(low, high));
+    }
+    unormToHalfScalar(src + index, dst + index, value_count - index);
+}
+
+__attribute__((target("avx2"))) __m256i unormToHalfOctAvx2(__m256i values) {
+    __m256 normalized = _mm256_div_ps(_mm256_cvtepi32_ps(values),
+                                      _mm256_set1_ps(255.0f));
+    __m256i bits = _mm256_castps_si256(normalized);
+    bits = _mm256_add_epi32(
+            bits,
+            _mm256_add_epi32(_mm256_set1_epi32(0x0fff),
+                             _mm256_and_si256(_mm256_srli_epi32(bits, 13),
+                                              _mm256_set1_epi32(1))));
+    __m256i half = _mm256_sub_epi32(_mm256_srli_epi32(bits, 13),
+                                    _mm256_set1_epi32((127 - 15) << 10));
+    return _mm256_andnot_si256(
+            _mm256_cmpeq_epi32(values, _mm256_setzero_si256()), half);
+}
+
+__attribute__((target("avx2"))) void unormToHalfAvx2(const std::uint8_t* src,
+                                                     std::uint16_t* dst,
+                                                     std::size_t value_count) {
+    std::size_t index = 0;
+    for (; index + 16 <= value_count; index += 16) {
+        __m256i low = unormToHalfOctAvx2(_mm256_cvtepu8_epi32(_mm_loadl_epi64(
+                reinterpret_cast<const __m128i*>(src + index))));
+        __m256i high = unormToHalfOctAvx2(_mm256_cvtepu8_epi32(_mm_loadl_epi64(
+                reinterpret_cast<const __m128i*>(src + index + 8))));
+        // The pack interleaves the lanes of low and high; put them back in
+        // order.
+        _mm256_storeu_si256(
+                reinterpret_cast<__m256i*>(dst + index),
+                _mm256_permute4x64_epi64(_mm256_packs_epi32(low, high),
+                                         _MM_SHUFFLE(3, 1, 2, 0)));
+    }
+    unormToHalfScalar(src + index, dst + index, value_count - index);
+}
+#endif
+
+std::atomic<Isa>& isaSlot() {
+    static std::atomic<Isa> isa(bestIsa());
+    return isa;
+}
+}  // namespace
+
+Isa activeIsa() { return isaSlot().load(std::memory_order_relaxed); }
+
+Isa setIsa(Isa isa) {
+    isa = CpuFeatures::supportedIsa(isa);
+    isaSlot().store(isa, std::memory_order_relaxed);
+    return isa;
+}
+
+void rgbToRgba(const std::uint8_t* src,
+               std::uint8_t* dst,
+               std::size_t pixel_count) {
+    switch (activeIsa()) {
+#ifdef INTEL_VULKAN_PIXELCONVERT_X86
+        case Isa::AVX2:
+            return rgbToRgbaAvx2(src, dst, pixel_count);
+        case Isa::SSSE3:
+            return rgbToRgbaSsse3(src, dst, pixel_count);
+#endif
+        default:
+            return rgbToRgbaScalar(src, dst, pixel_count);
+    }
+}
+
+void rgbaToBgra(const std::uint8_t* src,
+                std::uint8_t* dst,
+                std::size_t pixel_count) {
+    switch (activeIsa()) {
+#ifdef INTEL_VULKAN_PIXELCONVERT_X86
+        case Isa::AVX2:
+            return rgbaToBgraAvx2(src, dst, pixel_count);
+        case Isa::SSSE3:
+            return rgbaToBgraSsse3(src, dst, pixel_count);
+#endif
+        default:
+            return rgbaToBgraScalar(src, dst, pixel_count);
+    }
+}
+
+void srgbToLinear(const std::uint8_t* src,
+                  float* dst,
+                  std::size_t pixel_count) {
+    switch (activeIsa()) {
+#ifdef INTEL_VULKAN_PIXELCONVERT_X86
+        case Isa::AVX2:
+            return srgbToLinearAvx2(src, dst, pixel_count);
+#endif
+        default:
+            // Without a gather instruction the table lookups stay scalar.
+            return srgbToLinearScalar(src, dst, pixel_count);
+    }
+}
+
+void premultiplyAlpha(const std::uint8_t* src,
+                      std::uint8_t* dst,
+                      std::size_t pixel_count) {
+    switch (activeIsa()) {
+#ifdef INTEL_VULKAN_PIXELCONVERT_X86
+        case Isa::AVX2:
+            return premultiplyAlphaAvx2(src, dst, pixel_count);
+        case Isa::SSSE3:
+            return premultiplyAlphaSsse3(src, dst, pixel_count);
+#endif
+        default:
+            return premultiplyAlphaScalar(src, dst, pixel_count);
+    }
+}
+
+void unormToHalf(const std::uint8_t* src,
+                 std::uint16_t* dst,
+                 std::size_t value_count) {
+    switch (activeIsa()) {
+#ifdef INTEL_VULKAN_PIXELCONVERT_X86
+        case Isa::AVX2:
+            return unormToHalfAvx2(src, dst, value_count);
+        case Isa::SSSE3:
+            return unormToHalfSsse3(src, dst, value_count);
+#endif
+        default:
+            return unormToHalfScalar(src, dst, value_count);
+    }
+}
+}  // namespace intel_vulkan::Tools::PixelConvert
@@ -0,0 +1,1354 @@
+////////////////////////////////////////////////////////////////////////////
+// Copyright (c) 2026 intel_vulkan
+// All rights reserved.
+//
+// Contact: mehoggan@gmail.com
+//
+// This software is licensed under the terms of the Your License.
+// See the LICENSE file in the top-level directory.
+/////////////////////////////////////////////////////////////////////////
+#include "intel_vulkan/PngDecode.h"
+
+#include "intel_vulkan/PixelConvert.h"
+
+#include <algorithm>
+#include <array>
+#include <atomic>
+#include <cstdint>
+#include <cstring>
+#include <limits>
+#include <memory>
+#include <thread>
+
+#if defined(__x86_64__) || defined(__i386__)
+#define INTEL_VULKAN_PNGDECODE_X86 1
+#include <immintrin.h>
+#endif
+
+namespace intel_vulkan::Tools {
+
+namespace {
+std::atomic<PngDecoder> s_decoder(PngDecoder::FAST);
+
+std::atomic<CpuFeatures::Isa>& isaSlot() {
+    static std::atomic<CpuFeatures::Isa> isa(CpuFeatures::bestIsa());
+    return isa;
+}
+
+// ---------------------------------------------------------------------------
+// Inflate
+//
+// Every table entry is a 32 bit word: the code's length in bits 0-4, the
+// kind in bits 5-7 and a payload from bit 8 on.
+// ---------------------------------------------------------------------------
+enum EntryKind : std::uint32_t {
+    INVALID = 0,  ///< Not a code of the table; decoding it is an error.
+    LITERAL = 1,  ///< The byte in bits 8-15.
+    LITERAL_PAIR = 2,  ///< Two literals, in bits 8-15 and 16-23.
+    LENGTH = 3,  ///< Extra bits in bits 8-12, the base from bit 16.
+    END_OF_BLOCK = 4,
+    SUBTABLE = 5,  ///< Index bits in bits 8-12, the offset from bit 16.
+    DISTANCE = 6,  ///< Extra bits in bits 8-12, the base from bit 16.
+};
+
+constexpr std::uint32_t kindOf(std::uint32_t entry) {
+    return (entry >> 5) & 7;
+}
+
+// Codes up to this long are decoded with one lookup, longer ones with a
+// second one in a subtable.
+constexpr int LITLEN_BITS = 11;
+constexpr int DISTANCE_BITS = 8;
+constexpr int CODE_LENGTH_BITS = 7;
+constexpr std::size_t LITLEN_TABLE_SIZE = (1 << LITLEN_BITS) + 288 * 16;
+constexpr std::size_t DISTANCE_TABLE_SIZE = (1 << DISTANCE_BITS) + 32 * 128;
+
+// Matches copy 8 bytes at a time and may write this far past their end.
+constexpr std::size_t OUTPUT_SLACK = 16;
+
+constexpr std::uint64_t NO_STOP = std::numeric_limits<std::uint64_t>::max();
+
+constexpr std::uint16_t LENGTH_BASE[29] = {
+        3,  4,  5,  6,  7,  8,  9,  10,  11,  13,  15,  17,  19,  23, 27,
+        31, 35, 43, 51, 59, 67, 83, 99, 115, 131, 163, 195, 227, 258};
+constexpr std::uint8_t LENGTH_EXTRA[29] = {0, 0, 0, 0, 0, 0, 0, 0, 1, 1,
+                                           1, 1, 2, 2, 2, 2, 3, 3, 3, 3,
+                                           4, 4, 4, 4, 5, 5, 5, 5, 0};
+constexpr std::uint16_t DISTANCE_BASE[30] = {
+        1,    2,    3,    4,    5,    7,     9,     13,    17,    25,
+        33,   49,   65,   97,   129,  193,   257,   385,   513,   769,
+        1025, 1537, 2049, 3073, 4097, 6145,  8193,  12289, 16385, 24577};
+constexpr std::uint8_t DISTANCE_EXTRA[30] = {0, 0, 0,  0,  1,  1,  2,  2,
+                                             3, 3, 4,  4,  5,  5,  6,  6,
+                                             7, 7, 8,  8,  9,  9,  10, 10,
+                                             11, 11, 12, 12, 13, 13};
+constexpr std::uint8_t CODE_LENGTH_ORDER[19] = {
+        16, 17, 18, 0, 8, 7, 9, 6, 10, 5, 11, 4, 12, 3, 13, 2, 14, 1, 15};
+
+std::uint32_t litlenEntry(int symbol) {
+    if (symbol < 256) {
+        return LITERAL << 5 | static_cast<std::uint32_t>(symbol) << 8;
+    }
+    if (symbol == 256) {
+        return END_OF_BLOCK << 5;
+    }
+    if (symbol < 286) {
+        return LENGTH << 5 |
+               static_cast<std::uint32_t>(LENGTH_EXTRA[symbol - 257]) << 8 |
+               static_cast<std::uint32_t>(LENGTH_BASE[symbol - 257]) << 16;
+    }
+    return INVALID << 5;
+}
+
+std::uint32_t distanceEntry(int symbol) {
+    if (symbol < 30) {
+        return DISTANCE << 5 |
+               static_cast<std::uint32_t>(DISTANCE_EXTRA[symbol]) << 8 |
+               static_cast<std::uint32_t>(DISTANCE_BASE[symbol]) << 16;
+    }
+    return INVALID << 5;
+}
+
+std::uint32_t codeLengthEntry(int symbol) {
+    return LITERAL << 5 | static_cast<std::uint32_t>(symbol) << 8;
+}
+
+// Builds the table of the canonical code with \p lengths. Fails on
+// over-subscribed codes like stb_image does; incomplete codes are allowed
+// and their unused bit patterns decode as INVALID.
+bool buildTable(const std::uint8_t* lengths,
+                int count,
+                int primary_bits,
+                std::uint32_t (*symbol_entry)(int),
+                std::uint32_t* table) {
+    int counts[16] = {};
+    for (int symbol = 0; symbol < count; ++symbol) {
+        ++counts[lengths[symbol]];
+    }
+    counts[0] = 0;
+    int next_code[16] = {};
+    int code = 0;
+    int max_length = 0;
+    for (int length = 1; length < 16; ++length) {
+        next_code[length] = code;
+        code += counts[length];
+        if (counts[length] != 0) {
+            if (code - 1 >= (1 << length)) {
+                return false;
+            }
+            max_length = length;
+        }
+        code <<= 1;
+    }
+
+    std::uint32_t primary_size = 1u << primary_bits;
+    std::fill(table, table + primary_size, INVALID << 5);
+    int sub_bits = std::max(0, max_length - primary_bits);
+    std::uint32_t next_subtable = primary_size;
+    for (int symbol = 0; symbol < count; ++symbol) {
+        int length = lengths[symbol];
+        if (length == 0) {
+            continue;
+        }
+        // Deflate sends codes starting with their most significant bit,
+        // which the LSB first bit buffer sees reversed.
+        std::uint32_t reversed = 0;
+        for (int bit = 0, value = next_code[length]++; bit < length; ++bit) {
+            reversed = (reversed << 1) | ((value >> bit) & 1);
+        }
+        std::uint32_t entry = symbol_entry(symbol);
+        if (length <= primary_bits) {
+            for (std::uint32_t index = reversed; index < primary_size;
+                 index += 1u << length) {
+                table[index] = entry | static_cast<std::uint32_t>(length);
+            }
+            continue;
+        }
+        std::uint32_t& prefix = table[reversed & (primary_size - 1)];
+        if (kindOf(prefix) != SUBTABLE) {
+            prefix = SUBTABLE << 5 |
+                     static_cast<std::uint32_t>(sub_bits) << 8 |
+                     next_subtable << 16 |
+                     static_cast<std::uint32_t>(primary_bits);
+            std::fill(table + next_subtable,
+                      table + next_subtable + (1u << sub_bits),
+                      INVALID << 5);
+            next_subtable += 1u << sub_bits;
+        }
+        std::uint32_t* subtable = table + (prefix >> 16);
+        for (std::uint32_t index = reversed >> primary_bits;
+             index < (1u << sub_bits);
+             index += 1u << (length - primary_bits)) {
+            subtable[index] =
+                    entry | static_cast<std::uint32_t>(length - primary_bits);
+        }
+    }
+    return true;
+}
+
+// Turns every entry whose literal leaves room for a second whole literal
+// code into a pair, so runs of literals take half the lookups. Entries are
+// visited from the top because the second literal is looked up at a lower
+// index, which must still hold a single literal.
+void pairLiterals(std::uint32_t* table) {
+    for (std::uint32_t index = (1u << LITLEN_BITS); index-- > 0;) {
+        std::uint32_t first = table[index];
+        std::uint32_t first_bits = first & 31;
+        if (kindOf(first) != LITERAL || first_bits >= LITLEN_BITS) {
+            continue;
+        }
+        std::uint32_t second = table[index >> first_bits];
+        std::uint32_t bits = first_bits + (second & 31);
+        if (kindOf(second) == LITERAL && bits <= LITLEN_BITS) {
+            table[index] = LITERAL_PAIR << 5 | (first & 0xff00) |
+                           (second & 0xff00) << 8 | bits;
+        }
+    }
+}
+
+struct FixedTables {
+    FixedTables() {
+        std::uint8_t lengths[288];
+        std::fill(lengths, lengths + 144, 8);
+        std::fill(lengths + 144, lengths + 256, 9);
+        std::fill(lengths + 256, lengths + 280, 7);
+        std::fill(lengths + 280, lengths + 288, 8);
+        buildTable(lengths, 288, LITLEN_BITS, litlenEntry, litlen.data());
+        pairLiterals(litlen.data());
+        std::fill(lengths, lengths + 32, 5);
+        buildTable(lengths, 32, DISTANCE_BITS, distanceEntry, distance.data());
+    }
+
+    std::array<std::uint32_t, LITLEN_TABLE_SIZE> litlen;
+    std::array<std::uint32_t, DISTANCE_TABLE_SIZE> distance;
+};
+
+const FixedTables& fixedTables() {
+    static const FixedTables tables;
+    return tables;
+}
+
+// Tops the bit buffer up to at least 56 bits. Bits above \p count may
+// already hold the following bytes; loading them again is harmless because
+// they land in the same place.
+inline void refillBits(const std::uint8_t*& in,
+                       const std::uint8_t* end,
+                       std::size_t& overrun,
+                       std::uint64_t& bits,
+                       unsigned& count) {
+    if (end - in >= 8) {
+        std::uint64_t word;
+        std::memcpy(&word, in, sizeof(word));
+#if __BYTE_ORDER__ == __ORDER_BIG_ENDIAN__
+        word = __builtin_bswap64(word);
+#endif
+        bits |= word << count;
+        in += (63 - count) >> 3;
+        count |= 56;
+        return;
+    }
+    while (count <= 56) {
+        std::uint64_t byte = 0;
+        if (in < end) {
+            byte = *in++;
+        } else {
+            ++overrun;
+        }
+        bits |= byte << count;
+        count += 8;
+    }
+}
+
+// Inflates a raw deflate stream, or a run of blocks of one, into a buffer
+// that grows up to a limit.
+class Inflater {
+public:
+    Inflater(const std::uint8_t* data, std::size_t size, std::size_t start)
+            : m_begin(data)
+            , m_in(data + start)
+            , m_end(data + size)
+            , m_bits(0)
+            , m_count(0)
+            , m_overrun(0) {}
+
+    /**
+     * Inflates into \p output, which holds its capacity plus OUTPUT_SLACK
+     * bytes, until the final block or, if \p stop_bit is set, the block
+     * starting at that bit.
+     *
+     * @return false on corrupt data, more than \p limit bytes of output
+     *         or if the final block came before \p stop_bit.
+     */
+    bool run(std::vector<std::uint8_t>& output,
+             std::size_t limit,
+             std::uint64_t stop_bit) {
+        m_output = &output;
+        m_limit = limit;
+        m_out_begin = output.data();
+        m_out = m_out_begin;
+        m_out_end = m_out_begin + (output.size() - OUTPUT_SLACK);
+
+        for (;;) {
+            std::uint64_t position = consumedBits();
+            if (position == stop_bit) {
+                return true;
+            }
+            if (position > stop_bit) {
+                return false;
+            }
+            refill();
+            bool final = take(1) != 0;
+            std::uint32_t type = take(2);
+            bool decoded = false;
+            if (type == 0) {
+                decoded = storedBlock();
+            } else if (type == 1) {
+                decoded = huffmanBlock(fixedTables().litlen.data(),
+                                       fixedTables().distance.data());
+            } else if (type == 2) {
+                decoded = dynamicTables() &&
+                          huffmanBlock(m_litlen.data(), m_distance.data());
+            }
+            // Bits past the end of the data read as zeros, which must not
+            // have been decoded.
+            if (!decoded || m_overrun * 8 > m_count) {
+                return false;
+            }
+            if (final) {
+                return stop_bit == NO_STOP;
+            }
+        }
+    }
+
+    std::size_t produced() const {
+        return static_cast<std::size_t>(m_out - m_out_begin);
+    }
+
+private:
+    std::uint64_t consumedBits() const {
+        return (static_cast<std::uint64_t>(m_in - m_begin) + m_overrun) * 8 -
+               m_count;
+    }
+
+    void refill() { refillBits(m_in, m_end, m_overrun, m_bits, m_count); }
+
+    std::uint32_t take(unsigned count) {
+        std::uint32_t value =
+                static_cast<std::uint32_t>(m_bits & ((1ull << count) - 1));
+        m_bits >>= count;
+        m_count -= count;
+        return value;
+    }
+
+    // Makes room for \p needed more bytes of output.
+    bool grow(std::size_t needed) {
+        std::size_t size = produced();
+        std::size_t capacity = m_output->size() - OUTPUT_SLACK;
+        if (size + needed > m_limit) {
+            return false;
+        }
+        capacity = std::min(m_limit, std::max(capacity * 2, size + needed));
+        m_output->resize(capacity + OUTPUT_SLACK);
+        m_out_begin = m_output->data();
+        m_out = m_out_begin + size;
+        m_out_end = m_out_begin + capacity;
+        return true;
+    }
+
+    bool storedBlock() {
+        take(m_count & 7);
+        std::uint64_t position = consumedBits() / 8;
+        if (position + 4 > static_cast<std::uint64_t>(m_end - m_begin)) {
+            return false;
+        }
+        m_in = m_begin + position;
+        m_bits = 0;
+        m_count = 0;
+        m_overrun = 0;
+        std::size_t length = m_in[0] | m_in[1] << 8;
+        std::size_t inverse = m_in[2] | m_in[3] << 8;
+        m_in += 4;
+        if (length != (inverse ^ 0xffff) ||
+            length > static_cast<std::size_t>(m_end - m_in)) {
+            return false;
+        }
+        if (static_cast<std::size_t>(m_out_end - m_out) < length &&
+            !grow(length)) {
+            return false;
+        }
+        std::memcpy(m_out, m_in, length);
+        m_out += length;
+        m_in += length;
+        return true;
+    }
+
+    bool dynamicTables() {
+        refill();
+        int litlen_count = static_cast<int>(take(5)) + 257;
+        int distance_count = static_cast<int>(take(5)) + 1;
+        int code_length_count = static_cast<int>(take(4)) + 4;
+        std::uint8_t code_lengths[19] = {};
+        for (int index = 0; index < code_length_count; ++index) {
+            refill();
+            code_lengths[CODE_LENGTH_ORDER[index]] =
+                    static_cast<std::uint8_t>(take(3));
+        }
+        std::uint32_t code_length_table[1 << CODE_LENGTH_BITS];
+        if (!buildTable(code_lengths,
+                        19,
+                        CODE_LENGTH_BITS,
+                        codeLengthEntry,
+                        code_length_table)) {
+            return false;
+        }
+
+        std::uint8_t lengths[288 + 32];
+        int total = litlen_count + distance_count;
+        int count = 0;
+        while (count < total) {
+            refill();
+            std::uint32_t entry =
+                    code_length_table[m_bits & ((1u << CODE_LENGTH_BITS) - 1)];
+            if (kindOf(entry) == INVALID) {
+                return false;
+            }
+            take(entry & 31);
+            std::uint32_t symbol = (entry >> 8) & 0xff;
+            if (symbol < 16) {
+                lengths[count++] = static_cast<std::uint8_t>(symbol);
+                continue;
+            }
+            std::uint8_t value = 0;
+            int repeat = 0;
+            if (symbol == 16) {
+                if (count == 0) {
+                    return false;
+                }
+                value = lengths[count - 1];
+                repeat = static_cast<int>(take(2)) + 3;
+            } else if (symbol == 17) {
+                repeat = static_cast<int>(take(3)) + 3;
+            } else {
+                repeat = static_cast<int>(take(7)) + 11;
+            }
+            if (count + repeat > total) {
+                return false;
+            }
+            std::fill(lengths + count, lengths + count + repeat, value);
+            count += repeat;
+        }
+        if (!buildTable(lengths,
+                        litlen_count,
+                        LITLEN_BITS,
+                        litlenEntry,
+                        m_litlen.data()) ||
+            !buildTable(lengths + litlen_count,
+                        distance_count,
+                        DISTANCE_BITS,
+                        distanceEntry,
+                        m_distance.data())) {
+            return false;
+        }
+        pairLiterals(m_litlen.data());
+        return true;
+    }
+
+    // The hot loop. One refill covers the longest length and distance
+    // codes with their extra bits, 48 bits in total.
+    bool huffmanBlock(const std::uint32_t* litlen,
+                      const std::uint32_t* distance_table) {
+        // Locals, because stores through the output pointer could alias
+        // the members.
+        const std::uint8_t* in = m_in;
+        std::size_t overrun = m_overrun;
+        std::uint8_t* out = m_out;
+        std::uint8_t* out_end = m_out_end;
+        std::uint64_t bits = m_bits;
+        unsigned count = m_count;
+        bool result = false;
+        auto take_bits = [&](unsigned length) {
+            std::uint32_t value =
+                    static_cast<std::uint32_t>(bits & ((1ull << length) - 1));
+            bits >>= length;
+            count -= length;
+            return value;
+        };
+        auto make_room = [&](std::size_t needed) {
+            m_out = out;
+            if (!grow(needed)) {
+                return false;
+            }
+            out = m_out;
+            out_end = m_out_end;
+            return true;
+        };
+
+        for (;;) {
+            refillBits(in, m_end, overrun, bits, count);
+
+            std::uint32_t entry = litlen[bits & ((1u << LITLEN_BITS) - 1)];
+            if (kindOf(entry) == SUBTABLE) {
+                take_bits(LITLEN_BITS);
+                entry = litlen[(entry >> 16) +
+                               (bits & ((1u << ((entry >> 8) & 31)) - 1))];
+            }
+            take_bits(entry & 31);
+            std::uint32_t kind = kindOf(entry);
+            if (kind == LITERAL_PAIR) {
+                if (out_end - out < 2 && !make_room(2)) {
+                    break;
+                }
+                out[0] = static_cast<std::uint8_t>(entry >> 8);
+                out[1] = static_cast<std::uint8_t>(entry >> 16);
+                out += 2;
+                continue;
+            }
+            if (kind == LITERAL) {
+                if (out == out_end && !make_room(1)) {
+                    break;
+                }
+                *out++ = static_cast<std::uint8_t>(entry >> 8);
+                continue;
+            }
+            if (kind == END_OF_BLOCK) {
+                result = true;
+                break;
+            }
+            if (kind != LENGTH) {
+                break;
+            }
+            std::size_t length =
+                    (entry >> 16) + take_bits((entry >> 8) & 31);
+
+            std::uint32_t code =
+                    distance_table[bits & ((1u << DISTANCE_BITS) - 1)];
+            if (kindOf(code) == SUBTABLE) {
+                take_bits(DISTANCE_BITS);
+                code = distance_table[(code >> 16) +
+                                      (bits & ((1u << ((code >> 8) & 31)) -
+                                               1))];
+            }
+            take_bits(code & 31);
+            if (kindOf(code) != DISTANCE) {
+                break;
+            }
+            std::size_t distance = (code >> 16) + take_bits((code >> 8) & 31);
+            if (distance > static_cast<std::size_t>(out - m_out_begin)) {
+                break;
+            }
+            if (static_cast<std::size_t>(out_end - out) < length &&
+                !make_room(length)) {
+                break;
+            }
+
+            const std::uint8_t* from = out - distance;
+            std::uint8_t* to = out;
+            out += length;
+            if (distance >= 8) {
+                // Each 8 byte copy only reads bytes written before it.
+                do {
+                    std::memcpy(to, from, 8);
+                    to += 8;
+                    from += 8;
+                } while (to < out);
+            } else if (distance == 1) {
+                std::memset(to, *from, length);
+            } else {
+                for (; to < out; ++to, ++from) {
+                    *to = *from;
+                }
+            }
+        }
+        m_in = in;
+        m_overrun = overrun;
+        m_out = out;
+        m_bits = bits;
+        m_count = count;
+        return result;
+    }
+
+    const std::uint8_t* m_begin;
+    const std::uint8_t* m_in;
+    const std::uint8_t* m_end;
+    std::uint64_t m_bits;
+    unsigned m_count;  ///< Valid bits in m_bits.
+    std::size_t m_overrun;  ///< Zero bytes read past m_end.
+
+    std::vector<std::uint8_t>* m_output = nullptr;
+    std::size_t m_limit = 0;
+    std::uint8_t* m_out_begin = nullptr;
+    std::uint8_t* m_out = nullptr;
+    std::uint8_t* m_out_end = nullptr;
+
+    std::array<std::uint32_t, LITLEN_TABLE_SIZE> m_litlen;
+    std::array<std::uint32_t, DISTANCE_TABLE_SIZE> m_distance;
+};
+
+// ---------------------------------------------------------------------------
+// Unfiltering
+// ---------------------------------------------------------------------------
+enum Filter { NONE = 0, SUB = 1, UP = 2, AVERAGE = 3, PAETH = 4 };
+
+std::uint8_t paeth(int left, int up, int up_left) {
+    int estimate = left + up - up_left;
+    int distance_left = std::abs(estimate - left);
+    int distance_up = std::abs(estimate - up);
+    int distance_up_left = std::abs(estimate - up_left);
+    if (distance_left <= distance_up && distance_left <= distance_up_left) {
+        return static_cast<std::uint8_t>(left);
+    }
+    if (distance_up <= distance_up_left) {
+        return static_cast<std::uint8_t>(up);
+    }
+    return static_cast<std::uint8_t>(up_left);
+}
+
+void unfilterScalar(int filter,
+                    std::uint8_t* row,
+                    const std::uint8_t* prior,
+                    std::size_t size,
+                    std::size_t pixel_size) {
+    switch (filter) {
+        case SUB:
+            for (std::size_t index = pixel_size; index < size; ++index) {
+                row[index] += row[index - pixel_size];
+            }
+            break;
+        case UP:
+            for (std::size_t index = 0; index < size; ++index) {
+                row[index] += prior[index];
+            }
+            break;
+        case AVERAGE:
+            for (std::size_t index = 0; index < pixel_size; ++index) {
+                row[index] += prior[index] >> 1;
+            }
+            for (std::size_t index = pixel_size; index < size; ++index) {
+                row[index] += (prior[index] + row[index - pixel_size]) >> 1;
+            }
+            break;
+        case PAETH:
+            for (std::size_t index = 0; index < pixel_size; ++index) {
+                row[index] += prior[index];
+            }
+            for (std::size_t index = pixel_size; index < size; ++index) {
+                row[index] += paeth(row[index - pixel_size],
+                                    prior[index],
+                                    prior[index - pixel_size]);
+            }
+            break;
+    }
+}
+
+#ifdef INTEL_VULKAN_PNGDECODE_X86
+// Sub, Avg and Paeth depend on the pixel to the left, so the SIMD kernels
+// work on one pixel at a time with its channels in parallel. Up has no
+// such dependency and runs on whole vectors.
+template <int PIXEL_SIZE>
+__attribute__((target("ssse3"))) __m128i loadPixel(const std::uint8_t* p) {
+    std::uint32_t value = 0;
+    std::memcpy(&value, p, PIXEL_SIZE);
+    return _mm_cvtsi32_si128(static_cast<int>(value));
+}
+
+template <int PIXEL_SIZE>
+__attribute__((target("ssse3"))) void storePixel(std::uint8_t* p,
+                                                 __m128i pixel) {
+    std::uint32_t value = static_cast<std::uint32_t>(_mm_cvtsi128_si32(pixel));
+    std::memcpy(p, &value, PIXEL_SIZE);
+}
+
+template <int PIXEL_SIZE>
+__attribute__((target("ssse3"))) void unfilterSubSsse3(std::uint8_t* row,
+                                                       std::size_t size) {
+    __m128i left = _mm_setzero_si128();
+    for (std::size_t index = 0; index < size; index += PIXEL_SIZE) {
+        left = _mm_add_epi8(left, loadPixel<PIXEL_SIZE>(row + index));
+        storePixel<PIXEL_SIZE>(row + index, left);
+    }
+}
+
+template <int PIXEL_SIZE>
+__attribute__((target("ssse3"))) void unfilterAverageSsse3(
+        std::uint8_t* row,
+        const std::uint8_t* prior,
+        std::size_t size) {
+    const __m128i ones = _mm_set1_epi8(1);
+    __m128i left = _mm_setzero_si128();
+    for (std::size_t index = 0; index < size; index += PIXEL_SIZE) {
+        __m128i up = loadPixel<PIXEL_SIZE>(prior + index);
+        // _mm_avg_epu8 rounds up; the filter rounds down.
+        __m128i average = _mm_sub_epi8(
+                _mm_avg_epu8(left, up),
+                _mm_and_si128(_mm_xor_si128(left, up), ones));
+        left = _mm_add_epi8(loadPixel<PIXEL_SIZE>(row + index), average);
+        storePixel<PIXEL_SIZE>(row + index, left);
+    }
+}
+
+template <int PIXEL_SIZE>
+__attribute__((target("ssse3"))) void unfilterPaethSsse3(
+        std::uint8_t* row,
+        const std::uint8_t* prior,
+        std::size_t size) {
+    const __m128i zero = _mm_setzero_si128();
+    __m128i left = zero;
+    __m128i up_left = zero;
+    for (std::size_t index = 0; index < size; index += PIXEL_SIZE) {
+        __m128i up =
+                _mm_unpacklo_epi8(loadPixel<PIXEL_SIZE>(prior + index), zero);
+        // With estimate = left + up - up_left, the distances to left, up
+        // and up_left are |up - up_left|, |left - up_left| and their sum.
+        __m128i to_left = _mm_sub_epi16(up, up_left);
+        __m128i to_up = _mm_sub_epi16(left, up_left);
+        __m128i to_up_left = _mm_abs_epi16(_mm_add_epi16(to_left, to_up));
+        to_left = _mm_abs_epi16(to_left);
+        to_up = _mm_abs_epi16(to_up);
+        __m128i smallest =
+                _mm_min_epi16(to_up_left, _mm_min_epi16(to_left, to_up));
+        __m128i use_left = _mm_cmpeq_epi16(smallest, to_left);
+        __m128i use_up = _mm_cmpeq_epi16(smallest, to_up);
+        __m128i nearest = _mm_or_si128(
+                _mm_and_si128(use_left, left),
+                _mm_andnot_si128(use_left,
+                                 _mm_or_si128(_mm_and_si128(use_up, up),
+                                              _mm_andnot_si128(use_up,
+                                                               up_left))));
+        __m128i pixel =
+                _mm_add_epi8(loadPixel<PIXEL_SIZE>(row + index),
+                             _mm_packus_epi16(nearest, nearest));
+        storePixel<PIXEL_SIZE>(row + index, pixel);
+        left = _mm_unpacklo_epi8(pixel, zero);
+        up_left = up;
+    }
+}
+
+__attribute__((target("ssse3"))) void unfilterUpSsse3(
+        std::uint8_t* row,
+        const std::uint8_t* prior,
+        std::size_t size) {
+    std::size_t index = 0;
+    for (; index + 16 <= size; index += 16) {
+        __m128i sum = _mm_add_epi8(
+                _mm_loadu_si128(reinterpret_cast<const __m128i*>(row + index)),
+                _mm_loadu_si128(
+                        reinterpret_cast<const __m128i*>(prior + index)));
+        _mm_storeu_si128(reinterpret_cast<__m128i*>(row + index), sum);
+    }
+    unfilterScalar(UP, row + index, prior + index, size - index, 1);
+}
+
+__attribute__((target("avx2"))) void unfilterUpAvx2(std::uint8_t* row,
+                                                    const std::uint8_t* prior,
+                                                    std::size_t size) {
+    std::size_t index = 0;
+    for (; index + 32 <= size; index += 32) {
+        __m256i sum = _mm256_add_epi8(
+                _mm256_loadu_si256(
+                        reinterpret_cast<const __m256i*>(row + index)),
+                _mm256_loadu_si256(
+                        reinterpret_cast<const __m256i*>(prior + index)));
+        _mm256_storeu_si256(reinterpret_cast<__m256i*>(row + index), sum);
+    }
+    unfilterUpSsse3(row + index, prior + index, size - index);
+}
+
+template <int PIXEL_SIZE>
+bool unfilterSsse3(int filter,
+                   std::uint8_t* row,
+                   const std::uint8_t* prior,
+                   std::size_t size) {
+    switch (filter) {
+        case SUB:
+            unfilterSubSsse3<PIXEL_SIZE>(row, size);
+            return true;
+        case AVERAGE:
+            unfilterAverageSsse3<PIXEL_SIZE>(row, prior, size);
+            return true;
+        case PAETH:
+            unfilterPaethSsse3<PIXEL_SIZE>(row, prior, size);
+            return true;
+    }
+    return false;
+}
+#endif
+
+// Undoes \p filter on \p row in place; \p prior is the unfiltered row above
+// it, zeros for the first row.
+void unfilter(int filter,
+              std::uint8_t* row,
+              const std::uint8_t* prior,
+              std::size_t size,
+              std::size_t pixel_size,
+              CpuFeatures::Isa isa) {
+    if (filter == NONE) {
+        return;
+    }
+#ifdef INTEL_VULKAN_PNGDECODE_X86
+    if (isa >= CpuFeatures::Isa::SSSE3) {
+        if (filter == UP) {
+            if (isa == CpuFeatures::Isa::AVX2) {
+                unfilterUpAvx2(row, prior, size);
+            } else {
+                unfilterUpSsse3(row, prior, size);
+            }
+            return;
+        }
+        if ((pixel_size == 4 && unfilterSsse3<4>(filter, row, prior, size)) ||
+            (pixel_size == 3 && unfilterSsse3<3>(filter, row, prior, size))) {
+            return;
+        }
+    }
+#endif
+    unfilterScalar(filter, row, prior, size, pixel_size);
+}
+
+// ---------------------------------------------------------------------------
+// Format conversion, following stb_image's stbi__convert_format
+// ---------------------------------------------------------------------------
+std::uint8_t luma(std::uint8_t red, std::uint8_t green, std::uint8_t blue) {
+    return static_cast<std::uint8_t>((red * 77 + green * 150 + 29 * blue) >>
+                                     8);
+}
+
+void convertRow(const std::uint8_t* src,
+                int src_channels,
+                std::uint8_t* dst,
+                int dst_channels,
+                std::size_t width) {
+    if (src_channels == dst_channels) {
+        std::memcpy(dst, src, width * static_cast<std::size_t>(dst_channels));
+        return;
+    }
+    if (src_channels == 3 && dst_channels == 4) {
+        PixelConvert::rgbToRgba(src, dst, width);
+        return;
+    }
+    for (std::size_t pixel = 0; pixel < width; ++pixel,
+                     src += src_channels,
+                     dst += dst_channels) {
+        switch (src_channels * 8 + dst_channels) {
+            case 1 * 8 + 2:
+                dst[0] = src[0];
+                dst[1] = 255;
+                break;
+            case 1 * 8 + 3:
+                dst[0] = dst[1] = dst[2] = src[0];
+                break;
+            case 1 * 8 + 4:
+                dst[0] = dst[1] = dst[2] = src[0];
+                dst[3] = 255;
+                break;
+            case 2 * 8 + 1:
+                dst[0] = src[0];
+                break;
+            case 2 * 8 + 3:
+                dst[0] = dst[1] = dst[2] = src[0];
+                break;
+            case 2 * 8 + 4:
+                dst[0] = dst[1] = dst[2] = src[0];
+                dst[3] = src[1];
+                break;
+            case 3 * 8 + 1:
+                dst[0] = luma(src[0], src[1], src[2]);
+                break;
+            case 3 * 8 + 2:
+                dst[0] = luma(src[0], src[1], src[2]);
+                dst[1] = 255;
+                break;
+            case 4 * 8 + 1:
+                dst[0] = luma(src[0], src[1], src[2]);
+                break;
+            case 4 * 8 + 2:
+                dst[0] = luma(src[0], src[1], src[2]);
+                dst[1] = src[3];
+                break;
+            case 4 * 8 + 3:
+                dst[0] = src[0];
+                dst[1] = src[1];
+                dst[2] = src[2];
+                break;
+        }
+    }
+}
+
+// ---------------------------------------------------------------------------
+// PNG files
+// ---------------------------------------------------------------------------
+struct PngFile {
+    std::uint32_t width = 0;
+    std::uint32_t height = 0;
+    int depth = 0;
+    int channels = 0;  ///< Samples per pixel, 1 for palette indices.
+    bool interlaced = false;
+
+    bool indexed = false;
+    int palette_channels = 3;  ///< 4 once tRNS gave the palette alpha.
+    std::uint32_t palette_size = 0;
+    std::array<std::uint8_t, 1024> palette{};  ///< RGBA per entry.
+
+    bool keyed = false;  ///< tRNS named a transparent color.
+    std::array<std::uint16_t, 3> key{};
+
+    std::vector<std::span<const std::uint8_t>> data;  ///< IDAT contents.
+};
+
+std::uint32_t readBigEndian(const std::uint8_t* bytes) {
+    return static_cast<std::uint32_t>(bytes[0]) << 24 | bytes[1] << 16 |
+           bytes[2] << 8 | bytes[3];
+}
+
+constexpr std::uint32_t chunkType(const char (&name)[5]) {
+    return static_cast<std::uint32_t>(name[0]) << 24 |
+           static_cast<std::uint32_t>(name[1]) << 16 |
+           static_cast<std::uint32_t>(name[2]) << 8 |
+           static_cast<std::uint32_t>(name[3]);
+}
+
+// Walks the chunks up to IEND. Rejects everything stb_image rejects, so a
+// file is never decoded here but refused by stb_image, and additionally
+// what decodePng leaves to stb_image.
+bool parsePng(std::span<const std::uint8_t> file, PngFile* png) {
+    static constexpr std::uint8_t SIGNATURE[8] = {
+            0x89, 'P', 'N', 'G', '\r', '\n', 0x1a, '\n'};
+    if (file.size() < 8 || std::memcmp(file.data(), SIGNATURE, 8) != 0) {
+        return false;
+    }
+    bool first = true;
+    std::size_t offset = 8;
+    for (;;) {
+        if (file.size() - offset < 8) {
+            return false;
+        }
+        std::uint32_t length = readBigEndian(file.data() + offset);
+        std::uint32_t type = readBigEndian(file.data() + offset + 4);
+        offset += 8;
+        if (type == chunkType("IEND")) {
+            return !first && !png->data.empty();
+        }
+        // Apple's CgBI files are left to stb_image, like everything else
+        // only it handles.
+        if (first && type != chunkType("IHDR")) {
+            return false;
+        }
+        if (file.size() - offset < static_cast<std::size_t>(length) + 4) {
+            return false;
+        }
+        const std::uint8_t* data = file.data() + offset;
+        offset += static_cast<std::size_t>(length) + 4;
+
+        if (type == chunkType("IHDR")) {
+            if (!first || length != 13) {
+                return false;
+            }
+            first = false;
+            png->width = readBigEndian(data);
+            png->height = readBigEndian(data + 4);
+            png->depth = data[8];
+            int color = data[9];
+            png->interlaced = data[12] != 0;
+            png->indexed = color == 3;
+            png->channels = png->indexed ? 1
+                                         : (color & 2 ? 3 : 1) +
+                                                   (color & 4 ? 1 : 0);
+            if (png->width == 0 || png->height == 0 ||
+                png->width > (1u << 24) || png->height > (1u << 24) ||
+                (png->depth != 8 && png->depth != 16) || color > 6 ||
+                (png->indexed && png->depth == 16) ||
+                (!png->indexed && (color & 1)) || data[10] != 0 ||
+                data[11] != 0 || data[12] > 1 || png->interlaced ||
+                (1u << 30) / png->width /
+                                static_cast<std::uint32_t>(
+                                        png->indexed ? 4 : png->channels) <
+                        png->height) {
+                return false;
+            }
+        } else if (type == chunkType("PLTE")) {
+            if (length > 256 * 3 || length % 3 != 0) {
+                return false;
+            }
+            png->palette_size = length / 3;
+            for (std::uint32_t entry = 0; entry < png->palette_size; ++entry) {
+                png->palette[entry * 4 + 0] = data[entry * 3 + 0];
+                png->palette[entry * 4 + 1] = data[entry * 3 + 1];
+                png->palette[entry * 4 + 2] = data[entry * 3 + 2];
+                png->palette[entry * 4 + 3] = 255;
+            }
+        } else if (type == chunkType("tRNS")) {
+            if (!png->data.empty()) {
+                return false;
+            }
+            if (png->indexed) {
+                if (png->palette_size == 0 || length > png->palette_size) {
+                    return false;
+                }
+                png->palette_channels = 4;
+                for (std::uint32_t entry = 0; entry < length; ++entry) {
+                    png->palette[entry * 4 + 3] = data[entry];
+                }
+            } else {
+                if (!(png->channels & 1) ||
+                    length != static_cast<std::uint32_t>(png->channels) * 2) {
+                    return false;
+                }
+                png->keyed = true;
+                for (int channel = 0; channel < png->channels; ++channel) {
+                    std::uint16_t value = static_cast<std::uint16_t>(
+                            data[channel * 2] << 8 | data[channel * 2 + 1]);
+                    png->key[channel] = png->depth == 16 ? value
+                                                         : (value & 0xff);
+                }
+            }
+        } else if (type == chunkType("IDAT")) {
+            if (png->indexed && png->palette_size == 0) {
+                return false;
+            }
+            png->data.emplace_back(data, length);
+        } else if ((type & (1u << 29)) == 0) {
+            // An unknown critical chunk.
+            return false;
+        }
+    }
+}
+
+// The offsets in the zlib stream where an IDAT chunk starts right after a
+// full flush's empty stored block. Those are candidates for inflating
+// independently; whether the encoder really reset its window there only
+// shows while inflating.
+std::vector<std::size_t> independentChunks(
+        const std::vector<std::span<const std::uint8_t>>& chunks,
+        const std::uint8_t* stream) {
+    static constexpr std::uint8_t FLUSH_MARKER[4] = {0, 0, 0xff, 0xff};
+    std::vector<std::size_t> offsets;
+    std::size_t offset = 0;
+    for (const std::span<const std::uint8_t>& chunk : chunks) {
+        if (offset > 6 &&
+            std::memcmp(stream + offset - 4, FLUSH_MARKER, 4) == 0) {
+            offsets.push_back(offset);
+        }
+        offset += chunk.size();
+    }
+    return offsets;
+}
+
+// Inflates \p stream into \p raw, which holds \p expected bytes plus
+// OUTPUT_SLACK, in parallel at the independent chunks if possible.
+bool inflateImage(std::span<const std::uint8_t> stream,
+                  const std::vector<std::size_t>& independent,
+                  std::size_t thread_count,
+                  std::vector<std::uint8_t>& raw,
+                  std::size_t expected) {
+    // Below this much compressed data per thread, starting threads costs
+    // more than it saves.
+    constexpr std::size_t MIN_RUN_SIZE = 64 * 1024;
+
+    std::vector<std::size_t> starts = {2};
+    for (std::size_t offset : independent) {
+        std::size_t target = 2 + (stream.size() - 2) * starts.size() /
+                                         std::max<std::size_t>(thread_count, 1);
+        if (starts.size() < thread_count && offset >= target &&
+            offset - starts.back() >= MIN_RUN_SIZE &&
+            stream.size() - offset >= MIN_RUN_SIZE) {
+            starts.push_back(offset);
+        }
+    }
+
+    if (starts.size() > 1) {
+        // Runs after the first inflate into buffers of their own.
+        std::vector<std::vector<std::uint8_t>> outputs(starts.size());
+        std::vector<char> decoded(starts.size(), 0);
+        auto inflate_run = [&](std::size_t run, std::vector<std::uint8_t>& out,
+                               std::size_t limit) {
+            auto inflater = std::make_unique<Inflater>(
+                    stream.data(), stream.size(), starts[run]);
+            decoded[run] = inflater->run(out,
+                                         limit,
+                                         run + 1 < starts.size()
+                                                 ? starts[run + 1] * 8
+                                                 : NO_STOP);
+            out.resize(decoded[run] ? inflater->produced() : 0);
+        };
+        std::vector<std::thread> threads;
+        for (std::size_t run = 1; run < starts.size(); ++run) {
+            std::size_t compressed =
+                    (run + 1 < starts.size() ? starts[run + 1]
+                                             : stream.size()) -
+                    starts[run];
+            outputs[run].resize(std::min(expected,
+                                         expected / stream.size() *
+                                                         compressed * 2 +
+                                                 65536) +
+                                OUTPUT_SLACK);
+            threads.emplace_back(
+                    inflate_run, run, std::ref(outputs[run]), expected);
+        }
+        // The first run goes straight into place.
+        inflate_run(0, raw, expected);
+        std::size_t size = raw.size();
+        raw.resize(expected + OUTPUT_SLACK);
+        for (std::thread& thread : threads) {
+            thread.join();
+        }
+
+        bool complete = decoded[0] != 0;
+        for (std::size_t run = 1; complete && run < starts.size(); ++run) {
+            complete = decoded[run] != 0 &&
+                       outputs[run].size() <= expected - size;
+            if (complete) {
+                std::memcpy(raw.data() + size,
+                            outputs[run].data(),
+                            outputs[run].size());
+                size += outputs[run].size();
+            }
+        }
+        if (complete && size == expected) {
+            return true;
+        }
+        // A back reference crossed a run, so the encoder only flushed
+        // there; inflate the stream in one go.
+    }
+
+    auto inflater =
+            std::make_unique<Inflater>(stream.data(), stream.size(), 2);
+    return inflater->run(raw, expected, NO_STOP) &&
+           inflater->produced() == expected;
+}
+
+// Decodes into the rows \p destination hands out once it knows the size;
+// see decodePng.
+template <typename Destination>
+bool decode(std::span<const char> contents,
+            int requested_components,
+            std::size_t thread_count,
+            int* width,
+            int* height,
+            int* components,
+            Destination&& destination) {
+    if (requested_components < 0 || requested_components > 4) {
+        return false;
+    }
+    PngFile png;
+    std::span<const std::uint8_t> file(
+            reinterpret_cast<const std::uint8_t*>(contents.data()),
+            contents.size());
+    if (!parsePng(file, &png)) {
+        return false;
+    }
+
+    // The zlib header, checked like stb_image does.
+    std::vector<std::uint8_t> joined;
+    std::span<const std::uint8_t> stream = png.data.front();
+    if (png.data.size() > 1) {
+        for (const std::span<const std::uint8_t>& chunk : png.data) {
+            joined.insert(joined.end(), chunk.begin(), chunk.end());
+        }
+        stream = joined;
+    }
+    if (stream.size() < 2 || (stream[0] * 256 + stream[1]) % 31 != 0 ||
+        (stream[1] & 32) != 0 || (stream[0] & 15) != 8) {
+        return false;
+    }
+
+    // stb_image's channel counts: the file's own for the caller, and what
+    // it writes for requested_components 0.
+    int file_components = png.indexed ? png.palette_channels : png.channels;
+    int pixel_channels = png.indexed ? png.palette_channels
+                                     : png.channels + (png.keyed ? 1 : 0);
+    int out_channels =
+            requested_components != 0 ? requested_components : pixel_channels;
+    std::size_t image_width = png.width;
+    std::size_t row_size = image_width * static_cast<std::size_t>(out_channels);
+
+    std::uint8_t* output = nullptr;
+    std::size_t row_pitch = 0;
+    if (!destination(png.height, row_size, &output, &row_pitch)) {
+        return false;
+    }
+
+    std::size_t pixel_size =
+            static_cast<std::size_t>(png.channels) * (png.depth / 8);
+    std::size_t stride = image_width * pixel_size;
+    std::size_t expected = (stride + 1) * png.height;
+    std::vector<std::uint8_t> raw(expected + OUTPUT_SLACK);
+    if (thread_count == 0) {
+        thread_count = std::max(1u, std::thread::hardware_concurrency());
+    }
+    std::vector<std::size_t> independent;
+    if (thread_count > 1) {
+        independent = independentChunks(png.data, stream.data());
+    }
+    if (!inflateImage(stream, independent, thread_count, raw, expected)) {
+        return false;
+    }
+
+    CpuFeatures::Isa isa = pngIsa();
+    std::vector<std::uint8_t> zeros(stride, 0);
+    std::vector<std::uint8_t> pixels(image_width * 4);
+    // Whatever else can fail is checked before the first row is written:
+    // the filter types, and the palette indices, which are only known once
+    // every row is unfiltered.
+    for (std::size_t y = 0; y < png.height; ++y) {
+        if (raw[y * (stride + 1)] > PAETH) {
+            return false;
+        }
+    }
+    auto unfilter_row = [&, prior = zeros.data()](std::size_t y) mutable {
+        std::uint8_t* line = raw.data() + y * (stride + 1);
+        unfilter(line[0], line + 1, prior, stride, pixel_size, isa);
+        prior = line + 1;
+        return line + 1;
+    };
+    if (png.indexed) {
+        for (std::size_t y = 0; y < png.height; ++y) {
+            const std::uint8_t* row = unfilter_row(y);
+            // stb_image reads uninitialized memory for these.
+            if (*std::max_element(row, row + stride) >= png.palette_size) {
+                return false;
+            }
+        }
+    }
+
+    for (std::size_t y = 0; y < png.height; ++y) {
+        std::uint8_t* row = png.indexed ? raw.data() + y * (stride + 1) + 1
+                                        : unfilter_row(y);
+        std::uint8_t* out = output + y * row_pitch;
+        if (png.indexed) {
+            const std::uint8_t* palette = png.palette.data();
+            std::uint8_t* expanded = out_channels >= 3 ? out : pixels.data();
+            int expanded_channels =
+                    out_channels >= 3 ? out_channels : png.palette_channels;
+            for (std::size_t x = 0; x < image_width; ++x) {
+                std::memcpy(expanded + x * expanded_channels,
+                            palette + row[x] * 4,
+                            static_cast<std::size_t>(expanded_channels));
+            }
+            if (expanded != out) {
+                convertRow(expanded,
+                           expanded_channels,
+                           out,
+                           out_channels,
+                           image_width);
+            }
+            continue;
+        }
+
+        const std::uint8_t* samples = row;
+        if (png.depth == 16 || png.keyed) {
+            // stb_image compares the key with the full samples, then keeps
+            // the high byte of 16 bit ones.
+            int channels = png.channels;
+            int bytes = png.depth / 8;
+            for (std::size_t x = 0; x < image_width; ++x) {
+                const std::uint8_t* sample = row + x * pixel_size;
+                std::uint8_t* pixel = pixels.data() + x * pixel_channels;
+                bool transparent = png.keyed;
+                for (int channel = 0; channel < channels; ++channel) {
+                    std::uint16_t value =
+                            bytes == 2 ? static_cast<std::uint16_t>(
+                                                 sample[channel * 2] << 8 |
+                                                 sample[channel * 2 + 1])
+                                       : sample[channel];
+                    transparent = transparent && value == png.key[channel];
+                    pixel[channel] = sample[channel * bytes];
+                }
+                if (png.keyed) {
+                    pixel[channels] = transparent ? 0 : 255;
+                }
+            }
+            samples = pixels.data();
+        }
+        convertRow(samples, pixel_channels, out, out_channels, image_width);
+    }
+
+    if (width) {
+        *width = static_cast<int>(png.width);
+    }
+    if (height) {
+        *height = static_cast<int>(png.height);
+    }
+    if (components) {
+        *components = file_components;
+    }
+    return true;
+}
+}  // namespace
+
+void setPngDecoder(PngDecoder decoder) {
+    s_decoder.store(decoder, std::memory_order_relaxed);
+}
+
+PngDecoder pngDecoder() { return s_decoder.load(std::memory_order_relaxed); }
+
+CpuFeatures::Isa setPngIsa(CpuFeatures::Isa isa) {
+    isa = CpuFeatures::supportedIsa(isa);
+    isaSlot().store(isa, std::memory_order_relaxed);
+    return isa;
+}
+
+CpuFeatures::Isa pngIsa() {
+    return isaSlot().load(std::memory_order_relaxed);
+}
+
+bool decodePng(std::span<const char> contents,
+               int requested_components,
+               void* destination,
+               std::size_t row_pitch,
+               std::size_t destination_size,
+               int* width,
+               int* height,
+               int* components,
+               std::size_t thread_count) {
+    return decode(contents,
+                  requested_components,
+                  thread_count,
+                  width,
+                  height,
+                  components,
+                  [&](std::size_t rows,
+                      std::size_t row_size,
+                      std::uint8_t** output,
+                      std::size_t* pitch) {
+                      if (destination == nullptr || row_pitch < row_size ||
+                          (rows - 1) * row_pitch + row_size >
+                                  destination_size) {
+                          return false;
+                      }
+                      *output = static_cast<std::uint8_t*>(destination);
+                      *pitch = row_pitch;
+                      return true;
+                  });
+}
+
+std::vector<char> decodePng(std::span<const char> contents,
+                            int requested_components,
+                            int* width,
+                            int* height,
+                            int* components,
+                            int* data_size,
+                            std::size_t thread_count) {
+    std::vector<char> pixels;
+    bool decoded = decode(contents,
+                          requested_components,
+                          thread_count,
+                          width,
+                          height,
+                          components,
+                          [&](std::size_t rows,
+                              std::size_t row_size,
+                              std::uint8_t** output,
+                              std::size_t* pitch) {
+                              pixels.resize(rows * row_size);
+                              *output = reinterpret_cast<std::uint8_t*>(
+                                      pixels.data());
+                              *pitch = row_size;
+                              return true;
+                          });
+    if (!decoded) {
+        return std::vector<char>();
+    }
+    if (data_size) {
+        *data_size = static_cast<int>(pixels.size());
+    }
+    return pixels;
+}
+}  // namespace intel_vulkan::Tools
@@ -0,0 +1,241 @@
+////////////////////////////////////////////////////////////////////////////
+// Copyright (c) 2026 intel_vulkan
+// All rights reserved.
+//
+// Contact: mehoggan@gmail.com
+//
+// This software is licensed under the terms of the Your License.
+// See the LICENSE file in the top-level directory.
+/////////////////////////////////////////////////////////////////////////
+#include "intel_vulkan/RotatingFileBackend.h"
+
+#include <fcntl.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+#include <boost/log/attributes/value_extraction.hpp>
+
+#include <algorithm>
+#include <atomic>
+#include <cerrno>
+#include <condition_variable>
+#include <cstdio>
+#include <thread>
+
+namespace intel_vulkan {
+namespace {
+std::atomic<std::uint64_t> s_bytes_written(0);
+}  // namespace
+
+// One thread syncs the pending records of every backend, so each file
+// logger does not cost a thread of its own. It is started by the first
+// backend and then waits for work for the rest of the program.
+class RotatingFileBackend::SyncTimer {
+public:
+    static SyncTimer& instance() {
+        // Never destroyed, so backends released during exit can still
+        // remove themselves.
+        static SyncTimer* s_timer = new SyncTimer();
+        return *s_timer;
+    }
+
+    void add(RotatingFileBackend* backend) {
+        {
+            std::lock_guard<std::mutex> lock(m_mutex);
+            m_backends.push_back(backend);
+            if (!m_thread.joinable()) {
+                m_thread = std::thread([this]() { run(); });
+            }
+        }
+        // The new backend may be due before the thread would wake up.
+        m_condition.notify_one();
+    }
+
+    // Once this returns the thread no longer touches backend, since it
+    // only calls into backends while holding m_mutex.
+    void remove(RotatingFileBackend* backend) {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        m_backends.erase(
+                std::find(m_backends.begin(), m_backends.end(), backend));
+    }
+
+private:
+    void run() {
+        std::unique_lock<std::mutex> lock(m_mutex);
+        while (true) {
+            std::chrono::steady_clock::time_point now =
+                    std::chrono::steady_clock::now();
+            std::chrono::steady_clock::time_point wake =
+                    std::chrono::steady_clock::time_point::max();
+            for (RotatingFileBackend* backend : m_backends) {
+                wake = std::min(wake, backend->syncIfDue(now));
+            }
+            if (m_backends.empty()) {
+                m_condition.wait(lock);
+            } else {
+                m_condition.wait_until(lock, wake);
+            }
+        }
+    }
+
+    std::mutex m_mutex;
+    std::condition_variable m_condition;
+    std::vector<RotatingFileBackend*> m_backends;
+    std::thread m_thread;
+};
+
+RotatingFileBackend::RotatingFileBackend(const boost::filesystem::path& path,
+                                         const FileLogOptions& options)
+        : m_path(path.string())
+        , m_options(options)
+        , m_fd(-1)
+        , m_regular_file(false)
+        , m_file_size(0)
+        , m_unsynced(false)
+        , m_last_sync(std::chrono::steady_clock::now())
+        , m_timed(false) {
+    m_buffer.reserve(m_options.buffer_size);
+    if (open() && m_options.sync_interval.count() > 0) {
+        SyncTimer::instance().add(this);
+        m_timed = true;
+    }
+}
+
+RotatingFileBackend::~RotatingFileBackend() {
+    if (m_timed) {
+        SyncTimer::instance().remove(this);
+    }
+    if (m_fd != -1) {
+        writeBuffer();
+        sync();
+        ::close(m_fd);
+    }
+}
+
+bool RotatingFileBackend::isOpen() const { return m_fd != -1; }
+
+std::uint64_t RotatingFileBackend::bytesWritten() {
+    return s_bytes_written.load(std::memory_order_relaxed);
+}
+
+void RotatingFileBackend::consume(const boost::log::record_view& record,
+                                  const string_type& formatted_message) {
+    std::lock_guard<std::mutex> lock(m_mutex);
+    if (m_fd == -1) {
+        return;
+    }
+
+    std::size_t record_size = formatted_message.size() + 1;
+    if (m_regular_file && m_options.rotation_size > 0 &&
+        m_file_size + m_buffer.size() + record_size >
+                m_options.rotation_size &&
+        m_file_size + m_buffer.size() > 0) {
+        rotate();
+    }
+    if (m_buffer.size() + record_size > m_options.buffer_size) {
+        writeBuffer();
+    }
+    m_buffer.insert(
+            m_buffer.end(), formatted_message.begin(), formatted_message.end());
+    m_buffer.push_back('\n');
+    m_unsynced = true;
+
+    boost::log::value_ref<boost::log::trivial::severity_level> level =
+            boost::log::extract<boost::log::trivial::severity_level>(
+                    "Severity", record);
+    if ((level && *level >= m_options.sync_level) ||
+        std::chrono::steady_clock::now() - m_last_sync >=
+                m_options.sync_interval) {
+        writeBuffer();
+        sync();
+    }
+}
+
+void RotatingFileBackend::flush() {
+    std::lock_guard<std::mutex> lock(m_mutex);
+    if (m_fd != -1) {
+        writeBuffer();
+    }
+}
+
+bool RotatingFileBackend::open() {
+    m_fd = ::open(m_path.c_str(),
+                  O_WRONLY | O_CREAT | O_TRUNC | O_CLOEXEC,
+                  0644);
+    if (m_fd == -1) {
+        return false;
+    }
+    struct stat file_stat;
+    m_regular_file = ::fstat(m_fd, &file_stat) == 0 &&
+                     S_ISREG(file_stat.st_mode);
+    m_file_size = 0;
+    return true;
+}
+
+void RotatingFileBackend::writeBuffer() {
+    std::size_t written = 0;
+    while (written < m_buffer.size()) {
+        ssize_t result = ::write(
+                m_fd, m_buffer.data() + written, m_buffer.size() - written);
+        if (result < 0 && errno == EINTR) {
+            continue;
+        }
+        if (result <= 0) {
+            // Keep logging even if the disk is full; what did not fit is
+            // lost rather than retried forever.
+            break;
+        }
+        written += static_cast<std::size_t>(result);
+    }
+    m_file_size += written;
+    s_bytes_written.fetch_add(written, std::memory_order_relaxed);
+    m_buffer.clear();
+}
+
+void RotatingFileBackend::sync() {
+    if (m_regular_file) {
+        ::fdatasync(m_fd);
+    }
+    m_unsynced = false;
+    m_last_sync = std::chrono::steady_clock::now();
+}
+
+void RotatingFileBackend::rotate() {
+    writeBuffer();
+    sync();
+    ::close(m_fd);
+    m_fd = -1;
+
+    if (m_options.max_files > 0) {
+        std::remove(rotatedPath(m_options.max_files).c_str());
+        for (std::size_t index = m_options.max_files; index > 1; --index) {
+            std::rename(rotatedPath(index - 1).c_str(),
+                        rotatedPath(index).c_str());
+        }
+        std::rename(m_path.c_str(), rotatedPath(1).c_str());
+    }
+    open();
+}
+
+std::chrono::steady_clock::time_point RotatingFileBackend::syncIfDue(
+        std::chrono::steady_clock::time_point now) {
+    std::lock_guard<std::mutex> lock(m_mutex);
+    if (!m_unsynced || m_fd == -1) {
+        // A record arriving while nothing is pending is due at most one
+        // interval from now, so waking up then keeps the bound.
+        return now + m_options.sync_interval;
+    }
+    std::chrono::steady_clock::time_point due =
+            m_last_sync + m_options.sync_interval;
+    if (now < due) {
+        return due;
+    }
+    writeBuffer();
+    sync();
+    return m_last_sync + m_options.sync_interval;
+}
+
+std::string RotatingFileBackend::rotatedPath(std::size_t index) const {
+    return m_path + "." + std::to_string(index);
+}
+}  // namespace intel_vulkan
@@ -16,7 +16,17 @@
 
 #include "intel_vulkan/Tools.h"
 
+#include "intel_vulkan/AssetArchive.h"
+#include "intel_vulkan/ImageCache.h"
+#include "intel_vulkan/Matrix.h"
+#include "intel_vulkan/PixelConvert.h"
+#include "intel_vulkan/PngDecode.h"
+
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
 #include <unistd.h>
+#include <cerrno>
 #include <cmath>
 #include <filesystem>
 #include <fstream>
@@ -27,7 +37,7 @@
 namespace intel_vulkan::Tools {
 
 namespace {
-std::filesystem::path executableDir() {
+std::filesystem::path findExecutableDir() {
     char exec_buf[4096];
     ssize_t nread =
             ::readlink("/proc/self/exe", exec_buf, sizeof(exec_buf) - 1);
@@ -42,13 +52,283 @@ std::filesystem::path executableDir() {
     }
     return exec_dir;
 }
-}  // namespace
 
-std::vector<char> getBinaryFileContents(std::string const& filename) {
+// Looked up once; the executable does not move while it runs.
+const std::filesystem::path& executableDir() {
+    static const std::filesystem::path exec_dir = findExecutableDir();
+    return exec_dir;
+}
+
+std::filesystem::path resolvePath(std::string const& filename) {
     std::filesystem::path path(filename);
     if (!std::filesystem::exists(path)) {
         path = executableDir() / filename;
     }
+    return path;
+}
+
+int adviceFor(MappedFile::Access access) {
+    switch (access) {
+        case MappedFile::Access::SEQUENTIAL:
+            return MADV_SEQUENTIAL;
+        case MappedFile::Access::WILL_NEED:
+            return MADV_WILLNEED;
+        case MappedFile::Access::NORMAL:
+            break;
+    }
+    return MADV_NORMAL;
+}
+
+bool fitsDestination(size_t row_size,
+                     int rows,
+                     size_t row_pitch,
+                     size_t destination_size) {
+    if ((row_pitch < row_size) ||
+        (destination_size <
+         (static_cast<size_t>(rows) - 1) * row_pitch + row_size)) {
+        std::cout << "Image does not fit into the destination!" << std::endl;
+        return false;
+    }
+    return true;
+}
+
+// Decodes an image with stb into memory provided by the caller, see
+// getImageData.
+bool decodeWithStb(std::span<const char> contents,
+                   int requested_components,
+                   char* output,
+                   size_t row_pitch,
+                   size_t destination_size,
+                   int* width,
+                   int* height,
+                   int* components) {
+    // stb expands RGB to RGBA one pixel at a time in an extra pass over an
+    // extra buffer. Decode such files as RGB and expand them with the SIMD
+    // kernels while copying to the destination instead.
+    int file_width = 0, file_height = 0, file_components = 0;
+    bool expand_rgb = false;
+    if ((requested_components == 4) &&
+        stbi_info_from_memory(
+                reinterpret_cast<const unsigned char*>(contents.data()),
+                static_cast<int>(contents.size()),
+                &file_width,
+                &file_height,
+                &file_components)) {
+        expand_rgb = file_components == 3;
+    }
+
+    unsigned char* image_data = stbi_load_from_memory(
+            reinterpret_cast<const unsigned char*>(contents.data()),
+            static_cast<int>(contents.size()),
+            width,
+            height,
+            components,
+            expand_rgb ? 3 : requested_components);
+    if ((image_data == nullptr) || (*width <= 0) || (*height <= 0) ||
+        (*components <= 0)) {
+        std::cout << "Could not read image data!" << std::endl;
+        stbi_image_free(image_data);
+        return false;
+    }
+
+    size_t row_size = static_cast<size_t>(*width) *
+                      static_cast<size_t>(requested_components <= 0
+                                                  ? *components
+                                                  : requested_components);
+    if (!fitsDestination(row_size, *height, row_pitch, destination_size)) {
+        stbi_image_free(image_data);
+        return false;
+    }
+
+    // stb always decodes into memory of its own, so this is the only copy
+    // of the pixels and the only write to the destination.
+    if (expand_rgb) {
+        for (int row = 0; row < *height; ++row) {
+            PixelConvert::rgbToRgba(
+                    image_data + static_cast<size_t>(row) * *width * 3,
+                    reinterpret_cast<std::uint8_t*>(output + row * row_pitch),
+                    static_cast<size_t>(*width));
+        }
+    } else if (row_pitch == row_size) {
+        memcpy(output, image_data, row_size * *height);
+    } else {
+        for (int row = 0; row < *height; ++row) {
+            memcpy(output + row * row_pitch,
+                   image_data + row * row_size,
+                   row_size);
+        }
+    }
+    stbi_image_free(image_data);
+    return true;
+}
+
+// Decodes an image into a tightly packed buffer of its own, see
+// getImageData.
+std::vector<char> decodeToBuffer(std::span<const char> contents,
+                                 int requested_components,
+                                 int* width,
+                                 int* height,
+                                 int* components) {
+    std::vector<char> output;
+    if (pngDecoder() == PngDecoder::FAST) {
+        int size = 0;
+        output = decodePng(contents,
+                           requested_components,
+                           width,
+                           height,
+                           components,
+                           &size);
+    }
+    if (output.empty()) {
+        unsigned char* image_data = stbi_load_from_memory(
+                reinterpret_cast<const unsigned char*>(contents.data()),
+                static_cast<int>(contents.size()),
+                width,
+                height,
+                components,
+                requested_components);
+        if ((image_data == nullptr) || (*width <= 0) || (*height <= 0) ||
+            (*components <= 0)) {
+            std::cout << "Could not read image data!" << std::endl;
+            stbi_image_free(image_data);
+            return std::vector<char>();
+        }
+
+        size_t size = static_cast<size_t>(*width) * *height *
+                      (requested_components <= 0 ? *components
+                                                 : requested_components);
+        output.assign(reinterpret_cast<const char*>(image_data),
+                      reinterpret_cast<const char*>(image_data) + size);
+        stbi_image_free(image_data);
+    }
+    return output;
+}
+}  // namespace
+
+MappedFile::MappedFile() : m_data(nullptr), m_size(0), m_buffer() {}
+
+MappedFile::MappedFile(std::string const& filename, Access access)
+        : m_data(nullptr), m_size(0), m_buffer() {
+    std::filesystem::path path = resolvePath(filename);
+    int fd = ::open(path.c_str(), O_RDONLY | O_CLOEXEC);
+    if (fd == -1) {
+        std::cout << "Could not open \"" << filename << "\" file!"
+                  << std::endl;
+        return;
+    }
+    struct stat file_stat;
+    if (::fstat(fd, &file_stat) != 0 || file_stat.st_size <= 0) {
+        ::close(fd);
+        return;
+    }
+    size_t size = static_cast<size_t>(file_stat.st_size);
+    if (size < MIN_MAPPED_SIZE) {
+        m_buffer.reset(new char[size]);
+        size_t nread = 0;
+        while (nread < size) {
+            ssize_t result = ::pread(fd,
+                                     m_buffer.get() + nread,
+                                     size - nread,
+                                     static_cast<off_t>(nread));
+            if (result < 0 && errno == EINTR) {
+                continue;
+            }
+            if (result <= 0) {
+                break;
+            }
+            nread += static_cast<size_t>(result);
+        }
+        ::close(fd);
+        if (nread != size) {
+            std::cout << "Could not read \"" << filename << "\" file!"
+                      << std::endl;
+            m_buffer.reset();
+            return;
+        }
+        m_data = m_buffer.get();
+        m_size = size;
+        return;
+    }
+
+    // The mapping keeps its own reference to the file. Contents that are
+    // needed right away are faulted in by mmap itself instead of one page
+    // fault per page.
+    void* mapping = ::mmap(nullptr,
+                           size,
+                           PROT_READ,
+                           access == Access::WILL_NEED
+                                   ? MAP_PRIVATE | MAP_POPULATE
+                                   : MAP_PRIVATE,
+                           fd,
+                           0);
+    ::close(fd);
+    if (mapping == MAP_FAILED) {
+        std::cout << "Could not map \"" << filename << "\" file!"
+                  << std::endl;
+        return;
+    }
+    m_data = static_cast<const char*>(mapping);
+    m_size = size;
+    advise(access);
+}
+
+MappedFile::MappedFile(MappedFile&& other) noexcept
+        : m_data(other.m_data)
+        , m_size(other.m_size)
+        , m_buffer(std::move(other.m_buffer)) {
+    other.m_data = nullptr;
+    other.m_size = 0;
+}
+
+MappedFile& MappedFile::operator=(MappedFile&& other) noexcept {
+    if (this != &other) {
+        unmap();
+        m_data = other.m_data;
+        m_size = other.m_size;
+        m_buffer = std::move(other.m_buffer);
+        other.m_data = nullptr;
+        other.m_size = 0;
+    }
+    return *this;
+}
+
+MappedFile::~MappedFile() { unmap(); }
+
+void MappedFile::advise(Access access) const {
+    if (m_data != nullptr && !m_buffer) {
+        ::madvise(const_cast<char*>(m_data), m_size, adviceFor(access));
+    }
+}
+
+void MappedFile::unmap() {
+    if (m_buffer) {
+        m_buffer.reset();
+    } else if (m_data != nullptr) {
+        ::munmap(const_cast<char*>(m_data), m_size);
+    }
+    m_data = nullptr;
+    m_size = 0;
+}
+
+std::string findFile(std::string const& filename) {
+    std::filesystem::path path = resolvePath(filename);
+    std::error_code error;
+    if (!std::filesystem::exists(path, error)) {
+        return {};
+    }
+    return path.string();
+}
+
+std::vector<char> getBinaryFileContents(std::string const& filename) {
+    std::shared_ptr<const AssetArchive> archive = AssetArchive::global();
+    if (archive) {
+        if (std::optional<std::span<const char>> contents =
+                    archive->find(filename)) {
+            return std::vector<char>(contents->begin(), contents->end());
+        }
+    }
+
+    std::filesystem::path path = resolvePath(filename);
     std::ifstream file(path, std::ios::binary);
     if (file.fail()) {
         std::cout << "Could not open \"" << filename << "\" file!"
@@ -80,28 +360,62 @@ std::vector<char> getImageData(std::string const& filename,
                                int* height,
                                int* components,
                                int* data_size) {
-    std::vector<char> file_data = Tools::getBinaryFileContents(filename);
-    if (file_data.size() == 0) {
+    // Assets in the archive are decoded from it directly; only loose
+    // files, which can change, go through the image cache.
+    std::shared_ptr<const AssetArchive> archive = AssetArchive::global();
+    std::optional<std::span<const char>> archived;
+    if (archive) {
+        archived = archive->find(filename);
+    }
+    std::span<const char> contents =
+            archived.value_or(std::span<const char>());
+    std::string path;
+    std::shared_ptr<ImageCache> cache;
+    MappedFile file;
+    if (!archived) {
+        path = resolvePath(filename).string();
+        cache = ImageCache::global();
+    }
+    if (cache) {
+        std::optional<ImageCache::Image> cached =
+                cache->find(path, requested_components);
+        if (cached) {
+            if (data_size) {
+                *data_size = static_cast<int>(cached->pixels.size());
+            }
+            if (width) {
+                *width = cached->width;
+            }
+            if (height) {
+                *height = cached->height;
+            }
+            if (components) {
+                *components = cached->components;
+            }
+            return std::vector<char>(cached->pixels.begin(),
+                                     cached->pixels.end());
+        }
+    }
+
+    if (!archived) {
+        file = MappedFile(path, MappedFile::Access::SEQUENTIAL);
+        contents = file.view();
+    }
+    if (contents.empty()) {
         return std::vector<char>();
     }
 
     int tmp_width = 0, tmp_height = 0, tmp_components = 0;
-    unsigned char* image_data = stbi_load_from_memory(
-            reinterpret_cast<unsigned char*>(&file_data[0]),
-            static_cast<int>(file_data.size()),
-            &tmp_width,
-            &tmp_height,
-            &tmp_components,
-            requested_components);
-    if ((image_data == nullptr) || (tmp_width <= 0) || (tmp_height <= 0) ||
-        (tmp_components <= 0)) {
-        std::cout << "Could not read image data!" << std::endl;
-        return std::vector<char>();
+    std::vector<char> output = decodeToBuffer(contents,
+                                              requested_components,
+                                              &tmp_width,
+                                              &tmp_height,
+                                              &tmp_components);
+    if (output.empty()) {
+        return output;
     }
+    int size = static_cast<int>(output.size());
 
-    int size = (tmp_width) * (tmp_height) *
-               (requested_components <= 0 ? tmp_components
-                                          : requested_components);
     if (data_size) {
         *data_size = size;
     }
@@ -115,13 +429,193 @@ std::vector<char> getImageData(std::string const& filename,
         *components = tmp_components;
     }
 
-    std::vector<char> output(size);
-    memcpy(&output[0], image_data, size);
-
-    stbi_image_free(image_data);
+    if (cache) {
+        int channels = size / (tmp_width * tmp_height);
+        cache->store(path,
+                     requested_components,
+                     tmp_width,
+                     tmp_height,
+                     tmp_components,
+                     channels,
+                     output.data(),
+                     static_cast<size_t>(tmp_width) * channels);
+    }
     return output;
 }
 
+// ************************************************************ //
+// GetImageInfo                                                 //
+//                                                              //
+// Function reading image dimensions without decoding the image //
+// ************************************************************ //
+bool getImageInfo(std::string const& filename,
+                  int* width,
+                  int* height,
+                  int* components) {
+    Asset asset = loadAsset(filename, MappedFile::Access::NORMAL);
+    if (asset.empty()) {
+        return false;
+    }
+
+    int tmp_width = 0, tmp_height = 0, tmp_components = 0;
+    if (!stbi_info_from_memory(
+                reinterpret_cast<const unsigned char*>(asset.contents.data()),
+                static_cast<int>(asset.contents.size()),
+                &tmp_width,
+                &tmp_height,
+                &tmp_components)) {
+        std::cout << "Could not read image info!" << std::endl;
+        return false;
+    }
+
+    if (width) {
+        *width = tmp_width;
+    }
+    if (height) {
+        *height = tmp_height;
+    }
+    if (components) {
+        *components = tmp_components;
+    }
+    return true;
+}
+
+// ************************************************************ //
+// GetImageData                                                 //
+//                                                              //
+// Function decoding image (texture) data from a specified file //
+// into memory provided by the caller                           //
+// ************************************************************ //
+bool getImageData(std::string const& filename,
+                  int requested_components,
+                  void* destination,
+                  size_t row_pitch,
+                  size_t destination_size,
+                  int* width,
+                  int* height,
+                  int* components) {
+    if (destination == nullptr) {
+        return false;
+    }
+    char* output = static_cast<char*>(destination);
+    std::shared_ptr<const AssetArchive> archive = AssetArchive::global();
+    std::optional<std::span<const char>> archived;
+    if (archive) {
+        archived = archive->find(filename);
+    }
+    std::span<const char> contents =
+            archived.value_or(std::span<const char>());
+    std::string path;
+    std::shared_ptr<ImageCache> cache;
+    MappedFile file;
+    if (!archived) {
+        path = resolvePath(filename).string();
+        cache = ImageCache::global();
+    }
+    if (cache) {
+        std::optional<ImageCache::Image> cached =
+                cache->find(path, requested_components);
+        if (cached) {
+            size_t row_size = cached->pixels.size() / cached->height;
+            if (!fitsDestination(row_size,
+                                 cached->height,
+                                 row_pitch,
+                                 destination_size)) {
+                return false;
+            }
+            for (int row = 0; row < cached->height; ++row) {
+                memcpy(output + row * row_pitch,
+                       cached->pixels.data() + row * row_size,
+                       row_size);
+            }
+            if (width) {
+                *width = cached->width;
+            }
+            if (height) {
+                *height = cached->height;
+            }
+            if (components) {
+                *components = cached->components;
+            }
+            return true;
+        }
+    }
+
+    if (!archived) {
+        file = MappedFile(path, MappedFile::Access::SEQUENTIAL);
+        contents = file.view();
+    }
+    if (contents.empty()) {
+        return false;
+    }
+
+    int tmp_width = 0, tmp_height = 0, tmp_components = 0;
+    if (cache) {
+        // The destination may be write-combined mapped memory, which is
+        // slow to read back. Decode into a buffer of our own, store the
+        // entry from it and copy it to the destination.
+        std::vector<char> pixels = decodeToBuffer(contents,
+                                                  requested_components,
+                                                  &tmp_width,
+                                                  &tmp_height,
+                                                  &tmp_components);
+        if (pixels.empty()) {
+            return false;
+        }
+        size_t row_size = pixels.size() / tmp_height;
+        if (!fitsDestination(row_size,
+                             tmp_height,
+                             row_pitch,
+                             destination_size)) {
+            return false;
+        }
+        for (int row = 0; row < tmp_height; ++row) {
+            memcpy(output + row * row_pitch,
+                   pixels.data() + row * row_size,
+                   row_size);
+        }
+        cache->store(path,
+                     requested_components,
+                     tmp_width,
+                     tmp_height,
+                     tmp_components,
+                     static_cast<int>(row_size / tmp_width),
+                     pixels.data(),
+                     row_size);
+    } else {
+        bool decoded = pngDecoder() == PngDecoder::FAST &&
+                       decodePng(contents,
+                                 requested_components,
+                                 destination,
+                                 row_pitch,
+                                 destination_size,
+                                 &tmp_width,
+                                 &tmp_height,
+                                 &tmp_components);
+        if (!decoded && !decodeWithStb(contents,
+                                       requested_components,
+                                       output,
+                                       row_pitch,
+                                       destination_size,
+                                       &tmp_width,
+                                       &tmp_height,
+                                       &tmp_components)) {
+            return false;
+        }
+    }
+
+    if (width) {
+        *width = tmp_width;
+    }
+    if (height) {
+        *height = tmp_height;
+    }
+    if (components) {
+        *components = tmp_components;
+    }
+    return true;
+}
+
 // ************************************************************ //
 // GetPerspectiveProjectionMatrix                               //
 //                                                              //
@@ -131,28 +625,8 @@ std::array<float, 16> getPerspectiveProjectionMatrix(float const aspect_ratio,
                                                      float const field_of_view,
                                                      float const near_clip,
                                                      float const far_clip) {
-    float fov_value = 1.0f / std::tan(field_of_view * 0.5f *
-                                      0.01745329251994329576923690768489f);
-
-    return {fov_value / aspect_ratio,
-            0.0f,
-            0.0f,
-            0.0f,
-
-            0.0f,
-            -fov_value,
-            0.0f,
-            0.0f,
-
-            0.0f,
-            0.0f,
-            far_clip / (near_clip - far_clip),
-            -1.0f,
-
-            0.0f,
-            0.0f,
-            (near_clip * far_clip) / (near_clip - far_clip),
-            0.0f};
+    return perspective(aspect_ratio, field_of_view, near_clip, far_clip)
+            .toArray();
 }
 
 std::array<float, 16> getOrthographicProjectionMatrix(float const left_plane,
@@ -161,25 +635,13 @@ std::array<float, 16> getOrthographicProjectionMatrix(float const left_plane,
                                                       float const bottom_plane,
                                                       float const near_plane,
                                                       float const far_plane) {
-    return {2.0f / (right_plane - left_plane),
-            0.0f,
-            0.0f,
-            0.0f,
-
-            0.0f,
-            2.0f / (bottom_plane - top_plane),
-            0.0f,
-            0.0f,
-
-            0.0f,
-            0.0f,
-            1.0f / (near_plane - far_plane),
-            0.0f,
-
-            -(right_plane + left_plane) / (right_plane - left_plane),
-            -(bottom_plane + top_plane) / (bottom_plane - top_plane),
-            near_plane / (near_plane - far_plane),
-            1.0f};
+    return orthographic(left_plane,
+                        right_plane,
+                        top_plane,
+                        bottom_plane,
+                        near_plane,
+                        far_plane)
+            .toArray();
 }
 
 }  // namespace intel_vulkan::Tools
@@ -96,8 +96,8 @@ Tutorial01::~Tutorial01() {
     if (m_vulkan_tutorial01_parameters.getVkDebugUtilsMessenger() !=
         VK_NULL_HANDLE) {
         if (!destroyDebugMessenger()) {
-            Logging::error(LOG_TAG,
-                           "Failed to destroy VkDebugUtilsMessengerExt!!!");
+            INTEL_VULKAN_LOG_ERROR(
+                    LOG_TAG, "Failed to destroy VkDebugUtilsMessengerExt!!!");
         }
     }
 
@@ -147,7 +147,7 @@ bool Tutorial01::loadVulkanLibrary() {
     m_vulkan_library_handle = dlopen("libvulkan.so.1", RTLD_NOW);
 
     if (m_vulkan_library_handle == nullptr) {
-        Logging::error(LOG_TAG, "Could not load Vulkan library!");
+        INTEL_VULKAN_LOG_ERROR(LOG_TAG, "Could not load Vulkan library!");
         return false;
     }
     return true;
@@ -158,10 +158,10 @@ bool Tutorial01::loadExportedEntryPoints() {
 
 #define VK_EXPORTED_FUNCTION(fun)                                             \
     if (m_enable_vulkan_debug) {                                              \
-        Logging::info(LOG_TAG, "Loading entry point", #fun, "...");           \
+        INTEL_VULKAN_LOG_INFO(LOG_TAG, "Loading entry point", #fun, "...");   \
     }                                                                         \
     if (!(fun = (PFN_##fun)LoadProcAddress(m_vulkan_library_handle, #fun))) { \
-        Logging::error(                                                       \
+        INTEL_VULKAN_LOG_ERROR(                                               \
                 LOG_TAG, "Could not load exported function:", #fun, "!");     \
         return false;                                                         \
     }
@@ -174,10 +174,10 @@ bool Tutorial01::loadExportedEntryPoints() {
 bool Tutorial01::loadGlobalLevelEntryPoints() {
 #define VK_GLOBAL_LEVEL_FUNCTION(fun)                                         \
     if (m_enable_vulkan_debug) {                                              \
-        Logging::info(LOG_TAG, "Loading global", #fun, "...");                \
+        INTEL_VULKAN_LOG_INFO(LOG_TAG, "Loading global", #fun, "...");        \
     }                                                                         \
     if (!(fun = (PFN_##fun)vkGetInstanceProcAddr(nullptr, #fun))) {           \
-        Logging::error(                                                       \
+        INTEL_VULKAN_LOG_ERROR(                                               \
                 LOG_TAG, "Could not load global level function:", #fun, "!"); \
         return false;                                                         \
     }
@@ -189,9 +189,10 @@ bool Tutorial01::loadGlobalLevelEntryPoints() {
 
 bool Tutorial01::createInstance() {
     if (!checkValidationLayerSupport()) {
-        Logging::error(LOG_TAG,
-                       "Failed to create an instance that does not support",
-                       "validation layers.");
+        INTEL_VULKAN_LOG_ERROR(
+                LOG_TAG,
+                "Failed to create an instance that does not support",
+                "validation layers.");
         return false;
     }
 
@@ -215,9 +216,9 @@ bool Tutorial01::createInstance() {
     std::vector<const char*> vk_extensions =
             (m_enable_vulkan_debug ? get_required_extensions()
                                    : std::vector<const char*>{});
-    Logging::info(LOG_TAG,
-                  "Creating an instance with the following extensions",
-                  vk_extensions);
+    INTEL_VULKAN_LOG_INFO(LOG_TAG,
+                          "Creating an instance with the following extensions",
+                          vk_extensions);
 
     VkInstanceCreateInfo instance_create_info{
             .sType = VK_STRUCTURE_TYPE_INSTANCE_CREATE_INFO,
@@ -239,12 +240,12 @@ bool Tutorial01::createInstance() {
                          nullptr,
                          &m_vulkan_tutorial01_parameters.getVkInstance()) !=
         VK_SUCCESS) {
-        Logging::error(LOG_TAG, "Could not create Vulkan instance!");
+        INTEL_VULKAN_LOG_ERROR(LOG_TAG, "Could not create Vulkan instance!");
         return false;
     }
 
     if (!setupDebugMessenger()) {
-        Logging::error(LOG_TAG, "Failed to setup debug messenger!!!");
+        INTEL_VULKAN_LOG_ERROR(LOG_TAG, "Failed to setup debug messenger!!!");
     }
 
     return true;
@@ -253,14 +254,14 @@ bool Tutorial01::createInstance() {
 bool Tutorial01::loadInstanceLevelEntryPoints() {
 #define VK_INSTANCE_LEVEL_FUNCTION(fun)                                     \
     if (m_enable_vulkan_debug) {                                            \
-        Logging::info(LOG_TAG, "Loading instance", #fun, "...");            \
+        INTEL_VULKAN_LOG_INFO(LOG_TAG, "Loading instance", #fun, "...");    \
     }                                                                       \
     if (!(fun = (PFN_##fun)vkGetInstanceProcAddr(                           \
                   m_vulkan_tutorial01_parameters.getVkInstance(), #fun))) { \
-        Logging::error(LOG_TAG,                                             \
-                       "Could not load instance level function:",           \
-                       #fun,                                                \
-                       "!");                                                \
+        INTEL_VULKAN_LOG_ERROR(LOG_TAG,                                     \
+                               "Could not load instance level function:",   \
+                               #fun,                                        \
+                               "!");                                        \
         return false;                                                       \
     }
 
@@ -276,8 +277,9 @@ bool Tutorial01::createDevice() {
                  &num_devices,
                  nullptr) != VK_SUCCESS) ||
         (num_devices == 0)) {
-        Logging::error(LOG_TAG,
-                       "Error occurred during physical devices enumeration!");
+        INTEL_VULKAN_LOG_ERROR(
+                LOG_TAG,
+                "Error occurred during physical devices enumeration!");
         return false;
     }
 
@@ -286,8 +288,9 @@ bool Tutorial01::createDevice() {
                 m_vulkan_tutorial01_parameters.getVkInstance(),
                 &num_devices,
                 vk_physical_devices.data()) != VK_SUCCESS) {
-        Logging::error(LOG_TAG,
-                       "Error occurred during physical devices enumeration!");
+        INTEL_VULKAN_LOG_ERROR(
+                LOG_TAG,
+                "Error occurred during physical devices enumeration!");
         return false;
     }
 
@@ -302,9 +305,10 @@ bool Tutorial01::createDevice() {
         }
     }
     if (vk_physical_device == VK_NULL_HANDLE) {
-        Logging::error(LOG_TAG,
-                       "Could not select physical device based on the chosen "
-                       "properties!");
+        INTEL_VULKAN_LOG_ERROR(
+                LOG_TAG,
+                "Could not select physical device based on the chosen "
+                "properties!");
         return false;
     }
 
@@ -335,7 +339,7 @@ bool Tutorial01::createDevice() {
                        nullptr,
                        &m_vulkan_tutorial01_parameters.getVkDevice()) !=
         VK_SUCCESS) {
-        Logging::error(LOG_TAG, "Could not create Vulkan device!");
+        INTEL_VULKAN_LOG_ERROR(LOG_TAG, "Could not create Vulkan device!");
         return false;
     }
 
@@ -359,10 +363,10 @@ bool Tutorial01::checkPhysicalDeviceProperties(
 
     if ((major_version < 1) ||
         (vk_physical_device_properties.limits.maxImageDimension2D < 4096)) {
-        Logging::error(LOG_TAG,
-                       "Physical device",
-                       vk_physical_device,
-                       "doesn't support required parameters!");
+        INTEL_VULKAN_LOG_ERROR(LOG_TAG,
+                               "Physical device",
+                               vk_physical_device,
+                               "doesn't support required parameters!");
         return false;
     }
 
@@ -370,10 +374,10 @@ bool Tutorial01::checkPhysicalDeviceProperties(
     vkGetPhysicalDeviceQueueFamilyProperties(
             vk_physical_device, &queue_families_count, nullptr);
     if (queue_families_count == 0) {
-        Logging::error(LOG_TAG,
-                       "Physical device",
-                       vk_physical_device,
-                       "doesn't have any queue families!");
+        INTEL_VULKAN_LOG_ERROR(LOG_TAG,
+                               "Physical device",
+                               vk_physical_device,
+                               "doesn't have any queue families!");
         return false;
     }
 
@@ -389,16 +393,16 @@ bool Tutorial01::checkPhysicalDeviceProperties(
             (vk_queue_family_properties[i].queueFlags &
              VK_QUEUE_GRAPHICS_BIT)) {
             queue_family_index = i;
-            Logging::info(LOG_TAG,
-                          "Selected device:",
-                          vk_physical_device_properties.deviceName);
+            INTEL_VULKAN_LOG_INFO(LOG_TAG,
+                                  "Selected device:",
+                                  vk_physical_device_properties.deviceName);
             found = true;
             break;
         }
     }
 
     if (!found) {
-        Logging::error(
+        INTEL_VULKAN_LOG_ERROR(
                 LOG_TAG,
                 "Could not find queue family with required properties on",
                 "physical device",
@@ -412,11 +416,11 @@ bool Tutorial01::checkPhysicalDeviceProperties(
 bool Tutorial01::loadDeviceLevelEntryPoints() {
 #define VK_DEVICE_LEVEL_FUNCTION(fun)                                         \
     if (m_enable_vulkan_debug) {                                              \
-        Logging::info(LOG_TAG, "Loading device", #fun, "...");                \
+        INTEL_VULKAN_LOG_INFO(LOG_TAG, "Loading device", #fun, "...");        \
     }                                                                         \
     if (!(fun = (PFN_##fun)vkGetDeviceProcAddr(                               \
                   m_vulkan_tutorial01_parameters.getVkDevice(), #fun))) {     \
-        Logging::error(                                                       \
+        INTEL_VULKAN_LOG_ERROR(                                               \
                 LOG_TAG, "Could not load device level function:", #fun, "!"); \
         return false;                                                         \
     }
@@ -444,8 +448,9 @@ bool Tutorial01::checkValidationLayerSupport() const {
     std::vector<VkLayerProperties> vk_layer_properties(layer_count);
     vkEnumerateInstanceLayerProperties(&layer_count,
                                        vk_layer_properties.data());
-    Logging::info(LOG_TAG, "The vk_instance has the following properties:");
-    Logging::info(LOG_TAG, vk_layer_properties);
+    INTEL_VULKAN_LOG_INFO(LOG_TAG,
+                          "The vk_instance has the following properties:");
+    INTEL_VULKAN_LOG_INFO(LOG_TAG, vk_layer_properties);
 
     bool response = true;
     for (const char* layer_name : validation_layers) {
@@ -457,11 +462,11 @@ bool Tutorial01::checkValidationLayerSupport() const {
                            0;
                 });
         if (layer_it == vk_layer_properties.end()) {
-            Logging::error(LOG_TAG,
-                           "The following layer \"",
-                           layer_name,
-                           "\""
-                           "could not be loaded!!!");
+            INTEL_VULKAN_LOG_ERROR(LOG_TAG,
+                                   "The following layer \"",
+                                   layer_name,
+                                   "\""
+                                   "could not be loaded!!!");
             response = false;
             break;
         }
@@ -483,9 +488,10 @@ debugCallback(VkDebugUtilsMessageSeverityFlagBitsEXT message_severity,
         log_tag_created.store(true);
     }
 
-    Logging::error(debug_log_tag,
-                   "validation layer:",
-                   vk_debug_utils_messenger_callback_data_ext->pMessage);
+    INTEL_VULKAN_LOG_ERROR(
+            debug_log_tag,
+            "validation layer:",
+            vk_debug_utils_messenger_callback_data_ext->pMessage);
 
     return VK_FALSE;
 }
@@ -495,7 +501,7 @@ bool Tutorial01::setupDebugMessenger() {
     if (!m_enable_vulkan_debug.load()) {
         response = true;
     } else {
-        Logging::info(LOG_TAG, "Setting up Vulkan debugger...");
+        INTEL_VULKAN_LOG_INFO(LOG_TAG, "Setting up Vulkan debugger...");
         VkDebugUtilsMessengerCreateInfoEXT vk_debug_utils_messenger_create_info_ext{
                 .sType =
                         VK_STRUCTURE_TYPE_DEBUG_UTILS_MESSENGER_CREATE_INFO_EXT,
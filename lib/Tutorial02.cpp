@@ -207,7 +207,7 @@ Tutorial02::~Tutorial02() {
         if (m_vulkan_tutorial02_parameters.getVkDebugUtilsMessenger() !=
             VK_NULL_HANDLE) {
             if (!destroyDebugMessenger()) {
-                Logging::error(
+                INTEL_VULKAN_LOG_ERROR(
                         LOG_TAG,
                         "Failed to destroy VkDebugUtilsMessengerExt!!!");
             }
@@ -258,43 +258,43 @@ Tutorial02::~Tutorial02() {
 bool Tutorial02::prepareVulkan(os::WindowParameters parameters) {
     m_window_parameters = parameters;
 
-    Logging::info(LOG_TAG, "loadVulkanLibrary()");
+    INTEL_VULKAN_LOG_INFO(LOG_TAG, "loadVulkanLibrary()");
     if (!loadVulkanLibrary()) {
         return false;
     }
-    Logging::info(LOG_TAG, "loadExportedEntryPoints()");
+    INTEL_VULKAN_LOG_INFO(LOG_TAG, "loadExportedEntryPoints()");
     if (!loadExportedEntryPoints()) {
         return false;
     }
-    Logging::info(LOG_TAG, "loadGlobalLevelEntryPoints()");
+    INTEL_VULKAN_LOG_INFO(LOG_TAG, "loadGlobalLevelEntryPoints()");
     if (!loadGlobalLevelEntryPoints()) {
         return false;
     }
-    Logging::info(LOG_TAG, "createInstance()");
+    INTEL_VULKAN_LOG_INFO(LOG_TAG, "createInstance()");
     if (!createInstance()) {
         return false;
     }
-    Logging::info(LOG_TAG, "loadInstanceLevelEntryPoints()");
+    INTEL_VULKAN_LOG_INFO(LOG_TAG, "loadInstanceLevelEntryPoints()");
     if (!loadInstanceLevelEntryPoints()) {
         return false;
     }
-    Logging::info(LOG_TAG, "createPresentationSurface()");
+    INTEL_VULKAN_LOG_INFO(LOG_TAG, "createPresentationSurface()");
     if (!createPresentationSurface()) {
         return false;
     }
-    Logging::info(LOG_TAG, "createDevice()");
+    INTEL_VULKAN_LOG_INFO(LOG_TAG, "createDevice()");
     if (!createDevice()) {
         return false;
     }
-    Logging::info(LOG_TAG, "loadDeviceLevelEntryPoints()");
+    INTEL_VULKAN_LOG_INFO(LOG_TAG, "loadDeviceLevelEntryPoints()");
     if (!loadDeviceLevelEntryPoints()) {
         return false;
     }
-    Logging::info(LOG_TAG, "getDeviceQueue()");
+    INTEL_VULKAN_LOG_INFO(LOG_TAG, "getDeviceQueue()");
     if (!getDeviceQueue()) {
         return false;
     }
-    Logging::info(LOG_TAG, "createSemaphores()");
+    INTEL_VULKAN_LOG_INFO(LOG_TAG, "createSemaphores()");
     if (!createSemaphores()) {
         return false;
     }
@@ -313,8 +313,8 @@ bool Tutorial02::createSwapChain() {
                 m_vulkan_tutorial02_parameters.getVkPhysicalDevice(),
                 m_vulkan_tutorial02_parameters.getPresentVkSurfaceKHR(),
                 &surface_capabilities) != VK_SUCCESS) {
-        Logging::error(LOG_TAG,
-                       "Could not check presentation surface capabilities!");
+        INTEL_VULKAN_LOG_ERROR(
+                LOG_TAG, "Could not check presentation surface capabilities!");
         return false;
     }
 
@@ -325,9 +325,10 @@ bool Tutorial02::createSwapChain() {
                  &formats_count,
                  nullptr) != VK_SUCCESS) ||
         (formats_count == 0)) {
-        Logging::error(LOG_TAG,
-                       "Error occurred during presentation surface formats "
-                       "enumeration!");
+        INTEL_VULKAN_LOG_ERROR(
+                LOG_TAG,
+                "Error occurred during presentation surface formats "
+                "enumeration!");
         return false;
     }
 
@@ -337,9 +338,10 @@ bool Tutorial02::createSwapChain() {
                 m_vulkan_tutorial02_parameters.getPresentVkSurfaceKHR(),
                 &formats_count,
                 surface_formats.data()) != VK_SUCCESS) {
-        Logging::error(LOG_TAG,
-                       "Error occurred during presentation surface formats "
-                       "enumeration!");
+        INTEL_VULKAN_LOG_ERROR(
+                LOG_TAG,
+                "Error occurred during presentation surface formats "
+                "enumeration!");
         return false;
     }
 
@@ -350,7 +352,7 @@ bool Tutorial02::createSwapChain() {
                  &present_modes_count,
                  nullptr) != VK_SUCCESS) ||
         (present_modes_count == 0)) {
-        Logging::error(
+        INTEL_VULKAN_LOG_ERROR(
                 LOG_TAG,
                 "Error occurred during presentation surface present modes "
                 "enumeration!");
@@ -363,7 +365,7 @@ bool Tutorial02::createSwapChain() {
                 m_vulkan_tutorial02_parameters.getPresentVkSurfaceKHR(),
                 &present_modes_count,
                 present_modes.data()) != VK_SUCCESS) {
-        Logging::error(
+        INTEL_VULKAN_LOG_ERROR(
                 LOG_TAG,
                 "Error occurred during presentation surface present modes "
                 "enumeration!");
@@ -423,7 +425,7 @@ bool Tutorial02::createSwapChain() {
                 nullptr,
                 &m_vulkan_tutorial02_parameters.getVkSwapchainKHR()) !=
         VK_SUCCESS) {
-        Logging::error(LOG_TAG, "Could not create swap chain!");
+        INTEL_VULKAN_LOG_ERROR(LOG_TAG, "Could not create swap chain!");
         return false;
     }
     if (old_swap_chain != VK_NULL_HANDLE) {
@@ -463,7 +465,7 @@ bool Tutorial02::createCommandBuffers() {
                             &m_vulkan_tutorial02_parameters
                                      .getPresentQueueVkCommandPool()) !=
         VK_SUCCESS) {
-        Logging::error(LOG_TAG, "Could not create a command pool!");
+        INTEL_VULKAN_LOG_ERROR(LOG_TAG, "Could not create a command pool!");
         return false;
     }
 
@@ -474,8 +476,8 @@ bool Tutorial02::createCommandBuffers() {
                  &image_count,
                  nullptr) != VK_SUCCESS) ||
         (image_count == 0)) {
-        Logging::error(LOG_TAG,
-                       "Could not get the number of swap chain images!");
+        INTEL_VULKAN_LOG_ERROR(
+                LOG_TAG, "Could not get the number of swap chain images!");
         return false;
     }
 
@@ -494,12 +496,12 @@ bool Tutorial02::createCommandBuffers() {
                                  m_vulkan_tutorial02_parameters
                                          .getPresentQueueVkCommandBuffers()
                                          .data()) != VK_SUCCESS) {
-        Logging::error(LOG_TAG, "Could not allocate command buffers!");
+        INTEL_VULKAN_LOG_ERROR(LOG_TAG, "Could not allocate command buffers!");
         return false;
     }
 
     if (!recordCommandBuffers()) {
-        Logging::error(LOG_TAG, "Could not record command buffers!");
+        INTEL_VULKAN_LOG_ERROR(LOG_TAG, "Could not record command buffers!");
         return false;
     }
     return true;
@@ -521,7 +523,7 @@ bool Tutorial02::draw() {
         case VK_ERROR_OUT_OF_DATE_KHR:
             return onWindowSizeChanged();
         default:
-            Logging::error(
+            INTEL_VULKAN_LOG_ERROR(
                     LOG_TAG,
                     "Problem occurred during swap chain image acquisition!");
             return false;
@@ -570,8 +572,8 @@ bool Tutorial02::draw() {
         case VK_SUBOPTIMAL_KHR:
             return onWindowSizeChanged();
         default:
-            Logging::error(LOG_TAG,
-                           "Problem occurred during image presentation!");
+            INTEL_VULKAN_LOG_ERROR(
+                    LOG_TAG, "Problem occurred during image presentation!");
             return false;
     }
 
@@ -582,7 +584,7 @@ bool Tutorial02::loadVulkanLibrary() {
     m_vulkan_library = dlopen("libvulkan.so.1", RTLD_NOW);
 
     if (m_vulkan_library == nullptr) {
-        Logging::error(LOG_TAG, "Could not load Vulkan library!");
+        INTEL_VULKAN_LOG_ERROR(LOG_TAG, "Could not load Vulkan library!");
         return false;
     }
     return true;
@@ -593,7 +595,7 @@ bool Tutorial02::loadExportedEntryPoints() {
 
 #define VK_EXPORTED_FUNCTION(fun)                                         \
     if (!(fun = (PFN_##fun)LoadProcAddress(m_vulkan_library, #fun))) {    \
-        Logging::error(                                                   \
+        INTEL_VULKAN_LOG_ERROR(                                           \
                 LOG_TAG, "Could not load exported function:", #fun, "!"); \
         return false;                                                     \
     }
@@ -604,13 +606,13 @@ bool Tutorial02::loadExportedEntryPoints() {
 }
 
 bool Tutorial02::loadGlobalLevelEntryPoints() {
-#define VK_GLOBAL_LEVEL_FUNCTION(fun)                               \
-    if (!(fun = (PFN_##fun)vkGetInstanceProcAddr(nullptr, #fun))) { \
-        Logging::error(LOG_TAG,                                     \
-                       "Could not load global level function: ",    \
-                       #fun,                                        \
-                       "!");                                        \
-        return false;                                               \
+#define VK_GLOBAL_LEVEL_FUNCTION(fun)                                    \
+    if (!(fun = (PFN_##fun)vkGetInstanceProcAddr(nullptr, #fun))) {      \
+        INTEL_VULKAN_LOG_ERROR(LOG_TAG,                                  \
+                               "Could not load global level function: ", \
+                               #fun,                                     \
+                               "!");                                     \
+        return false;                                                    \
     }
 
 #include "intel_vulkan/ListOfFunctions.inl"
@@ -620,16 +622,17 @@ bool Tutorial02::loadGlobalLevelEntryPoints() {
 
 bool Tutorial02::createInstance() {
     if (!checkValidationLayerSupport()) {
-        Logging::error(LOG_TAG,
-                       "Failed to create an instance that does not support",
-                       "validation layers.");
+        INTEL_VULKAN_LOG_ERROR(
+                LOG_TAG,
+                "Failed to create an instance that does not support",
+                "validation layers.");
     }
 
     uint32_t extensions_count = 0;
     if ((vkEnumerateInstanceExtensionProperties(
                  nullptr, &extensions_count, nullptr) != VK_SUCCESS) ||
         (extensions_count == 0)) {
-        Logging::error(
+        INTEL_VULKAN_LOG_ERROR(
                 LOG_TAG,
                 "Error occurred during instance extensions enumeration!");
         return false;
@@ -639,7 +642,7 @@ bool Tutorial02::createInstance() {
     if (vkEnumerateInstanceExtensionProperties(
                 nullptr, &extensions_count, available_extensions.data()) !=
         VK_SUCCESS) {
-        Logging::error(
+        INTEL_VULKAN_LOG_ERROR(
                 LOG_TAG,
                 "Error occurred during instance extensions enumeration!");
         return false;
@@ -650,10 +653,11 @@ bool Tutorial02::createInstance() {
 
     for (size_t i = 0; i < extensions.size(); ++i) {
         if (!checkExtensionAvailability(extensions[i], available_extensions)) {
-            Logging::error(LOG_TAG,
-                           "Could not find instance extension named \"",
-                           extensions[i],
-                           "\"!");
+            INTEL_VULKAN_LOG_ERROR(
+                    LOG_TAG,
+                    "Could not find instance extension named \"",
+                    extensions[i],
+                    "\"!");
             return false;
         }
     }
@@ -684,12 +688,12 @@ bool Tutorial02::createInstance() {
                          nullptr,
                          &m_vulkan_tutorial02_parameters.getVkInstance()) !=
         VK_SUCCESS) {
-        Logging::error(LOG_TAG, "Could not create Vulkan instance!");
+        INTEL_VULKAN_LOG_ERROR(LOG_TAG, "Could not create Vulkan instance!");
         return false;
     }
 
     if (!setupDebugMessenger()) {
-        Logging::error(LOG_TAG, "Failed to setup debug messenger!!!");
+        INTEL_VULKAN_LOG_ERROR(LOG_TAG, "Failed to setup debug messenger!!!");
     }
     return true;
 }
@@ -698,10 +702,10 @@ bool Tutorial02::loadInstanceLevelEntryPoints() {
 #define VK_INSTANCE_LEVEL_FUNCTION(fun)                                     \
     if (!(fun = (PFN_##fun)vkGetInstanceProcAddr(                           \
                   m_vulkan_tutorial02_parameters.getVkInstance(), #fun))) { \
-        Logging::error(LOG_TAG,                                             \
-                       "Could not load instance level function:",           \
-                       #fun,                                                \
-                       "!");                                                \
+        INTEL_VULKAN_LOG_ERROR(LOG_TAG,                                     \
+                               "Could not load instance level function:",   \
+                               #fun,                                        \
+                               "!");                                        \
         return false;                                                       \
     }
 
@@ -726,7 +730,7 @@ bool Tutorial02::createPresentationSurface() {
         return true;
     }
 
-    Logging::error(LOG_TAG, "Could not create presentation surface!");
+    INTEL_VULKAN_LOG_ERROR(LOG_TAG, "Could not create presentation surface!");
     return false;
 }
 
@@ -737,8 +741,9 @@ bool Tutorial02::createDevice() {
                  &num_devices,
                  nullptr) != VK_SUCCESS) ||
         (num_devices == 0)) {
-        Logging::error(LOG_TAG,
-                       "Error occurred during physical devices enumeration!");
+        INTEL_VULKAN_LOG_ERROR(
+                LOG_TAG,
+                "Error occurred during physical devices enumeration!");
         return false;
     }
 
@@ -747,8 +752,9 @@ bool Tutorial02::createDevice() {
                 m_vulkan_tutorial02_parameters.getVkInstance(),
                 &num_devices,
                 physical_devices.data()) != VK_SUCCESS) {
-        Logging::error(LOG_TAG,
-                       "Error occurred during physical devices enumeration!");
+        INTEL_VULKAN_LOG_ERROR(
+                LOG_TAG,
+                "Error occurred during physical devices enumeration!");
         return false;
     }
 
@@ -767,9 +773,10 @@ bool Tutorial02::createDevice() {
     }
     if (m_vulkan_tutorial02_parameters.getVkPhysicalDevice() ==
         VK_NULL_HANDLE) {
-        Logging::error(LOG_TAG,
-                       "Could not select physical device based on the chosen "
-                       "properties!");
+        INTEL_VULKAN_LOG_ERROR(
+                LOG_TAG,
+                "Could not select physical device based on the chosen "
+                "properties!");
         return false;
     }
 
@@ -815,7 +822,7 @@ bool Tutorial02::createDevice() {
                        nullptr,
                        &m_vulkan_tutorial02_parameters.getVkDevice()) !=
         VK_SUCCESS) {
-        Logging::error(LOG_TAG, "Could not create Vulkan device!");
+        INTEL_VULKAN_LOG_ERROR(LOG_TAG, "Could not create Vulkan device!");
         return false;
     }
 
@@ -835,10 +842,10 @@ bool Tutorial02::checkPhysicalDeviceProperties(
                  physical_device, nullptr, &extensions_count, nullptr) !=
          VK_SUCCESS) ||
         (extensions_count == 0)) {
-        Logging::error(LOG_TAG,
-                       "Error occurred during physical device",
-                       physical_device,
-                       "extensions enumeration!");
+        INTEL_VULKAN_LOG_ERROR(LOG_TAG,
+                               "Error occurred during physical device",
+                               physical_device,
+                               "extensions enumeration!");
         return false;
     }
 
@@ -848,10 +855,10 @@ bool Tutorial02::checkPhysicalDeviceProperties(
                                              &extensions_count,
                                              available_extensions.data()) !=
         VK_SUCCESS) {
-        Logging::error(LOG_TAG,
-                       "Error occurred during physical device",
-                       physical_device,
-                       "extensions enumeration!");
+        INTEL_VULKAN_LOG_ERROR(LOG_TAG,
+                               "Error occurred during physical device",
+                               physical_device,
+                               "extensions enumeration!");
         return false;
     }
 
@@ -861,12 +868,12 @@ bool Tutorial02::checkPhysicalDeviceProperties(
     for (size_t i = 0; i < device_extensions.size(); ++i) {
         if (!checkExtensionAvailability(device_extensions[i],
                                         available_extensions)) {
-            Logging::error(LOG_TAG,
-                           "Physical device ",
-                           physical_device,
-                           " doesn't support extension named \"",
-                           device_extensions[i],
-                           "\"!");
+            INTEL_VULKAN_LOG_ERROR(LOG_TAG,
+                                   "Physical device ",
+                                   physical_device,
+                                   " doesn't support extension named \"",
+                                   device_extensions[i],
+                                   "\"!");
             return false;
         }
     }
@@ -881,10 +888,10 @@ bool Tutorial02::checkPhysicalDeviceProperties(
 
     if ((major_version < 1) ||
         (device_properties.limits.maxImageDimension2D < 4096)) {
-        Logging::error(LOG_TAG,
-                       "Physical device ",
-                       physical_device,
-                       " doesn't support required parameters!");
+        INTEL_VULKAN_LOG_ERROR(LOG_TAG,
+                               "Physical device ",
+                               physical_device,
+                               " doesn't support required parameters!");
         return false;
     }
 
@@ -892,10 +899,10 @@ bool Tutorial02::checkPhysicalDeviceProperties(
     vkGetPhysicalDeviceQueueFamilyProperties(
             physical_device, &queue_families_count, nullptr);
     if (queue_families_count == 0) {
-        Logging::error(LOG_TAG,
-                       "Physical device ",
-                       physical_device,
-                       " doesn't have any queue families!");
+        INTEL_VULKAN_LOG_ERROR(LOG_TAG,
+                               "Physical device ",
+                               physical_device,
+                               " doesn't have any queue families!");
         return false;
     }
 
@@ -947,7 +954,7 @@ bool Tutorial02::checkPhysicalDeviceProperties(
     // capabilities don't use it
     if ((graphics_queue_family_index == UINT32_MAX) ||
         (present_queue_family_index == UINT32_MAX)) {
-        Logging::error(
+        INTEL_VULKAN_LOG_ERROR(
                 LOG_TAG,
                 "Could not find queue family with required properties on "
                 "physical device ",
@@ -965,10 +972,10 @@ bool Tutorial02::loadDeviceLevelEntryPoints() {
 #define VK_DEVICE_LEVEL_FUNCTION(fun)                                     \
     if (!(fun = (PFN_##fun)vkGetDeviceProcAddr(                           \
                   m_vulkan_tutorial02_parameters.getVkDevice(), #fun))) { \
-        Logging::error(LOG_TAG,                                           \
-                       "Could not load device level function: ",          \
-                       #fun,                                              \
-                       "!");                                              \
+        INTEL_VULKAN_LOG_ERROR(LOG_TAG,                                   \
+                               "Could not load device level function: ",  \
+                               #fun,                                      \
+                               "!");                                      \
         return false;                                                     \
     }
 
@@ -1009,7 +1016,7 @@ bool Tutorial02::createSemaphores() {
                            &m_vulkan_tutorial02_parameters
                                     .getRenderingFinishedVkSemaphore()) !=
          VK_SUCCESS)) {
-        Logging::error(LOG_TAG, "Could not create semaphores!");
+        INTEL_VULKAN_LOG_ERROR(LOG_TAG, "Could not create semaphores!");
         return false;
     }
 
@@ -1027,7 +1034,7 @@ bool Tutorial02::recordCommandBuffers() {
                 m_vulkan_tutorial02_parameters.getVkSwapchainKHR(),
                 &image_count,
                 swap_chain_images.data()) != VK_SUCCESS) {
-        Logging::error(LOG_TAG, "Could not get swap chain images!");
+        INTEL_VULKAN_LOG_ERROR(LOG_TAG, "Could not get swap chain images!");
         return false;
     }
 
@@ -1109,7 +1116,8 @@ bool Tutorial02::recordCommandBuffers() {
                     m_vulkan_tutorial02_parameters
                             .getPresentQueueVkCommandBuffers()[i]) !=
             VK_SUCCESS) {
-            Logging::error(LOG_TAG, "Could not record command buffers!");
+            INTEL_VULKAN_LOG_ERROR(LOG_TAG,
+                                   "Could not record command buffers!");
             return false;
         }
     }
@@ -1163,8 +1171,9 @@ bool Tutorial02::checkValidationLayerSupport() const {
     std::vector<VkLayerProperties> vk_layer_properties(layer_count);
     vkEnumerateInstanceLayerProperties(&layer_count,
                                        vk_layer_properties.data());
-    Logging::info(LOG_TAG, "The vk_instance has the following properties:");
-    Logging::info(LOG_TAG, vk_layer_properties);
+    INTEL_VULKAN_LOG_INFO(LOG_TAG,
+                          "The vk_instance has the following properties:");
+    INTEL_VULKAN_LOG_INFO(LOG_TAG, vk_layer_properties);
 
     bool response = true;
     for (const char* layer_name : validation_layers) {
@@ -1176,11 +1185,11 @@ bool Tutorial02::checkValidationLayerSupport() const {
                            0;
                 });
         if (layer_it == vk_layer_properties.end()) {
-            Logging::error(LOG_TAG,
-                           "The following layer \"",
-                           layer_name,
-                           "\""
-                           "could not be loaded!!!");
+            INTEL_VULKAN_LOG_ERROR(LOG_TAG,
+                                   "The following layer \"",
+                                   layer_name,
+                                   "\""
+                                   "could not be loaded!!!");
             response = false;
             break;
         }
@@ -1202,9 +1211,10 @@ debugCallback(VkDebugUtilsMessageSeverityFlagBitsEXT message_severity,
         log_tag_created.store(true);
     }
 
-    Logging::error(debug_log_tag,
-                   "validation layer:",
-                   vk_debug_utils_messenger_callback_data_ext->pMessage);
+    INTEL_VULKAN_LOG_ERROR(
+            debug_log_tag,
+            "validation layer:",
+            vk_debug_utils_messenger_callback_data_ext->pMessage);
 
     return VK_FALSE;
 }
@@ -1214,7 +1224,7 @@ bool Tutorial02::setupDebugMessenger() {
     if (!m_enable_vulkan_debug.load()) {
         response = true;
     } else {
-        Logging::info(LOG_TAG, "Setting up Vulkan debugger...");
+        INTEL_VULKAN_LOG_INFO(LOG_TAG, "Setting up Vulkan debugger...");
         VkDebugUtilsMessengerCreateInfoEXT
                 vk_debug_utils_messenger_create_info_ext{};
         vk_debug_utils_messenger_create_info_ext.sType =
@@ -1361,7 +1371,7 @@ VkImageUsageFlags Tutorial02::getSwapChainUsageFlags(
         return VK_IMAGE_USAGE_COLOR_ATTACHMENT_BIT |
                VK_IMAGE_USAGE_TRANSFER_DST_BIT;
     }
-    Logging::error(
+    INTEL_VULKAN_LOG_ERROR(
             LOG_TAG,
             "VK_IMAGE_USAGE_TRANSFER_DST image usage is not supported by "
             "the swap chain!\n",
@@ -1434,8 +1444,8 @@ VkPresentModeKHR Tutorial02::getSwapChainPresentMode(
             return present_mode;
         }
     }
-    Logging::error(LOG_TAG,
-                   "FIFO present mode is not supported by the swap chain!");
+    INTEL_VULKAN_LOG_ERROR(
+            LOG_TAG, "FIFO present mode is not supported by the swap chain!");
     return static_cast<VkPresentModeKHR>(-1);
 }
 }  // namespace intel_vulkan
@@ -18,6 +18,7 @@
 
 #include <vulkan/vulkan_core.h>
 
+#include "intel_vulkan/AssetArchive.h"
 #include "intel_vulkan/VulkanFunctions.h"
 
 namespace intel_vulkan {
@@ -29,7 +30,8 @@ VulkanTutorial03Parameters::VulkanTutorial03Parameters()
         , m_image_available_vk_semaphore(VK_NULL_HANDLE)
         , m_rendering_finished_vk_semaphore(VK_NULL_HANDLE)
         , m_vk_command_pool(VK_NULL_HANDLE)
-        , m_vk_command_buffers({}) {}
+        , m_vk_command_buffers({})
+        , m_vk_fences({}) {}
 
 const VkRenderPass& VulkanTutorial03Parameters::getVkRenderPass() const {
     return m_vk_render_pass;
@@ -112,6 +114,17 @@ void VulkanTutorial03Parameters::setVkCommandBuffers(
     m_vk_command_buffers = vk_command_buffers;
 }
 
+const std::vector<VkFence>& VulkanTutorial03Parameters::getVkFences() const {
+    return m_vk_fences;
+}
+std::vector<VkFence>& VulkanTutorial03Parameters::getVkFences() {
+    return m_vk_fences;
+}
+void VulkanTutorial03Parameters::setVkFences(
+        const std::vector<VkFence>& vk_fences) {
+    m_vk_fences = vk_fences;
+}
+
 Tutorial03::Tutorial03() {}
 
 Tutorial03::~Tutorial03() {
@@ -183,7 +196,7 @@ bool Tutorial03::createRenderPass() {
                 nullptr,
                 &m_vulkan_tutorial03_parameters.getVkRenderPass()) !=
         VK_SUCCESS) {
-        Logging::error(LOG_TAG, "Could not create render pass!");
+        INTEL_VULKAN_LOG_ERROR(LOG_TAG, "Could not create render pass!");
         return false;
     }
 
@@ -214,7 +227,7 @@ bool Tutorial03::createFramebuffers() {
                     nullptr,
                     &m_vulkan_tutorial03_parameters.getVkFramebuffers()[i]) !=
             VK_SUCCESS) {
-            Logging::error(LOG_TAG, "Could not create a framebuffer!");
+            INTEL_VULKAN_LOG_ERROR(LOG_TAG, "Could not create a framebuffer!");
             return false;
         }
     }
@@ -370,7 +383,7 @@ bool Tutorial03::createPipeline() {
                 nullptr,
                 &m_vulkan_tutorial03_parameters.getVkPipeline()) !=
         VK_SUCCESS) {
-        Logging::error(LOG_TAG, "Could not create graphics pipeline!");
+        INTEL_VULKAN_LOG_ERROR(LOG_TAG, "Could not create graphics pipeline!");
         return false;
     }
     return true;
@@ -392,7 +405,7 @@ bool Tutorial03::createSemaphores() {
                            &m_vulkan_tutorial03_parameters
                                     .getRenderingFinishedVkSemaphore()) !=
          VK_SUCCESS)) {
-        Logging::error(LOG_TAG, "Could not create semaphores!");
+        INTEL_VULKAN_LOG_ERROR(LOG_TAG, "Could not create semaphores!");
         return false;
     }
 
@@ -403,7 +416,7 @@ bool Tutorial03::createCommandBuffers() {
     if (!createCommandPool(
                 getGraphicsQueueParameters().getFamilyIndex(),
                 &m_vulkan_tutorial03_parameters.getVkCommandPool())) {
-        Logging::error(LOG_TAG, "Could not create command pool!");
+        INTEL_VULKAN_LOG_ERROR(LOG_TAG, "Could not create command pool!");
         return false;
     }
 
@@ -416,9 +429,23 @@ bool Tutorial03::createCommandBuffers() {
                 m_vulkan_tutorial03_parameters.getVkCommandPool(),
                 image_count,
                 m_vulkan_tutorial03_parameters.getVkCommandBuffers().data())) {
-        Logging::error(LOG_TAG, "Could not allocate command buffers!");
+        INTEL_VULKAN_LOG_ERROR(LOG_TAG, "Could not allocate command buffers!");
         return false;
     }
+
+    // Signaled, so the first wait on each one returns at once.
+    VkFenceCreateInfo fence_create_info = {VK_STRUCTURE_TYPE_FENCE_CREATE_INFO,
+                                           nullptr,
+                                           VK_FENCE_CREATE_SIGNALED_BIT};
+    m_vulkan_tutorial03_parameters.setVkFences(
+            std::vector<VkFence>(image_count, VK_NULL_HANDLE));
+    for (VkFence& fence : m_vulkan_tutorial03_parameters.getVkFences()) {
+        if (vkCreateFence(getVkDevice(), &fence_create_info, nullptr, &fence) !=
+            VK_SUCCESS) {
+            INTEL_VULKAN_LOG_ERROR(LOG_TAG, "Could not create fences!");
+            return false;
+        }
+    }
     return true;
 }
 
@@ -526,7 +553,8 @@ bool Tutorial03::recordCommandBuffers() {
         if (vkEndCommandBuffer(
                     m_vulkan_tutorial03_parameters.getVkCommandBuffers()[i]) !=
             VK_SUCCESS) {
-            Logging::error(LOG_TAG, "Could not record command buffer!");
+            INTEL_VULKAN_LOG_ERROR(LOG_TAG,
+                                   "Could not record command buffer!");
             return false;
         }
     }
@@ -551,12 +579,25 @@ bool Tutorial03::draw() {
         case VK_ERROR_OUT_OF_DATE_KHR:
             return onWindowSizeChanged();
         default:
-            Logging::error(
+            INTEL_VULKAN_LOG_ERROR(
                     LOG_TAG,
                     "Problem occurred during swap chain image acquisition!");
             return false;
     }
 
+    // The image's previous frame has to finish before its fence can be
+    // reused. The deletion backend retires that frame before the reset, so
+    // it never waits on the fence while it is unsignaled.
+    VkFence fence = m_vulkan_tutorial03_parameters.getVkFences()[image_index];
+    if (vkWaitForFences(getVkDevice(), 1, &fence, VK_FALSE, UINT64_MAX) !=
+        VK_SUCCESS) {
+        INTEL_VULKAN_LOG_ERROR(LOG_TAG, "Could not wait for fence!");
+        return false;
+    }
+    m_deletion_backend->signaled(fence);
+    m_deferred_deleter->collect();
+    vkResetFences(getVkDevice(), 1, &fence);
+
     VkPipelineStageFlags wait_dst_stage_mask =
             VK_PIPELINE_STAGE_COLOR_ATTACHMENT_OUTPUT_BIT;
     VkSubmitInfo submit_info = {
@@ -573,9 +614,17 @@ bool Tutorial03::draw() {
     if (vkQueueSubmit(getGraphicsQueueParameters().getVkQueue(),
                       1,
                       &submit_info,
-                      VK_NULL_HANDLE) != VK_SUCCESS) {
+                      fence) != VK_SUCCESS) {
+        INTEL_VULKAN_LOG_ERROR(LOG_TAG, "Could not submit the command buffer!");
+        // An empty submission signals the fence again once the queue is
+        // idle, so the next frame on this image does not wait forever.
+        vkQueueSubmit(getGraphicsQueueParameters().getVkQueue(),
+                      0,
+                      nullptr,
+                      fence);
         return false;
     }
+    m_deletion_backend->submitted(++m_frame_value, fence);
 
     VkPresentInfoKHR present_info = {
             VK_STRUCTURE_TYPE_PRESENT_INFO_KHR,
@@ -596,8 +645,8 @@ bool Tutorial03::draw() {
         case VK_SUBOPTIMAL_KHR:
             return onWindowSizeChanged();
         default:
-            Logging::error(LOG_TAG,
-                           "Problem occurred during image presentation!");
+            INTEL_VULKAN_LOG_ERROR(
+                    LOG_TAG, "Problem occurred during image presentation!");
             return false;
     }
 
@@ -606,8 +655,11 @@ bool Tutorial03::draw() {
 
 Tools::AutoDeleter<VkShaderModule, PFN_vkDestroyShaderModule>
 Tutorial03::createShaderModule(const char* filename) {
-    const std::vector<char> code = Tools::getBinaryFileContents(filename);
-    if (code.size() == 0) {
+    // Archive payloads and mappings are page aligned, which satisfies
+    // pCode's 4 byte alignment.
+    const Tools::Asset code =
+            Tools::loadAsset(filename, Tools::MappedFile::Access::WILL_NEED);
+    if (code.empty()) {
         return Tools::AutoDeleter<VkShaderModule, PFN_vkDestroyShaderModule>();
     }
 
@@ -615,18 +667,18 @@ Tutorial03::createShaderModule(const char* filename) {
             VK_STRUCTURE_TYPE_SHADER_MODULE_CREATE_INFO,
             nullptr,
             0,
-            code.size(),
-            reinterpret_cast<const uint32_t*>(code.data())};
+            code.contents.size(),
+            reinterpret_cast<const uint32_t*>(code.contents.data())};
 
     VkShaderModule shader_module;
     if (vkCreateShaderModule(getVkDevice(),
                              &shader_module_create_info,
                              nullptr,
                              &shader_module) != VK_SUCCESS) {
-        Logging::error(LOG_TAG,
-                       "Could not create shader module from a \"",
-                       filename,
-                       "\" file!");
+        INTEL_VULKAN_LOG_ERROR(LOG_TAG,
+                               "Could not create shader module from a \"",
+                               filename,
+                               "\" file!");
         return Tools::AutoDeleter<VkShaderModule, PFN_vkDestroyShaderModule>();
     }
 
@@ -650,7 +702,7 @@ Tutorial03::createPipelineLayout() {
                                &layout_create_info,
                                nullptr,
                                &pipeline_layout) != VK_SUCCESS) {
-        Logging::error(LOG_TAG, "Could not create pipeline layout!");
+        INTEL_VULKAN_LOG_ERROR(LOG_TAG, "Could not create pipeline layout!");
         return Tools::AutoDeleter<VkPipelineLayout,
                                   PFN_vkDestroyPipelineLayout>();
     }
@@ -694,61 +746,56 @@ bool Tutorial03::allocateCommandBuffers(VkCommandPool pool,
 }
 
 void Tutorial03::childClear() {
-    if (getVkDevice() != VK_NULL_HANDLE) {
-        vkDeviceWaitIdle(getVkDevice());
-
-        if ((m_vulkan_tutorial03_parameters.getVkCommandBuffers().size() >
-             0) &&
-            (m_vulkan_tutorial03_parameters.getVkCommandBuffers()[0] !=
-             VK_NULL_HANDLE)) {
-            vkFreeCommandBuffers(
-                    getVkDevice(),
-                    m_vulkan_tutorial03_parameters.getVkCommandPool(),
-                    static_cast<uint32_t>(m_vulkan_tutorial03_parameters
-                                                  .getVkCommandBuffers()
-                                                  .size()),
-                    m_vulkan_tutorial03_parameters.getVkCommandBuffers()
-                            .data());
-            m_vulkan_tutorial03_parameters.getVkCommandBuffers().clear();
+    if ((getVkDevice() != VK_NULL_HANDLE) && (m_deferred_deleter != nullptr)) {
+        // The last submitted frame may still use all of these, so they are
+        // destroyed once it is done instead of after a device idle.
+        VkDevice device = getVkDevice();
+        VkCommandPool command_pool =
+                m_vulkan_tutorial03_parameters.getVkCommandPool();
+        std::vector<VkCommandBuffer> command_buffers =
+                m_vulkan_tutorial03_parameters.getVkCommandBuffers();
+        if ((command_buffers.size() > 0) &&
+            (command_buffers[0] != VK_NULL_HANDLE)) {
+            m_deferred_deleter->defer(
+                    m_frame_value,
+                    [device, command_pool, command_buffers]() {
+                        vkFreeCommandBuffers(
+                                device,
+                                command_pool,
+                                static_cast<uint32_t>(command_buffers.size()),
+                                command_buffers.data());
+                    });
         }
+        m_vulkan_tutorial03_parameters.getVkCommandBuffers().clear();
 
-        if (m_vulkan_tutorial03_parameters.getVkCommandPool() !=
-            VK_NULL_HANDLE) {
-            vkDestroyCommandPool(
-                    getVkDevice(),
-                    m_vulkan_tutorial03_parameters.getVkCommandPool(),
-                    nullptr);
-            m_vulkan_tutorial03_parameters.getVkCommandPool() = VK_NULL_HANDLE;
-        }
+        m_deferred_deleter->defer(
+                m_frame_value, command_pool, vkDestroyCommandPool, device);
+        m_vulkan_tutorial03_parameters.getVkCommandPool() = VK_NULL_HANDLE;
 
-        if (m_vulkan_tutorial03_parameters.getVkPipeline() != VK_NULL_HANDLE) {
-            vkDestroyPipeline(getVkDevice(),
-                              m_vulkan_tutorial03_parameters.getVkPipeline(),
-                              nullptr);
-            m_vulkan_tutorial03_parameters.getVkPipeline() = VK_NULL_HANDLE;
+        for (VkFence fence : m_vulkan_tutorial03_parameters.getVkFences()) {
+            m_deferred_deleter->defer(
+                    m_frame_value, fence, vkDestroyFence, device);
         }
+        m_vulkan_tutorial03_parameters.getVkFences().clear();
 
-        if (m_vulkan_tutorial03_parameters.getVkRenderPass() !=
-            VK_NULL_HANDLE) {
-            vkDestroyRenderPass(
-                    getVkDevice(),
-                    m_vulkan_tutorial03_parameters.getVkRenderPass(),
-                    nullptr);
-            m_vulkan_tutorial03_parameters.getVkRenderPass() = VK_NULL_HANDLE;
-        }
+        m_deferred_deleter->defer(
+                m_frame_value,
+                m_vulkan_tutorial03_parameters.getVkPipeline(),
+                vkDestroyPipeline,
+                device);
+        m_vulkan_tutorial03_parameters.getVkPipeline() = VK_NULL_HANDLE;
 
-        for (size_t i = 0;
-             i < m_vulkan_tutorial03_parameters.getVkFramebuffers().size();
-             ++i) {
-            if (m_vulkan_tutorial03_parameters.getVkFramebuffers()[i] !=
-                VK_NULL_HANDLE) {
-                vkDestroyFramebuffer(
-                        getVkDevice(),
-                        m_vulkan_tutorial03_parameters.getVkFramebuffers()[i],
-                        nullptr);
-                m_vulkan_tutorial03_parameters.getVkFramebuffers()[i] =
-                        VK_NULL_HANDLE;
-            }
+        m_deferred_deleter->defer(
+                m_frame_value,
+                m_vulkan_tutorial03_parameters.getVkRenderPass(),
+                vkDestroyRenderPass,
+                device);
+        m_vulkan_tutorial03_parameters.getVkRenderPass() = VK_NULL_HANDLE;
+
+        for (VkFramebuffer framebuffer :
+             m_vulkan_tutorial03_parameters.getVkFramebuffers()) {
+            m_deferred_deleter->defer(
+                    m_frame_value, framebuffer, vkDestroyFramebuffer, device);
         }
         m_vulkan_tutorial03_parameters.getVkFramebuffers().clear();
     }
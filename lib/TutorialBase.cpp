@@ -18,6 +18,7 @@
 #include <vulkan/vulkan_core.h>
 
 #include <cstdint>
+#include <memory>
 
 #include "intel_vulkan/VulkanFunctions.h"
 
@@ -309,16 +310,23 @@ TutorialBase::TutorialBase()
         , m_vulkan_library_handle()
         , m_window_parameters()
         , m_vulkan_common_parameters()
-        , m_enable_vk_debug(true) {}
+        , m_enable_vk_debug(true)
+        , m_validation_message_filter()
+        , m_deletion_backend()
+        , m_deferred_deleter()
+        , m_frame_value(0)
+        , m_memory_allocator() {}
 
 TutorialBase::~TutorialBase() {
     if (m_vulkan_common_parameters.getVkDevice() != VK_NULL_HANDLE) {
         vkDeviceWaitIdle(m_vulkan_common_parameters.getVkDevice());
+        m_deferred_deleter.reset();
+        m_memory_allocator.reset();
 
         if (m_vulkan_common_parameters.getVkDebugUtilsMessenger() !=
             VK_NULL_HANDLE) {
             if (!destroyDebugMessenger()) {
-                Logging::error(
+                INTEL_VULKAN_LOG_ERROR(
                         LOG_TAG,
                         "Failed to destroy VkDebugUtilsMessengerExt!!!");
             }
@@ -370,43 +378,58 @@ TutorialBase::~TutorialBase() {
 bool TutorialBase::prepareVulkan(os::WindowParameters parameters) {
     m_window_parameters = parameters;
 
-    Logging::info(LOG_TAG, "loadVulkanLibrary()");
+    INTEL_VULKAN_LOG_INFO(LOG_TAG, "loadVulkanLibrary()");
     if (!loadVulkanLibrary()) {
         return false;
     }
-    Logging::info(LOG_TAG, "loadExportedEntryPoints()");
+    INTEL_VULKAN_LOG_INFO(LOG_TAG, "loadExportedEntryPoints()");
     if (!loadExportedEntryPoints()) {
         return false;
     }
-    Logging::info(LOG_TAG, "loadGlobalLevelEntryPoints()");
+    INTEL_VULKAN_LOG_INFO(LOG_TAG, "loadGlobalLevelEntryPoints()");
     if (!loadGlobalLevelEntryPoints()) {
         return false;
     }
-    Logging::info(LOG_TAG, "createInstance()");
+    INTEL_VULKAN_LOG_INFO(LOG_TAG, "createInstance()");
     if (!createInstance()) {
         return false;
     }
-    Logging::info(LOG_TAG, "loadInstanceLevelEntryPoints()");
+    INTEL_VULKAN_LOG_INFO(LOG_TAG, "loadInstanceLevelEntryPoints()");
     if (!loadInstanceLevelEntryPoints()) {
         return false;
     }
-    Logging::info(LOG_TAG, "createPresentationSurface()");
+    INTEL_VULKAN_LOG_INFO(LOG_TAG, "createPresentationSurface()");
     if (!createPresentationSurface()) {
         return false;
     }
-    Logging::info(LOG_TAG, "createDevice()");
+    INTEL_VULKAN_LOG_INFO(LOG_TAG, "createDevice()");
     if (!createDevice()) {
         return false;
     }
-    Logging::info(LOG_TAG, "loadDeviceLevelEntryPoints()");
+    INTEL_VULKAN_LOG_INFO(LOG_TAG, "loadDeviceLevelEntryPoints()");
     if (!loadDeviceLevelEntryPoints()) {
         return false;
     }
-    Logging::info(LOG_TAG, "getDeviceQueue()");
+    INTEL_VULKAN_LOG_INFO(LOG_TAG, "getDeviceQueue()");
     if (!getDeviceQueue()) {
         return false;
     }
-    Logging::info(LOG_TAG, "createSwapChain()");
+    m_deletion_backend = std::make_unique<Tools::FenceDeletionBackend>(
+            getVkDevice(), vkGetFenceStatus, vkWaitForFences);
+    m_deferred_deleter =
+            std::make_unique<Tools::DeferredDeleter>(*m_deletion_backend);
+    VkPhysicalDeviceMemoryProperties memory_properties;
+    vkGetPhysicalDeviceMemoryProperties(getVkPhysicalDevice(),
+                                        &memory_properties);
+    VkPhysicalDeviceProperties device_properties;
+    vkGetPhysicalDeviceProperties(getVkPhysicalDevice(), &device_properties);
+    m_memory_allocator = std::make_unique<Tools::DeviceMemoryAllocator>(
+            getVkDevice(),
+            memory_properties,
+            device_properties.limits,
+            Tools::DeviceMemoryAllocator::Functions{
+                    vkAllocateMemory, vkFreeMemory, vkMapMemory});
+    INTEL_VULKAN_LOG_INFO(LOG_TAG, "createSwapChain()");
     if (!createSwapChain()) {
         return false;
     }
@@ -414,10 +437,9 @@ bool TutorialBase::prepareVulkan(os::WindowParameters parameters) {
 }
 
 bool TutorialBase::onWindowSizeChanged() {
-    if (m_vulkan_common_parameters.getVkDevice() != VK_NULL_HANDLE) {
-        vkDeviceWaitIdle(m_vulkan_common_parameters.getVkDevice());
-    }
-
+    // The child's objects are destroyed by m_deferred_deleter once the
+    // frames using them are done; createSwapChain waits for the device
+    // itself before retiring the swap chain.
     childClear();
 
     if (createSwapChain()) {
@@ -462,7 +484,7 @@ bool TutorialBase::loadVulkanLibrary() {
     m_vulkan_library_handle = dlopen("libvulkan.so.1", RTLD_NOW);
 
     if (m_vulkan_library_handle == nullptr) {
-        Logging::error(LOG_TAG, "Could not load Vulkan library!");
+        INTEL_VULKAN_LOG_ERROR(LOG_TAG, "Could not load Vulkan library!");
         return false;
     }
     return true;
@@ -473,7 +495,7 @@ bool TutorialBase::loadExportedEntryPoints() {
 
 #define VK_EXPORTED_FUNCTION(fun)                                             \
     if (!(fun = (PFN_##fun)LoadProcAddress(m_vulkan_library_handle, #fun))) { \
-        Logging::error(                                                       \
+        INTEL_VULKAN_LOG_ERROR(                                               \
                 LOG_TAG, "Could not load exported function:", #fun, "!");     \
         return false;                                                         \
     }
@@ -484,13 +506,13 @@ bool TutorialBase::loadExportedEntryPoints() {
 }
 
 bool TutorialBase::loadGlobalLevelEntryPoints() {
-#define VK_GLOBAL_LEVEL_FUNCTION(fun)                               \
-    if (!(fun = (PFN_##fun)vkGetInstanceProcAddr(nullptr, #fun))) { \
-        Logging::error(LOG_TAG,                                     \
-                       "Could not load global level function: ",    \
-                       #fun,                                        \
-                       "!");                                        \
-        return false;                                               \
+#define VK_GLOBAL_LEVEL_FUNCTION(fun)                                    \
+    if (!(fun = (PFN_##fun)vkGetInstanceProcAddr(nullptr, #fun))) {      \
+        INTEL_VULKAN_LOG_ERROR(LOG_TAG,                                  \
+                               "Could not load global level function: ", \
+                               #fun,                                     \
+                               "!");                                     \
+        return false;                                                    \
     }
 
 #include "intel_vulkan/ListOfFunctions.inl"
@@ -500,16 +522,17 @@ bool TutorialBase::loadGlobalLevelEntryPoints() {
 
 bool TutorialBase::createInstance() {
     if (!checkValidationLayerSupport()) {
-        Logging::error(LOG_TAG,
-                       "Failed to create an instance that does not support",
-                       "validation layers.");
+        INTEL_VULKAN_LOG_ERROR(
+                LOG_TAG,
+                "Failed to create an instance that does not support",
+                "validation layers.");
     }
 
     uint32_t extensions_count = 0;
     if ((vkEnumerateInstanceExtensionProperties(
                  nullptr, &extensions_count, nullptr) != VK_SUCCESS) ||
         (extensions_count == 0)) {
-        Logging::error(
+        INTEL_VULKAN_LOG_ERROR(
                 LOG_TAG,
                 "Error occurred during instance extensions enumeration!");
         return false;
@@ -519,7 +542,7 @@ bool TutorialBase::createInstance() {
     if (vkEnumerateInstanceExtensionProperties(
                 nullptr, &extensions_count, available_extensions.data()) !=
         VK_SUCCESS) {
-        Logging::error(
+        INTEL_VULKAN_LOG_ERROR(
                 LOG_TAG,
                 "Error occurred during instance extensions enumeration!");
         return false;
@@ -529,19 +552,20 @@ bool TutorialBase::createInstance() {
                                            VK_KHR_XLIB_SURFACE_EXTENSION_NAME};
 
     if (m_enable_vk_debug.load()) {
-        Logging::info(LOG_TAG,
-                      "Adding the",
-                      VK_EXT_DEBUG_UTILS_EXTENSION_NAME,
-                      "extension...");
+        INTEL_VULKAN_LOG_INFO(LOG_TAG,
+                              "Adding the",
+                              VK_EXT_DEBUG_UTILS_EXTENSION_NAME,
+                              "extension...");
         extensions.push_back(VK_EXT_DEBUG_UTILS_EXTENSION_NAME);
     }
 
     for (size_t i = 0; i < extensions.size(); ++i) {
         if (!checkExtensionAvailability(extensions[i], available_extensions)) {
-            Logging::error(LOG_TAG,
-                           "Could not find instance extension named \"",
-                           extensions[i],
-                           "\"!");
+            INTEL_VULKAN_LOG_ERROR(
+                    LOG_TAG,
+                    "Could not find instance extension named \"",
+                    extensions[i],
+                    "\"!");
             return false;
         }
     }
@@ -569,26 +593,26 @@ bool TutorialBase::createInstance() {
                          nullptr,
                          &m_vulkan_common_parameters.getVkInstance()) !=
         VK_SUCCESS) {
-        Logging::error(LOG_TAG, "Could not create Vulkan instance!");
+        INTEL_VULKAN_LOG_ERROR(LOG_TAG, "Could not create Vulkan instance!");
         return false;
     }
 
     if (!setupDebugMessenger()) {
-        Logging::error(LOG_TAG, "Failed to setup debug messenger!!!");
+        INTEL_VULKAN_LOG_ERROR(LOG_TAG, "Failed to setup debug messenger!!!");
     }
 
     return true;
 }
 
 bool TutorialBase::loadInstanceLevelEntryPoints() {
-#define VK_INSTANCE_LEVEL_FUNCTION(fun)                                 \
-    if (!(fun = (PFN_##fun)vkGetInstanceProcAddr(                       \
-                  m_vulkan_common_parameters.getVkInstance(), #fun))) { \
-        Logging::error(LOG_TAG,                                         \
-                       "Could not load instance level function:",       \
-                       #fun,                                            \
-                       "!");                                            \
-        return false;                                                   \
+#define VK_INSTANCE_LEVEL_FUNCTION(fun)                                   \
+    if (!(fun = (PFN_##fun)vkGetInstanceProcAddr(                         \
+                  m_vulkan_common_parameters.getVkInstance(), #fun))) {   \
+        INTEL_VULKAN_LOG_ERROR(LOG_TAG,                                   \
+                               "Could not load instance level function:", \
+                               #fun,                                      \
+                               "!");                                      \
+        return false;                                                     \
     }
 
 #include "intel_vulkan/ListOfFunctions.inl"
@@ -611,7 +635,7 @@ bool TutorialBase::createPresentationSurface() {
         return true;
     }
 
-    Logging::error(LOG_TAG, "Could not create presentation surface!");
+    INTEL_VULKAN_LOG_ERROR(LOG_TAG, "Could not create presentation surface!");
     return false;
 }
 
@@ -621,8 +645,9 @@ bool TutorialBase::createDevice() {
                                     &num_devices,
                                     nullptr) != VK_SUCCESS) ||
         (num_devices == 0)) {
-        Logging::error(LOG_TAG,
-                       "Error occurred during physical devices enumeration!");
+        INTEL_VULKAN_LOG_ERROR(
+                LOG_TAG,
+                "Error occurred during physical devices enumeration!");
         return false;
     }
 
@@ -630,8 +655,9 @@ bool TutorialBase::createDevice() {
     if (vkEnumeratePhysicalDevices(m_vulkan_common_parameters.getVkInstance(),
                                    &num_devices,
                                    physical_devices.data()) != VK_SUCCESS) {
-        Logging::error(LOG_TAG,
-                       "Error occurred during physical devices enumeration!");
+        INTEL_VULKAN_LOG_ERROR(
+                LOG_TAG,
+                "Error occurred during physical devices enumeration!");
         return false;
     }
 
@@ -649,9 +675,10 @@ bool TutorialBase::createDevice() {
         }
     }
     if (m_vulkan_common_parameters.getVkPhysicalDevice() == VK_NULL_HANDLE) {
-        Logging::error(LOG_TAG,
-                       "Could not select physical device based on the chosen "
-                       "properties!");
+        INTEL_VULKAN_LOG_ERROR(
+                LOG_TAG,
+                "Could not select physical device based on the chosen "
+                "properties!");
         return false;
     }
 
@@ -697,7 +724,7 @@ bool TutorialBase::createDevice() {
                        nullptr,
                        &m_vulkan_common_parameters.getVkDevice()) !=
         VK_SUCCESS) {
-        Logging::error(LOG_TAG, "Could not create Vulkan device!");
+        INTEL_VULKAN_LOG_ERROR(LOG_TAG, "Could not create Vulkan device!");
         return false;
     }
 
@@ -717,10 +744,10 @@ bool TutorialBase::checkPhysicalDeviceProperties(
                  physical_device, nullptr, &extensions_count, nullptr) !=
          VK_SUCCESS) ||
         (extensions_count == 0)) {
-        Logging::error(LOG_TAG,
-                       "Error occurred during physical device",
-                       physical_device,
-                       "extensions enumeration!");
+        INTEL_VULKAN_LOG_ERROR(LOG_TAG,
+                               "Error occurred during physical device",
+                               physical_device,
+                               "extensions enumeration!");
         return false;
     }
 
@@ -730,10 +757,10 @@ bool TutorialBase::checkPhysicalDeviceProperties(
                                              &extensions_count,
                                              available_extensions.data()) !=
         VK_SUCCESS) {
-        Logging::error(LOG_TAG,
-                       "Error occurred during physical device",
-                       physical_device,
-                       "extensions enumeration!");
+        INTEL_VULKAN_LOG_ERROR(LOG_TAG,
+                               "Error occurred during physical device",
+                               physical_device,
+                               "extensions enumeration!");
         return false;
     }
 
@@ -743,12 +770,12 @@ bool TutorialBase::checkPhysicalDeviceProperties(
     for (size_t i = 0; i < device_extensions.size(); ++i) {
         if (!checkExtensionAvailability(device_extensions[i],
                                         available_extensions)) {
-            Logging::error(LOG_TAG,
-                           "Physical device",
-                           physical_device,
-                           "doesn't support extension named \"",
-                           device_extensions[i],
-                           "\"!");
+            INTEL_VULKAN_LOG_ERROR(LOG_TAG,
+                                   "Physical device",
+                                   physical_device,
+                                   "doesn't support extension named \"",
+                                   device_extensions[i],
+                                   "\"!");
             return false;
         }
     }
@@ -763,10 +790,10 @@ bool TutorialBase::checkPhysicalDeviceProperties(
 
     if ((major_version < 1) ||
         (device_properties.limits.maxImageDimension2D < 4096)) {
-        Logging::error(LOG_TAG,
-                       "Physical device",
-                       physical_device,
-                       "doesn't support required parameters!");
+        INTEL_VULKAN_LOG_ERROR(LOG_TAG,
+                               "Physical device",
+                               physical_device,
+                               "doesn't support required parameters!");
         return false;
     }
 
@@ -774,10 +801,10 @@ bool TutorialBase::checkPhysicalDeviceProperties(
     vkGetPhysicalDeviceQueueFamilyProperties(
             physical_device, &queue_families_count, nullptr);
     if (queue_families_count == 0) {
-        Logging::error(LOG_TAG,
-                       "Physical device",
-                       physical_device,
-                       "doesn't have any queue families!");
+        INTEL_VULKAN_LOG_ERROR(LOG_TAG,
+                               "Physical device",
+                               physical_device,
+                               "doesn't have any queue families!");
         return false;
     }
 
@@ -829,11 +856,11 @@ bool TutorialBase::checkPhysicalDeviceProperties(
     // capabilities don't use it
     if ((graphics_queue_family_index == UINT32_MAX) ||
         (present_queue_family_index == UINT32_MAX)) {
-        Logging::error(LOG_TAG,
-                       "Could not find queue families with required",
-                       "properties on physical device",
-                       physical_device,
-                       "!");
+        INTEL_VULKAN_LOG_ERROR(LOG_TAG,
+                               "Could not find queue families with required",
+                               "properties on physical device",
+                               physical_device,
+                               "!");
         return false;
     }
 
@@ -846,7 +873,7 @@ bool TutorialBase::loadDeviceLevelEntryPoints() {
 #define VK_DEVICE_LEVEL_FUNCTION(fun)                                         \
     if (!(fun = (PFN_##fun)vkGetDeviceProcAddr(                               \
                   m_vulkan_common_parameters.getVkDevice(), #fun))) {         \
-        Logging::error(                                                       \
+        INTEL_VULKAN_LOG_ERROR(                                               \
                 LOG_TAG, "Could not load device level function:", #fun, "!"); \
         return false;                                                         \
     }
@@ -875,6 +902,8 @@ bool TutorialBase::getDeviceQueue() {
 bool TutorialBase::createSwapChain() {
     m_can_render = false;
 
+    // Presents are not tracked by the frame fences, so nothing says when
+    // the old swap chain's images are done with short of an idle device.
     if (m_vulkan_common_parameters.getVkDevice() != VK_NULL_HANDLE) {
         vkDeviceWaitIdle(m_vulkan_common_parameters.getVkDevice());
     }
@@ -892,10 +921,10 @@ bool TutorialBase::createSwapChain() {
                             .getImageParameters()[i]
                             .getVkImageView(),
                     nullptr);
-            m_vulkan_common_parameters.getSwapchainParameters()
-                    .getImageParameters()[i]
-                    .setVkImageView(VK_NULL_HANDLE);
         }
+        m_vulkan_common_parameters.getSwapchainParameters()
+                .getImageParameters()[i]
+                .setVkImageView(VK_NULL_HANDLE);
     }
     m_vulkan_common_parameters.getSwapchainParameters()
             .getImageParameters()
@@ -906,8 +935,8 @@ bool TutorialBase::createSwapChain() {
                 m_vulkan_common_parameters.getVkPhysicalDevice(),
                 m_vulkan_common_parameters.getVkSurfaceKhr(),
                 &surface_capabilities) != VK_SUCCESS) {
-        Logging::error(LOG_TAG,
-                       "Could not check presentation surface capabilities!");
+        INTEL_VULKAN_LOG_ERROR(
+                LOG_TAG, "Could not check presentation surface capabilities!");
         return false;
     }
 
@@ -918,9 +947,10 @@ bool TutorialBase::createSwapChain() {
                  &formats_count,
                  nullptr) != VK_SUCCESS) ||
         (formats_count == 0)) {
-        Logging::error(LOG_TAG,
-                       "Error occurred during presentation surface formats",
-                       "enumeration!");
+        INTEL_VULKAN_LOG_ERROR(
+                LOG_TAG,
+                "Error occurred during presentation surface formats",
+                "enumeration!");
         return false;
     }
 
@@ -930,9 +960,10 @@ bool TutorialBase::createSwapChain() {
                 m_vulkan_common_parameters.getVkSurfaceKhr(),
                 &formats_count,
                 surface_formats.data()) != VK_SUCCESS) {
-        Logging::error(LOG_TAG,
-                       "Error occurred during presentation surface formats"
-                       "enumeration!");
+        INTEL_VULKAN_LOG_ERROR(
+                LOG_TAG,
+                "Error occurred during presentation surface formats"
+                "enumeration!");
         return false;
     }
 
@@ -943,7 +974,7 @@ bool TutorialBase::createSwapChain() {
                  &present_modes_count,
                  nullptr) != VK_SUCCESS) ||
         (present_modes_count == 0)) {
-        Logging::error(
+        INTEL_VULKAN_LOG_ERROR(
                 LOG_TAG,
                 "Error occurred during presentation surface present modes",
                 "enumeration!");
@@ -956,7 +987,7 @@ bool TutorialBase::createSwapChain() {
                 m_vulkan_common_parameters.getVkSurfaceKhr(),
                 &present_modes_count,
                 present_modes.data()) != VK_SUCCESS) {
-        Logging::error(
+        INTEL_VULKAN_LOG_ERROR(
                 LOG_TAG,
                 "Error occurred during presentation surface present modes",
                 "enumeration!");
@@ -1017,7 +1048,7 @@ bool TutorialBase::createSwapChain() {
                 nullptr,
                 &m_vulkan_common_parameters.getSwapchainParameters()
                          .getVkSwapchainKhr()) != VK_SUCCESS) {
-        Logging::error(LOG_TAG, "Could not create swap chain!");
+        INTEL_VULKAN_LOG_ERROR(LOG_TAG, "Could not create swap chain!");
         return false;
     }
     if (old_swap_chain != VK_NULL_HANDLE) {
@@ -1037,7 +1068,7 @@ bool TutorialBase::createSwapChain() {
                  &image_count,
                  nullptr) != VK_SUCCESS) ||
         (image_count == 0)) {
-        Logging::error(LOG_TAG, "Could not get swap chain images!");
+        INTEL_VULKAN_LOG_ERROR(LOG_TAG, "Could not get swap chain images!");
         return false;
     }
 
@@ -1052,7 +1083,7 @@ bool TutorialBase::createSwapChain() {
                         .getVkSwapchainKhr(),
                 &image_count,
                 images.data()) != VK_SUCCESS) {
-        Logging::error(LOG_TAG, "Could not get swap chain images!");
+        INTEL_VULKAN_LOG_ERROR(LOG_TAG, "Could not get swap chain images!");
         return false;
     }
 
@@ -1103,8 +1134,8 @@ bool TutorialBase::createSwapChainImageViews() {
                     &m_vulkan_common_parameters.getSwapchainParameters()
                              .getImageParameters()[i]
                              .getVkImageView()) != VK_SUCCESS) {
-            Logging::error(LOG_TAG,
-                           "Could not create image view for framebuffer!");
+            INTEL_VULKAN_LOG_ERROR(
+                    LOG_TAG, "Could not create image view for framebuffer!");
             return false;
         }
     }
@@ -1207,42 +1238,43 @@ VkImageUsageFlags TutorialBase::getSwapChainUsageFlags(
         VK_IMAGE_USAGE_COLOR_ATTACHMENT_BIT) {
         return VK_IMAGE_USAGE_COLOR_ATTACHMENT_BIT;
     }
-    Logging::error(LOG_TAG,
-                   "VK_IMAGE_USAGE_COLOR_ATTACHMENT_BIT image usage is not "
-                   "supported by the swap chain!\n",
-                   "Supported swap chain's image usages include:",
-                   (surface_capabilities.supportedUsageFlags &
-                                    VK_IMAGE_USAGE_TRANSFER_SRC_BIT
-                            ? "\tVK_IMAGE_USAGE_TRANSFER_SRC\n"
-                            : ""),
-                   (surface_capabilities.supportedUsageFlags &
-                                    VK_IMAGE_USAGE_TRANSFER_DST_BIT
-                            ? "\tVK_IMAGE_USAGE_TRANSFER_DST\n"
-                            : ""),
-                   (surface_capabilities.supportedUsageFlags &
-                                    VK_IMAGE_USAGE_SAMPLED_BIT
-                            ? "\tVK_IMAGE_USAGE_SAMPLED\n"
-                            : ""),
-                   (surface_capabilities.supportedUsageFlags &
-                                    VK_IMAGE_USAGE_STORAGE_BIT
-                            ? "\tVK_IMAGE_USAGE_STORAGE\n"
-                            : ""),
-                   (surface_capabilities.supportedUsageFlags &
-                                    VK_IMAGE_USAGE_COLOR_ATTACHMENT_BIT
-                            ? "\tVK_IMAGE_USAGE_COLOR_ATTACHMENT\n"
-                            : ""),
-                   (surface_capabilities.supportedUsageFlags &
-                                    VK_IMAGE_USAGE_DEPTH_STENCIL_ATTACHMENT_BIT
-                            ? "\tVK_IMAGE_USAGE_DEPTH_STENCIL_ATTACHMENT\n"
-                            : ""),
-                   (surface_capabilities.supportedUsageFlags &
-                                    VK_IMAGE_USAGE_TRANSIENT_ATTACHMENT_BIT
-                            ? "\tVK_IMAGE_USAGE_TRANSIENT_ATTACHMENT\n"
-                            : ""),
-                   (surface_capabilities.supportedUsageFlags &
-                                    VK_IMAGE_USAGE_INPUT_ATTACHMENT_BIT
-                            ? "\tVK_IMAGE_USAGE_INPUT_ATTACHMENT"
-                            : ""));
+    INTEL_VULKAN_LOG_ERROR(
+            LOG_TAG,
+            "VK_IMAGE_USAGE_COLOR_ATTACHMENT_BIT image usage is not "
+            "supported by the swap chain!\n",
+            "Supported swap chain's image usages include:",
+            (surface_capabilities.supportedUsageFlags &
+            VK_IMAGE_USAGE_TRANSFER_SRC_BIT
+            ? "\tVK_IMAGE_USAGE_TRANSFER_SRC\n"
+            : ""),
+            (surface_capabilities.supportedUsageFlags &
+            VK_IMAGE_USAGE_TRANSFER_DST_BIT
+            ? "\tVK_IMAGE_USAGE_TRANSFER_DST\n"
+            : ""),
+            (surface_capabilities.supportedUsageFlags &
+            VK_IMAGE_USAGE_SAMPLED_BIT
+            ? "\tVK_IMAGE_USAGE_SAMPLED\n"
+            : ""),
+            (surface_capabilities.supportedUsageFlags &
+            VK_IMAGE_USAGE_STORAGE_BIT
+            ? "\tVK_IMAGE_USAGE_STORAGE\n"
+            : ""),
+            (surface_capabilities.supportedUsageFlags &
+            VK_IMAGE_USAGE_COLOR_ATTACHMENT_BIT
+            ? "\tVK_IMAGE_USAGE_COLOR_ATTACHMENT\n"
+            : ""),
+            (surface_capabilities.supportedUsageFlags &
+            VK_IMAGE_USAGE_DEPTH_STENCIL_ATTACHMENT_BIT
+            ? "\tVK_IMAGE_USAGE_DEPTH_STENCIL_ATTACHMENT\n"
+            : ""),
+            (surface_capabilities.supportedUsageFlags &
+            VK_IMAGE_USAGE_TRANSIENT_ATTACHMENT_BIT
+            ? "\tVK_IMAGE_USAGE_TRANSIENT_ATTACHMENT\n"
+            : ""),
+            (surface_capabilities.supportedUsageFlags &
+            VK_IMAGE_USAGE_INPUT_ATTACHMENT_BIT
+            ? "\tVK_IMAGE_USAGE_INPUT_ATTACHMENT"
+            : ""));
     return static_cast<VkImageUsageFlags>(-1);
 }
 
@@ -1286,8 +1318,8 @@ VkPresentModeKHR TutorialBase::getSwapChainPresentMode(
             return present_mode;
         }
     }
-    Logging::error(LOG_TAG,
-                   "FIFO present mode is not supported by the swap chain!");
+    INTEL_VULKAN_LOG_ERROR(
+            LOG_TAG, "FIFO present mode is not supported by the swap chain!");
     return static_cast<VkPresentModeKHR>(-1);
 }
 
@@ -1301,8 +1333,9 @@ bool TutorialBase::checkValidationLayerSupport() const {
     std::vector<VkLayerProperties> vk_layer_properties(layer_count);
     vkEnumerateInstanceLayerProperties(&layer_count,
                                        vk_layer_properties.data());
-    Logging::error(LOG_TAG, "The vk_instance has the following properties:");
-    Logging::error(LOG_TAG, vk_layer_properties);
+    INTEL_VULKAN_LOG_ERROR(LOG_TAG,
+                           "The vk_instance has the following properties:");
+    INTEL_VULKAN_LOG_ERROR(LOG_TAG, vk_layer_properties);
 
     bool response = true;
     for (const char* layer_name : validation_layers) {
@@ -1315,11 +1348,11 @@ bool TutorialBase::checkValidationLayerSupport() const {
                            0;
                 });
         if (layer_it == vk_layer_properties.end()) {
-            Logging::error(LOG_TAG,
-                           "The following layer \"",
-                           layer_name,
-                           "\""
-                           "could not be loaded!!!");
+            INTEL_VULKAN_LOG_ERROR(LOG_TAG,
+                                   "The following layer \"",
+                                   layer_name,
+                                   "\""
+                                   "could not be loaded!!!");
             response = false;
             break;
         }
@@ -1334,29 +1367,29 @@ debugCallback(VkDebugUtilsMessageSeverityFlagBitsEXT message_severity,
               const VkDebugUtilsMessengerCallbackDataEXT*
                       vk_debug_utils_messenger_callback_data_ext,
               void* p_user_data) {
-    static LogTag debug_log_tag("DebugCallback");
-    static std::atomic<bool> log_tag_created(false);
-    if (!log_tag_created.load()) {
-        Logging::addStdCerrLogger(debug_log_tag);
-        log_tag_created.store(true);
-    }
+    // Called on whichever thread issued the Vulkan call, often every frame,
+    // so the message is only counted and queued here.
+    ValidationMessageFilter* filter =
+            static_cast<ValidationMessageFilter*>(p_user_data);
 
+    boost::log::trivial::severity_level level = INTEL_VULKAN_TRACE;
     if (message_severity & VK_DEBUG_UTILS_MESSAGE_SEVERITY_ERROR_BIT_EXT) {
-        Logging::error(debug_log_tag,
-                       "validation layer:",
-                       vk_debug_utils_messenger_callback_data_ext->pMessage);
+        level = INTEL_VULKAN_ERROR;
     } else if (message_severity &
                VK_DEBUG_UTILS_MESSAGE_SEVERITY_INFO_BIT_EXT) {
-        Logging::info(debug_log_tag,
-                      "validation layer:",
-                      vk_debug_utils_messenger_callback_data_ext->pMessage);
+        level = INTEL_VULKAN_INFO;
     } else if (message_severity &
                VK_DEBUG_UTILS_MESSAGE_SEVERITY_WARNING_BIT_EXT) {
-        Logging::warn(debug_log_tag,
-                      "validation layer:",
-                      vk_debug_utils_messenger_callback_data_ext->pMessage);
+        level = INTEL_VULKAN_WARN;
+    } else {
+        return VK_FALSE;
     }
 
+    filter->submit(vk_debug_utils_messenger_callback_data_ext->messageIdNumber,
+                   vk_debug_utils_messenger_callback_data_ext->pMessageIdName,
+                   level,
+                   vk_debug_utils_messenger_callback_data_ext->pMessage);
+
     return VK_FALSE;
 }
 
@@ -1365,7 +1398,12 @@ bool TutorialBase::setupDebugMessenger() {
     if (!m_enable_vk_debug.load()) {
         response = true;
     } else {
-        Logging::error(LOG_TAG, "Setting up Vulkan debugger...");
+        INTEL_VULKAN_LOG_ERROR(LOG_TAG, "Setting up Vulkan debugger...");
+        LogTag debug_log_tag("DebugCallback");
+        Logging::addStdCerrLogger(debug_log_tag);
+        m_validation_message_filter =
+                std::make_unique<ValidationMessageFilter>(debug_log_tag);
+
         VkDebugUtilsMessengerCreateInfoEXT vk_debug_utils_messenger_create_info_ext{
                 .sType =
                         VK_STRUCTURE_TYPE_DEBUG_UTILS_MESSENGER_CREATE_INFO_EXT,
@@ -1377,7 +1415,8 @@ bool TutorialBase::setupDebugMessenger() {
                 .messageType = VK_DEBUG_UTILS_MESSAGE_TYPE_GENERAL_BIT_EXT |
                                VK_DEBUG_UTILS_MESSAGE_TYPE_VALIDATION_BIT_EXT |
                                VK_DEBUG_UTILS_MESSAGE_TYPE_PERFORMANCE_BIT_EXT,
-                .pfnUserCallback = debugCallback};
+                .pfnUserCallback = debugCallback,
+                .pUserData = m_validation_message_filter.get()};
 
         PFN_vkCreateDebugUtilsMessengerEXT func =
                 (PFN_vkCreateDebugUtilsMessengerEXT)vkGetInstanceProcAddr(
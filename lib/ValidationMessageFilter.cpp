@@ -0,0 +1,205 @@
+////////////////////////////////////////////////////////////////////////////
+// Copyright (c) 2026 intel_vulkan
+// All rights reserved.
+//
+// Contact: mehoggan@gmail.com
+//
+// This software is licensed under the terms of the Your License.
+// See the LICENSE file in the top-level directory.
+/////////////////////////////////////////////////////////////////////////
+#include "intel_vulkan/ValidationMessageFilter.h"
+
+#include <cstring>
+#include <sstream>
+
+namespace intel_vulkan {
+
+namespace {
+constexpr std::int64_t EMPTY_KEY = INT64_MIN;
+
+// How long the writer thread sleeps when the queue is empty. Messages are
+// never held back longer than this.
+constexpr std::chrono::milliseconds WRITER_POLL_INTERVAL(20);
+
+std::int64_t nowNs() {
+    return std::chrono::duration_cast<std::chrono::nanoseconds>(
+                   std::chrono::steady_clock::now().time_since_epoch())
+            .count();
+}
+}  // namespace
+
+ValidationMessageFilter::ValidationMessageFilter(
+        const LogTag& tag,
+        std::uint32_t max_per_interval,
+        std::chrono::milliseconds interval,
+        std::size_t queue_capacity)
+        : m_tag(tag)
+        , m_max_per_interval(max_per_interval)
+        , m_interval_ns(
+                  std::chrono::duration_cast<std::chrono::nanoseconds>(interval)
+                          .count())
+        , m_stats(new MessageIdStats[MAX_MESSAGE_IDS])
+        , m_queue(queue_capacity)
+        , m_dropped(0)
+        , m_dropped_reported(0)
+        , m_running(true) {
+    m_writer = std::thread([this]() { writerLoop(); });
+}
+
+ValidationMessageFilter::~ValidationMessageFilter() {
+    {
+        std::lock_guard<std::mutex> lock(m_wake_mutex);
+        m_running.store(false);
+        m_wake.notify_one();
+    }
+    m_writer.join();
+}
+
+void ValidationMessageFilter::submit(std::int32_t message_id,
+                                     const char* message_id_name,
+                                     boost::log::trivial::severity_level level,
+                                     const char* message) {
+    bool emit = true;
+    MessageIdStats* stats = findStats(message_id, message_id_name);
+    if (stats != nullptr) {
+        stats->total.fetch_add(1, std::memory_order_relaxed);
+        stats->level.store(static_cast<std::uint8_t>(level),
+                           std::memory_order_relaxed);
+
+        // The thread that moves the window forward resets its count. A
+        // message racing with the reset may be counted in either window.
+        std::int64_t now = nowNs();
+        std::int64_t window_start = stats->window_start.load();
+        if (now - window_start >= m_interval_ns &&
+            stats->window_start.compare_exchange_strong(window_start, now)) {
+            stats->window_count.store(0);
+        }
+        emit = stats->window_count.fetch_add(1) < m_max_per_interval;
+        if (!emit) {
+            stats->suppressed.fetch_add(1, std::memory_order_relaxed);
+        }
+    }
+
+    if (emit && !m_queue.tryPushWith([&](QueuedMessage& queued) {
+            queued.level = level;
+            queued.message.assign(message != nullptr ? message : "");
+        })) {
+        m_dropped.fetch_add(1, std::memory_order_relaxed);
+    }
+}
+
+std::uint64_t ValidationMessageFilter::droppedCount() const {
+    return m_dropped.load();
+}
+
+ValidationMessageFilter::MessageIdStats* ValidationMessageFilter::findStats(
+        std::int32_t message_id,
+        const char* message_id_name) {
+    // Open addressing with linear probing. Slots are claimed with a CAS on
+    // the key and never released, so lookups need no lock.
+    std::size_t index =
+            (static_cast<std::uint32_t>(message_id) * 2654435761u) %
+            MAX_MESSAGE_IDS;
+    for (std::size_t probe = 0; probe < MAX_MESSAGE_IDS; ++probe) {
+        MessageIdStats& stats = m_stats[(index + probe) % MAX_MESSAGE_IDS];
+        std::int64_t key = stats.key.load();
+        if (key == EMPTY_KEY) {
+            if (stats.key.compare_exchange_strong(key, message_id)) {
+                if (message_id_name != nullptr) {
+                    std::strncpy(
+                            stats.name, message_id_name, MAX_ID_NAME - 1);
+                }
+                stats.name_ready.store(true);
+                return &stats;
+            }
+        }
+        if (key == message_id) {
+            return &stats;
+        }
+    }
+    // Every slot is taken; the message is logged without a rate limit.
+    return nullptr;
+}
+
+void ValidationMessageFilter::writerLoop() {
+    std::int64_t next_summary = nowNs() + m_interval_ns;
+    for (;;) {
+        writeQueued();
+        if (nowNs() >= next_summary) {
+            writeSummaries();
+            next_summary = nowNs() + m_interval_ns;
+        }
+        if (!m_running.load()) {
+            break;
+        }
+
+        std::unique_lock<std::mutex> lock(m_wake_mutex);
+        m_wake.wait_for(
+                lock, WRITER_POLL_INTERVAL, [this]() { return !m_running; });
+    }
+    writeQueued();
+    writeSummaries();
+}
+
+void ValidationMessageFilter::writeQueued() {
+    while (m_queue.tryPopWith([this](QueuedMessage& queued) {
+        log(queued.level, "validation layer: " + queued.message);
+    })) {
+    }
+}
+
+void ValidationMessageFilter::writeSummaries() {
+    for (std::size_t index = 0; index < MAX_MESSAGE_IDS; ++index) {
+        MessageIdStats& stats = m_stats[index];
+        if (!stats.name_ready.load()) {
+            continue;
+        }
+        std::uint64_t suppressed = stats.suppressed.exchange(0);
+        if (suppressed == 0) {
+            continue;
+        }
+        std::stringstream sstream;
+        sstream << "validation layer: suppressed " << suppressed
+                << " repeats of " << (stats.name[0] ? stats.name : "message")
+                << " (id " << stats.key.load() << "), "
+                << stats.total.load() << " in total";
+        log(static_cast<boost::log::trivial::severity_level>(
+                    stats.level.load()),
+            sstream.str());
+    }
+
+    std::uint64_t dropped = m_dropped.load();
+    if (dropped != m_dropped_reported) {
+        std::stringstream sstream;
+        sstream << "validation layer: dropped "
+                << dropped - m_dropped_reported
+                << " messages, the queue was full";
+        log(INTEL_VULKAN_WARN, sstream.str());
+        m_dropped_reported = dropped;
+    }
+}
+
+void ValidationMessageFilter::log(boost::log::trivial::severity_level level,
+                                  const std::string& message) const {
+    switch (level) {
+        case INTEL_VULKAN_TRACE:
+            INTEL_VULKAN_LOG_TRACE(m_tag, message);
+            break;
+        case INTEL_VULKAN_DEBUG:
+            INTEL_VULKAN_LOG_DEBUG(m_tag, message);
+            break;
+        case INTEL_VULKAN_INFO:
+            INTEL_VULKAN_LOG_INFO(m_tag, message);
+            break;
+        case INTEL_VULKAN_WARN:
+            INTEL_VULKAN_LOG_WARN(m_tag, message);
+            break;
+        case INTEL_VULKAN_ERROR:
+            INTEL_VULKAN_LOG_ERROR(m_tag, message);
+            break;
+        case INTEL_VULKAN_FATAL:
+            INTEL_VULKAN_LOG_FATAL(m_tag, message);
+            break;
+    }
+}
+}  // namespace intel_vulkan
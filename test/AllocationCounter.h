@@ -0,0 +1,25 @@
+////////////////////////////////////////////////////////////////////////////
+// Copyright (c) 2026 intel_vulkan
+// All rights reserved.
+//
+// Contact: mehoggan@gmail.com
+//
+// This software is licensed under the terms of the Your License.
+// See the LICENSE file in the top-level directory.
+/////////////////////////////////////////////////////////////////////////
+
+#ifndef INTEL_VULKAN_TEST_ALLOCATIONCOUNTER_H
+#define INTEL_VULKAN_TEST_ALLOCATIONCOUNTER_H
+
+#include <cstdint>
+
+/**
+ * @brief The number of times the calling thread has called the global
+ *        operator new since it started.
+ *
+ * Linking AllocationCounter.cpp into a test or a benchmark replaces the
+ * global operator new and delete with versions that keep this count.
+ */
+std::uint64_t threadAllocationCount();
+
+#endif
@@ -0,0 +1,183 @@
+////////////////////////////////////////////////////////////////////////////
+// Copyright (c) 2026 intel_vulkan
+// All rights reserved.
+//
+// Contact: mehoggan@gmail.com
+//
+// This software is licensed under the terms of the Your License.
+// See the LICENSE file in the top-level directory.
+/////////////////////////////////////////////////////////////////////////
+
+#include "intel_vulkan/AssetArchive.h"
+
+#include <gtest/gtest.h>
+
+#include <unistd.h>
+#include <cstdint>
+#include <cstring>
+#include <filesystem>
+#include <fstream>
+#include <iterator>
+#include <map>
+#include <memory>
+#include <optional>
+#include <span>
+#include <string>
+#include <vector>
+
+namespace {
+using intel_vulkan::Tools::AssetArchive;
+
+class AssetArchiveTest : public ::testing::Test {
+protected:
+    void SetUp() override {
+        m_dir = std::filesystem::temp_directory_path() /
+                ("asset_archive_test_" + std::to_string(::getpid()));
+        std::filesystem::create_directories(m_dir);
+        m_archive = (m_dir / "assets.pak").string();
+    }
+
+    void TearDown() override {
+        AssetArchive::setGlobal(nullptr);
+        std::filesystem::remove_all(m_dir);
+    }
+
+    AssetArchive::Source source(const std::string& name,
+                                const std::string& contents) {
+        std::string path = (m_dir / ("file" + std::to_string(m_files++)))
+                                   .string();
+        std::ofstream(path, std::ios::binary) << contents;
+        m_contents[name] = contents;
+        return {name, path};
+    }
+
+    std::string read(const std::string& path) {
+        std::ifstream file(path, std::ios::binary);
+        return std::string(std::istreambuf_iterator<char>(file), {});
+    }
+
+    void write(const std::string& path, const std::string& contents) {
+        std::ofstream(path, std::ios::binary | std::ios::trunc) << contents;
+    }
+
+    std::filesystem::path m_dir;
+    std::string m_archive;
+    std::size_t m_files = 0;
+    std::map<std::string, std::string> m_contents;
+};
+
+TEST_F(AssetArchiveTest, FindsEveryPackedAsset) {
+    std::string large(100000, '\0');
+    for (std::size_t index = 0; index < large.size(); ++index) {
+        large[index] = static_cast<char>(index * 31);
+    }
+    // Out of order, and with an empty asset last in name order.
+    std::vector<AssetArchive::Source> sources = {
+            source("b/shader.spv", "spirv"),
+            source("a.png", large),
+            source("c/empty", ""),
+    };
+    ASSERT_TRUE(AssetArchive::pack(m_archive, sources, 4096));
+
+    AssetArchive archive(m_archive);
+    ASSERT_TRUE(archive.isValid());
+    ASSERT_EQ(3u, archive.size());
+    EXPECT_TRUE(archive.verify());
+    for (std::size_t index = 0; index < archive.size(); ++index) {
+        AssetArchive::Entry entry = archive.entry(index);
+        EXPECT_EQ(0u, entry.offset % 4096) << entry.name;
+        std::optional<std::span<const char>> contents =
+                archive.find(entry.name);
+        ASSERT_TRUE(contents) << entry.name;
+        EXPECT_EQ(m_contents[std::string(entry.name)],
+                  std::string(contents->begin(), contents->end()));
+    }
+    EXPECT_EQ("a.png", archive.entry(0).name);
+    EXPECT_EQ("c/empty", archive.entry(2).name);
+
+    EXPECT_FALSE(archive.find("a"));
+    EXPECT_FALSE(archive.find("a.png2"));
+    EXPECT_FALSE(archive.find("d"));
+    EXPECT_FALSE(archive.find(""));
+}
+
+TEST_F(AssetArchiveTest, EmptyAssetIsFound) {
+    ASSERT_TRUE(AssetArchive::pack(m_archive, {source("empty", "")}));
+    auto archive = std::make_shared<const AssetArchive>(m_archive);
+    ASSERT_TRUE(archive->isValid());
+    std::optional<std::span<const char>> contents = archive->find("empty");
+    ASSERT_TRUE(contents);
+    EXPECT_TRUE(contents->empty());
+
+    // Found in the archive, not mapped from a loose file of that name.
+    AssetArchive::setGlobal(archive);
+    intel_vulkan::Tools::Asset asset =
+            intel_vulkan::Tools::loadAsset("empty");
+    EXPECT_EQ(archive, asset.archive);
+    EXPECT_TRUE(asset.empty());
+}
+
+TEST_F(AssetArchiveTest, RejectsDuplicateNames) {
+    EXPECT_FALSE(AssetArchive::pack(
+            m_archive, {source("same", "1"), source("other", "2"),
+                        source("same", "3")}));
+    EXPECT_FALSE(std::filesystem::exists(m_archive));
+}
+
+TEST_F(AssetArchiveTest, RejectsMissingSources) {
+    EXPECT_FALSE(AssetArchive::pack(
+            m_archive, {{"missing", (m_dir / "missing").string()}}));
+}
+
+TEST_F(AssetArchiveTest, RejectsACorruptIndex) {
+    ASSERT_TRUE(AssetArchive::pack(
+            m_archive, {source("a", "first"), source("b", "second")}, 64));
+    const std::string packed = read(m_archive);
+    ASSERT_TRUE(AssetArchive(m_archive).isValid());
+    std::uint32_t first_offset = static_cast<std::uint32_t>(
+            AssetArchive(m_archive).entry(0).offset);
+
+    // Header: magic, version, entry count and names size. Index entries:
+    // offset, size, hash, name offset, name size, alignment, reserved.
+    constexpr std::size_t HEADER_SIZE = 16;
+    constexpr std::size_t ENTRY_SIZE = 40;
+    auto corrupt = [&](std::size_t offset, std::uint32_t value) {
+        std::string bytes = packed;
+        std::memcpy(&bytes[offset], &value, sizeof(value));
+        write(m_archive, bytes);
+        return AssetArchive(m_archive).isValid();
+    };
+    EXPECT_FALSE(corrupt(0, 0));                          // Magic.
+    EXPECT_FALSE(corrupt(4, 2));                          // Version.
+    EXPECT_FALSE(corrupt(8, 1000000));                    // Entry count.
+    EXPECT_FALSE(corrupt(12, 1000000));                   // Names size.
+    EXPECT_FALSE(corrupt(HEADER_SIZE, 1 << 30));          // Offset.
+    EXPECT_FALSE(corrupt(HEADER_SIZE, first_offset + 1)); // Misaligned.
+    EXPECT_FALSE(corrupt(HEADER_SIZE + 8, 1 << 30));      // Size.
+    EXPECT_FALSE(corrupt(HEADER_SIZE + 24, 1000));        // Name offset.
+    EXPECT_FALSE(corrupt(HEADER_SIZE + 28, 1000));        // Name size.
+    EXPECT_FALSE(corrupt(HEADER_SIZE + 32, 0));           // Alignment.
+    // Names out of order, so the binary search could miss.
+    std::string swapped = packed;
+    std::swap(swapped[HEADER_SIZE + 2 * ENTRY_SIZE],
+              swapped[HEADER_SIZE + 2 * ENTRY_SIZE + 1]);
+    write(m_archive, swapped);
+    EXPECT_FALSE(AssetArchive(m_archive).isValid());
+
+    write(m_archive, packed.substr(0, HEADER_SIZE + ENTRY_SIZE));
+    EXPECT_FALSE(AssetArchive(m_archive).isValid());
+    write(m_archive, packed.substr(0, packed.size() - 1));
+    EXPECT_FALSE(AssetArchive(m_archive).isValid());
+}
+
+TEST_F(AssetArchiveTest, VerifyCatchesChangedContents) {
+    ASSERT_TRUE(AssetArchive::pack(m_archive, {source("a", "contents")}, 64));
+    std::string bytes = read(m_archive);
+    AssetArchive::Entry entry = AssetArchive(m_archive).entry(0);
+    bytes[entry.offset] ^= 1;
+    write(m_archive, bytes);
+    AssetArchive archive(m_archive);
+    ASSERT_TRUE(archive.isValid());
+    EXPECT_FALSE(archive.verify());
+}
+}  // namespace
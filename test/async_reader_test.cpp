@@ -0,0 +1,206 @@
+////////////////////////////////////////////////////////////////////////////
+// Copyright (c) 2026 intel_vulkan
+// All rights reserved.
+//
+// Contact: mehoggan@gmail.com
+//
+// This software is licensed under the terms of the Your License.
+// See the LICENSE file in the top-level directory.
+/////////////////////////////////////////////////////////////////////////
+
+#include "intel_vulkan/AsyncReader.h"
+
+#include <gtest/gtest.h>
+
+#include <dlfcn.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+#include <algorithm>
+#include <atomic>
+#include <cerrno>
+#include <cstdarg>
+#include <cstdint>
+#include <filesystem>
+#include <fstream>
+#include <future>
+#include <random>
+#include <string>
+#include <vector>
+
+namespace {
+using intel_vulkan::Tools::AsyncReader;
+using intel_vulkan::Tools::ReadRequest;
+using intel_vulkan::Tools::ReadResult;
+
+// The number of io_uring_enter calls that submit something before one
+// fails, or -1 to never fail.
+std::atomic<int> g_submits_before_failure{-1};
+}  // namespace
+
+#if defined(__NR_io_uring_enter)
+// Stands in for libc's syscall so a test can make the ring fail while it
+// holds reads; every other call passes straight through.
+extern "C" long syscall(long number, ...) {
+    va_list args;
+    va_start(args, number);
+    long arg[6];
+    for (long& value : arg) {
+        value = va_arg(args, long);
+    }
+    va_end(args);
+
+    using Syscall = long (*)(long, ...);
+    static Syscall next =
+            reinterpret_cast<Syscall>(::dlsym(RTLD_NEXT, "syscall"));
+    if (number == __NR_io_uring_enter && arg[1] > 0 &&
+        g_submits_before_failure.load() >= 0 &&
+        g_submits_before_failure.fetch_sub(1) == 0) {
+        errno = EINVAL;
+        return -1;
+    }
+    return next(number, arg[0], arg[1], arg[2], arg[3], arg[4], arg[5]);
+}
+#endif
+
+namespace {
+struct Outcome {
+    std::string data;
+    int error = 0;
+
+    bool operator==(const Outcome& other) const = default;
+};
+
+class AsyncReaderTest : public ::testing::Test {
+protected:
+    void SetUp() override {
+        m_dir = std::filesystem::temp_directory_path() /
+                ("async_reader_test_" + std::to_string(::getpid()));
+        std::filesystem::create_directories(m_dir);
+        std::mt19937 random(7);
+        for (std::size_t size : {0, 1, 4095, 4096, 65537, (1 << 20) + 3}) {
+            std::string contents(size, '\0');
+            for (char& byte : contents) {
+                byte = static_cast<char>(random());
+            }
+            std::string path =
+                    (m_dir / ("file_" + std::to_string(size))).string();
+            std::ofstream(path, std::ios::binary) << contents;
+            m_files.push_back({path, contents});
+        }
+    }
+
+    void TearDown() override { std::filesystem::remove_all(m_dir); }
+
+    // Whole files, windows at offsets, buffers past the end of the file,
+    // empty buffers and a missing file, several times over.
+    std::vector<ReadRequest> requests(std::vector<std::vector<char>>& buffers) {
+        struct Shape {
+            std::size_t size;
+            std::uint64_t offset;
+        };
+        std::vector<std::pair<std::string, Shape>> shapes;
+        for (int round = 0; round < 4; ++round) {
+            for (const auto& [path, contents] : m_files) {
+                shapes.push_back({path, {contents.size(), 0}});
+                shapes.push_back({path, {contents.size() + 100, 0}});
+                shapes.push_back({path, {4096, contents.size() / 3}});
+                shapes.push_back({path, {16, contents.size() + 5}});
+                shapes.push_back({path, {0, 0}});
+            }
+            shapes.push_back({(m_dir / "missing").string(), {64, 0}});
+        }
+
+        buffers.assign(shapes.size(), {});
+        std::vector<ReadRequest> requests;
+        for (std::size_t index = 0; index < shapes.size(); ++index) {
+            buffers[index].assign(shapes[index].second.size, '\0');
+            requests.push_back({shapes[index].first,
+                                buffers[index],
+                                shapes[index].second.offset});
+        }
+        return requests;
+    }
+
+    std::vector<Outcome> run(AsyncReader& reader) {
+        std::vector<std::vector<char>> buffers;
+        std::vector<std::future<ReadResult>> futures =
+                reader.read(requests(buffers));
+        std::vector<Outcome> outcomes;
+        for (std::future<ReadResult>& future : futures) {
+            ReadResult result = future.get();
+            outcomes.push_back(
+                    {std::string(result.data.begin(), result.data.end()),
+                     result.error});
+        }
+        return outcomes;
+    }
+
+    std::vector<Outcome> expected() {
+        std::vector<std::vector<char>> buffers;
+        std::vector<Outcome> outcomes;
+        for (const ReadRequest& request : requests(buffers)) {
+            auto file = std::find_if(
+                    m_files.begin(), m_files.end(), [&](const auto& entry) {
+                        return entry.first == request.path;
+                    });
+            if (file == m_files.end()) {
+                outcomes.push_back({"", ENOENT});
+                continue;
+            }
+            const std::string& contents = file->second;
+            std::size_t offset =
+                    std::min<std::size_t>(request.offset, contents.size());
+            outcomes.push_back(
+                    {contents.substr(offset, request.buffer.size()), 0});
+        }
+        return outcomes;
+    }
+
+    std::filesystem::path m_dir;
+    std::vector<std::pair<std::string, std::string>> m_files;
+};
+
+TEST_F(AsyncReaderTest, BackendsReadTheSame) {
+    AsyncReader pool(8, AsyncReader::Backend::THREAD_POOL);
+    ASSERT_EQ(AsyncReader::Backend::THREAD_POOL, pool.backend());
+    std::vector<Outcome> from_pool = run(pool);
+    EXPECT_EQ(expected(), from_pool);
+
+    AsyncReader ring(8, AsyncReader::Backend::IO_URING);
+    if (ring.backend() != AsyncReader::Backend::IO_URING) {
+        GTEST_SKIP() << "io_uring is not available";
+    }
+    EXPECT_EQ(from_pool, run(ring));
+}
+
+TEST_F(AsyncReaderTest, CallbacksSeeEveryRead) {
+    AsyncReader reader(4, AsyncReader::Backend::AUTO);
+    std::vector<std::vector<char>> buffers;
+    std::vector<ReadRequest> all = requests(buffers);
+    std::atomic<std::size_t> delivered{0};
+    reader.read(all, [&](ReadResult&&) { ++delivered; });
+    reader.wait();
+    EXPECT_EQ(all.size(), delivered.load());
+}
+
+#if defined(__NR_io_uring_enter)
+// However far the ring got before failing, every read completes as if the
+// thread pool had done it and the reader carries on with the pool.
+TEST_F(AsyncReaderTest, FailedRingFallsBackToThreadPool) {
+    std::vector<Outcome> want = expected();
+    for (int submits = 0; submits < 6; ++submits) {
+        SCOPED_TRACE(submits);
+        g_submits_before_failure = submits;
+        AsyncReader reader(8, AsyncReader::Backend::IO_URING);
+        if (reader.backend() != AsyncReader::Backend::IO_URING) {
+            g_submits_before_failure = -1;
+            GTEST_SKIP() << "io_uring is not available";
+        }
+        EXPECT_EQ(want, run(reader));
+        EXPECT_EQ(AsyncReader::Backend::THREAD_POOL, reader.backend());
+        EXPECT_EQ(want, run(reader));
+        g_submits_before_failure = -1;
+    }
+}
+#endif
+}  // namespace
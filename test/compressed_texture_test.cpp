@@ -0,0 +1,252 @@
+////////////////////////////////////////////////////////////////////////////
+// Copyright (c) 2026 intel_vulkan
+// All rights reserved.
+//
+// Contact: mehoggan@gmail.com
+//
+// This software is licensed under the terms of the Your License.
+// See the LICENSE file in the top-level directory.
+/////////////////////////////////////////////////////////////////////////
+
+#include "intel_vulkan/CompressedTexture.h"
+
+#include <gtest/gtest.h>
+
+#include <cstdint>
+#include <cstring>
+#include <filesystem>
+#include <string>
+#include <vector>
+
+namespace {
+namespace Tools = intel_vulkan::Tools;
+
+constexpr std::uint32_t DDPF_FOURCC = 0x4;
+constexpr std::uint32_t DXGI_FORMAT_BC7_UNORM = 98;
+constexpr std::uint32_t DDS_DIMENSION_TEXTURE2D = 3;
+
+void appendWord(std::vector<char>* bytes, std::uint32_t word) {
+    const char* data = reinterpret_cast<const char*>(&word);
+    bytes->insert(bytes->end(), data, data + sizeof(word));
+}
+
+// A DDS file: the magic, a DDS_HEADER and, for DX10, a DDS_HEADER_DXT10,
+// followed by the levels.
+std::vector<char> ddsFile(std::uint32_t width,
+                          std::uint32_t height,
+                          std::uint32_t mip_map_count,
+                          const char (&four_cc)[5],
+                          std::uint32_t dxgi_format = 0) {
+    std::vector<char> bytes;
+    appendWord(&bytes, 0x20534444);  // "DDS "
+    appendWord(&bytes, 124);         // size
+    appendWord(&bytes, 0);           // flags
+    appendWord(&bytes, height);
+    appendWord(&bytes, width);
+    appendWord(&bytes, 0);  // pitch_or_linear_size
+    appendWord(&bytes, 0);  // depth
+    appendWord(&bytes, mip_map_count);
+    for (int index = 0; index < 11; ++index) {
+        appendWord(&bytes, 0);  // reserved1
+    }
+    appendWord(&bytes, 32);  // pixel format size
+    appendWord(&bytes, DDPF_FOURCC);
+    std::uint32_t code = 0;
+    std::memcpy(&code, four_cc, sizeof(code));
+    appendWord(&bytes, code);
+    for (int index = 0; index < 5; ++index) {
+        appendWord(&bytes, 0);  // rgb_bit_count and masks
+    }
+    for (int index = 0; index < 5; ++index) {
+        appendWord(&bytes, 0);  // caps to caps4, reserved2
+    }
+    if (std::string(four_cc) == "DX10") {
+        appendWord(&bytes, dxgi_format);
+        appendWord(&bytes, DDS_DIMENSION_TEXTURE2D);
+        appendWord(&bytes, 0);  // misc_flag
+        appendWord(&bytes, 1);  // array_size
+        appendWord(&bytes, 0);  // misc_flags2
+    }
+    return bytes;
+}
+
+// Appends a level of size bytes, every byte set to value.
+void appendLevel(std::vector<char>* bytes, std::size_t size, char value) {
+    bytes->insert(bytes->end(), size, value);
+}
+
+bool filledWith(std::span<const char> data, char value) {
+    for (char byte : data) {
+        if (byte != value) {
+            return false;
+        }
+    }
+    return !data.empty();
+}
+
+class CompressedTextureTest : public ::testing::Test {
+protected:
+    void TearDown() override { std::filesystem::remove(path); }
+
+    std::string path = (std::filesystem::temp_directory_path() /
+                        "intel_vulkan_compressed_texture_test.ktx2")
+                               .string();
+};
+
+TEST_F(CompressedTextureTest, Ktx2Bc7LevelsStoredSmallestFirst) {
+    // 16x8 down to 1x1: 8x2, 2x1, 1x1, 1x1 and 1x1 blocks.
+    const std::vector<std::size_t> sizes = {128, 32, 16, 16, 16};
+    std::vector<std::vector<char>> levels;
+    for (std::size_t index = 0; index < sizes.size(); ++index) {
+        levels.emplace_back(sizes[index], static_cast<char>('a' + index));
+    }
+    ASSERT_TRUE(Tools::writeKtx2(
+            path, VK_FORMAT_BC7_UNORM_BLOCK, 16, 8, levels));
+
+    Tools::CompressedTexture texture(path);
+    ASSERT_TRUE(texture.isValid());
+    EXPECT_EQ(texture.format(), VK_FORMAT_BC7_UNORM_BLOCK);
+    EXPECT_EQ(texture.width(), 16u);
+    EXPECT_EQ(texture.height(), 8u);
+    ASSERT_EQ(texture.levels().size(), 5u);
+    const std::uint32_t widths[] = {16, 8, 4, 2, 1};
+    const std::uint32_t heights[] = {8, 4, 2, 1, 1};
+    for (std::size_t index = 0; index < sizes.size(); ++index) {
+        SCOPED_TRACE(index);
+        const Tools::CompressedLevel& level = texture.levels()[index];
+        EXPECT_EQ(level.width, widths[index]);
+        EXPECT_EQ(level.height, heights[index]);
+        EXPECT_EQ(level.size, sizes[index]);
+        EXPECT_EQ(level.offset % 16, 0u);
+        EXPECT_TRUE(filledWith(texture.levelData(index),
+                               static_cast<char>('a' + index)));
+        if (index > 0) {
+            EXPECT_LT(level.offset, texture.levels()[index - 1].offset);
+        }
+    }
+
+    // Staged level 0 first, each level at a multiple of 16.
+    std::vector<char> staging(texture.stagingSize());
+    EXPECT_EQ(staging.size(), 208u);
+    std::vector<VkBufferImageCopy> regions =
+            texture.copyTo(staging.data(), staging.size(), 256);
+    ASSERT_EQ(regions.size(), 5u);
+    VkDeviceSize expected_offset = 256;
+    for (std::size_t index = 0; index < regions.size(); ++index) {
+        SCOPED_TRACE(index);
+        const VkBufferImageCopy& region = regions[index];
+        EXPECT_EQ(region.bufferOffset, expected_offset);
+        EXPECT_EQ(region.bufferRowLength, 0u);
+        EXPECT_EQ(region.imageSubresource.aspectMask,
+                  static_cast<VkImageAspectFlags>(VK_IMAGE_ASPECT_COLOR_BIT));
+        EXPECT_EQ(region.imageSubresource.mipLevel, index);
+        EXPECT_EQ(region.imageSubresource.layerCount, 1u);
+        EXPECT_EQ(region.imageExtent.width, widths[index]);
+        EXPECT_EQ(region.imageExtent.height, heights[index]);
+        EXPECT_EQ(region.imageExtent.depth, 1u);
+        EXPECT_TRUE(filledWith(
+                std::span<const char>(staging).subspan(
+                        region.bufferOffset - 256, sizes[index]),
+                static_cast<char>('a' + index)));
+        expected_offset += sizes[index];
+    }
+
+    EXPECT_TRUE(texture.copyTo(staging.data(), staging.size() - 1, 0).empty());
+}
+
+TEST_F(CompressedTextureTest, DdsDxt5WithMips) {
+    std::vector<char> file = ddsFile(8, 8, 4, "DXT5");
+    const std::vector<std::size_t> sizes = {64, 16, 16, 16};
+    for (std::size_t index = 0; index < sizes.size(); ++index) {
+        appendLevel(&file, sizes[index], static_cast<char>('a' + index));
+    }
+
+    Tools::CompressedTexture texture = Tools::CompressedTexture::fromMemory(
+            file);
+    ASSERT_TRUE(texture.isValid());
+    EXPECT_EQ(texture.format(), VK_FORMAT_BC3_UNORM_BLOCK);
+    ASSERT_EQ(texture.levels().size(), 4u);
+    std::size_t offset = 128;
+    for (std::size_t index = 0; index < sizes.size(); ++index) {
+        SCOPED_TRACE(index);
+        const Tools::CompressedLevel& level = texture.levels()[index];
+        EXPECT_EQ(level.width, 8u >> index);
+        EXPECT_EQ(level.height, 8u >> index);
+        EXPECT_EQ(level.offset, offset);
+        EXPECT_EQ(level.size, sizes[index]);
+        EXPECT_TRUE(filledWith(texture.levelData(index),
+                               static_cast<char>('a' + index)));
+        offset += sizes[index];
+    }
+    EXPECT_TRUE(texture.levelData(4).empty());
+
+    std::vector<char> staging(texture.stagingSize());
+    std::vector<VkBufferImageCopy> regions =
+            texture.copyTo(staging.data(), staging.size(), 0);
+    ASSERT_EQ(regions.size(), 4u);
+    EXPECT_EQ(regions[3].bufferOffset, 96u);
+    EXPECT_EQ(regions[3].imageExtent.width, 1u);
+}
+
+TEST_F(CompressedTextureTest, DdsDx10Bc7) {
+    std::vector<char> file = ddsFile(8, 4, 1, "DX10", DXGI_FORMAT_BC7_UNORM);
+    appendLevel(&file, 32, 'a');
+
+    Tools::CompressedTexture texture = Tools::CompressedTexture::fromMemory(
+            file);
+    ASSERT_TRUE(texture.isValid());
+    EXPECT_EQ(texture.format(), VK_FORMAT_BC7_UNORM_BLOCK);
+    EXPECT_EQ(texture.width(), 8u);
+    EXPECT_EQ(texture.height(), 4u);
+    ASSERT_EQ(texture.levels().size(), 1u);
+    EXPECT_EQ(texture.levels()[0].offset, 148u);
+    EXPECT_TRUE(filledWith(texture.levelData(0), 'a'));
+}
+
+TEST_F(CompressedTextureTest, RejectsTruncatedFiles) {
+    std::vector<char> dds = ddsFile(8, 8, 4, "DXT5");
+    appendLevel(&dds, 64 + 16 + 16 + 16 - 1, 'a');
+    EXPECT_FALSE(Tools::CompressedTexture::fromMemory(dds).isValid());
+    dds.resize(100);
+    EXPECT_FALSE(Tools::CompressedTexture::fromMemory(dds).isValid());
+
+    ASSERT_TRUE(Tools::writeKtx2(path,
+                                 VK_FORMAT_BC1_RGBA_UNORM_BLOCK,
+                                 8,
+                                 8,
+                                 {std::vector<char>(32, 'a'),
+                                  std::vector<char>(8, 'b')}));
+    std::filesystem::resize_file(path, std::filesystem::file_size(path) - 1);
+    Tools::CompressedTexture ktx2(path);
+    EXPECT_FALSE(ktx2.isValid());
+    EXPECT_TRUE(ktx2.levels().empty());
+}
+
+TEST_F(CompressedTextureTest, RejectsMoreLevelsThanAMipChain) {
+    // A 4x4 texture has 3 levels, 4x4, 2x2 and 1x1.
+    std::vector<char> dds = ddsFile(4, 4, 3, "DXT1");
+    appendLevel(&dds, 3 * 8, 'a');
+    EXPECT_EQ(Tools::CompressedTexture::fromMemory(dds).levels().size(), 3u);
+
+    // Enough data for every level, so only the count is wrong.
+    dds = ddsFile(4, 4, 40, "DXT1");
+    appendLevel(&dds, 40 * 8, 'a');
+    EXPECT_FALSE(Tools::CompressedTexture::fromMemory(dds).isValid());
+
+    ASSERT_TRUE(Tools::writeKtx2(path,
+                                 VK_FORMAT_BC1_RGBA_UNORM_BLOCK,
+                                 4,
+                                 4,
+                                 std::vector<std::vector<char>>(
+                                         4, std::vector<char>(8, 'a'))));
+    EXPECT_FALSE(Tools::CompressedTexture(path).isValid());
+}
+
+TEST_F(CompressedTextureTest, RejectsOtherFiles) {
+    EXPECT_FALSE(Tools::CompressedTexture::fromMemory({}).isValid());
+    std::vector<char> dds = ddsFile(4, 4, 1, "RGBA");
+    appendLevel(&dds, 64, 'a');
+    EXPECT_FALSE(Tools::CompressedTexture::fromMemory(dds).isValid());
+    EXPECT_FALSE(Tools::CompressedTexture(path).isValid());
+}
+}  // namespace
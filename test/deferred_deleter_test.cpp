@@ -0,0 +1,296 @@
+////////////////////////////////////////////////////////////////////////////
+// Copyright (c) 2026 intel_vulkan
+// All rights reserved.
+//
+// Contact: mehoggan@gmail.com
+//
+// This software is licensed under the terms of the Your License.
+// See the LICENSE file in the top-level directory.
+/////////////////////////////////////////////////////////////////////////
+
+#include "intel_vulkan/DeferredDeleter.h"
+
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <cstdint>
+#include <functional>
+#include <map>
+#include <string>
+#include <vector>
+
+namespace {
+namespace Tools = intel_vulkan::Tools;
+
+// Completes values when the test says so; waitFor fails for values past
+// submitted_value, like work that was never submitted.
+class MockBackend : public Tools::DeletionBackend {
+public:
+    std::uint64_t completedValue() override { return completed_value; }
+
+    bool waitFor(std::uint64_t value) override {
+        ++wait_count;
+        if (value > submitted_value) {
+            return false;
+        }
+        completed_value = std::max(completed_value, value);
+        return true;
+    }
+
+    std::uint64_t completed_value = 0;
+    std::uint64_t submitted_value = 0;
+    int wait_count = 0;
+};
+
+class DeferredDeleterTest : public ::testing::Test {
+protected:
+    std::function<void()> record(std::string name) {
+        return [this, name]() { destroyed.push_back(name); };
+    }
+
+    MockBackend backend;
+    std::vector<std::string> destroyed;
+};
+
+TEST_F(DeferredDeleterTest, CollectDestroysCompletedInQueueOrder) {
+    Tools::DeferredDeleter deleter(backend);
+    deleter.defer(0, record("unused"));
+    deleter.defer(2, record("frame 2"));
+    deleter.defer(1, record("frame 1"));
+    deleter.defer(2, record("frame 2 again"));
+
+    EXPECT_EQ(deleter.collect(), 1u);
+    EXPECT_EQ(destroyed, std::vector<std::string>({"unused"}));
+
+    // Frame 1 is complete but queued behind frame 2, so it waits.
+    backend.completed_value = 1;
+    EXPECT_EQ(deleter.collect(), 0u);
+    EXPECT_EQ(deleter.pending(), 3u);
+
+    backend.completed_value = 2;
+    EXPECT_EQ(deleter.collect(), 3u);
+    EXPECT_EQ(destroyed,
+              std::vector<std::string>(
+                      {"unused", "frame 2", "frame 1", "frame 2 again"}));
+    EXPECT_EQ(deleter.pending(), 0u);
+}
+
+TEST_F(DeferredDeleterTest, DestroyMayDeferMore) {
+    Tools::DeferredDeleter deleter(backend);
+    deleter.defer(1, [&]() {
+        destroyed.push_back("outer");
+        deleter.defer(1, record("inner"));
+    });
+    backend.completed_value = 1;
+    EXPECT_EQ(deleter.collect(), 2u);
+    EXPECT_EQ(destroyed, std::vector<std::string>({"outer", "inner"}));
+}
+
+TEST_F(DeferredDeleterTest, FlushKeepsEntriesAfterFailedWait) {
+    Tools::DeferredDeleter deleter(backend);
+    deleter.defer(3, record("frame 3"));
+    deleter.defer(5, record("frame 5"));
+
+    backend.submitted_value = 4;
+    EXPECT_FALSE(deleter.flush());
+    EXPECT_EQ(deleter.pending(), 2u);
+    EXPECT_TRUE(destroyed.empty());
+
+    backend.submitted_value = 5;
+    EXPECT_TRUE(deleter.flush());
+    EXPECT_EQ(deleter.pending(), 0u);
+    EXPECT_EQ(destroyed, std::vector<std::string>({"frame 3", "frame 5"}));
+}
+
+TEST_F(DeferredDeleterTest, FlushStopsIfWaitDoesNotComplete) {
+    // A backend whose wait succeeds without advancing its completed value
+    // must not make flush spin.
+    class StuckBackend : public Tools::DeletionBackend {
+    public:
+        std::uint64_t completedValue() override { return 0; }
+        bool waitFor(std::uint64_t) override { return true; }
+    } stuck;
+    Tools::DeferredDeleter deleter(stuck);
+    deleter.defer(1, record("frame 1"));
+    EXPECT_FALSE(deleter.flush());
+    EXPECT_EQ(deleter.pending(), 1u);
+    EXPECT_TRUE(destroyed.empty());
+}
+
+TEST_F(DeferredDeleterTest, DestructorFlushes) {
+    backend.submitted_value = 7;
+    {
+        Tools::DeferredDeleter deleter(backend);
+        deleter.defer(7, record("frame 7"));
+    }
+    EXPECT_EQ(destroyed, std::vector<std::string>({"frame 7"}));
+    EXPECT_EQ(backend.wait_count, 1);
+}
+
+std::vector<std::uintptr_t> g_destroyed_fences;
+
+void destroyFence(VkDevice, VkFence fence, const VkAllocationCallbacks*) {
+    g_destroyed_fences.push_back(reinterpret_cast<std::uintptr_t>(fence));
+}
+
+TEST_F(DeferredDeleterTest, DeferHandleSkipsNullObjects) {
+    g_destroyed_fences.clear();
+    VkDevice device = reinterpret_cast<VkDevice>(1);
+    Tools::DeferredDeleter deleter(backend);
+    deleter.defer(1, reinterpret_cast<VkFence>(7), destroyFence, device);
+    deleter.defer(1, VkFence(VK_NULL_HANDLE), destroyFence, device);
+    deleter.defer(1,
+                  reinterpret_cast<VkFence>(8),
+                  destroyFence,
+                  VkDevice(VK_NULL_HANDLE));
+    EXPECT_EQ(deleter.pending(), 1u);
+    backend.completed_value = 1;
+    deleter.collect();
+    EXPECT_EQ(g_destroyed_fences, std::vector<std::uintptr_t>({7}));
+}
+
+// Fake fences: the status is whatever the test set, and waiting on a fence
+// signals it unless g_device_lost.
+std::map<VkFence, bool> g_signaled;
+std::vector<VkFence> g_waited;
+bool g_device_lost = false;
+
+VkResult getFenceStatus(VkDevice, VkFence fence) {
+    return g_signaled[fence] ? VK_SUCCESS : VK_NOT_READY;
+}
+
+VkResult waitForFences(VkDevice,
+                       std::uint32_t count,
+                       const VkFence* fences,
+                       VkBool32,
+                       std::uint64_t) {
+    if (g_device_lost) {
+        return VK_ERROR_DEVICE_LOST;
+    }
+    for (std::uint32_t index = 0; index < count; ++index) {
+        g_signaled[fences[index]] = true;
+        g_waited.push_back(fences[index]);
+    }
+    return VK_SUCCESS;
+}
+
+class FenceDeletionBackendTest : public ::testing::Test {
+protected:
+    void SetUp() override {
+        g_signaled.clear();
+        g_waited.clear();
+        g_device_lost = false;
+    }
+
+    VkDevice device = reinterpret_cast<VkDevice>(1);
+    VkFence fence_a = reinterpret_cast<VkFence>(10);
+    VkFence fence_b = reinterpret_cast<VkFence>(11);
+    Tools::FenceDeletionBackend backend{device, getFenceStatus, waitForFences};
+};
+
+TEST_F(FenceDeletionBackendTest, CompletesInSubmissionOrder) {
+    backend.submitted(1, fence_a);
+    backend.submitted(2, fence_b);
+    EXPECT_EQ(backend.completedValue(), 0u);
+
+    // Fence b alone does not complete value 2 while value 1 is pending.
+    g_signaled[fence_b] = true;
+    EXPECT_EQ(backend.completedValue(), 0u);
+
+    g_signaled[fence_a] = true;
+    EXPECT_EQ(backend.completedValue(), 2u);
+}
+
+TEST_F(FenceDeletionBackendTest, ReusedFenceCompletesEarlierSubmission) {
+    backend.submitted(1, fence_a);
+    backend.submitted(2, fence_b);
+    g_signaled[fence_b] = true;
+
+    // The application waited on fence a and reset it before submitting it
+    // again, so its signal is gone but value 1 is complete.
+    g_signaled[fence_a] = false;
+    backend.submitted(3, fence_a);
+    EXPECT_EQ(backend.completedValue(), 2u);
+
+    EXPECT_TRUE(backend.waitFor(3));
+    EXPECT_EQ(g_waited, std::vector<VkFence>({fence_a}));
+    EXPECT_EQ(backend.completedValue(), 3u);
+}
+
+TEST_F(FenceDeletionBackendTest, SignaledFenceStaysCompleteAfterReset) {
+    std::vector<int> destroyed;
+    Tools::DeferredDeleter deleter(backend);
+    backend.submitted(1, fence_a);
+    deleter.defer(1, [&]() { destroyed.push_back(1); });
+    backend.submitted(2, fence_b);
+    g_signaled[fence_b] = true;
+
+    // The application waited on fence a and reset it, then its next
+    // submission failed, so fence a is never signaled again.
+    g_signaled[fence_a] = true;
+    backend.signaled(fence_a);
+    g_signaled[fence_a] = false;
+    EXPECT_EQ(backend.completedValue(), 2u);
+
+    EXPECT_TRUE(deleter.flush());
+    EXPECT_EQ(destroyed, std::vector<int>({1}));
+    EXPECT_TRUE(g_waited.empty());
+}
+
+TEST_F(FenceDeletionBackendTest, WaitForFailsForLostDeviceAndUnknownValue) {
+    backend.submitted(1, fence_a);
+    EXPECT_FALSE(backend.waitFor(2));
+
+    g_device_lost = true;
+    EXPECT_FALSE(backend.waitFor(1));
+    EXPECT_EQ(backend.completedValue(), 0u);
+
+    g_device_lost = false;
+    EXPECT_TRUE(backend.waitFor(1));
+    EXPECT_TRUE(backend.waitFor(0));
+}
+
+TEST_F(FenceDeletionBackendTest, DrivesDeferredDeleter) {
+    std::vector<int> destroyed;
+    Tools::DeferredDeleter deleter(backend);
+    backend.submitted(1, fence_a);
+    deleter.defer(1, [&]() { destroyed.push_back(1); });
+    backend.submitted(2, fence_b);
+    deleter.defer(2, [&]() { destroyed.push_back(2); });
+
+    g_signaled[fence_a] = true;
+    EXPECT_EQ(deleter.collect(), 1u);
+    EXPECT_TRUE(deleter.flush());
+    EXPECT_EQ(destroyed, std::vector<int>({1, 2}));
+    EXPECT_EQ(g_waited, std::vector<VkFence>({fence_b}));
+}
+
+std::uint64_t g_counter = 0;
+
+VkResult getSemaphoreCounterValue(VkDevice,
+                                  VkSemaphore,
+                                  std::uint64_t* value) {
+    *value = g_counter;
+    return VK_SUCCESS;
+}
+
+VkResult waitSemaphores(VkDevice,
+                        const VkSemaphoreWaitInfo* info,
+                        std::uint64_t) {
+    g_counter = std::max(g_counter, info->pValues[0]);
+    return VK_SUCCESS;
+}
+
+TEST(TimelineDeletionBackendTest, ReadsAndWaitsOnCounter) {
+    g_counter = 0;
+    Tools::TimelineDeletionBackend backend(reinterpret_cast<VkDevice>(1),
+                                           reinterpret_cast<VkSemaphore>(3),
+                                           getSemaphoreCounterValue,
+                                           waitSemaphores);
+    g_counter = 4;
+    EXPECT_EQ(backend.completedValue(), 4u);
+    EXPECT_TRUE(backend.waitFor(9));
+    EXPECT_EQ(g_counter, 9u);
+    EXPECT_EQ(backend.completedValue(), 9u);
+}
+}  // namespace
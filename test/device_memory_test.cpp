@@ -0,0 +1,678 @@
+////////////////////////////////////////////////////////////////////////////
+// Copyright (c) 2026 intel_vulkan
+// All rights reserved.
+//
+// Contact: mehoggan@gmail.com
+//
+// This software is licensed under the terms of the Your License.
+// See the LICENSE file in the top-level directory.
+/////////////////////////////////////////////////////////////////////////
+
+#include "intel_vulkan/DeviceMemoryAllocator.h"
+
+#include <gtest/gtest.h>
+
+#include <cstdint>
+#include <cstdlib>
+#include <initializer_list>
+#include <iterator>
+#include <map>
+#include <optional>
+#include <random>
+#include <set>
+#include <utility>
+#include <vector>
+
+namespace {
+namespace Tools = intel_vulkan::Tools;
+
+constexpr VkDeviceSize KIB = 1ull << 10;
+constexpr VkDeviceSize MIB = 1ull << 20;
+constexpr VkDeviceSize GIB = 1ull << 30;
+
+// The live allocations of a TlsfAllocator, keyed by offset, and the sizes
+// of the free gaps between them. The offsets are also kept unordered so a
+// random one can be picked in constant time.
+class ShadowModel {
+public:
+    explicit ShadowModel(std::uint64_t total) : m_total(total) {
+        m_gaps.insert(total);
+    }
+
+    bool overlaps(std::uint64_t offset, std::uint64_t size) const {
+        auto next = m_ranges.lower_bound(offset);
+        if ((next != m_ranges.end()) && (next->first < offset + size)) {
+            return true;
+        }
+        if (next == m_ranges.begin()) {
+            return false;
+        }
+        auto previous = std::prev(next);
+        return previous->first + previous->second.size > offset;
+    }
+
+    void add(std::uint64_t offset, std::uint64_t size, std::uint32_t handle) {
+        auto range = m_ranges.emplace(offset, Range{size, handle, 0}).first;
+        auto [gap_begin, gap_end] = gapAround(range);
+        m_gaps.erase(m_gaps.find(gap_end - gap_begin));
+        m_gaps.insert(offset - gap_begin);
+        m_gaps.insert(gap_end - (offset + size));
+        range->second.index = m_offsets.size();
+        m_offsets.push_back(offset);
+        m_used += size;
+    }
+
+    // Returns the handle of the removed range.
+    std::uint32_t removeAny(std::uint64_t random) {
+        auto range = m_ranges.find(m_offsets[random % m_offsets.size()]);
+        auto [gap_begin, gap_end] = gapAround(range);
+        m_gaps.erase(m_gaps.find(range->first - gap_begin));
+        m_gaps.erase(m_gaps.find(gap_end - (range->first +
+                                            range->second.size)));
+        m_gaps.insert(gap_end - gap_begin);
+        m_offsets[range->second.index] = m_offsets.back();
+        m_ranges[m_offsets.back()].index = range->second.index;
+        m_offsets.pop_back();
+        m_used -= range->second.size;
+        std::uint32_t handle = range->second.handle;
+        m_ranges.erase(range);
+        return handle;
+    }
+
+    std::uint64_t largestGap() const { return *m_gaps.rbegin(); }
+    std::uint64_t total() const { return m_total; }
+    std::uint64_t used() const { return m_used; }
+    std::size_t count() const { return m_offsets.size(); }
+
+private:
+    struct Range {
+        std::uint64_t size;
+        std::uint32_t handle;
+        std::size_t index;  ///< In m_offsets.
+    };
+    using RangeIterator = std::map<std::uint64_t, Range>::iterator;
+
+    // The free space around range if it were not there.
+    std::pair<std::uint64_t, std::uint64_t> gapAround(RangeIterator range) {
+        std::uint64_t begin = 0;
+        if (range != m_ranges.begin()) {
+            auto previous = std::prev(range);
+            begin = previous->first + previous->second.size;
+        }
+        auto next = std::next(range);
+        return {begin, next == m_ranges.end() ? m_total : next->first};
+    }
+
+    std::uint64_t m_total;
+    std::uint64_t m_used = 0;
+    std::map<std::uint64_t, Range> m_ranges;
+    std::vector<std::uint64_t> m_offsets;
+    std::multiset<std::uint64_t> m_gaps;
+};
+
+// Random allocations and frees checked against a shadow model: ranges
+// are aligned, inside the allocator and disjoint, the counters match, an
+// allocation only fails when no free range is comfortably large enough,
+// and freeing everything merges the allocator back into one range.
+TEST(TlsfAllocatorTest, MatchesShadowModel) {
+    constexpr int SEEDS = 200;
+    constexpr int OPERATIONS = 20000;
+    for (int seed = 0; seed < SEEDS; ++seed) {
+        SCOPED_TRACE(seed);
+        std::mt19937_64 random(seed);
+        ShadowModel model(1ull << (20 + seed % 4));
+        Tools::TlsfAllocator allocator(model.total());
+
+        for (int operation = 0; operation < OPERATIONS; ++operation) {
+            if ((model.count() == 0) || (random() % 3 != 0)) {
+                std::uint64_t size =
+                        1 + random() % (random() % 4 ? 512 : 32 * KIB);
+                std::uint64_t alignment = 1ull << (random() % 13);
+                std::optional<Tools::TlsfAllocator::Allocation> allocation =
+                        allocator.allocate(size, alignment);
+                if (!allocation) {
+                    // Good fit rounds the request up by at most a size
+                    // class, 1/32 of it.
+                    std::uint64_t needed = size + alignment - 1;
+                    ASSERT_LT(model.largestGap(), needed + needed / 16 + 32);
+                    continue;
+                }
+                ASSERT_EQ(allocation->offset % alignment, 0u);
+                ASSERT_LE(allocation->offset + size, model.total());
+                ASSERT_FALSE(model.overlaps(allocation->offset, size));
+                model.add(allocation->offset, size, allocation->handle);
+            } else {
+                allocator.free(model.removeAny(random()));
+            }
+            ASSERT_EQ(allocator.usedSize(), model.used());
+            ASSERT_EQ(allocator.allocationCount(), model.count());
+            if (operation % 256 == 0) {
+                ASSERT_EQ(allocator.largestFreeRange(), model.largestGap());
+            }
+        }
+
+        while (model.count() != 0) {
+            allocator.free(model.removeAny(random()));
+        }
+        EXPECT_EQ(allocator.usedSize(), 0u);
+        EXPECT_EQ(allocator.allocationCount(), 0u);
+        EXPECT_EQ(allocator.largestFreeRange(), model.total());
+        std::optional<Tools::TlsfAllocator::Allocation> whole =
+                allocator.allocate(model.total(), 1);
+        ASSERT_TRUE(whole);
+        EXPECT_EQ(whole->offset, 0u);
+    }
+}
+
+TEST(TlsfAllocatorTest, AlignsIntoFreedRange) {
+    Tools::TlsfAllocator allocator(4 * KIB);
+    auto first = allocator.allocate(1000, 1);
+    auto second = allocator.allocate(KIB, KIB);
+    auto third = allocator.allocate(2 * KIB, 2 * KIB);
+    ASSERT_TRUE(first && second && third);
+    EXPECT_EQ(first->offset, 0u);
+    EXPECT_EQ(second->offset, KIB);
+    EXPECT_EQ(third->offset, 2 * KIB);
+
+    allocator.free(second->handle);
+    auto again = allocator.allocate(KIB, KIB);
+    ASSERT_TRUE(again);
+    EXPECT_EQ(again->offset, KIB);
+    EXPECT_FALSE(allocator.allocate(5 * KIB, 1));
+}
+
+constexpr VkMemoryPropertyFlags DEVICE_LOCAL =
+        VK_MEMORY_PROPERTY_DEVICE_LOCAL_BIT;
+constexpr VkMemoryPropertyFlags HOST_VISIBLE =
+        VK_MEMORY_PROPERTY_HOST_VISIBLE_BIT;
+constexpr VkMemoryPropertyFlags HOST_COHERENT =
+        VK_MEMORY_PROPERTY_HOST_COHERENT_BIT;
+constexpr VkMemoryPropertyFlags HOST_CACHED =
+        VK_MEMORY_PROPERTY_HOST_CACHED_BIT;
+
+using MemoryTypes = std::vector<std::uint32_t>;
+
+// Memory types as {flags, heap index} pairs, and heap sizes.
+VkPhysicalDeviceMemoryProperties memoryProperties(
+        std::initializer_list<VkMemoryType> types,
+        std::initializer_list<VkDeviceSize> heap_sizes) {
+    VkPhysicalDeviceMemoryProperties properties = {};
+    for (const VkMemoryType& type : types) {
+        properties.memoryTypes[properties.memoryTypeCount++] = type;
+    }
+    for (VkDeviceSize heap_size : heap_sizes) {
+        properties.memoryHeaps[properties.memoryHeapCount++] = {heap_size, 0};
+    }
+    return properties;
+}
+
+// A discrete GPU without resizable BAR: the host only sees a 256 MiB
+// window of device local memory.
+VkPhysicalDeviceMemoryProperties smallBarProperties() {
+    return memoryProperties({{DEVICE_LOCAL, 0},
+                             {HOST_VISIBLE | HOST_COHERENT, 1},
+                             {HOST_VISIBLE | HOST_COHERENT | HOST_CACHED, 1},
+                             {DEVICE_LOCAL | HOST_VISIBLE | HOST_COHERENT, 2}},
+                            {8 * GIB, 16 * GIB, 256 * MIB});
+}
+
+TEST(RankMemoryTypesTest, SmallBar) {
+    VkPhysicalDeviceMemoryProperties properties = smallBarProperties();
+    EXPECT_EQ(Tools::rankMemoryTypes(
+                      properties, UINT32_MAX, Tools::MemoryUsage::GPU_ONLY),
+              MemoryTypes({0, 3, 1, 2}));
+    // Uploaded assets would fill the BAR window, so it comes last.
+    EXPECT_EQ(Tools::rankMemoryTypes(
+                      properties, UINT32_MAX, Tools::MemoryUsage::UPLOAD),
+              MemoryTypes({1, 2, 3}));
+    EXPECT_EQ(Tools::rankMemoryTypes(
+                      properties, UINT32_MAX, Tools::MemoryUsage::READBACK),
+              MemoryTypes({2, 1, 3}));
+    // Per frame data is small enough for it and skips the staging copy.
+    EXPECT_EQ(Tools::rankMemoryTypes(
+                      properties, UINT32_MAX, Tools::MemoryUsage::DYNAMIC),
+              MemoryTypes({3, 1, 2}));
+}
+
+TEST(RankMemoryTypesTest, OnlyReturnsAllowedTypes) {
+    VkPhysicalDeviceMemoryProperties properties = smallBarProperties();
+    EXPECT_EQ(Tools::rankMemoryTypes(
+                      properties, 0b0110, Tools::MemoryUsage::DYNAMIC),
+              MemoryTypes({1, 2}));
+    EXPECT_EQ(Tools::rankMemoryTypes(
+                      properties, 0b1001, Tools::MemoryUsage::GPU_ONLY),
+              MemoryTypes({0, 3}));
+    EXPECT_TRUE(Tools::rankMemoryTypes(
+                        properties, 0b0001, Tools::MemoryUsage::UPLOAD)
+                        .empty());
+}
+
+TEST(RankMemoryTypesTest, ResizableBar) {
+    VkPhysicalDeviceMemoryProperties properties = memoryProperties(
+            {{DEVICE_LOCAL, 0},
+             {HOST_VISIBLE | HOST_COHERENT, 1},
+             {HOST_VISIBLE | HOST_COHERENT | HOST_CACHED, 1},
+             {DEVICE_LOCAL | HOST_VISIBLE | HOST_COHERENT, 0}},
+            {8 * GIB, 16 * GIB});
+    EXPECT_EQ(Tools::rankMemoryTypes(
+                      properties, UINT32_MAX, Tools::MemoryUsage::GPU_ONLY),
+              MemoryTypes({0, 3, 1, 2}));
+    EXPECT_EQ(Tools::rankMemoryTypes(
+                      properties, UINT32_MAX, Tools::MemoryUsage::UPLOAD),
+              MemoryTypes({3, 1, 2}));
+    EXPECT_EQ(Tools::rankMemoryTypes(
+                      properties, UINT32_MAX, Tools::MemoryUsage::READBACK),
+              MemoryTypes({2, 1, 3}));
+    EXPECT_EQ(Tools::rankMemoryTypes(
+                      properties, UINT32_MAX, Tools::MemoryUsage::DYNAMIC),
+              MemoryTypes({3, 1, 2}));
+}
+
+TEST(RankMemoryTypesTest, IntegratedGpu) {
+    VkPhysicalDeviceMemoryProperties properties = memoryProperties(
+            {{DEVICE_LOCAL, 0},
+             {DEVICE_LOCAL | HOST_VISIBLE | HOST_COHERENT, 0},
+             {DEVICE_LOCAL | HOST_VISIBLE | HOST_COHERENT | HOST_CACHED, 0}},
+            {4 * GIB});
+    EXPECT_EQ(Tools::rankMemoryTypes(
+                      properties, UINT32_MAX, Tools::MemoryUsage::GPU_ONLY),
+              MemoryTypes({0, 1, 2}));
+    EXPECT_EQ(Tools::rankMemoryTypes(
+                      properties, UINT32_MAX, Tools::MemoryUsage::UPLOAD),
+              MemoryTypes({1, 2}));
+    EXPECT_EQ(Tools::rankMemoryTypes(
+                      properties, UINT32_MAX, Tools::MemoryUsage::READBACK),
+              MemoryTypes({2, 1}));
+    EXPECT_EQ(Tools::rankMemoryTypes(
+                      properties, UINT32_MAX, Tools::MemoryUsage::DYNAMIC),
+              MemoryTypes({1, 2}));
+}
+
+TEST(RankMemoryTypesTest, SkipsSpecialPurposeTypes) {
+    VkPhysicalDeviceMemoryProperties properties = memoryProperties(
+            {{DEVICE_LOCAL | VK_MEMORY_PROPERTY_LAZILY_ALLOCATED_BIT, 0},
+             {DEVICE_LOCAL | HOST_VISIBLE | HOST_COHERENT |
+                      VK_MEMORY_PROPERTY_DEVICE_COHERENT_BIT_AMD,
+              0},
+             {DEVICE_LOCAL | VK_MEMORY_PROPERTY_PROTECTED_BIT, 0},
+             {DEVICE_LOCAL, 0},
+             {HOST_VISIBLE | HOST_COHERENT, 1}},
+            {8 * GIB, 8 * GIB});
+    EXPECT_EQ(Tools::rankMemoryTypes(
+                      properties, UINT32_MAX, Tools::MemoryUsage::GPU_ONLY),
+              MemoryTypes({3, 4}));
+    EXPECT_EQ(Tools::rankMemoryTypes(
+                      properties, UINT32_MAX, Tools::MemoryUsage::DYNAMIC),
+              MemoryTypes({4}));
+}
+
+TEST(RankMemoryTypesTest, NothingForOnlySpecialPurposeTypes) {
+    VkPhysicalDeviceMemoryProperties properties = memoryProperties(
+            {{DEVICE_LOCAL | VK_MEMORY_PROPERTY_LAZILY_ALLOCATED_BIT, 0},
+             {VK_MEMORY_PROPERTY_PROTECTED_BIT, 0},
+             {DEVICE_LOCAL | VK_MEMORY_PROPERTY_PROTECTED_BIT, 0},
+             {DEVICE_LOCAL | HOST_VISIBLE | HOST_COHERENT |
+                      VK_MEMORY_PROPERTY_DEVICE_COHERENT_BIT_AMD,
+              0}},
+            {GIB});
+    for (Tools::MemoryUsage usage : {Tools::MemoryUsage::GPU_ONLY,
+                                     Tools::MemoryUsage::UPLOAD,
+                                     Tools::MemoryUsage::READBACK,
+                                     Tools::MemoryUsage::DYNAMIC}) {
+        EXPECT_TRUE(
+                Tools::rankMemoryTypes(properties, UINT32_MAX, usage).empty());
+    }
+}
+
+// vkAllocateMemory and friends over malloc. Allocations larger than
+// g_fail_over or from g_failing_type fail like an out of memory device;
+// every block is mapped
+// at g_mapping, which is as large as the largest block in these tests.
+std::vector<VkDeviceSize> g_allocation_sizes;
+int g_live_memory = 0;
+VkDeviceSize g_fail_over = 0;
+std::uint32_t g_failing_type = UINT32_MAX;
+char g_mapping[8 << 20];
+
+VkResult fakeAllocateMemory(VkDevice,
+                            const VkMemoryAllocateInfo* allocate_info,
+                            const VkAllocationCallbacks*,
+                            VkDeviceMemory* memory) {
+    g_allocation_sizes.push_back(allocate_info->allocationSize);
+    if (((g_fail_over != 0) &&
+         (allocate_info->allocationSize > g_fail_over)) ||
+        (allocate_info->memoryTypeIndex == g_failing_type)) {
+        return VK_ERROR_OUT_OF_DEVICE_MEMORY;
+    }
+    *memory = reinterpret_cast<VkDeviceMemory>(std::malloc(1));
+    ++g_live_memory;
+    return VK_SUCCESS;
+}
+
+void fakeFreeMemory(VkDevice,
+                    VkDeviceMemory memory,
+                    const VkAllocationCallbacks*) {
+    std::free(memory);
+    --g_live_memory;
+}
+
+VkResult fakeMapMemory(VkDevice,
+                       VkDeviceMemory,
+                       VkDeviceSize,
+                       VkDeviceSize,
+                       VkMemoryMapFlags,
+                       void** data) {
+    *data = g_mapping;
+    return VK_SUCCESS;
+}
+
+class DeviceMemoryAllocatorTest : public ::testing::Test {
+protected:
+    static constexpr std::uint32_t DEVICE_LOCAL_TYPE = 0;
+    static constexpr std::uint32_t NON_COHERENT_TYPE = 1;
+    static constexpr std::uint32_t COHERENT_TYPE = 2;
+
+    void SetUp() override {
+        g_allocation_sizes.clear();
+        g_live_memory = 0;
+        g_fail_over = 0;
+        g_failing_type = UINT32_MAX;
+
+        properties.memoryTypeCount = 3;
+        properties.memoryTypes[DEVICE_LOCAL_TYPE] = {
+                VK_MEMORY_PROPERTY_DEVICE_LOCAL_BIT, 0};
+        properties.memoryTypes[NON_COHERENT_TYPE] = {
+                VK_MEMORY_PROPERTY_HOST_VISIBLE_BIT, 1};
+        properties.memoryTypes[COHERENT_TYPE] = {
+                VK_MEMORY_PROPERTY_HOST_VISIBLE_BIT |
+                        VK_MEMORY_PROPERTY_HOST_COHERENT_BIT,
+                1};
+        properties.memoryHeapCount = 2;
+        properties.memoryHeaps[0] = {8 * GIB,
+                                     VK_MEMORY_HEAP_DEVICE_LOCAL_BIT};
+        properties.memoryHeaps[1] = {16 * GIB, 0};
+        limits.bufferImageGranularity = 4 * KIB;
+        limits.nonCoherentAtomSize = 64;
+    }
+
+    void TearDown() override { EXPECT_EQ(g_live_memory, 0); }
+
+    Tools::DeviceMemoryAllocator makeAllocator(VkDeviceSize block_size) {
+        return Tools::DeviceMemoryAllocator(
+                reinterpret_cast<VkDevice>(1),
+                properties,
+                limits,
+                {fakeAllocateMemory, fakeFreeMemory, fakeMapMemory},
+                block_size);
+    }
+
+    static VkMemoryRequirements requirements(VkDeviceSize size,
+                                             VkDeviceSize alignment,
+                                             std::uint32_t memory_type) {
+        return {size, alignment, 1u << memory_type};
+    }
+
+    VkPhysicalDeviceMemoryProperties properties = {};
+    VkPhysicalDeviceLimits limits = {};
+};
+
+TEST_F(DeviceMemoryAllocatorTest, PadsOptimalToGranularity) {
+    Tools::DeviceMemoryAllocator allocator = makeAllocator(MIB);
+    VkMemoryRequirements small = requirements(1000, 256, DEVICE_LOCAL_TYPE);
+    Tools::MemoryAllocation buffer =
+            allocator.allocate(small, 0, Tools::ResourceTiling::LINEAR);
+    Tools::MemoryAllocation image =
+            allocator.allocate(small, 0, Tools::ResourceTiling::OPTIMAL);
+    Tools::MemoryAllocation other_buffer =
+            allocator.allocate(small, 0, Tools::ResourceTiling::LINEAR);
+    ASSERT_TRUE(!!buffer && !!image && !!other_buffer);
+    EXPECT_EQ(buffer.memory, image.memory);
+    EXPECT_EQ(buffer.size, 1000u);
+    EXPECT_EQ(image.offset % (4 * KIB), 0u);
+    EXPECT_EQ(image.size, 4 * KIB);
+
+    // No buffer shares a granularity page with the image.
+    for (const Tools::MemoryAllocation* linear : {&buffer, &other_buffer}) {
+        EXPECT_TRUE((linear->offset + linear->size <= image.offset) ||
+                    (linear->offset >= image.offset + image.size));
+    }
+    allocator.free(buffer);
+    allocator.free(image);
+    allocator.free(other_buffer);
+}
+
+TEST_F(DeviceMemoryAllocatorTest, NoPaddingWithoutGranularity) {
+    limits.bufferImageGranularity = 1;
+    Tools::DeviceMemoryAllocator allocator = makeAllocator(MIB);
+    Tools::MemoryAllocation image =
+            allocator.allocate(requirements(1000, 256, DEVICE_LOCAL_TYPE),
+                               0,
+                               Tools::ResourceTiling::OPTIMAL);
+    ASSERT_TRUE(!!image);
+    EXPECT_EQ(image.size, 1000u);
+    allocator.free(image);
+}
+
+TEST_F(DeviceMemoryAllocatorTest, RoundsNonCoherentToAtomSize) {
+    Tools::DeviceMemoryAllocator allocator = makeAllocator(MIB);
+    Tools::MemoryAllocation first =
+            allocator.allocate(requirements(100, 4, NON_COHERENT_TYPE),
+                               VK_MEMORY_PROPERTY_HOST_VISIBLE_BIT,
+                               Tools::ResourceTiling::LINEAR);
+    Tools::MemoryAllocation second =
+            allocator.allocate(requirements(100, 4, NON_COHERENT_TYPE),
+                               VK_MEMORY_PROPERTY_HOST_VISIBLE_BIT,
+                               Tools::ResourceTiling::LINEAR);
+    ASSERT_TRUE(!!first && !!second);
+    for (const Tools::MemoryAllocation* allocation : {&first, &second}) {
+        EXPECT_EQ(allocation->memory_type, NON_COHERENT_TYPE);
+        EXPECT_EQ(allocation->offset % 64, 0u);
+        EXPECT_EQ(allocation->size, 128u);
+        EXPECT_EQ(allocation->mapped, g_mapping + allocation->offset);
+    }
+
+    // Coherent memory is never flushed, so it is not rounded.
+    Tools::MemoryAllocation coherent =
+            allocator.allocate(requirements(100, 4, COHERENT_TYPE),
+                               VK_MEMORY_PROPERTY_HOST_VISIBLE_BIT,
+                               Tools::ResourceTiling::LINEAR);
+    ASSERT_TRUE(!!coherent);
+    EXPECT_EQ(coherent.memory_type, COHERENT_TYPE);
+    EXPECT_EQ(coherent.size, 100u);
+    allocator.free(first);
+    allocator.free(second);
+    allocator.free(coherent);
+}
+
+TEST_F(DeviceMemoryAllocatorTest, DedicatedAboveHalfABlock) {
+    Tools::DeviceMemoryAllocator allocator = makeAllocator(MIB);
+    Tools::MemoryAllocation shared =
+            allocator.allocate(requirements(MIB / 2, 256, DEVICE_LOCAL_TYPE),
+                               0,
+                               Tools::ResourceTiling::LINEAR);
+    ASSERT_TRUE(!!shared);
+    EXPECT_EQ(g_allocation_sizes, std::vector<VkDeviceSize>({MIB}));
+
+    Tools::MemoryAllocation dedicated = allocator.allocate(
+            requirements(MIB / 2 + 1, 256, DEVICE_LOCAL_TYPE),
+            0,
+            Tools::ResourceTiling::LINEAR);
+    ASSERT_TRUE(!!dedicated);
+    EXPECT_EQ(g_allocation_sizes,
+              std::vector<VkDeviceSize>({MIB, MIB / 2 + 1}));
+    EXPECT_NE(dedicated.memory, shared.memory);
+    EXPECT_EQ(dedicated.offset, 0u);
+    EXPECT_EQ(allocator.stats().block_count, 2u);
+
+    // A dedicated allocation goes back to the device right away.
+    allocator.free(dedicated);
+    EXPECT_EQ(g_live_memory, 1);
+    allocator.free(shared);
+}
+
+TEST_F(DeviceMemoryAllocatorTest, SmallHeapsGetSmallerBlocks) {
+    properties.memoryHeaps[1].size = 64 * MIB;
+    Tools::DeviceMemoryAllocator allocator =
+            makeAllocator(Tools::DeviceMemoryAllocator::DEFAULT_BLOCK_SIZE);
+    Tools::MemoryAllocation shared =
+            allocator.allocate(requirements(4 * MIB, 256, COHERENT_TYPE),
+                               VK_MEMORY_PROPERTY_HOST_VISIBLE_BIT,
+                               Tools::ResourceTiling::LINEAR);
+    Tools::MemoryAllocation dedicated =
+            allocator.allocate(requirements(5 * MIB, 256, COHERENT_TYPE),
+                               VK_MEMORY_PROPERTY_HOST_VISIBLE_BIT,
+                               Tools::ResourceTiling::LINEAR);
+    ASSERT_TRUE(!!shared && !!dedicated);
+    EXPECT_EQ(g_allocation_sizes,
+              std::vector<VkDeviceSize>({8 * MIB, 5 * MIB}));
+    allocator.free(shared);
+    allocator.free(dedicated);
+}
+
+TEST_F(DeviceMemoryAllocatorTest, RetriesWithSmallerBlocks) {
+    Tools::DeviceMemoryAllocator allocator = makeAllocator(MIB);
+    g_fail_over = 300 * KIB;
+    Tools::MemoryAllocation first =
+            allocator.allocate(requirements(100 * KIB, 256, DEVICE_LOCAL_TYPE),
+                               0,
+                               Tools::ResourceTiling::LINEAR);
+    ASSERT_TRUE(!!first);
+    EXPECT_EQ(g_allocation_sizes,
+              std::vector<VkDeviceSize>({MIB, MIB / 2, MIB / 4}));
+    EXPECT_EQ(allocator.stats().block_size, MIB / 4);
+
+    // Does not fit the rest of the 256 KiB block, and a block must hold
+    // at least two such requests, so only 1 MiB and 512 KiB are tried.
+    g_allocation_sizes.clear();
+    Tools::MemoryAllocation second =
+            allocator.allocate(requirements(200 * KIB, 256, DEVICE_LOCAL_TYPE),
+                               0,
+                               Tools::ResourceTiling::LINEAR);
+    EXPECT_FALSE(!!second);
+    EXPECT_EQ(g_allocation_sizes, std::vector<VkDeviceSize>({MIB, MIB / 2}));
+
+    // At most three block sizes are tried.
+    g_fail_over = 1;
+    g_allocation_sizes.clear();
+    Tools::MemoryAllocation third =
+            allocator.allocate(requirements(200 * KIB, 256, NON_COHERENT_TYPE),
+                               VK_MEMORY_PROPERTY_HOST_VISIBLE_BIT,
+                               Tools::ResourceTiling::LINEAR);
+    EXPECT_FALSE(!!third);
+    EXPECT_EQ(g_allocation_sizes, std::vector<VkDeviceSize>({MIB, MIB / 2}));
+    g_allocation_sizes.clear();
+    Tools::MemoryAllocation tiny =
+            allocator.allocate(requirements(KIB, 256, NON_COHERENT_TYPE),
+                               VK_MEMORY_PROPERTY_HOST_VISIBLE_BIT,
+                               Tools::ResourceTiling::LINEAR);
+    EXPECT_FALSE(!!tiny);
+    EXPECT_EQ(g_allocation_sizes,
+              std::vector<VkDeviceSize>({MIB, MIB / 2, MIB / 4}));
+    allocator.free(first);
+}
+
+TEST_F(DeviceMemoryAllocatorTest, ReleasesEmptyBlocksButKeepsTheLast) {
+    Tools::DeviceMemoryAllocator allocator = makeAllocator(MIB);
+    VkMemoryRequirements request = requirements(400 * KIB, 256, 0);
+    std::vector<Tools::MemoryAllocation> allocations;
+    for (int index = 0; index < 3; ++index) {
+        allocations.push_back(allocator.allocate(
+                request, 0, Tools::ResourceTiling::LINEAR));
+        ASSERT_TRUE(!!allocations.back());
+    }
+    Tools::MemoryAllocation host =
+            allocator.allocate(requirements(KIB, 256, COHERENT_TYPE),
+                               VK_MEMORY_PROPERTY_HOST_VISIBLE_BIT,
+                               Tools::ResourceTiling::LINEAR);
+    ASSERT_TRUE(!!host);
+    EXPECT_EQ(g_live_memory, 3);
+    EXPECT_EQ(allocations[0].memory, allocations[1].memory);
+    EXPECT_NE(allocations[0].memory, allocations[2].memory);
+
+    // The second block empties while the first is in use: released.
+    allocator.free(allocations[2]);
+    EXPECT_EQ(g_live_memory, 2);
+
+    // The first block empties and is the last of its type: kept.
+    allocator.free(allocations[0]);
+    allocator.free(allocations[1]);
+    EXPECT_EQ(g_live_memory, 2);
+    Tools::MemoryStats stats = allocator.stats();
+    EXPECT_EQ(stats.block_count, 2u);
+    EXPECT_EQ(stats.allocation_count, 1u);
+
+    // Other memory types keep their own last block.
+    allocator.free(host);
+    EXPECT_EQ(g_live_memory, 2);
+
+    // The kept block is reused.
+    g_allocation_sizes.clear();
+    Tools::MemoryAllocation reused =
+            allocator.allocate(request, 0, Tools::ResourceTiling::LINEAR);
+    EXPECT_TRUE(g_allocation_sizes.empty());
+    allocator.free(reused);
+    allocator.free(Tools::MemoryAllocation());
+}
+
+TEST_F(DeviceMemoryAllocatorTest, DestructorFreesEveryBlock) {
+    {
+        Tools::DeviceMemoryAllocator allocator = makeAllocator(MIB);
+        allocator.allocate(requirements(KIB, 256, DEVICE_LOCAL_TYPE),
+                           0,
+                           Tools::ResourceTiling::LINEAR);
+        allocator.allocate(requirements(MIB, 256, COHERENT_TYPE),
+                           VK_MEMORY_PROPERTY_HOST_VISIBLE_BIT,
+                           Tools::ResourceTiling::LINEAR);
+        EXPECT_EQ(g_live_memory, 2);
+    }
+    EXPECT_EQ(g_live_memory, 0);
+}
+
+TEST_F(DeviceMemoryAllocatorTest, FallsBackDownTheRanking) {
+    properties = smallBarProperties();
+    limits.bufferImageGranularity = 1;
+    Tools::DeviceMemoryAllocator allocator = makeAllocator(16 * MIB);
+    VkMemoryRequirements small = {KIB, 256, UINT32_MAX};
+    Tools::MemoryAllocation first = allocator.allocate(
+            small, Tools::MemoryUsage::DYNAMIC, Tools::ResourceTiling::LINEAR);
+    ASSERT_TRUE(!!first);
+    EXPECT_EQ(first.memory_type, 3u);
+    EXPECT_EQ(first.property_flags,
+              DEVICE_LOCAL | HOST_VISIBLE | HOST_COHERENT);
+
+    // The BAR heap is out of memory, but its block still has room.
+    g_failing_type = 3;
+    Tools::MemoryAllocation second = allocator.allocate(
+            small, Tools::MemoryUsage::DYNAMIC, Tools::ResourceTiling::LINEAR);
+    EXPECT_EQ(second.memory_type, 3u);
+    EXPECT_EQ(second.memory, first.memory);
+
+    Tools::MemoryAllocation large =
+            allocator.allocate({20 * MIB, 256, UINT32_MAX},
+                               Tools::MemoryUsage::DYNAMIC,
+                               Tools::ResourceTiling::LINEAR);
+    EXPECT_EQ(large.memory_type, 1u);
+
+    // No host visible type is allowed.
+    g_allocation_sizes.clear();
+    Tools::MemoryAllocation none =
+            allocator.allocate({KIB, 256, 0b0001},
+                               Tools::MemoryUsage::READBACK,
+                               Tools::ResourceTiling::LINEAR);
+    EXPECT_FALSE(!!none);
+    EXPECT_TRUE(g_allocation_sizes.empty());
+    allocator.free(first);
+    allocator.free(second);
+    allocator.free(large);
+}
+
+TEST_F(DeviceMemoryAllocatorTest, FailsWithoutMatchingType) {
+    Tools::DeviceMemoryAllocator allocator = makeAllocator(MIB);
+    Tools::MemoryAllocation allocation =
+            allocator.allocate(requirements(KIB, 256, DEVICE_LOCAL_TYPE),
+                               VK_MEMORY_PROPERTY_HOST_VISIBLE_BIT,
+                               Tools::ResourceTiling::LINEAR);
+    EXPECT_FALSE(!!allocation);
+    EXPECT_TRUE(g_allocation_sizes.empty());
+}
+}  // namespace
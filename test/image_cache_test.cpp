@@ -0,0 +1,187 @@
+////////////////////////////////////////////////////////////////////////////
+// Copyright (c) 2026 intel_vulkan
+// All rights reserved.
+//
+// Contact: mehoggan@gmail.com
+//
+// This software is licensed under the terms of the Your License.
+// See the LICENSE file in the top-level directory.
+/////////////////////////////////////////////////////////////////////////
+
+#include "intel_vulkan/ImageCache.h"
+
+#include <gtest/gtest.h>
+
+#include <fcntl.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#include <chrono>
+#include <cstring>
+#include <filesystem>
+#include <fstream>
+#include <optional>
+#include <string>
+#include <thread>
+#include <vector>
+
+namespace {
+using intel_vulkan::Tools::ImageCache;
+
+constexpr int WIDTH = 5;
+constexpr int HEIGHT = 3;
+constexpr int CHANNELS = 4;
+constexpr std::size_t ROW_PITCH = 24;  // Padded past WIDTH * CHANNELS.
+
+class ImageCacheTest : public ::testing::Test {
+protected:
+    void SetUp() override {
+        m_dir = std::filesystem::temp_directory_path() /
+                ("image_cache_test_" + std::to_string(::getpid()));
+        std::filesystem::create_directories(m_dir);
+        m_pixels.resize(ROW_PITCH * HEIGHT);
+        for (std::size_t index = 0; index < m_pixels.size(); ++index) {
+            m_pixels[index] = static_cast<char>(index * 7);
+        }
+    }
+
+    void TearDown() override { std::filesystem::remove_all(m_dir); }
+
+    // The cache only stats the source, so any bytes stand in for an image.
+    std::string source(const std::string& name,
+                       const std::string& contents = "png") {
+        std::string path = (m_dir / name).string();
+        std::ofstream(path, std::ios::binary) << contents;
+        return path;
+    }
+
+    bool store(ImageCache& cache, const std::string& path) {
+        return cache.store(path,
+                           CHANNELS,
+                           WIDTH,
+                           HEIGHT,
+                           3,
+                           CHANNELS,
+                           m_pixels.data(),
+                           ROW_PITCH);
+    }
+
+    std::vector<std::filesystem::path> entries(const ImageCache& cache) {
+        std::vector<std::filesystem::path> paths;
+        for (const auto& item :
+             std::filesystem::directory_iterator(cache.directory())) {
+            if (item.path().extension() == ".img") {
+                paths.push_back(item.path());
+            }
+        }
+        return paths;
+    }
+
+    std::filesystem::path m_dir;
+    std::vector<char> m_pixels;
+};
+
+TEST_F(ImageCacheTest, FindsTheStoredPixels) {
+    ImageCache cache((m_dir / "cache").string());
+    std::string path = source("a.png");
+    EXPECT_FALSE(cache.find(path, CHANNELS));
+    ASSERT_TRUE(store(cache, path));
+
+    std::optional<ImageCache::Image> image = cache.find(path, CHANNELS);
+    ASSERT_TRUE(image);
+    EXPECT_EQ(WIDTH, image->width);
+    EXPECT_EQ(HEIGHT, image->height);
+    EXPECT_EQ(3, image->components);
+    ASSERT_EQ(std::size_t(WIDTH * CHANNELS * HEIGHT), image->pixels.size());
+    for (int row = 0; row < HEIGHT; ++row) {
+        EXPECT_EQ(0,
+                  std::memcmp(image->pixels.data() + row * WIDTH * CHANNELS,
+                              m_pixels.data() + row * ROW_PITCH,
+                              WIDTH * CHANNELS));
+    }
+}
+
+TEST_F(ImageCacheTest, KeyIncludesPathAndComponents) {
+    ImageCache cache((m_dir / "cache").string());
+    std::string path = source("a.png");
+    ASSERT_TRUE(store(cache, path));
+    EXPECT_FALSE(cache.find(path, 3));
+    EXPECT_FALSE(cache.find(source("b.png"), CHANNELS));
+    EXPECT_FALSE(cache.find((m_dir / "missing.png").string(), CHANNELS));
+}
+
+TEST_F(ImageCacheTest, ChangedSourceIsAMiss) {
+    ImageCache cache((m_dir / "cache").string());
+    std::string path = source("a.png");
+    ASSERT_TRUE(store(cache, path));
+    ASSERT_TRUE(cache.find(path, CHANNELS));
+
+    // Same size, different modification time.
+    timespec times[2] = {{0, UTIME_OMIT}, {12345, 0}};
+    ASSERT_EQ(0, ::utimensat(AT_FDCWD, path.c_str(), times, 0));
+    EXPECT_FALSE(cache.find(path, CHANNELS));
+    ASSERT_TRUE(store(cache, path));
+    ASSERT_TRUE(cache.find(path, CHANNELS));
+
+    // Different size, same modification time.
+    source("a.png", "a larger png");
+    ASSERT_EQ(0, ::utimensat(AT_FDCWD, path.c_str(), times, 0));
+    EXPECT_FALSE(cache.find(path, CHANNELS));
+}
+
+TEST_F(ImageCacheTest, EntryOfTheWrongLengthIsAMiss) {
+    ImageCache cache((m_dir / "cache").string());
+    std::string path = source("a.png");
+    ASSERT_TRUE(store(cache, path));
+    std::vector<std::filesystem::path> paths = entries(cache);
+    ASSERT_EQ(1u, paths.size());
+    std::uintmax_t size = std::filesystem::file_size(paths[0]);
+
+    std::filesystem::resize_file(paths[0], size + 1);
+    EXPECT_FALSE(cache.find(path, CHANNELS));
+    std::filesystem::resize_file(paths[0], size - 1);
+    EXPECT_FALSE(cache.find(path, CHANNELS));
+    std::filesystem::resize_file(paths[0], 16);
+    EXPECT_FALSE(cache.find(path, CHANNELS));
+}
+
+TEST_F(ImageCacheTest, TrimEvictsTheLeastRecentlyUsed) {
+    ImageCache sizer((m_dir / "sizer").string());
+    ASSERT_TRUE(store(sizer, source("sizer.png")));
+    std::uintmax_t entry_size =
+            std::filesystem::file_size(entries(sizer).at(0));
+
+    ImageCache cache((m_dir / "cache").string(), entry_size * 2);
+    std::string a = source("a.png");
+    std::string b = source("b.png");
+    std::string c = source("c.png");
+    ASSERT_TRUE(store(cache, a));
+    std::this_thread::sleep_for(std::chrono::milliseconds(20));
+    ASSERT_TRUE(store(cache, b));
+    std::this_thread::sleep_for(std::chrono::milliseconds(20));
+    // A hit makes a the most recently used, so b goes first.
+    ASSERT_TRUE(cache.find(a, CHANNELS));
+    std::this_thread::sleep_for(std::chrono::milliseconds(20));
+    ASSERT_TRUE(store(cache, c));
+
+    EXPECT_EQ(2u, entries(cache).size());
+    EXPECT_TRUE(cache.find(a, CHANNELS));
+    EXPECT_FALSE(cache.find(b, CHANNELS));
+    EXPECT_TRUE(cache.find(c, CHANNELS));
+
+    // Replacing an entry does not count it twice.
+    ASSERT_TRUE(store(cache, c));
+    EXPECT_TRUE(cache.find(a, CHANNELS));
+    EXPECT_TRUE(cache.find(c, CHANNELS));
+}
+
+TEST_F(ImageCacheTest, ClearDeletesEveryEntry) {
+    ImageCache cache((m_dir / "cache").string());
+    std::string a = source("a.png");
+    std::string b = source("b.png");
+    ASSERT_TRUE(store(cache, a));
+    ASSERT_TRUE(store(cache, b));
+    cache.clear();
+    EXPECT_TRUE(entries(cache).empty());
+    EXPECT_FALSE(cache.find(a, CHANNELS));
+}
+}  // namespace
@@ -0,0 +1,145 @@
+////////////////////////////////////////////////////////////////////////////
+// Copyright (c) 2026 intel_vulkan
+// All rights reserved.
+//
+// Contact: mehoggan@gmail.com
+//
+// This software is licensed under the terms of the Your License.
+// See the LICENSE file in the top-level directory.
+/////////////////////////////////////////////////////////////////////////
+
+#include "intel_vulkan/ImageLoader.h"
+#include "intel_vulkan/Tools.h"
+
+#include <gtest/gtest.h>
+
+#include <chrono>
+#include <future>
+#include <memory>
+#include <string>
+#include <vector>
+
+namespace {
+using intel_vulkan::Tools::ImageLoader;
+using intel_vulkan::Tools::LoadedImage;
+
+const std::string TEXTURE =
+        std::string(INTEL_VULKAN_RESOURCES_DIR) + "/06/Data/texture.png";
+constexpr int WIDTH = 512;
+constexpr int HEIGHT = 462;
+constexpr std::size_t RGBA_SIZE = std::size_t(WIDTH) * HEIGHT * 4;
+constexpr std::size_t GRAY_SIZE = std::size_t(WIDTH) * HEIGHT;
+
+// Long enough for a worker to have decoded an image it was allowed to.
+constexpr auto SETTLE_TIME = std::chrono::milliseconds(200);
+
+bool isReady(const std::future<LoadedImage>& future) {
+    return future.wait_for(SETTLE_TIME) == std::future_status::ready;
+}
+
+TEST(ImageLoaderTest, DecodesEveryImage) {
+    std::vector<char> expected =
+            intel_vulkan::Tools::getImageData(TEXTURE, 4, nullptr, nullptr,
+                                              nullptr, nullptr);
+    ASSERT_EQ(RGBA_SIZE, expected.size());
+
+    ImageLoader loader(4);
+    std::vector<std::future<LoadedImage>> futures =
+            loader.load(std::vector<std::string>(8, TEXTURE), 4);
+    for (std::future<LoadedImage>& future : futures) {
+        LoadedImage image = future.get();
+        ASSERT_TRUE(image.loaded);
+        EXPECT_FALSE(image.cancelled);
+        EXPECT_EQ(WIDTH, image.width);
+        EXPECT_EQ(HEIGHT, image.height);
+        EXPECT_EQ(3, image.components);
+        EXPECT_EQ(expected, image.data);
+    }
+}
+
+TEST(ImageLoaderTest, MissingFileTakesItsTurn) {
+    ImageLoader loader(2, RGBA_SIZE);
+    std::vector<std::future<LoadedImage>> futures =
+            loader.load({"missing.png", TEXTURE}, 4);
+    LoadedImage missing = futures[0].get();
+    EXPECT_FALSE(missing.loaded);
+    EXPECT_FALSE(missing.cancelled);
+    EXPECT_TRUE(futures[1].get().loaded);
+}
+
+TEST(ImageLoaderTest, BudgetBoundsTheImagesInFlight) {
+    ImageLoader loader(4, 2 * RGBA_SIZE);
+    std::vector<std::future<LoadedImage>> futures =
+            loader.load(std::vector<std::string>(4, TEXTURE), 4);
+    LoadedImage first = futures[0].get();
+    LoadedImage second = futures[1].get();
+    ASSERT_TRUE(first.loaded);
+    ASSERT_TRUE(second.loaded);
+    EXPECT_FALSE(isReady(futures[2]));
+
+    first.release();
+    ASSERT_TRUE(isReady(futures[2]));
+    LoadedImage third = futures[2].get();
+    EXPECT_TRUE(third.loaded);
+    EXPECT_FALSE(isReady(futures[3]));
+
+    // Destroying the last copy returns the bytes as well.
+    second = LoadedImage();
+    EXPECT_TRUE(futures[3].get().loaded);
+}
+
+TEST(ImageLoaderTest, ImagesAreLetInInQueueOrder) {
+    // Room for one RGBA image and one gray one, but the gray one queued
+    // after a second RGBA image must wait for that one's turn.
+    ImageLoader loader(4, RGBA_SIZE + GRAY_SIZE);
+    std::vector<std::future<LoadedImage>> rgba =
+            loader.load({TEXTURE, TEXTURE}, 4);
+    std::vector<std::future<LoadedImage>> gray = loader.load({TEXTURE}, 1);
+    LoadedImage held = rgba[0].get();
+    ASSERT_TRUE(held.loaded);
+    EXPECT_FALSE(isReady(rgba[1]));
+    EXPECT_FALSE(isReady(gray[0]));
+
+    held.release();
+    EXPECT_TRUE(rgba[1].get().loaded);
+    LoadedImage small = gray[0].get();
+    EXPECT_TRUE(small.loaded);
+    EXPECT_EQ(GRAY_SIZE, small.data.size());
+}
+
+TEST(ImageLoaderTest, ImageLargerThanTheBudgetIsDecodedAlone) {
+    ImageLoader loader(2, 1);
+    std::vector<std::future<LoadedImage>> futures =
+            loader.load({TEXTURE, TEXTURE}, 4);
+    LoadedImage first = futures[0].get();
+    ASSERT_TRUE(first.loaded);
+    EXPECT_FALSE(isReady(futures[1]));
+    first.release();
+    EXPECT_TRUE(futures[1].get().loaded);
+}
+
+TEST(ImageLoaderTest, DestroyingTheLoaderCancelsWaitingImages) {
+    auto loader = std::make_unique<ImageLoader>(2, RGBA_SIZE);
+    std::vector<std::future<LoadedImage>> futures =
+            loader->load(std::vector<std::string>(4, TEXTURE), 4);
+    LoadedImage held = futures[0].get();
+    ASSERT_TRUE(held.loaded);
+    EXPECT_FALSE(isReady(futures[1]));
+
+    // Must not wait for the held image to be released.
+    std::future<void> destroyed = std::async(
+            std::launch::async, [&loader]() { loader.reset(); });
+    ASSERT_EQ(std::future_status::ready,
+              destroyed.wait_for(std::chrono::seconds(10)));
+    for (std::size_t index = 1; index < futures.size(); ++index) {
+        LoadedImage image = futures[index].get();
+        EXPECT_TRUE(image.cancelled);
+        EXPECT_FALSE(image.loaded);
+        EXPECT_TRUE(image.data.empty());
+    }
+
+    // The reservation outlives the loader.
+    EXPECT_EQ(RGBA_SIZE, held.data.size());
+    held.release();
+}
+}  // namespace
@@ -0,0 +1,94 @@
+////////////////////////////////////////////////////////////////////////////
+// Copyright (c) 2026 intel_vulkan
+// All rights reserved.
+//
+// Contact: mehoggan@gmail.com
+//
+// This software is licensed under the terms of the Your License.
+// See the LICENSE file in the top-level directory.
+/////////////////////////////////////////////////////////////////////////
+
+#include "intel_vulkan/Logging.h"
+
+#include "AllocationCounter.h"
+
+#include <gtest/gtest.h>
+
+#include <cstdint>
+
+namespace {
+constexpr std::uint64_t WARM_UP_CALLS = 4096;
+constexpr std::uint64_t MEASURED_CALLS = 1024;
+// Boost opens each synchronous record with a couple of allocations of its
+// own, and how many depends on its version. Formatting per call would add
+// several more, which is what this bound catches.
+constexpr double SYNC_ALLOCATIONS_LIMIT = 4.0;
+
+const intel_vulkan::LogTag& testTag() {
+    static intel_vulkan::LogTag test_tag("LoggingAllocationTest");
+    return test_tag;
+}
+
+void logInfo(std::uint64_t frame) {
+    intel_vulkan::Logging::info(
+            testTag(), "swapchain", 1920, "x", 1080, "frame", frame);
+}
+
+void logInfof(std::uint64_t frame) {
+    intel_vulkan::Logging::infof(
+            testTag(), "swapchain {}x{} frame {}", 1920, 1080, frame);
+}
+
+// Heap allocations on the calling thread per call of log_once, counted by
+// the operator new of AllocationCounter.cpp, after a warm up pass
+// that lets the reusable buffers reach their steady size.
+template <typename LogOnce>
+double allocationsPerCall(LogOnce log_once) {
+    std::uint64_t frame = 0;
+    for (; frame < WARM_UP_CALLS; ++frame) {
+        log_once(frame);
+    }
+    std::uint64_t allocations = threadAllocationCount();
+    for (std::uint64_t call = 0; call < MEASURED_CALLS; ++call) {
+        log_once(++frame);
+    }
+    allocations = threadAllocationCount() - allocations;
+    return static_cast<double>(allocations) / MEASURED_CALLS;
+}
+
+class LoggingAllocationTest : public ::testing::Test {
+protected:
+    void SetUp() override {
+        intel_vulkan::Logging::clearAll();
+        ASSERT_TRUE(intel_vulkan::Logging::addFileLogger(
+                testTag(), "/dev/null", INTEL_VULKAN_TRACE));
+    }
+
+    void TearDown() override {
+        intel_vulkan::Logging::disableAsync();
+        intel_vulkan::Logging::clearAll();
+    }
+};
+}  // namespace
+
+// The synchronous path reuses the thread's format stream and Boost logger,
+// so only Boost's own allocations for the record remain.
+TEST_F(LoggingAllocationTest, SyncInfoOnlyAllocatesForTheRecord) {
+    EXPECT_LE(allocationsPerCall(logInfo), SYNC_ALLOCATIONS_LIMIT);
+}
+
+TEST_F(LoggingAllocationTest, SyncInfofOnlyAllocatesForTheRecord) {
+    EXPECT_LE(allocationsPerCall(logInfof), SYNC_ALLOCATIONS_LIMIT);
+}
+
+// In async mode the message is assigned into a ring cell whose buffer is
+// reused, so the calling thread does not allocate at all.
+TEST_F(LoggingAllocationTest, AsyncInfoDoesNotAllocate) {
+    ASSERT_TRUE(intel_vulkan::Logging::enableAsync(1024));
+    EXPECT_EQ(0.0, allocationsPerCall(logInfo));
+}
+
+TEST_F(LoggingAllocationTest, AsyncInfofDoesNotAllocate) {
+    ASSERT_TRUE(intel_vulkan::Logging::enableAsync(1024));
+    EXPECT_EQ(0.0, allocationsPerCall(logInfof));
+}
@@ -0,0 +1,134 @@
+////////////////////////////////////////////////////////////////////////////
+// Copyright (c) 2026 intel_vulkan
+// All rights reserved.
+//
+// Contact: mehoggan@gmail.com
+//
+// This software is licensed under the terms of the Your License.
+// See the LICENSE file in the top-level directory.
+/////////////////////////////////////////////////////////////////////////
+
+#include "intel_vulkan/MipChain.h"
+
+#include <gtest/gtest.h>
+
+#include <cstdint>
+#include <vector>
+
+namespace {
+namespace Tools = intel_vulkan::Tools;
+
+// An RGBA8 image whose pixels all have the color channels set to the
+// value \p value(column, row) and an opaque alpha.
+template <typename Value>
+std::vector<std::uint8_t> grayImage(std::uint32_t width,
+                                    std::uint32_t height,
+                                    Value value) {
+    std::vector<std::uint8_t> pixels(static_cast<std::size_t>(width) * height *
+                                     4);
+    for (std::uint32_t row = 0; row < height; ++row) {
+        for (std::uint32_t column = 0; column < width; ++column) {
+            std::uint8_t* pixel =
+                    &pixels[(static_cast<std::size_t>(row) * width + column) *
+                            4];
+            pixel[0] = pixel[1] = pixel[2] = value(column, row);
+            pixel[3] = 255;
+        }
+    }
+    return pixels;
+}
+
+// The red channel of the texel at \p column, \p row of \p level.
+std::uint8_t red(const Tools::MipChain& chain,
+                 std::size_t level,
+                 std::uint32_t column,
+                 std::uint32_t row) {
+    const Tools::MipLevel& mip = chain.levels[level];
+    return static_cast<std::uint8_t>(
+            chain.data[mip.offset +
+                       (static_cast<std::size_t>(row) * mip.width + column) *
+                               4]);
+}
+}  // namespace
+
+TEST(MipChainTest, LevelSizesRoundDown) {
+    std::vector<std::uint8_t> pixels =
+            grayImage(5, 3, [](std::uint32_t, std::uint32_t) { return 0; });
+    Tools::MipChain chain =
+            Tools::generateMipChain(pixels.data(), 5, 3, 0, false);
+    ASSERT_EQ(3u, chain.levels.size());
+    EXPECT_EQ(2u, chain.levels[1].width);
+    EXPECT_EQ(1u, chain.levels[1].height);
+    EXPECT_EQ(1u, chain.levels[2].width);
+    EXPECT_EQ(1u, chain.levels[2].height);
+}
+
+TEST(MipChainTest, EvenSidesAverageTwoByTwo) {
+    std::vector<std::uint8_t> pixels =
+            grayImage(4, 2, [](std::uint32_t column, std::uint32_t row) {
+                return static_cast<std::uint8_t>(column * 40 + row * 10);
+            });
+    Tools::MipChain chain =
+            Tools::generateMipChain(pixels.data(), 4, 2, 0, false);
+    ASSERT_EQ(3u, chain.levels.size());
+    // (0 + 40 + 10 + 50) / 4 and (80 + 120 + 90 + 130) / 4.
+    EXPECT_EQ(25, red(chain, 1, 0, 0));
+    EXPECT_EQ(105, red(chain, 1, 1, 0));
+}
+
+// With only the last row of a 3x3 image set, a 2x2 box that drops it
+// would produce black.
+TEST(MipChainTest, OddSidesWeighInTheLastRowAndColumn) {
+    std::vector<std::uint8_t> last_row =
+            grayImage(3, 3, [](std::uint32_t, std::uint32_t row) {
+                return static_cast<std::uint8_t>(row == 2 ? 255 : 0);
+            });
+    Tools::MipChain chain =
+            Tools::generateMipChain(last_row.data(), 3, 3, 0, false);
+    ASSERT_EQ(2u, chain.levels.size());
+    EXPECT_EQ(85, red(chain, 1, 0, 0));
+
+    std::vector<std::uint8_t> last_column =
+            grayImage(3, 3, [](std::uint32_t column, std::uint32_t) {
+                return static_cast<std::uint8_t>(column == 2 ? 255 : 0);
+            });
+    chain = Tools::generateMipChain(last_column.data(), 3, 3, 0, false);
+    EXPECT_EQ(85, red(chain, 1, 0, 0));
+}
+
+// Five texels spread over two: weights 2/5, 2/5, 1/5 and 1/5, 2/5, 2/5.
+TEST(MipChainTest, OddSidesUseThreeTapWeights) {
+    std::vector<std::uint8_t> pixels =
+            grayImage(5, 1, [](std::uint32_t column, std::uint32_t) {
+                return static_cast<std::uint8_t>(column == 4 ? 250 : 0);
+            });
+    Tools::MipChain chain =
+            Tools::generateMipChain(pixels.data(), 5, 1, 0, false);
+    ASSERT_EQ(3u, chain.levels.size());
+    EXPECT_EQ(0, red(chain, 1, 0, 0));
+    EXPECT_EQ(100, red(chain, 1, 1, 0));
+    EXPECT_EQ(50, red(chain, 2, 0, 0));
+}
+
+TEST(MipChainTest, OddSidesKeepUniformSrgbColor) {
+    std::vector<std::uint8_t> pixels(7 * 5 * 4);
+    for (std::size_t index = 0; index < 7 * 5; ++index) {
+        pixels[index * 4 + 0] = 200;
+        pixels[index * 4 + 1] = 100;
+        pixels[index * 4 + 2] = 50;
+        pixels[index * 4 + 3] = 128;
+    }
+    Tools::MipChain chain =
+            Tools::generateMipChain(pixels.data(), 7, 5, 0, true);
+    for (const Tools::MipLevel& level : chain.levels) {
+        for (std::size_t texel = 0;
+             texel < static_cast<std::size_t>(level.width) * level.height;
+             ++texel) {
+            const char* pixel = &chain.data[level.offset + texel * 4];
+            EXPECT_EQ(200, static_cast<std::uint8_t>(pixel[0]));
+            EXPECT_EQ(100, static_cast<std::uint8_t>(pixel[1]));
+            EXPECT_EQ(50, static_cast<std::uint8_t>(pixel[2]));
+            EXPECT_EQ(128, static_cast<std::uint8_t>(pixel[3]));
+        }
+    }
+}
@@ -0,0 +1,253 @@
+////////////////////////////////////////////////////////////////////////////
+// Copyright (c) 2026 intel_vulkan
+// All rights reserved.
+//
+// Contact: mehoggan@gmail.com
+//
+// This software is licensed under the terms of the Your License.
+// See the LICENSE file in the top-level directory.
+/////////////////////////////////////////////////////////////////////////
+
+#include "intel_vulkan/PixelConvert.h"
+
+#include <gtest/gtest.h>
+
+#include <cstdint>
+#include <cstring>
+#include <random>
+#include <string>
+#include <vector>
+
+namespace {
+namespace PixelConvert = intel_vulkan::Tools::PixelConvert;
+
+// The offsets the source and destination are shifted by, in bytes and in
+// elements of the destination type, so the SIMD kernels also run on
+// buffers that are not 16 or 32 byte aligned.
+constexpr std::size_t MAX_OFFSET = 3;
+
+// Every length up to a few AVX2 iterations, so each kernel's scalar tail
+// is hit with every remainder, plus a longer odd one.
+std::vector<std::size_t> pixelCounts() {
+    std::vector<std::size_t> counts;
+    for (std::size_t count = 0; count <= 67; ++count) {
+        counts.push_back(count);
+    }
+    counts.push_back(1031);
+    return counts;
+}
+
+std::vector<std::uint8_t> randomBytes(std::size_t size, unsigned seed) {
+    std::vector<std::uint8_t> bytes(size);
+    std::mt19937 random(seed);
+    for (std::uint8_t& value : bytes) {
+        value = static_cast<std::uint8_t>(random());
+    }
+    return bytes;
+}
+
+std::string isaName(PixelConvert::Isa isa) {
+    switch (isa) {
+        case PixelConvert::Isa::AVX2:
+            return "AVX2";
+        case PixelConvert::Isa::SSSE3:
+            return "SSSE3";
+        case PixelConvert::Isa::SCALAR:
+            break;
+    }
+    return "SCALAR";
+}
+
+class PixelConvertTest : public ::testing::Test {
+protected:
+    void TearDown() override {
+        PixelConvert::setIsa(PixelConvert::bestIsa());
+    }
+
+    // The SIMD instruction sets the CPU supports.
+    static std::vector<PixelConvert::Isa> simdIsas() {
+        std::vector<PixelConvert::Isa> isas;
+        for (PixelConvert::Isa isa :
+             {PixelConvert::Isa::SSSE3, PixelConvert::Isa::AVX2}) {
+            if (isa <= PixelConvert::bestIsa()) {
+                isas.push_back(isa);
+            }
+        }
+        return isas;
+    }
+
+    // Runs \p convert(src, dst, pixel_count) with the scalar kernels and
+    // with every SIMD kernel, for every pixel count and source and
+    // destination offset, and expects identical output bytes.
+    template <typename Out, typename Convert>
+    static void expectMatchesScalar(std::size_t in_per_pixel,
+                                    std::size_t out_per_pixel,
+                                    Convert convert) {
+        std::vector<PixelConvert::Isa> isas = simdIsas();
+        if (isas.empty()) {
+            GTEST_SKIP() << "no SIMD instruction set supported";
+        }
+        for (std::size_t count : pixelCounts()) {
+            std::vector<std::uint8_t> src = randomBytes(
+                    (count + MAX_OFFSET) * in_per_pixel,
+                    static_cast<unsigned>(count));
+            for (std::size_t src_offset = 0; src_offset <= MAX_OFFSET;
+                 ++src_offset) {
+                const std::uint8_t* in = src.data() + src_offset;
+                std::vector<Out> expected(count * out_per_pixel + 1);
+                PixelConvert::setIsa(PixelConvert::Isa::SCALAR);
+                convert(in, expected.data(), count);
+                for (PixelConvert::Isa isa : isas) {
+                    ASSERT_EQ(isa, PixelConvert::setIsa(isa));
+                    for (std::size_t dst_offset = 0;
+                         dst_offset <= MAX_OFFSET;
+                         ++dst_offset) {
+                        // Offsets in elements, which leave the
+                        // destination off 16 and 32 byte alignment.
+                        std::vector<Out> actual(
+                                count * out_per_pixel + 1 + MAX_OFFSET);
+                        std::memset(actual.data(),
+                                    0xcd,
+                                    actual.size() * sizeof(Out));
+                        Out* out = actual.data() + dst_offset;
+                        convert(in, out, count);
+                        EXPECT_EQ(0,
+                                  std::memcmp(expected.data(),
+                                              out,
+                                              count * out_per_pixel *
+                                                      sizeof(Out)))
+                                << isaName(isa) << ", " << count
+                                << " pixels, source offset " << src_offset
+                                << ", destination offset " << dst_offset;
+                        // Nothing is written past the last pixel.
+                        const std::uint8_t* end =
+                                reinterpret_cast<const std::uint8_t*>(
+                                        out + count * out_per_pixel);
+                        EXPECT_EQ(0xcd, end[0])
+                                << isaName(isa) << ", " << count
+                                << " pixels";
+                    }
+                }
+            }
+        }
+    }
+
+    // Converts RGBA8 pixels in place with every instruction set and expects
+    // the result of the scalar kernels run out of place.
+    template <typename Convert>
+    static void expectInPlaceMatchesScalar(Convert convert) {
+        for (std::size_t count : pixelCounts()) {
+            std::vector<std::uint8_t> src = randomBytes(
+                    (count + 1) * 4, static_cast<unsigned>(count) + 1000);
+            std::vector<std::uint8_t> expected((count + 1) * 4);
+            PixelConvert::setIsa(PixelConvert::Isa::SCALAR);
+            convert(src.data() + 1, expected.data(), count);
+            std::vector<PixelConvert::Isa> isas = simdIsas();
+            isas.push_back(PixelConvert::Isa::SCALAR);
+            for (PixelConvert::Isa isa : isas) {
+                ASSERT_EQ(isa, PixelConvert::setIsa(isa));
+                std::vector<std::uint8_t> pixels = src;
+                convert(pixels.data() + 1, pixels.data() + 1, count);
+                EXPECT_EQ(0,
+                          std::memcmp(expected.data(),
+                                      pixels.data() + 1,
+                                      count * 4))
+                        << isaName(isa) << ", " << count << " pixels";
+            }
+        }
+    }
+};
+}  // namespace
+
+TEST_F(PixelConvertTest, RgbToRgbaMatchesScalar) {
+    expectMatchesScalar<std::uint8_t>(
+            3,
+            4,
+            [](const std::uint8_t* src, std::uint8_t* dst, std::size_t count) {
+                PixelConvert::rgbToRgba(src, dst, count);
+            });
+}
+
+TEST_F(PixelConvertTest, RgbaToBgraMatchesScalar) {
+    expectMatchesScalar<std::uint8_t>(
+            4,
+            4,
+            [](const std::uint8_t* src, std::uint8_t* dst, std::size_t count) {
+                PixelConvert::rgbaToBgra(src, dst, count);
+            });
+}
+
+TEST_F(PixelConvertTest, SrgbToLinearMatchesScalar) {
+    expectMatchesScalar<float>(
+            4, 4, [](const std::uint8_t* src, float* dst, std::size_t count) {
+                PixelConvert::srgbToLinear(src, dst, count);
+            });
+}
+
+TEST_F(PixelConvertTest, PremultiplyAlphaMatchesScalar) {
+    expectMatchesScalar<std::uint8_t>(
+            4,
+            4,
+            [](const std::uint8_t* src, std::uint8_t* dst, std::size_t count) {
+                PixelConvert::premultiplyAlpha(src, dst, count);
+            });
+}
+
+TEST_F(PixelConvertTest, UnormToHalfMatchesScalar) {
+    // Four channels per "pixel", converted as individual values.
+    expectMatchesScalar<std::uint16_t>(
+            4,
+            4,
+            [](const std::uint8_t* src, std::uint16_t* dst, std::size_t count) {
+                PixelConvert::unormToHalf(src, dst, count * 4);
+            });
+}
+
+TEST_F(PixelConvertTest, RgbaToBgraInPlace) {
+    expectInPlaceMatchesScalar(
+            [](const std::uint8_t* src, std::uint8_t* dst, std::size_t count) {
+                PixelConvert::rgbaToBgra(src, dst, count);
+            });
+}
+
+TEST_F(PixelConvertTest, PremultiplyAlphaInPlace) {
+    expectInPlaceMatchesScalar(
+            [](const std::uint8_t* src, std::uint8_t* dst, std::size_t count) {
+                PixelConvert::premultiplyAlpha(src, dst, count);
+            });
+}
+
+// Every color and alpha pair, with alpha left unchanged and each color
+// channel rounded to nearest.
+TEST_F(PixelConvertTest, PremultiplyAlphaRoundsToNearest) {
+    std::vector<std::uint8_t> src(256 * 256 * 4);
+    for (std::size_t color = 0; color < 256; ++color) {
+        for (std::size_t alpha = 0; alpha < 256; ++alpha) {
+            std::uint8_t* pixel = &src[(color * 256 + alpha) * 4];
+            pixel[0] = static_cast<std::uint8_t>(color);
+            pixel[1] = static_cast<std::uint8_t>(255 - color);
+            pixel[2] = static_cast<std::uint8_t>(color);
+            pixel[3] = static_cast<std::uint8_t>(alpha);
+        }
+    }
+    std::vector<PixelConvert::Isa> isas = simdIsas();
+    isas.push_back(PixelConvert::Isa::SCALAR);
+    for (PixelConvert::Isa isa : isas) {
+        ASSERT_EQ(isa, PixelConvert::setIsa(isa));
+        std::vector<std::uint8_t> dst(src.size());
+        PixelConvert::premultiplyAlpha(src.data(), dst.data(), 256 * 256);
+        for (std::size_t index = 0; index < 256 * 256; ++index) {
+            unsigned alpha = src[index * 4 + 3];
+            for (std::size_t channel = 0; channel < 3; ++channel) {
+                unsigned color = src[index * 4 + channel];
+                // round(c * a / 255) in integers: a product exactly halfway
+                // between two multiples of 255 cannot occur, as 255 is odd.
+                unsigned expected = (color * alpha * 2 + 255) / 510;
+                ASSERT_EQ(expected, dst[index * 4 + channel])
+                        << isaName(isa) << ", color " << color << ", alpha "
+                        << alpha;
+            }
+            ASSERT_EQ(alpha, dst[index * 4 + 3]) << isaName(isa);
+        }
+    }
+}
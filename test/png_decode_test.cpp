@@ -0,0 +1,681 @@
+////////////////////////////////////////////////////////////////////////////
+// Copyright (c) 2026 intel_vulkan
+// All rights reserved.
+//
+// Contact: mehoggan@gmail.com
+//
+// This software is licensed under the terms of the Your License.
+// See the LICENSE file in the top-level directory.
+/////////////////////////////////////////////////////////////////////////
+
+#include "intel_vulkan/PngDecode.h"
+#include "intel_vulkan/STBImage.h"
+
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <array>
+#include <cstdint>
+#include <cstdlib>
+#include <filesystem>
+#include <fstream>
+#include <iterator>
+#include <random>
+#include <string>
+#include <vector>
+
+namespace {
+namespace Tools = intel_vulkan::Tools;
+namespace CpuFeatures = Tools::CpuFeatures;
+
+// The thread counts decodes run with: one, and enough for every run of
+// independent IDAT chunks the large images have.
+constexpr std::array<std::size_t, 2> THREAD_COUNTS = {1, 4};
+
+enum class Deflate {
+    STORED,  ///< Stored blocks only, which the threads split at flushes.
+    FIXED,  ///< Fixed Huffman codes with matches, as a real encoder.
+};
+
+enum class Flush {
+    FULL,  ///< The window is reset, so the chunks are independent.
+    SYNC,  ///< Matches may reach back into the previous chunk.
+};
+
+struct PngOptions {
+    std::uint32_t width = 1;
+    std::uint32_t height = 1;
+    std::uint8_t bit_depth = 8;
+    std::uint8_t color_type = 6;
+    bool transparency = false;  ///< Write a tRNS chunk.
+    Deflate deflate = Deflate::FIXED;
+    Flush flush = Flush::FULL;
+    std::size_t chunk_count = 1;  ///< IDAT chunks, each ending in a flush.
+    unsigned seed = 0;
+};
+
+std::size_t channelCount(std::uint8_t color_type) {
+    switch (color_type) {
+        case 0:
+        case 3:
+            return 1;
+        case 2:
+            return 3;
+        case 4:
+            return 2;
+        default:
+            return 4;
+    }
+}
+
+// Writes a deflate bit stream, least significant bit first.
+class BitWriter {
+public:
+    void write(std::uint32_t bits, unsigned count) {
+        for (unsigned bit = 0; bit < count; ++bit) {
+            if (m_bit_count == 0) {
+                m_bytes.push_back(0);
+            }
+            m_bytes.back() |= static_cast<std::uint8_t>(((bits >> bit) & 1u)
+                                                        << m_bit_count);
+            m_bit_count = (m_bit_count + 1) % 8;
+        }
+    }
+
+    // Huffman codes go most significant bit first.
+    void writeCode(std::uint32_t code, unsigned length) {
+        for (unsigned bit = length; bit > 0; --bit) {
+            write((code >> (bit - 1)) & 1u, 1);
+        }
+    }
+
+    void alignToByte() { m_bit_count = 0; }
+
+    std::vector<std::uint8_t>& bytes() { return m_bytes; }
+
+private:
+    std::vector<std::uint8_t> m_bytes;
+    unsigned m_bit_count = 0;
+};
+
+constexpr std::array<std::uint16_t, 29> LENGTH_BASES = {
+        3,  4,  5,  6,  7,  8,  9,  10, 11,  13,  15,  17,  19,  23, 27,
+        31, 35, 43, 51, 59, 67, 83, 99, 115, 131, 163, 195, 227, 258};
+constexpr std::array<std::uint8_t, 29> LENGTH_EXTRA_BITS = {
+        0, 0, 0, 0, 0, 0, 0, 0, 1, 1, 1, 1, 2, 2, 2,
+        2, 3, 3, 3, 3, 4, 4, 4, 4, 5, 5, 5, 5, 0};
+constexpr std::array<std::uint16_t, 30> DISTANCE_BASES = {
+        1,    2,    3,    4,    5,    7,     9,     13,    17,  25,
+        33,   49,   65,   97,   129,  193,   257,   385,   513, 769,
+        1025, 1537, 2049, 3073, 4097, 6145, 8193, 12289, 16385, 24577};
+constexpr std::array<std::uint8_t, 30> DISTANCE_EXTRA_BITS = {
+        0, 0, 0, 0, 1, 1, 2, 2,  3,  3,  4,  4,  5,  5,  6,
+        6, 7, 7, 8, 8, 9, 9, 10, 10, 11, 11, 12, 12, 13, 13};
+
+// Writes \p symbol of the fixed literal/length code.
+void writeFixedSymbol(BitWriter& writer, unsigned symbol) {
+    if (symbol < 144) {
+        writer.writeCode(0x30 + symbol, 8);
+    } else if (symbol < 256) {
+        writer.writeCode(0x190 + symbol - 144, 9);
+    } else if (symbol < 280) {
+        writer.writeCode(symbol - 256, 7);
+    } else {
+        writer.writeCode(0xc0 + symbol - 280, 8);
+    }
+}
+
+void writeMatch(BitWriter& writer, std::size_t length, std::size_t distance) {
+    std::size_t code = LENGTH_BASES.size() - 1;
+    while (LENGTH_BASES[code] > length) {
+        --code;
+    }
+    writeFixedSymbol(writer, static_cast<unsigned>(257 + code));
+    writer.write(static_cast<std::uint32_t>(length - LENGTH_BASES[code]),
+                 LENGTH_EXTRA_BITS[code]);
+    code = DISTANCE_BASES.size() - 1;
+    while (DISTANCE_BASES[code] > distance) {
+        --code;
+    }
+    writer.writeCode(static_cast<std::uint32_t>(code), 5);
+    writer.write(static_cast<std::uint32_t>(distance - DISTANCE_BASES[code]),
+                 DISTANCE_EXTRA_BITS[code]);
+}
+
+// Deflates raw[begin, end) as one block, with matches reaching no further
+// back than \p window_start.
+void deflateBlock(BitWriter& writer,
+                  const std::vector<std::uint8_t>& raw,
+                  std::size_t begin,
+                  std::size_t end,
+                  std::size_t window_start,
+                  Deflate deflate,
+                  std::size_t stride) {
+    if (deflate == Deflate::STORED) {
+        for (std::size_t offset = begin; offset < end;) {
+            std::size_t size = std::min<std::size_t>(end - offset, 65535);
+            writer.write(0, 3);
+            writer.alignToByte();
+            writer.write(static_cast<std::uint32_t>(size), 16);
+            writer.write(static_cast<std::uint32_t>(~size & 0xffff), 16);
+            writer.bytes().insert(writer.bytes().end(),
+                                  raw.begin() + offset,
+                                  raw.begin() + offset + size);
+            offset += size;
+        }
+        return;
+    }
+
+    // Not the final block, fixed Huffman codes.
+    writer.write(0, 1);
+    writer.write(1, 2);
+    for (std::size_t offset = begin; offset < end;) {
+        // Runs, and the rows makePng repeats.
+        std::size_t best_length = 0;
+        std::size_t best_distance = 0;
+        for (std::size_t distance : {std::size_t(1), stride * 5}) {
+            if (distance == 0 || distance > offset - window_start ||
+                distance > 32768) {
+                continue;
+            }
+            std::size_t length = 0;
+            while (length < 258 && offset + length < end &&
+                   raw[offset + length] == raw[offset + length - distance]) {
+                ++length;
+            }
+            if (length > best_length) {
+                best_length = length;
+                best_distance = distance;
+            }
+        }
+        if (best_length >= 3) {
+            writeMatch(writer, best_length, best_distance);
+            offset += best_length;
+        } else {
+            writeFixedSymbol(writer, raw[offset]);
+            ++offset;
+        }
+    }
+    writeFixedSymbol(writer, 256);
+}
+
+std::uint32_t adler32(const std::vector<std::uint8_t>& data) {
+    std::uint32_t low = 1;
+    std::uint32_t high = 0;
+    for (std::uint8_t value : data) {
+        low = (low + value) % 65521;
+        high = (high + low) % 65521;
+    }
+    return (high << 16) | low;
+}
+
+std::uint32_t crc32(const std::string& data) {
+    std::uint32_t crc = 0xffffffffu;
+    for (char value : data) {
+        crc ^= static_cast<std::uint8_t>(value);
+        for (int bit = 0; bit < 8; ++bit) {
+            crc = (crc >> 1) ^ (0xedb88320u & (0u - (crc & 1u)));
+        }
+    }
+    return ~crc;
+}
+
+void appendBigEndian(std::string& out, std::uint32_t value) {
+    for (int shift = 24; shift >= 0; shift -= 8) {
+        out.push_back(static_cast<char>((value >> shift) & 0xff));
+    }
+}
+
+void appendChunk(std::string& png, const char* type, const std::string& data) {
+    appendBigEndian(png, static_cast<std::uint32_t>(data.size()));
+    std::string body = std::string(type, 4) + data;
+    png += body;
+    appendBigEndian(png, crc32(body));
+}
+
+// Applies PNG filter \p filter to \p row, with \p prior the row above.
+void filterRow(int filter,
+               const std::uint8_t* row,
+               const std::uint8_t* prior,
+               std::size_t size,
+               std::size_t pixel_size,
+               std::uint8_t* out) {
+    for (std::size_t index = 0; index < size; ++index) {
+        int left = index >= pixel_size ? row[index - pixel_size] : 0;
+        int up = prior[index];
+        int up_left = index >= pixel_size ? prior[index - pixel_size] : 0;
+        int predictor = 0;
+        switch (filter) {
+            case 1:
+                predictor = left;
+                break;
+            case 2:
+                predictor = up;
+                break;
+            case 3:
+                predictor = (left + up) / 2;
+                break;
+            case 4: {
+                int estimate = left + up - up_left;
+                int to_left = std::abs(estimate - left);
+                int to_up = std::abs(estimate - up);
+                int to_up_left = std::abs(estimate - up_left);
+                predictor = to_left <= to_up && to_left <= to_up_left
+                                    ? left
+                                    : (to_up <= to_up_left ? up : up_left);
+                break;
+            }
+        }
+        out[index] = static_cast<std::uint8_t>(row[index] - predictor);
+    }
+}
+
+// A PNG of random pixels with the filter types in turn. Every other run
+// of five rows repeats the five before it, so those filter to the same
+// bytes and the fixed Huffman encoder finds long matches.
+std::string makePng(const PngOptions& options) {
+    std::mt19937 random(options.seed);
+    std::size_t pixel_size =
+            channelCount(options.color_type) * options.bit_depth / 8;
+    std::size_t stride = options.width * pixel_size;
+    std::vector<std::uint8_t> pixels(stride * options.height);
+    for (std::size_t index = 0; index < pixels.size(); ++index) {
+        if (index / stride / 5 % 2 == 1) {
+            pixels[index] = pixels[index - stride * 5];
+        } else if (options.color_type == 3) {
+            pixels[index] = static_cast<std::uint8_t>(random() % 16);
+        } else {
+            pixels[index] = static_cast<std::uint8_t>(random());
+        }
+    }
+
+    std::vector<std::uint8_t> raw((stride + 1) * options.height);
+    std::vector<std::uint8_t> zeros(stride, 0);
+    for (std::size_t row = 0; row < options.height; ++row) {
+        int filter = static_cast<int>(row % 5);
+        raw[row * (stride + 1)] = static_cast<std::uint8_t>(filter);
+        filterRow(filter,
+                  &pixels[row * stride],
+                  row > 0 ? &pixels[(row - 1) * stride] : zeros.data(),
+                  stride,
+                  pixel_size,
+                  &raw[row * (stride + 1) + 1]);
+    }
+
+    BitWriter writer;
+    writer.write(0x78, 8);
+    writer.write(0x01, 8);
+    std::vector<std::size_t> chunk_ends;
+    std::size_t chunk_size = raw.size() / options.chunk_count + 1;
+    std::size_t window_start = 0;
+    for (std::size_t begin = 0; begin < raw.size(); begin += chunk_size) {
+        std::size_t end = std::min(raw.size(), begin + chunk_size);
+        if (options.flush == Flush::FULL) {
+            window_start = begin;
+        }
+        deflateBlock(writer,
+                     raw,
+                     begin,
+                     end,
+                     window_start,
+                     options.deflate,
+                     stride + 1);
+        if (end < raw.size()) {
+            // An empty stored block, which byte aligns the stream.
+            writer.write(0, 3);
+            writer.alignToByte();
+            writer.write(0xffff0000u, 32);
+            chunk_ends.push_back(writer.bytes().size());
+        }
+    }
+    // A final empty stored block, then the Adler-32 of the raw data.
+    writer.write(1, 3);
+    writer.alignToByte();
+    writer.write(0xffff0000u, 32);
+    std::uint32_t checksum = adler32(raw);
+    for (int shift = 24; shift >= 0; shift -= 8) {
+        writer.write((checksum >> shift) & 0xff, 8);
+    }
+    chunk_ends.push_back(writer.bytes().size());
+
+    std::string png = "\x89PNG\r\n\x1a\n";
+    std::string header;
+    appendBigEndian(header, options.width);
+    appendBigEndian(header, options.height);
+    header += {static_cast<char>(options.bit_depth),
+               static_cast<char>(options.color_type),
+               0,
+               0,
+               0};
+    appendChunk(png, "IHDR", header);
+    if (options.color_type == 3) {
+        std::string palette;
+        for (int entry = 0; entry < 16 * 3; ++entry) {
+            palette.push_back(static_cast<char>(random()));
+        }
+        appendChunk(png, "PLTE", palette);
+    }
+    if (options.transparency) {
+        // Every other palette entry is fully transparent.
+        std::string transparency;
+        if (options.color_type == 3) {
+            for (int entry = 0; entry < 12; ++entry) {
+                transparency.push_back(
+                        static_cast<char>(entry % 2 ? 0 : random()));
+            }
+        } else {
+            // The first pixel's color, so some pixels are transparent.
+            std::size_t samples = channelCount(options.color_type);
+            for (std::size_t sample = 0; sample < samples; ++sample) {
+                if (options.bit_depth == 8) {
+                    transparency += {0, static_cast<char>(pixels[sample])};
+                } else {
+                    transparency += {static_cast<char>(pixels[sample * 2]),
+                                     static_cast<char>(pixels[sample * 2 + 1])};
+                }
+            }
+        }
+        appendChunk(png, "tRNS", transparency);
+    }
+    const std::vector<std::uint8_t>& stream = writer.bytes();
+    std::size_t begin = 0;
+    for (std::size_t end : chunk_ends) {
+        appendChunk(png,
+                    "IDAT",
+                    std::string(stream.begin() + begin, stream.begin() + end));
+        begin = end;
+    }
+    appendChunk(png, "IEND", "");
+    return png;
+}
+
+std::string readFile(const std::filesystem::path& path) {
+    std::ifstream file(path, std::ios::binary);
+    return std::string(std::istreambuf_iterator<char>(file), {});
+}
+
+std::string describe(const std::string& name,
+                     int requested_components,
+                     std::size_t thread_count,
+                     CpuFeatures::Isa isa) {
+    return name + ", " + std::to_string(requested_components) +
+           " components requested, " + std::to_string(thread_count) +
+           " threads, instruction set " +
+           std::to_string(static_cast<int>(isa));
+}
+
+class PngDecodeTest : public ::testing::Test {
+protected:
+    void TearDown() override { Tools::setPngIsa(CpuFeatures::bestIsa()); }
+
+    // The instruction sets the CPU supports.
+    static std::vector<CpuFeatures::Isa> isas() {
+        std::vector<CpuFeatures::Isa> supported;
+        for (CpuFeatures::Isa isa : {CpuFeatures::Isa::SCALAR,
+                                     CpuFeatures::Isa::SSSE3,
+                                     CpuFeatures::Isa::AVX2}) {
+            if (isa <= CpuFeatures::bestIsa()) {
+                supported.push_back(isa);
+            }
+        }
+        return supported;
+    }
+
+    // Decodes \p png with every requested component count, thread count
+    // and instruction set, and expects what stb_image produces.
+    static void expectMatchesStb(const std::string& png,
+                                 const std::string& name) {
+        const stbi_uc* bytes = reinterpret_cast<const stbi_uc*>(png.data());
+        for (int requested = 0; requested <= 4; ++requested) {
+            int stb_width = 0;
+            int stb_height = 0;
+            int stb_components = 0;
+            stbi_uc* expected =
+                    stbi_load_from_memory(bytes,
+                                          static_cast<int>(png.size()),
+                                          &stb_width,
+                                          &stb_height,
+                                          &stb_components,
+                                          requested);
+            ASSERT_NE(nullptr, expected) << name;
+            for (CpuFeatures::Isa isa : isas()) {
+                ASSERT_EQ(isa, Tools::setPngIsa(isa));
+                for (std::size_t thread_count : THREAD_COUNTS) {
+                    std::string context =
+                            describe(name, requested, thread_count, isa);
+                    int width = 0;
+                    int height = 0;
+                    int components = 0;
+                    int data_size = 0;
+                    std::vector<char> actual = Tools::decodePng(
+                            std::span<const char>(png.data(), png.size()),
+                            requested,
+                            &width,
+                            &height,
+                            &components,
+                            &data_size,
+                            thread_count);
+                    ASSERT_FALSE(actual.empty()) << context;
+                    EXPECT_EQ(stb_width, width) << context;
+                    EXPECT_EQ(stb_height, height) << context;
+                    EXPECT_EQ(stb_components, components) << context;
+                    ASSERT_EQ(static_cast<std::size_t>(data_size),
+                              actual.size())
+                            << context;
+                    std::size_t pixel_count =
+                            static_cast<std::size_t>(width) * height;
+                    ASSERT_EQ(0u, actual.size() % pixel_count) << context;
+                    if (requested != 0) {
+                        EXPECT_EQ(pixel_count * requested, actual.size())
+                                << context;
+                    }
+                    EXPECT_TRUE(std::equal(actual.begin(),
+                                           actual.end(),
+                                           reinterpret_cast<char*>(expected)))
+                            << context;
+                }
+            }
+            stbi_image_free(expected);
+        }
+    }
+
+    // Expects decodePng to reject \p png, or else to produce what
+    // stb_image does, without reading out of bounds either way.
+    static void expectRejectedOrMatchesStb(const std::string& png,
+                                           const std::string& name) {
+        for (std::size_t thread_count : THREAD_COUNTS) {
+            int width = 0;
+            int height = 0;
+            int components = 0;
+            int data_size = 0;
+            std::vector<char> actual = Tools::decodePng(
+                    std::span<const char>(png.data(), png.size()),
+                    4,
+                    &width,
+                    &height,
+                    &components,
+                    &data_size,
+                    thread_count);
+            if (actual.empty()) {
+                continue;
+            }
+            int stb_width = 0;
+            int stb_height = 0;
+            int stb_components = 0;
+            stbi_uc* expected = stbi_load_from_memory(
+                    reinterpret_cast<const stbi_uc*>(png.data()),
+                    static_cast<int>(png.size()),
+                    &stb_width,
+                    &stb_height,
+                    &stb_components,
+                    4);
+            ASSERT_NE(nullptr, expected) << name;
+            EXPECT_EQ(stb_width, width) << name;
+            EXPECT_EQ(stb_height, height) << name;
+            EXPECT_TRUE(std::equal(actual.begin(),
+                                   actual.end(),
+                                   reinterpret_cast<char*>(expected)))
+                    << name;
+            stbi_image_free(expected);
+        }
+    }
+
+    static bool decodes(const std::string& png) {
+        int width = 0;
+        int height = 0;
+        int components = 0;
+        int data_size = 0;
+        return !Tools::decodePng(std::span<const char>(png.data(), png.size()),
+                                 4,
+                                 &width,
+                                 &height,
+                                 &components,
+                                 &data_size,
+                                 1)
+                        .empty();
+    }
+};
+}  // namespace
+
+// Every color type at 8 and 16 bits, with and without tRNS, at widths that
+// leave each SIMD unfilter a different tail.
+TEST_F(PngDecodeTest, EveryColorTypeMatchesStb) {
+    struct Format {
+        std::uint8_t color_type;
+        std::uint8_t bit_depth;
+        bool transparency;
+    };
+    const Format formats[] = {
+            {0, 8, false}, {0, 8, true},   {0, 16, false}, {0, 16, true},
+            {2, 8, false}, {2, 8, true},   {2, 16, false}, {2, 16, true},
+            {3, 8, false}, {3, 8, true},   {4, 8, false},  {4, 16, false},
+            {6, 8, false}, {6, 16, false},
+    };
+    const std::uint32_t widths[] = {1, 5, 33, 67};
+    unsigned seed = 0;
+    for (const Format& format : formats) {
+        for (std::uint32_t width : widths) {
+            for (Deflate deflate : {Deflate::STORED, Deflate::FIXED}) {
+                PngOptions options;
+                options.width = width;
+                options.height = 11;
+                options.color_type = format.color_type;
+                options.bit_depth = format.bit_depth;
+                options.transparency = format.transparency;
+                options.deflate = deflate;
+                options.chunk_count = 3;
+                options.seed = ++seed;
+                expectMatchesStb(
+                        makePng(options),
+                        "color type " + std::to_string(format.color_type) +
+                                ", " + std::to_string(format.bit_depth) +
+                                " bit" +
+                                (format.transparency ? ", tRNS" : "") +
+                                ", width " + std::to_string(width) +
+                                (deflate == Deflate::STORED ? ", stored"
+                                                            : ", fixed"));
+            }
+        }
+    }
+}
+
+// Large enough that the threads each inflate a run of IDAT chunks. With a
+// sync flush matches cross the runs, so the decoder has to notice and
+// inflate the stream in one go.
+TEST_F(PngDecodeTest, IndependentChunksMatchStb) {
+    for (Flush flush : {Flush::FULL, Flush::SYNC}) {
+        for (Deflate deflate : {Deflate::STORED, Deflate::FIXED}) {
+            PngOptions options;
+            options.width = 301;
+            options.height = 257;
+            options.color_type = 6;
+            options.deflate = deflate;
+            options.flush = flush;
+            options.chunk_count = 8;
+            options.seed = 7;
+            expectMatchesStb(makePng(options),
+                             std::string(flush == Flush::FULL ? "full"
+                                                              : "sync") +
+                                     " flush, " +
+                                     (deflate == Deflate::STORED ? "stored"
+                                                                 : "fixed"));
+        }
+    }
+}
+
+TEST_F(PngDecodeTest, ResourcesMatchStb) {
+    std::size_t count = 0;
+    for (const std::filesystem::directory_entry& entry :
+         std::filesystem::recursive_directory_iterator(
+                 INTEL_VULKAN_RESOURCES_DIR)) {
+        if (entry.path().extension() == ".png") {
+            expectMatchesStb(readFile(entry.path()), entry.path().string());
+            ++count;
+        }
+    }
+    EXPECT_LT(0u, count);
+}
+
+// Every prefix of a file short of its IEND chunk lacks image data or the
+// IEND chunk, and is rejected.
+TEST_F(PngDecodeTest, RejectsTruncatedFiles) {
+    PngOptions options;
+    options.width = 13;
+    options.height = 9;
+    options.chunk_count = 3;
+    for (Deflate deflate : {Deflate::STORED, Deflate::FIXED}) {
+        options.deflate = deflate;
+        std::string png = makePng(options);
+        ASSERT_TRUE(decodes(png));
+        for (std::size_t size = 0; size + 12 < png.size(); ++size) {
+            EXPECT_FALSE(decodes(png.substr(0, size)))
+                    << "truncated to " << size;
+        }
+    }
+}
+
+// Flipping bits anywhere must not make the decoder read or write out of
+// bounds, and whatever it still decodes must agree with stb_image.
+TEST_F(PngDecodeTest, CorruptFilesAreRejectedOrMatchStb) {
+    PngOptions options;
+    options.width = 17;
+    options.height = 6;
+    options.color_type = 2;
+    options.chunk_count = 2;
+    for (Deflate deflate : {Deflate::STORED, Deflate::FIXED}) {
+        options.deflate = deflate;
+        std::string png = makePng(options);
+        for (std::size_t index = 8; index < png.size(); ++index) {
+            for (int bit : {0, 3, 7}) {
+                std::string corrupt = png;
+                corrupt[index] = static_cast<char>(corrupt[index] ^ (1 << bit));
+                expectRejectedOrMatchesStb(corrupt,
+                                           "byte " + std::to_string(index) +
+                                                   " bit " +
+                                                   std::to_string(bit));
+            }
+        }
+    }
+}
+
+TEST_F(PngDecodeTest, RejectsUnsupportedHeaders) {
+    PngOptions options;
+    options.width = 4;
+    options.height = 4;
+    std::string png = makePng(options);
+    // IHDR data starts at byte 16: width, height, bit depth, color type,
+    // compression, filter and interlace method.
+    auto with_header_byte = [&png](std::size_t offset, char value) {
+        std::string changed = png;
+        changed[16 + offset] = value;
+        return changed;
+    };
+    EXPECT_FALSE(decodes(png.substr(1)));
+    EXPECT_FALSE(decodes(with_header_byte(3, 0)));   // width 0
+    EXPECT_FALSE(decodes(with_header_byte(8, 4)));   // bit depth 4
+    EXPECT_FALSE(decodes(with_header_byte(8, 7)));   // bit depth 7
+    EXPECT_FALSE(decodes(with_header_byte(9, 5)));   // color type 5
+    EXPECT_FALSE(decodes(with_header_byte(10, 1)));  // compression method
+    EXPECT_FALSE(decodes(with_header_byte(11, 1)));  // filter method
+    EXPECT_FALSE(decodes(with_header_byte(12, 1)));  // interlaced
+}
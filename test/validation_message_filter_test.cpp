@@ -0,0 +1,193 @@
+////////////////////////////////////////////////////////////////////////////
+// Copyright (c) 2026 intel_vulkan
+// All rights reserved.
+//
+// Contact: mehoggan@gmail.com
+//
+// This software is licensed under the terms of the Your License.
+// See the LICENSE file in the top-level directory.
+/////////////////////////////////////////////////////////////////////////
+
+#include "intel_vulkan/ValidationMessageFilter.h"
+
+#include <gtest/gtest.h>
+
+#include <unistd.h>
+#include <algorithm>
+#include <chrono>
+#include <cstdint>
+#include <filesystem>
+#include <fstream>
+#include <memory>
+#include <regex>
+#include <string>
+#include <thread>
+#include <vector>
+
+namespace {
+using intel_vulkan::ValidationMessageFilter;
+
+// Long enough that no window ends while a test submits.
+constexpr std::chrono::milliseconds LONG_INTERVAL = std::chrono::seconds(60);
+
+const intel_vulkan::LogTag& testTag() {
+    static intel_vulkan::LogTag test_tag("ValidationMessageFilterTest");
+    return test_tag;
+}
+
+class ValidationMessageFilterTest : public ::testing::Test {
+protected:
+    void SetUp() override {
+        m_dir = std::filesystem::temp_directory_path() /
+                ("validation_message_filter_test_" +
+                 std::to_string(::getpid()));
+        std::filesystem::create_directories(m_dir);
+        m_log = (m_dir / "validation.log").string();
+        intel_vulkan::Logging::clearAll();
+        ASSERT_TRUE(intel_vulkan::Logging::addFileLogger(
+                testTag(), m_log, INTEL_VULKAN_TRACE));
+    }
+
+    void TearDown() override {
+        intel_vulkan::Logging::clearAll();
+        std::filesystem::remove_all(m_dir);
+    }
+
+    void submit(ValidationMessageFilter& filter,
+                std::int32_t message_id,
+                const char* message_id_name,
+                const char* message,
+                int times = 1) {
+        for (int index = 0; index < times; ++index) {
+            filter.submit(message_id, message_id_name, INTEL_VULKAN_WARN,
+                          message);
+        }
+    }
+
+    // The messages written so far, without the record prefix.
+    std::vector<std::string> messages() {
+        intel_vulkan::Logging::flush();
+        std::vector<std::string> lines;
+        std::ifstream file(m_log);
+        std::string line;
+        while (std::getline(file, line)) {
+            std::string::size_type start = line.find(" - '");
+            if (start != std::string::npos && line.back() == '\'') {
+                lines.push_back(
+                        line.substr(start + 4, line.size() - start - 5));
+            }
+        }
+        return lines;
+    }
+
+    std::size_t count(const std::string& message) {
+        std::vector<std::string> lines = messages();
+        return static_cast<std::size_t>(
+                std::count(lines.begin(), lines.end(), message));
+    }
+
+    // The repeats suppressed for message_id over every summary written.
+    std::uint64_t suppressed(std::int32_t message_id) {
+        std::regex summary("validation layer: suppressed ([0-9]+) repeats "
+                           "of .* \\(id " +
+                           std::to_string(message_id) + "\\), .*");
+        std::uint64_t total = 0;
+        for (const std::string& line : messages()) {
+            std::smatch match;
+            if (std::regex_match(line, match, summary)) {
+                total += std::stoull(match[1]);
+            }
+        }
+        return total;
+    }
+
+    std::filesystem::path m_dir;
+    std::string m_log;
+};
+
+TEST_F(ValidationMessageFilterTest, LogsTheFirstMessagesOfEachId) {
+    auto filter = std::make_unique<ValidationMessageFilter>(
+            testTag(), 3, LONG_INTERVAL);
+    submit(*filter, 7, "VUID-seven", "seven", 10);
+    submit(*filter, 8, "VUID-eight", "eight", 2);
+    filter.reset();
+
+    EXPECT_EQ(3u, count("validation layer: seven"));
+    EXPECT_EQ(2u, count("validation layer: eight"));
+    EXPECT_EQ(1u,
+              count("validation layer: suppressed 7 repeats of VUID-seven "
+                    "(id 7), 10 in total"));
+    // An id that stayed under its limit has no summary.
+    EXPECT_EQ(0u, suppressed(8));
+}
+
+TEST_F(ValidationMessageFilterTest, MessagesAreMatchedByIdOnly) {
+    auto filter = std::make_unique<ValidationMessageFilter>(
+            testTag(), 2, LONG_INTERVAL);
+    // The name and text of a repeat do not matter; the first name is kept.
+    submit(*filter, 5, "first-name", "one", 2);
+    submit(*filter, 5, "second-name", "two", 2);
+    submit(*filter, 5, nullptr, "three");
+    // Ids landing on the same slot, and ids differing only in sign, are
+    // still counted apart.
+    submit(*filter, 5 + 1024, "collides", "collides", 2);
+    submit(*filter, -5, "negative", "negative", 3);
+    filter.reset();
+
+    EXPECT_EQ(2u, count("validation layer: one"));
+    EXPECT_EQ(0u, count("validation layer: two"));
+    EXPECT_EQ(0u, count("validation layer: three"));
+    EXPECT_EQ(1u,
+              count("validation layer: suppressed 3 repeats of first-name "
+                    "(id 5), 5 in total"));
+    EXPECT_EQ(2u, count("validation layer: collides"));
+    EXPECT_EQ(0u, suppressed(5 + 1024));
+    EXPECT_EQ(2u, count("validation layer: negative"));
+    EXPECT_EQ(1u,
+              count("validation layer: suppressed 1 repeats of negative "
+                    "(id -5), 3 in total"));
+}
+
+TEST_F(ValidationMessageFilterTest, MissingNameAndMessage) {
+    auto filter = std::make_unique<ValidationMessageFilter>(
+            testTag(), 1, LONG_INTERVAL);
+    submit(*filter, 9, nullptr, nullptr, 2);
+    filter.reset();
+
+    EXPECT_EQ(1u, count("validation layer: "));
+    EXPECT_EQ(1u,
+              count("validation layer: suppressed 1 repeats of message "
+                    "(id 9), 2 in total"));
+}
+
+TEST_F(ValidationMessageFilterTest, LimitStartsOverEachInterval) {
+    constexpr std::chrono::milliseconds INTERVAL(100);
+    auto filter = std::make_unique<ValidationMessageFilter>(
+            testTag(), 2, INTERVAL);
+    submit(*filter, 3, "VUID-three", "three", 5);
+    std::this_thread::sleep_for(INTERVAL * 2);
+    submit(*filter, 3, "VUID-three", "three", 5);
+    filter.reset();
+
+    EXPECT_EQ(4u, count("validation layer: three"));
+    EXPECT_EQ(6u, suppressed(3));
+}
+
+TEST_F(ValidationMessageFilterTest, FullQueueCountsDroppedMessages) {
+    constexpr int SUBMITTED = 2000;
+    auto filter = std::make_unique<ValidationMessageFilter>(
+            testTag(), SUBMITTED, LONG_INTERVAL, 2);
+    submit(*filter, 4, "VUID-four", "four", SUBMITTED);
+    std::uint64_t dropped = filter->droppedCount();
+    filter.reset();
+
+    // Every message is either logged or counted as dropped, never both.
+    EXPECT_EQ(SUBMITTED - dropped, count("validation layer: four"));
+    if (dropped > 0) {
+        EXPECT_EQ(1u,
+                  count("validation layer: dropped " +
+                        std::to_string(dropped) +
+                        " messages, the queue was full"));
+    }
+}
+}  // namespace